@@ -0,0 +1,923 @@
+// Headless micro-benchmarks of the math & integration kernels.
+// Build with 'make bench', run bin/radar_bench [-reps N] [-time ms] [name filter...]
+// bin/radar_bench -validate checks the analytic integrators against Monte Carlo instead, and fails on mismatch.
+//
+// Each benchmark is calibrated to run for about -time ms, then run -reps times.
+// The reported numbers are the median repetition, with the min-max spread to judge their stability.
+
+#include "common/common.h"
+#include "common/SHEval.h"
+#include "common/SHRotation.h"
+#include "common/SHProduct.h"
+#include "common/sampling.h"
+#include "common/simd.h"
+#include "common/parallel.h"
+#include "geometry.h"
+#include "brdf.h"
+#include "shvolume.h"
+#include "zhlobes.h"
+#include "meshtools.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <thread>
+
+/// Result sink, to keep the compiler from removing the benchmarked code
+static volatile f32 sink;
+
+struct Benchmark
+{
+	std::string name;
+	u64 samplesPerOp;					//!< Work items (directions, samples...) processed by one op, for the samples/s column
+	std::function<void( u64 )> run;		//!< Runs the given number of ops
+};
+
+static std::vector<Benchmark> benchmarks;
+
+static void Add( const std::string &name, u64 samplesPerOp, const std::function<void( u64 )> &run )
+{
+	benchmarks.push_back( Benchmark{ name, samplesPerOp, run } );
+}
+
+static f64 TimeRun( const Benchmark &b, u64 ops )
+{
+	const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	b.run( ops );
+	return std::chrono::duration<f64>( std::chrono::steady_clock::now() - start ).count();
+}
+
+static void Measure( const Benchmark &b, u32 reps, f64 repTime )
+{
+	// Calibration : double the op count until a run lasts a tenth of the repetition time
+	u64 ops = 1;
+	f64 t = TimeRun( b, ops );
+	while ( t < repTime * 0.1 )
+	{
+		ops *= 2;
+		t = TimeRun( b, ops );
+	}
+	ops = std::max<u64>( 1, (u64) ( ops * repTime / t ) );
+
+	std::vector<f64> nsPerOp( reps );
+	for ( u32 r = 0; r < reps; ++r )
+		nsPerOp[r] = TimeRun( b, ops ) * 1e9 / ops;
+	std::sort( nsPerOp.begin(), nsPerOp.end() );
+
+	const f64 median = nsPerOp[reps / 2];
+	const f64 spread = 100.0 * ( nsPerOp.back() - nsPerOp.front() ) / median;
+	const f64 samplesPerSec = b.samplesPerOp * 1e9 / median;
+
+	printf( "%-44s %14.1f %14.3e %8.1f%%\n", b.name.c_str(), median, samplesPerSec, spread );
+	fflush( stdout );
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////
+//				BENCHMARKS
+//////////////////////////////////////////////////////////////////////////////////////////
+
+static const u32 DirCount = 1024;
+
+/// Coefficient row stride of the SHEvalBatch output. A 4 KiB stride (DirCount) makes every row alias in L1,
+/// so it is padded by two SIMD packets, as callers should do.
+static const u32 SHBatchStride = DirCount + simdf::Width * 2;
+
+/// Fixed pseudo-random unit directions, as SoA
+struct DirectionSet
+{
+	std::vector<vec3f> dirs;
+	std::vector<f32> x, y, z, w;
+
+	DirectionSet( u32 count )
+	{
+		Random::Philox rng( 1, 0 );
+		for ( u32 i = 0; i < count; ++i )
+		{
+			const f32 cosTheta = 2.f * rng.Next() - 1.f;
+			const f32 sinTheta = std::sqrt( std::max( 0.f, 1.f - cosTheta * cosTheta ) );
+			const f32 phi = 2.f * M_PI * rng.Next();
+
+			dirs.push_back( vec3f( sinTheta * std::cos( phi ), cosTheta, sinTheta * std::sin( phi ) ) );
+			x.push_back( dirs.back().x );
+			y.push_back( dirs.back().y );
+			z.push_back( dirs.back().z );
+			w.push_back( rng.Next() );
+		}
+	}
+};
+
+static void AddSHBenchmarks()
+{
+	static DirectionSet set( DirCount );
+	static std::vector<f32> sh( 21 * 21 * SHBatchStride );
+
+	for ( u32 n = 3; n <= 21; ++n )
+	{
+		char name[64];
+
+		snprintf( name, sizeof( name ), "SHEval/%u", n );
+		Add( name, 1, [n]( u64 ops )
+		{
+			for ( u64 i = 0; i < ops; ++i )
+			{
+				const u32 d = i % DirCount;
+				SHEval( n, set.x[d], set.y[d], set.z[d], &sh[0] );
+			}
+			sink = sh[n];
+		} );
+
+		snprintf( name, sizeof( name ), "SHEvalBatch/%u/stride%u", n, SHBatchStride );
+		Add( name, DirCount, [n]( u64 ops )
+		{
+			for ( u64 i = 0; i < ops; ++i )
+				SHEvalBatch( n, DirCount, &set.x[0], &set.y[0], &set.z[0], &sh[0], SHBatchStride );
+			sink = sh[n];
+		} );
+
+		snprintf( name, sizeof( name ), "SHEvalAccumulateBatch/%u", n );
+		Add( name, DirCount, [n]( u64 ops )
+		{
+			for ( u64 i = 0; i < ops; ++i )
+				SHEvalAccumulateBatch( n, DirCount, &set.x[0], &set.y[0], &set.z[0], &set.w[0], &sh[0] );
+			sink = sh[n];
+		} );
+	}
+
+	static mat3f R;
+	{
+		mat4f rotation;
+		rotation.Identity();
+		rotation = rotation.RotateX( 0.7f ).RotateY( -1.3f ).RotateZ( 2.1f );
+		for ( int col = 0; col < 3; ++col )
+			R[col] = vec3f( rotation[col].x, rotation[col].y, rotation[col].z );
+	}
+
+	const u32 rotationBands[] = { 3, 5, 11 };
+	for ( u32 n : rotationBands )
+	{
+		char name[64];
+
+		snprintf( name, sizeof( name ), "SHRotation::Init/%u", n );
+		Add( name, 1, [n]( u64 ops )
+		{
+			SHRotation rot;
+			for ( u64 i = 0; i < ops; ++i )
+				rot.Init( R, n );
+			sink = rot.blocks.back();
+		} );
+
+		snprintf( name, sizeof( name ), "SHRotation::Apply/%u", n );
+		Add( name, 1, [n]( u64 ops )
+		{
+			SHRotation rot;
+			rot.Init( R, n );
+			for ( u64 i = 0; i < ops; ++i )
+			{
+				f32 *v = &sh[( i % DirCount ) * n * n];
+				rot.Apply( v, v );
+			}
+			sink = sh[n];
+		} );
+
+		snprintf( name, sizeof( name ), "SHRotation::ApplyBatch/%u", n );
+		Add( name, DirCount, [n]( u64 ops )
+		{
+			SHRotation rot;
+			rot.Init( R, n );
+			for ( u64 i = 0; i < ops; ++i )
+				rot.ApplyBatch( DirCount, &sh[0], &sh[0] );
+			sink = sh[n];
+		} );
+	}
+
+	static std::vector<f32> product( 21 * 21 * DirCount );
+
+	const u32 productBands[] = { 3, 5, 11 };
+	for ( u32 n : productBands )
+	{
+		char name[64];
+
+		snprintf( name, sizeof( name ), "SHProductTable::Init/%u", n );
+		Add( name, 1, [n]( u64 ops )
+		{
+			SHProductTable table;
+			for ( u64 i = 0; i < ops; ++i )
+				table.Init( n );
+			sink = table.values.back();
+		} );
+
+		snprintf( name, sizeof( name ), "SHProductTable::Multiply/%u", n );
+		Add( name, 1, [n]( u64 ops )
+		{
+			const SHProductTable &table = SHProductTable::Get( n );
+			for ( u64 i = 0; i < ops; ++i )
+			{
+				const u32 v = ( i % ( DirCount - 1 ) ) * n * n;
+				table.Multiply( &sh[v], &sh[v + n * n], &product[v] );
+			}
+			sink = product[n];
+		} );
+
+		snprintf( name, sizeof( name ), "SHProductTable::MultiplyBatch/%u", n );
+		Add( name, DirCount / 2, [n]( u64 ops )
+		{
+			const SHProductTable &table = SHProductTable::Get( n );
+			for ( u64 i = 0; i < ops; ++i )
+				table.MultiplyBatch( DirCount / 2, &sh[0], &sh[DirCount / 2 * n * n], &product[0] );
+			sink = product[n];
+		} );
+	}
+}
+
+static Rectangle BenchRectangle()
+{
+	std::vector<vec3f> pts = { vec3f( -1, 2, 1 ), vec3f( 1, 2, 1 ), vec3f( 1, 2, -1 ), vec3f( -1, 2, -1 ) };
+	return Rectangle( pts );
+}
+
+static void AddIntegratorBenchmarks()
+{
+	static const Rectangle rect = BenchRectangle();
+	static const vec3f pos( 0.3f, 0.f, 0.1f );
+	static const vec3f nrm( 0.f, 1.f, 0.f );
+	static const int nBand = 5;
+	static const u32 sampleCount = 4096;
+	static std::vector<f32> shvals( nBand * nBand );
+
+	Add( "Rectangle::SolidAngle", 1, []( u64 ops )
+	{
+		f32 s = 0.f;
+		for ( u64 i = 0; i < ops; ++i )
+			s += rect.SolidAngle( pos + vec3f( 1e-6f * ( i & 7 ) ) );
+		sink = s;
+	} );
+
+	Add( "Rectangle::IntegrateStructuredSampling", 1, []( u64 ops )
+	{
+		f32 s = 0.f;
+		for ( u64 i = 0; i < ops; ++i )
+			s += rect.IntegrateStructuredSampling( pos + vec3f( 1e-6f * ( i & 7 ) ), nrm );
+		sink = s;
+	} );
+
+	Add( "Rectangle::IntegrateMRP", 1, []( u64 ops )
+	{
+		f32 s = 0.f;
+		for ( u64 i = 0; i < ops; ++i )
+			s += rect.IntegrateMRP( pos + vec3f( 1e-6f * ( i & 7 ) ), nrm );
+		sink = s;
+	} );
+
+	Add( "Rectangle::IntegrateRandom/5", sampleCount, []( u64 ops )
+	{
+		for ( u64 i = 0; i < ops; ++i )
+			sink = rect.IntegrateRandom( pos, nrm, sampleCount, shvals, nBand );
+	} );
+
+	Add( "Rectangle::IntegrateRandom/5/Sobol", sampleCount, []( u64 ops )
+	{
+		for ( u64 i = 0; i < ops; ++i )
+			sink = rect.IntegrateRandom( pos, nrm, sampleCount, shvals, nBand, i, Random::SEQ_SOBOL );
+	} );
+
+	Add( "Rectangle::IntegrateAngularStratification/5", sampleCount, []( u64 ops )
+	{
+		for ( u64 i = 0; i < ops; ++i )
+			sink = rect.IntegrateAngularStratification( pos, nrm, sampleCount, shvals, nBand );
+	} );
+
+	Add( "Rectangle::IntegrateRandomParallel/5", 16 * sampleCount, []( u64 ops )
+	{
+		for ( u64 i = 0; i < ops; ++i )
+			sink = rect.IntegrateRandomParallel( pos, nrm, 16 * sampleCount, shvals, nBand, i );
+	} );
+
+	Add( "Rectangle::IntegrateAnalytic/5", 1, []( u64 ops )
+	{
+		rect.IntegrateAnalytic( pos, nrm, shvals, nBand );	// lobe set built outside the timing
+		for ( u64 i = 0; i < ops; ++i )
+			sink = rect.IntegrateAnalytic( pos + vec3f( 1e-6f * ( i & 7 ) ), nrm, shvals, nBand );
+	} );
+
+	Add( "SphericalRectangle::Init", 1, []( u64 ops )
+	{
+		SphericalRectangle srect;
+		f32 s = 0.f;
+		for ( u64 i = 0; i < ops; ++i )
+		{
+			srect.Init( rect, pos + vec3f( 1e-6f * ( i & 7 ) ) );
+			s += srect.S;
+		}
+		sink = s;
+	} );
+
+	Add( "SphericalRectangle::Integrate/5", sampleCount, []( u64 ops )
+	{
+		SphericalRectangle srect;
+		srect.Init( rect, pos );
+		for ( u64 i = 0; i < ops; ++i )
+			sink = srect.Integrate( nrm, sampleCount, shvals, nBand );
+	} );
+
+	Add( "SphericalRectangle::IntegrateParallel/5", 16 * sampleCount, []( u64 ops )
+	{
+		SphericalRectangle srect;
+		srect.Init( rect, pos );
+		for ( u64 i = 0; i < ops; ++i )
+			sink = srect.IntegrateParallel( nrm, 16 * sampleCount, shvals, nBand, i );
+	} );
+
+	Add( "SphericalRectangle::IntegrateParallel/5/Sobol", 16 * sampleCount, []( u64 ops )
+	{
+		SphericalRectangle srect;
+		srect.Init( rect, pos );
+		for ( u64 i = 0; i < ops; ++i )
+			sink = srect.IntegrateParallel( nrm, 16 * sampleCount, shvals, nBand, i, Random::SEQ_SOBOL );
+	} );
+
+	Add( "SphericalRectangle::IntegrateAdaptive/5/1%", 1, []( u64 ops )
+	{
+		SphericalRectangle srect;
+		srect.Init( rect, pos );
+		for ( u64 i = 0; i < ops; ++i )
+		{
+			AdaptiveSampling adaptive;
+			adaptive.seed = i;
+			sink = srect.IntegrateAdaptive( nrm, adaptive, shvals, nBand );
+		}
+	} );
+
+	Add( "PlanarRectangle::IntegrateRandom/5", sampleCount, []( u64 ops )
+	{
+		PlanarRectangle prect;
+		prect.InitUnit( rect, pos );
+		for ( u64 i = 0; i < ops; ++i )
+			sink = prect.IntegrateRandom( sampleCount, shvals, nBand );
+	} );
+
+	Add( "PlanarRectangle::IntegrateRandomParallel/5", 16 * sampleCount, []( u64 ops )
+	{
+		PlanarRectangle prect;
+		prect.InitUnit( rect, pos );
+		for ( u64 i = 0; i < ops; ++i )
+			sink = prect.IntegrateRandomParallel( 16 * sampleCount, shvals, nBand, i );
+	} );
+
+	static SHVolume::Desc volumeDesc;
+	volumeDesc.boundsMin = vec3f( -2.f, -1.f, -2.f );
+	volumeDesc.boundsMax = vec3f( 2.f, 1.5f, 2.f );
+	volumeDesc.resolution = vec3i( 8 );
+	volumeDesc.sampleCount = 256;
+
+	Add( "SHVolume::Bake/5/8x8x8/256", 8 * 8 * 8 * 256, []( u64 ops )
+	{
+		SHVolume::Desc desc = volumeDesc;
+		SHVolume::Volume volume;
+		for ( u64 i = 0; i < ops; ++i )
+		{
+			desc.seed = i;
+			SHVolume::Bake( rect, desc, volume );
+		}
+		sink = volume.data[0];
+	} );
+
+	// baked once here, so that its cost does not end up in the Lookup calibration
+	static SHVolume::Volume volume;
+	SHVolume::Bake( rect, volumeDesc, volume );
+
+	Add( "SHVolume::Lookup/5", 1, []( u64 ops )
+	{
+		for ( u64 i = 0; i < ops; ++i )
+			volume.Lookup( pos + vec3f( 1e-3f * ( i & 255 ) ), &shvals[0] );
+		sink = shvals[0];
+	} );
+}
+
+static void AddPolygonBenchmarks()
+{
+	static const vec3f pts[4] = { Normalize( vec3f( -0.3f, -0.2f, 1 ) ), Normalize( vec3f( 0.4f, -0.3f, 1 ) ),
+								  Normalize( vec3f( 0.5f, 0.4f, 1 ) ), Normalize( vec3f( -0.2f, 0.5f, 1 ) ) };
+	static const int order = 9;
+	static const u32 dirCount = 2 * order + 1;
+	static DirectionSet set( dirCount );
+	static std::vector<f32> moments( dirCount * ( order + 1 ) );
+	static MomentWorkspace ws;
+
+	Add( "Polygon::SolidAngle", 1, []( u64 ops )
+	{
+		const Polygon P( std::vector<vec3f>( pts, pts + 4 ) );
+		f32 s = 0.f;
+		for ( u64 i = 0; i < ops; ++i )
+			s += P.SolidAngle();
+		sink = s;
+	} );
+
+	Add( "Polygon::AxialMoments/9", dirCount, []( u64 ops )
+	{
+		const Polygon P( std::vector<vec3f>( pts, pts + 4 ) );
+		for ( u64 i = 0; i < ops; ++i )
+			sink = P.AxialMoments( set.dirs )[3];
+	} );
+
+	Add( "FixedPolygon::AxialMoment/9", 1, []( u64 ops )
+	{
+		const FixedPolygon P( pts, 4 );
+		for ( u64 i = 0; i < ops; ++i )
+			P.AxialMoment( set.dirs[i % dirCount], order, &moments[0], ws );
+		sink = moments[3];
+	} );
+
+	Add( "FixedPolygon::AxialMomentsBatch/9", dirCount, []( u64 ops )
+	{
+		const FixedPolygon P( pts, 4 );
+		for ( u64 i = 0; i < ops; ++i )
+			P.AxialMomentsBatch( &set.x[0], &set.y[0], &set.z[0], dirCount, order, &moments[0], ws );
+		sink = moments[3];
+	} );
+
+	const u32 lobeBands[] = { 3, 5, 11 };
+	for ( u32 n : lobeBands )
+	{
+		char name[64];
+
+		snprintf( name, sizeof( name ), "ZHLobes::Init/%u", n );
+		Add( name, 1, [n]( u64 ops )
+		{
+			ZHLobes zh;
+			for ( u64 i = 0; i < ops; ++i )
+				zh.Init( n );
+			sink = zh.projection.back();
+		} );
+
+		static ZHLobes lobes[22];
+		lobes[n].Init( n );
+
+		snprintf( name, sizeof( name ), "ZHLobes::ProjectPolygon/%u", n );
+		Add( name, 1, [n]( u64 ops )
+		{
+			std::vector<f32> sh( n * n );
+			const FixedPolygon P( pts, 4 );
+			for ( u64 i = 0; i < ops; ++i )
+				lobes[n].ProjectPolygon( P, &sh[0], ws );
+			sink = sh[n];
+		} );
+	}
+}
+
+static void AddBRDFBenchmarks()
+{
+	static const vec3f points[4] = { vec3f( -1, 2, 1 ), vec3f( 1, 2, 1 ), vec3f( 1, 2, -1 ), vec3f( -1, 2, -1 ) };
+	static const mat3f Minv( vec3f( 1.2f, 0.f, 0.1f ), vec3f( 0.f, 1.5f, 0.f ), vec3f( -0.2f, 0.f, 0.9f ) );
+	static DirectionSet set( DirCount );
+
+	Add( "BRDF::LTC_Evaluate", 1, []( u64 ops )
+	{
+		const vec3f N( 0.f, 1.f, 0.f );
+		f32 s = 0.f;
+		for ( u64 i = 0; i < ops; ++i )
+		{
+			const vec3f &d = set.dirs[i % DirCount];
+			const vec3f V = Normalize( vec3f( d.x, std::fabs( d.y ) + 0.1f, d.z ) );
+			s += Render::BRDF::LTC_Evaluate( N, V, vec3f( 0.f ), Minv, points, false );
+		}
+		sink = s;
+	} );
+
+	// synthetic 32x32 LTC table and SoA shading points with a normal looking up
+	static const int LUTSize = 32;
+	static std::vector<f32> ltc( LUTSize * LUTSize * 4 );
+	static std::vector<f32> nX( DirCount, 0.f ), nY( DirCount, 1.f ), nZ( DirCount, 0.f );
+	static std::vector<f32> vX( DirCount ), vY( DirCount ), vZ( DirCount );
+	static std::vector<f32> pX( DirCount, 0.f ), pY( DirCount, 0.f ), pZ( DirCount, 0.f );
+	static std::vector<f32> rough( DirCount ), res( DirCount );
+
+	for ( int i = 0; i < LUTSize * LUTSize; ++i )
+	{
+		ltc[i * 4 + 0] = 0.9f;
+		ltc[i * 4 + 1] = 0.1f;
+		ltc[i * 4 + 2] = 1.5f;
+		ltc[i * 4 + 3] = -0.2f;
+	}
+	for ( u32 i = 0; i < DirCount; ++i )
+	{
+		const vec3f &d = set.dirs[i];
+		const vec3f V = Normalize( vec3f( d.x, std::fabs( d.y ) + 0.1f, d.z ) );
+		vX[i] = V.x; vY[i] = V.y; vZ[i] = V.z;
+		pX[i] = 0.01f * d.x; pZ[i] = 0.01f * d.z;
+		rough[i] = set.w[i];
+	}
+
+	Add( "BRDF::LTC_EvaluateBatch", DirCount, []( u64 ops )
+	{
+		const Render::BRDF::LTC_Points pts = { &nX[0], &nY[0], &nZ[0], &vX[0], &vY[0], &vZ[0], &pX[0], &pY[0], &pZ[0], &rough[0] };
+		for ( u64 i = 0; i < ops; ++i )
+			Render::BRDF::LTC_EvaluateBatch( pts, DirCount, &ltc[0], LUTSize, points, true, &res[0] );
+		sink = res[1];
+	} );
+}
+
+static void AddSamplingBenchmarks()
+{
+	static std::vector<vec3f> dirs;
+	static std::vector<vec2f> samples( DirCount );
+	static std::vector<f32> floats( DirCount );
+
+	Add( "Sampling::SampleSphereRandom", DirCount, []( u64 ops )
+	{
+		for ( u64 i = 0; i < ops; ++i )
+		{
+			dirs.clear();
+			Sampling::SampleSphereRandom( dirs, DirCount );
+		}
+		sink = dirs[0].x;
+	} );
+
+	Add( "Sampling::SampleHemisphereRandom", DirCount, []( u64 ops )
+	{
+		for ( u64 i = 0; i < ops; ++i )
+		{
+			dirs.clear();
+			Sampling::SampleHemisphereRandom( dirs, DirCount );
+		}
+		sink = dirs[0].x;
+	} );
+
+	static std::vector<f32> sx( DirCount ), sy( DirCount ), sz( DirCount );
+
+	Add( "Sampling::SampleSphereFibonacci", DirCount, []( u64 ops )
+	{
+		for ( u64 i = 0; i < ops; ++i )
+			Sampling::SampleSphereFibonacci( &sx[0], &sy[0], &sz[0], DirCount );
+		sink = sx[1];
+	} );
+
+	Add( "Sampling::SampleSphereStratified", DirCount, []( u64 ops )
+	{
+		for ( u64 i = 0; i < ops; ++i )
+			Sampling::SampleSphereStratified( &sx[0], &sy[0], &sz[0], DirCount, i );
+		sink = sx[1];
+	} );
+
+	Add( "Sampling::SampleHemisphereCosine", DirCount, []( u64 ops )
+	{
+		for ( u64 i = 0; i < ops; ++i )
+			Sampling::SampleHemisphereCosine( &sx[0], &sy[0], &sz[0], DirCount, i );
+		sink = sx[1];
+	} );
+
+	Add( "Sampling::SampleSphereBluenoise/256", 256, []( u64 ops )
+	{
+		for ( u64 i = 0; i < ops; ++i )
+		{
+			dirs.clear();
+			Sampling::SampleSphereBluenoise( dirs, 256 );
+		}
+		sink = dirs[0].x;
+	} );
+
+	Add( "Sampling::SampleSphereBluenoiseGrid/4096", 4096, []( u64 ops )
+	{
+		for ( u64 i = 0; i < ops; ++i )
+		{
+			dirs.clear();
+			Sampling::SampleSphereBluenoiseGrid( dirs, 4096, i );
+		}
+		sink = dirs[0].x;
+	} );
+
+	Add( "Random::Float", 1, []( u64 ops )
+	{
+		f32 s = 0.f;
+		for ( u64 i = 0; i < ops; ++i )
+			s += Random::Float();
+		sink = s;
+	} );
+
+	Add( "Random::Philox::Fill", DirCount, []( u64 ops )
+	{
+		Random::Philox rng( 1, 0 );
+		for ( u64 i = 0; i < ops; ++i )
+			rng.Fill( &floats[0], DirCount );
+		sink = floats[0];
+	} );
+
+	Add( "Random::Philox::Next8", 8, []( u64 ops )
+	{
+		Random::Philox rng( 1, 0 );
+		for ( u64 i = 0; i < ops; ++i )
+			rng.Next8( &floats[( i * 8 ) % DirCount] );
+		sink = floats[0];
+	} );
+
+	const char *seqNames[] = { "PCG", "Philox", "Sobol", "Halton", "R2" };
+	for ( int seq = Random::SEQ_PCG; seq <= Random::SEQ_R2; ++seq )
+	{
+		Add( std::string( "Random::Generate2D/" ) + seqNames[seq], DirCount, [seq]( u64 ops )
+		{
+			for ( u64 i = 0; i < ops; ++i )
+				Random::Generate2D( (Random::Sequence) seq, 1, i * DirCount, DirCount, &samples[0] );
+			sink = samples[0].x;
+		} );
+	}
+}
+
+static void AddMatrixBenchmarks()
+{
+	static mat4f A = mat4f::LookAt( vec3f( 1.f, 2.f, 3.f ), vec3f( 0.f ), vec3f( 0.f, 1.f, 0.f ) );
+	static mat4f B = mat4f::Perspective( 75.f, 1.6f, 0.1f, 100.f );
+
+	Add( "mat4f::operator*(mat4f)", 1, []( u64 ops )
+	{
+		mat4f M = A;
+		for ( u64 i = 0; i < ops; ++i )
+			M = M * B;
+		sink = M[0][0];
+	} );
+
+	Add( "mat4f::operator*(vec4f)", 1, []( u64 ops )
+	{
+		vec4f v( 1.f, 2.f, 3.f, 1.f );
+		for ( u64 i = 0; i < ops; ++i )
+			v = A * v;
+		sink = v.x;
+	} );
+
+	Add( "mat4f::Inverse", 1, []( u64 ops )
+	{
+		mat4f M = A * B;
+		for ( u64 i = 0; i < ops; ++i )
+			M = M.Inverse();
+		sink = M[0][0];
+	} );
+
+	Add( "mat4f::Transpose", 1, []( u64 ops )
+	{
+		mat4f M = A;
+		for ( u64 i = 0; i < ops; ++i )
+			M = M.Transpose();
+		sink = M[0][1];
+	} );
+}
+
+/// Unwelded triangle soup of a res x res grid, UVs mirrored on one half
+static void BenchGridMesh( u32 res, MeshTools::VertexStreams &vs, std::vector<u32> &indices )
+{
+	const u32 quadCorners[6] = { 0, 1, 2, 0, 2, 3 };
+
+	vs.Resize( res * res * 6 );
+	indices.resize( res * res * 6 );
+
+	u32 v = 0;
+	for ( u32 j = 0; j < res; ++j )
+		for ( u32 i = 0; i < res; ++i )
+			for ( u32 k : quadCorners )
+			{
+				const f32 x = (f32) i + ( k >= 2 ) - 0.5f * res, z = (f32) j + ( k == 1 || k == 2 );
+				vs.px[v] = x; vs.py[v] = 0.05f * std::sin( x + z ); vs.pz[v] = z;
+				vs.nx[v] = 0.f; vs.ny[v] = 1.f; vs.nz[v] = 0.f;
+				vs.u[v] = std::fabs( x ); vs.v[v] = z;
+				indices[v] = v;
+				++v;
+			}
+}
+
+static void AddMeshBenchmarks()
+{
+	static const u32 res = 256;
+	static MeshTools::VertexStreams soup, welded;
+	static std::vector<u32> soupIndices, weldedIndices;
+
+	BenchGridMesh( res, soup, soupIndices );
+	welded = soup;
+	weldedIndices = soupIndices;
+	MeshTools::WeldVertices( welded, weldedIndices );
+
+	Add( "MeshTools::WeldVertices/256", res * res * 6, []( u64 ops )
+	{
+		for ( u64 i = 0; i < ops; ++i )
+		{
+			MeshTools::VertexStreams vs = soup;
+			std::vector<u32> indices = soupIndices;
+			sink = (f32) MeshTools::WeldVertices( vs, indices );
+		}
+	} );
+
+	static std::vector<vec3f> positions( welded.Count() );
+	welded.ToArrays( &positions[0], nullptr, nullptr, nullptr, nullptr );
+
+	Add( "MeshTools::ComputeBounds/256", (u64) positions.size(), []( u64 ops )
+	{
+		MeshTools::Bounds bounds;
+		for ( u64 i = 0; i < ops; ++i )
+			MeshTools::ComputeBounds( (const f32*) &positions[0], (u32) positions.size(), bounds );
+		sink = bounds.radius;
+	} );
+
+	Add( "MeshTools::OptimizeVertexCache/256", res * res * 2, []( u64 ops )
+	{
+		for ( u64 i = 0; i < ops; ++i )
+		{
+			std::vector<u32> indices = weldedIndices;
+			MeshTools::OptimizeVertexCache( indices, welded.Count() );
+			sink = (f32) indices[0];
+		}
+	} );
+
+	Add( "MeshTools::ComputeACMR/256", res * res * 2, []( u64 ops )
+	{
+		for ( u64 i = 0; i < ops; ++i )
+			sink = MeshTools::ComputeACMR( weldedIndices, welded.Count() );
+	} );
+
+	Add( "MeshTools::GenerateTangents/256", res * res * 2, []( u64 ops )
+	{
+		MeshTools::TangentOptions opts;
+		opts.weld = false;
+		opts.splitMirrored = false;
+
+		MeshTools::VertexStreams vs = welded;
+		std::vector<u32> indices = weldedIndices;
+		for ( u64 i = 0; i < ops; ++i )
+			MeshTools::GenerateTangents( vs, indices, opts );
+		sink = vs.tx[0];
+	} );
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////
+//				VALIDATION
+//////////////////////////////////////////////////////////////////////////////////////////
+
+/// Rectangle::ValidateAnalytic on distant, close and large lights (the latter covering more than pi sr) and from
+/// behind a light, and the winding independence of ZHLobes::ProjectConvexPolygon. Returns the number of failed cases.
+static int Validate()
+{
+	struct Case
+	{
+		const char *name;
+		f32 halfSize, height;
+		vec3f pos;
+	};
+
+	const Case cases[] = {
+		{ "2x2 quad, distance 2", 1.f, 2.f, vec3f( 0.3f, 0.f, 0.1f ) },
+		{ "2x2 quad, distance 0.5", 1.f, 0.5f, vec3f( 0.f ) },
+		{ "2x2 quad, distance 0.2", 1.f, 0.2f, vec3f( 0.f ) },
+		{ "2x2 quad, distance 0.1", 1.f, 0.1f, vec3f( 0.f ) },
+		{ "2x2 quad, distance 0.1, off-center", 1.f, 0.1f, vec3f( 0.7f, 0.f, -0.4f ) },
+		{ "20x20 quad, distance 0.1", 10.f, 0.1f, vec3f( 0.f ) },
+		{ "2x2 quad, behind", 1.f, 0.5f, vec3f( 0.f, 1.f, 0.f ) },
+	};
+
+	const vec3f nrm( 0.f, 1.f, 0.f );
+	const u32 sampleCount = 1 << 18;
+	const int nBand = 5;
+	const f32 maxError = 1e-3f;
+	MomentWorkspace ws;
+	int failed = 0;
+
+	printf( "%-44s %14s %14s %14s\n", "case", "solid angle", "error", "winding error" );
+
+	for ( const Case &c : cases )
+	{
+		const f32 s = c.halfSize, h = c.height;
+		const std::vector<vec3f> pts = { vec3f( -s, h, s ), vec3f( s, h, s ), vec3f( s, h, -s ), vec3f( -s, h, -s ) };
+		const std::vector<vec3f> reversed( pts.rbegin(), pts.rend() );
+		const Rectangle rect( pts );
+
+		std::vector<vec3f> unit;
+		for ( const vec3f &p : pts )
+			unit.push_back( Normalize( p - c.pos ) );
+
+		// the polygon solid angle is signed by the winding
+		const f32 solidAngle = std::fabs( Polygon( unit ).SolidAngle() );
+		const f32 error = rect.ValidateAnalytic( c.pos, nrm, sampleCount, nBand );
+
+		std::vector<f32> sh( nBand * nBand ), shReversed( nBand * nBand );
+		ZHLobes::Get( nBand ).ProjectConvexPolygon( &pts[0], 4, c.pos, &sh[0], ws );
+		ZHLobes::Get( nBand ).ProjectConvexPolygon( &reversed[0], 4, c.pos, &shReversed[0], ws );
+
+		f32 windingError = 0.f;
+		for ( int i = 0; i < nBand * nBand; ++i )
+			windingError = std::max( windingError, std::fabs( sh[i] - shReversed[i] ) );
+
+		const bool ok = std::fabs( solidAngle - rect.SolidAngle( c.pos ) ) < 1e-3f && error < maxError && windingError < 1e-4f;
+		failed += !ok;
+
+		printf( "%-44s %14.4f %14.3e %14.3e %s\n", c.name, solidAngle, error, windingError, ok ? "" : "FAILED" );
+	}
+
+	return failed;
+}
+
+/// The parallel integrators at 1, 2 and N threads : their results must match bit for bit.
+/// Returns the number of failed cases.
+static int ValidateThreadCounts()
+{
+	const std::vector<vec3f> pts = { vec3f( -1.f, 0.5f, 1.f ), vec3f( 1.f, 0.5f, 1.f ), vec3f( 1.f, 0.5f, -1.f ), vec3f( -1.f, 0.5f, -1.f ) };
+	const Rectangle rect( pts );
+	const vec3f pos( 0.2f, 0.f, -0.1f ), nrm( 0.f, 1.f, 0.f );
+	SphericalRectangle srect;
+	srect.Init( rect, pos );
+
+	// not a multiple of the integration chunk size (8192, see geometry.cpp), so that the last chunk is a partial one
+	const u32 sampleCount = 3 * 8192 + 1000;
+	const int nBand = 5;
+	const u32 threadCounts[] = { 1, 2, std::max( 4u, std::thread::hardware_concurrency() ) };
+
+	struct Integrator
+	{
+		const char *name;
+		std::function<f32( std::vector<f32>& )> func;
+	};
+
+	const Integrator integrators[] = {
+		{ "Rectangle::IntegrateRandomParallel, PCG", [&]( std::vector<f32> &sh ) { return rect.IntegrateRandomParallel( pos, nrm, sampleCount, sh, nBand, 1, Random::SEQ_PCG ); } },
+		{ "Rectangle::IntegrateRandomParallel, Sobol", [&]( std::vector<f32> &sh ) { return rect.IntegrateRandomParallel( pos, nrm, sampleCount, sh, nBand, 1, Random::SEQ_SOBOL ); } },
+		{ "SphericalRectangle::IntegrateParallel", [&]( std::vector<f32> &sh ) { return srect.IntegrateParallel( nrm, sampleCount, sh, nBand, 1, Random::SEQ_PCG ); } },
+	};
+
+	int failed = 0;
+
+	printf( "\n%-44s %14s\n", "case", "threads" );
+
+	for ( const Integrator &it : integrators )
+	{
+		std::vector<f32> reference;
+		f32 referenceNorm = 0.f;
+		bool ok = true;
+
+		for ( u32 threads : threadCounts )
+		{
+			Parallel::SetThreadCount( threads );
+
+			std::vector<f32> sh( nBand * nBand, 0.f );
+			const f32 norm = it.func( sh );
+
+			if ( reference.empty() )
+			{
+				reference = sh;
+				referenceNorm = norm;
+			}
+			else
+				ok &= norm == referenceNorm && !memcmp( &sh[0], &reference[0], sh.size() * sizeof( f32 ) );
+		}
+
+		failed += !ok;
+		printf( "%-44s %4u %4u %4u %s\n", it.name, threadCounts[0], threadCounts[1], threadCounts[2], ok ? "" : "FAILED" );
+	}
+
+	Parallel::SetThreadCount( 0 );
+	return failed;
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////
+
+int main( int argc, char **argv )
+{
+	u32 reps = 7;
+	f64 repTime = 0.05;
+	std::vector<std::string> filters;
+	bool validate = false;
+
+	for ( int i = 1; i < argc; ++i )
+	{
+		if ( !strcmp( argv[i], "-reps" ) && i + 1 < argc )
+			reps = std::max( 1, atoi( argv[++i] ) );
+		else if ( !strcmp( argv[i], "-time" ) && i + 1 < argc )
+			repTime = std::max( 1, atoi( argv[++i] ) ) * 1e-3;
+		else if ( !strcmp( argv[i], "-validate" ) )
+			validate = true;
+		else
+			filters.push_back( argv[i] );
+	}
+
+	Random::InitRandom();
+
+	if ( validate )
+		return Validate() + ValidateThreadCounts() ? 1 : 0;
+
+	AddSHBenchmarks();
+	AddIntegratorBenchmarks();
+	AddPolygonBenchmarks();
+	AddBRDFBenchmarks();
+	AddSamplingBenchmarks();
+	AddMatrixBenchmarks();
+	AddMeshBenchmarks();
+
+	printf( "%u threads, simd width %d, %u reps of %.0f ms\n\n", Parallel::ThreadCount(), (int) RADAR_SIMD_WIDTH, reps, repTime * 1e3 );
+	printf( "%-44s %14s %14s %9s\n", "benchmark", "ns/op", "samples/s", "spread" );
+
+	for ( const Benchmark &b : benchmarks )
+	{
+		bool selected = filters.empty();
+		for ( const std::string &f : filters )
+			selected |= b.name.find( f ) != std::string::npos;
+
+		if ( selected )
+			Measure( b, reps, repTime );
+	}
+
+	return 0;
+}
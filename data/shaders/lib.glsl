@@ -265,13 +265,13 @@ float IntegrateEdge(in vec3 P1, in vec3 P2) {
 }
 
 // Returns a vec2 to index the BRDF matrix depending on the view angle and surface roughness
-vec2 LTCCoords(in float NdotV, in float roughness) {
+// lutSize is the side of the LTC tables (textureSize of ltc_mat)
+vec2 LTCCoords(in float NdotV, in float roughness, in float lutSize) {
     float theta = acos(NdotV);
     vec2 coords = vec2(roughness, theta/(0.5*M_PI));
 
     // corrected lookup (x - 1 + 0.5)
-    const float LUT_SIZE = 32.0;
-    coords = coords * (LUT_SIZE - 1.0) / LUT_SIZE + 0.5 / LUT_SIZE;
+    coords = coords * (lutSize - 1.0) / lutSize + 0.5 / lutSize;
 
     return coords;
 }
@@ -46,7 +46,7 @@ float diffuseBurley(in float NdotL, in float NdotV, in float LdotH, in float rou
 float getDistanceAttenuation(in vec3 light_vec, in float invSqrAttRadius);
 vec3 LTCEvaluate(in vec3 N, in vec3 V, in vec3 P, in mat3 Minv, in vec3 points[4], in bool twoSided);
 vec3 FetchCorrectedNormal(in sampler2D nrmTex, in vec2 texcoord, in mat3 TBN, in vec3 V);
-vec2 LTCCoords(in float NdotV, in float roughness);
+vec2 LTCCoords(in float NdotV, in float roughness, in float lutSize);
 mat3 LTCMatrix(in sampler2D ltcMatrix, in vec2 coord);
 float rand(in vec2 seed);
 vec3 rand3(in vec3 seed);
@@ -252,7 +252,7 @@ vec3 areaLightContribution(in vec3 N, in vec3 V, in float NdotV, in vec3 diff_co
     vec3 contrib = vec3(0);
     vec3 points[4];
 
-    vec2 ltcCoords = LTCCoords(NdotV, roughness);
+    vec2 ltcCoords = LTCCoords(NdotV, roughness, float(textureSize(ltc_mat, 0).x));
     mat3 MinvSpec = LTCMatrix(ltc_mat, ltcCoords);
     mat3 MinvDiff = mat3(1);
     vec2 schlick = texture2D(ltc_amp, ltcCoords).xy;
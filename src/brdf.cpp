@@ -1,4 +1,5 @@
 #include "brdf.h"
+#include "common/simd.h"
 #include <algorithm>
 
 namespace Render
@@ -144,5 +145,101 @@ namespace Render
 
 			return IntegratePoly( L, 4, twoSided );
 		}
+
+		/// IntegrateEdge for Width edges, u1 & u2 given by their components
+		static FORCEINLINE simdf IntegrateEdgeSIMD( const simdf u1[3], const simdf u2[3] )
+		{
+			const simdf cosTheta = Max( simdf( -0.9999f ), Min( simdf( 0.9999f ), MulAdd( u1[0], u2[0], MulAdd( u1[1], u2[1], u1[2] * u2[2] ) ) ) );
+
+			// sin(acos(c)) = sqrt(1 - c^2)
+			const simdf theta = Acos( cosTheta );
+			const simdf sinTheta = Sqrt( 1.f - cosTheta * cosTheta );
+			const simdf crossZ = u1[0] * u2[1] - u1[1] * u2[0];
+			return crossZ * theta / sinTheta;
+		}
+
+		/// One SIMD batch of LTC_EvaluateBatch, reading Width points from pts starting at index i
+		static void LTC_EvaluateLanes( const LTC_Points &pts, u32 i, const f32 *ltcMatrix, int LUTSize, const vec3f points[4], bool twoSided, f32 *out )
+		{
+			const u32 W = simdf::Width;
+
+			const simdf N[3] = { simdf::Load( pts.nX + i ), simdf::Load( pts.nY + i ), simdf::Load( pts.nZ + i ) };
+			const simdf V[3] = { simdf::Load( pts.vX + i ), simdf::Load( pts.vY + i ), simdf::Load( pts.vZ + i ) };
+			const simdf P[3] = { simdf::Load( pts.pX + i ), simdf::Load( pts.pY + i ), simdf::Load( pts.pZ + i ) };
+
+			// N orthonormal frame
+			const simdf NdotV = MulAdd( N[0], V[0], MulAdd( N[1], V[1], N[2] * V[2] ) );
+			simdf T[3] = { V[0] - N[0] * NdotV, V[1] - N[1] * NdotV, V[2] - N[2] * NdotV };
+			const simdf invLenT = 1.f / Sqrt( MulAdd( T[0], T[0], MulAdd( T[1], T[1], T[2] * T[2] ) ) );
+			T[0] *= invLenT; T[1] *= invLenT; T[2] *= invLenT;
+			const simdf B[3] = { N[1] * T[2] - N[2] * T[1], N[2] * T[0] - N[0] * T[2], N[0] * T[1] - N[1] * T[0] };
+
+			// LTC_Coords, then the bilinear lookups are gathered lane by lane
+			const f32 scale = ( LUTSize - 1.f ) / LUTSize;
+			const f32 bias = 0.5f / LUTSize;
+			alignas( 32 ) f32 u[W], v[W];
+			MulAdd( simdf::Load( pts.roughness + i ), simdf( scale ), simdf( bias ) ).Store( u );
+			MulAdd( Acos( Min( simdf( 1.f ), NdotV ) ) * ( 2.f / M_PI ), simdf( scale ), simdf( bias ) ).Store( v );
+
+			alignas( 32 ) f32 m[4][W];
+			for ( u32 l = 0; l < W; ++l )
+			{
+				const vec4f t = BilinearLookup<vec4f>( ltcMatrix, vec2f( u[l], v[l] ), vec2i( LUTSize, LUTSize ) );
+				m[0][l] = t.x; m[1][l] = t.y; m[2][l] = t.z; m[3][l] = t.w;
+			}
+			const simdf mx = simdf::Load( m[0] ), my = simdf::Load( m[1] ), mz = simdf::Load( m[2] ), mw = simdf::Load( m[3] );
+
+			// polygon in TBN frame, transformed by Minv (see LTC_Matrix) and projected onto the sphere
+			simdf L[4][3];
+			for ( u32 k = 0; k < 4; ++k )
+			{
+				const simdf d[3] = { points[k].x - P[0], points[k].y - P[1], points[k].z - P[2] };
+				const simdf lx = MulAdd( T[0], d[0], MulAdd( T[1], d[1], T[2] * d[2] ) );
+				const simdf ly = MulAdd( B[0], d[0], MulAdd( B[1], d[1], B[2] * d[2] ) );
+				const simdf lz = MulAdd( N[0], d[0], MulAdd( N[1], d[1], N[2] * d[2] ) );
+
+				L[k][0] = MulAdd( mw, lz, lx );
+				L[k][1] = mz * ly;
+				L[k][2] = MulAdd( my, lx, mx * lz );
+
+				const simdf invLen = 1.f / Sqrt( MulAdd( L[k][0], L[k][0], MulAdd( L[k][1], L[k][1], L[k][2] * L[k][2] ) ) );
+				L[k][0] *= invLen; L[k][1] *= invLen; L[k][2] *= invLen;
+			}
+
+			simdf sum = IntegrateEdgeSIMD( L[0], L[1] );
+			sum += IntegrateEdgeSIMD( L[1], L[2] );
+			sum += IntegrateEdgeSIMD( L[2], L[3] );
+			sum += IntegrateEdgeSIMD( L[3], L[0] );
+
+			sum = twoSided ? Abs( sum ) : Max( simdf::Zero(), -sum );
+			sum.Store( out );
+		}
+
+		void LTC_EvaluateBatch( const LTC_Points &pts, u32 count, const f32 *ltcMatrix, int LUTSize, const vec3f points[4], bool twoSided, f32 *out )
+		{
+			const u32 W = simdf::Width;
+			const u32 full = count - count % W;
+
+			for ( u32 i = 0; i < full; i += W )
+				LTC_EvaluateLanes( pts, i, ltcMatrix, LUTSize, points, twoSided, out + i );
+
+			if ( full == count )
+				return;
+
+			// last partial batch through padded copies, padding lanes shade a valid dummy point
+			alignas( 32 ) f32 pad[10][W];
+			const f32 *src[10] = { pts.nX, pts.nY, pts.nZ, pts.vX, pts.vY, pts.vZ, pts.pX, pts.pY, pts.pZ, pts.roughness };
+			const f32 dummy[10] = { 0.f, 0.f, 1.f, 1.f, 0.f, 1.f, 0.f, 0.f, 0.f, 0.5f };
+
+			const u32 n = count - full;
+			for ( u32 c = 0; c < 10; ++c )
+				for ( u32 l = 0; l < W; ++l )
+					pad[c][l] = l < n ? src[c][full + l] : dummy[c];
+
+			const LTC_Points tail = { pad[0], pad[1], pad[2], pad[3], pad[4], pad[5], pad[6], pad[7], pad[8], pad[9] };
+			alignas( 32 ) f32 res[W];
+			LTC_EvaluateLanes( tail, 0, ltcMatrix, LUTSize, points, twoSided, res );
+			std::copy( res, res + n, out + full );
+		}
 	}
-}
\ No newline at end of file
+}
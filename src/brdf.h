@@ -31,5 +31,19 @@ namespace Render
 		vec2f LTC_Coords( f32 NdotV, f32 roughness, int LUTSize );
 		mat3f LTC_Matrix( f32 *ltcMatrix, const vec2f &coord, int LUTSize );
 		f32   LTC_Evaluate( const vec3f &N, const vec3f &V, const vec3f &P, const mat3f &Minv, const vec3f points[4], bool twoSided );
+
+		/// SoA shading points for LTC_EvaluateBatch
+		struct LTC_Points
+		{
+			const f32 *nX, *nY, *nZ;	//!< unit normals
+			const f32 *vX, *vY, *vZ;	//!< unit view vectors
+			const f32 *pX, *pY, *pZ;	//!< world positions
+			const f32 *roughness;
+		};
+
+		/// LTC_Evaluate of the same quad for count shading points, simdf::Width points at a time (see simd.h).
+		/// Each point does its own LTC_Coords + LTC_Matrix lookup in the LUTSize * LUTSize ltcMatrix table.
+		/// out[i] receives the integral of point i.
+		void LTC_EvaluateBatch( const LTC_Points &pts, u32 count, const f32 *ltcMatrix, int LUTSize, const vec3f points[4], bool twoSided, f32 *out );
 	}
 }
\ No newline at end of file
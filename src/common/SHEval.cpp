@@ -1,9 +1,12 @@
 #include "SHEval.h"
+#include "simd.h"
 #include <assert.h>
 
+#include "SHEval.inl"
+
 void SHEval( unsigned int bandN, const float fX, const float fY, const float fZ, float *pSH )
 {
-	assert( bandN <= 11 );
+	assert( bandN >= 3 && bandN <= 21 );
 
 	switch ( bandN )
 	{
@@ -34,73 +37,231 @@ void SHEval( unsigned int bandN, const float fX, const float fY, const float fZ,
 	case 11:
 		SHEval11( fX, fY, fZ, pSH );
 		break;
+	case 12:
+		SHEval12( fX, fY, fZ, pSH );
+		break;
+	case 13:
+		SHEval13( fX, fY, fZ, pSH );
+		break;
+	case 14:
+		SHEval14( fX, fY, fZ, pSH );
+		break;
+	case 15:
+		SHEval15( fX, fY, fZ, pSH );
+		break;
+	case 16:
+		SHEval16( fX, fY, fZ, pSH );
+		break;
+	case 17:
+		SHEval17( fX, fY, fZ, pSH );
+		break;
+	case 18:
+		SHEval18( fX, fY, fZ, pSH );
+		break;
+	case 19:
+		SHEval19( fX, fY, fZ, pSH );
+		break;
+	case 20:
+		SHEval20( fX, fY, fZ, pSH );
+		break;
+	case 21:
+		SHEval21( fX, fY, fZ, pSH );
+		break;
 	default: break;
 	}
 }
 
-// order 3
-void SHEval3( const float fX, const float fY, const float fZ, float *pSH )
+template<unsigned int N>
+void SHEval( const float fX, const float fY, const float fZ, float *pSH )
 {
-	float fC0, fC1, fS0, fS1, fTmpA, fTmpB, fTmpC;
-	float fZ2 = fZ*fZ;
+	SHKernel<N>::Eval( fX, fY, fZ, SHStore<float>{ pSH } );
+}
 
-	pSH[0] = 0.2820947917738781f;
-	pSH[2] = 0.4886025119029199f*fZ;
-	pSH[6] = 0.9461746957575601f*fZ2 + -0.3153915652525201f;
-	fC0 = fX;
-	fS0 = fY;
+#define SH_INSTANTIATE_EVAL( N ) template void SHEval<N>( const float fX, const float fY, const float fZ, float *pSH );
+SH_FOR_EACH_BAND( SH_INSTANTIATE_EVAL )
+#undef SH_INSTANTIATE_EVAL
 
-	fTmpA = -0.48860251190292f;
-	pSH[3] = fTmpA*fC0;
-	pSH[1] = fTmpA*fS0;
-	fTmpB = -1.092548430592079f*fZ;
-	pSH[7] = fTmpB*fC0;
-	pSH[5] = fTmpB*fS0;
-	fC1 = fX*fC0 - fY*fS0;
-	fS1 = fX*fS0 + fY*fC0;
+// Stores each basis value straight to its coefficient row. Staging the N * N values in a local
+// simdf array first (SHStore) spills it to the stack and copies it out again, which made the batch
+// no faster than the scalar SHEval.
+struct SHStoreRows
+{
+	float *pSH;
+	unsigned int stride;
 
-	fTmpC = 0.5462742152960395f;
-	pSH[8] = fTmpC*fC1;
-	pSH[4] = fTmpC*fS1;
+	FORCEINLINE void operator()( unsigned int c, const simdf &v ) const
+	{
+		v.Store( pSH + c * stride );
+	}
+};
+
+// Evaluates simdf::Width directions per iteration. The trailing directions are padded
+// with +Z and only the valid lanes are written back.
+template<unsigned int N>
+static void SHEvalBatchN( unsigned int count, const float *pX, const float *pY, const float *pZ, float *pSH, unsigned int stride )
+{
+	const unsigned int W = simdf::Width;
+
+	unsigned int i = 0;
+	for ( ; i + W <= count; i += W )
+		SHKernel<N>::Eval( simdf::Load( pX + i ), simdf::Load( pY + i ), simdf::Load( pZ + i ), SHStoreRows{ pSH + i, stride } );
+
+	if ( i < count )
+	{
+		const unsigned int rem = count - i;
+		alignas( 32 ) float x[W], y[W], z[W], lanes[W];
+		simdf sh[N * N];
+		for ( unsigned int l = 0; l < W; ++l )
+		{
+			x[l] = l < rem ? pX[i + l] : 0.f;
+			y[l] = l < rem ? pY[i + l] : 0.f;
+			z[l] = l < rem ? pZ[i + l] : 1.f;
+		}
+
+		SHKernel<N>::Eval( simdf::Load( x ), simdf::Load( y ), simdf::Load( z ), SHStore<simdf>{ sh } );
+
+		for ( unsigned int c = 0; c < N * N; ++c )
+		{
+			sh[c].Store( lanes );
+			for ( unsigned int l = 0; l < rem; ++l )
+				pSH[c * stride + i + l] = lanes[l];
+		}
+	}
 }
 
-// order 4
-void SHEval4( const float fX, const float fY, const float fZ, float *pSH )
+void SHEvalBatch( unsigned int bandN, unsigned int count, const float *pX, const float *pY, const float *pZ, float *pSH, unsigned int stride )
 {
-	float fC0, fC1, fS0, fS1, fTmpA, fTmpB, fTmpC;
-	float fZ2 = fZ*fZ;
+	assert( bandN >= 3 && bandN <= 21 );
+	assert( stride >= count );
 
-	pSH[0] = 0.2820947917738781f;
-	pSH[2] = 0.4886025119029199f*fZ;
-	pSH[6] = 0.9461746957575601f*fZ2 + -0.3153915652525201f;
-	pSH[12] = fZ*( 1.865881662950577f*fZ2 + -1.119528997770346f );
-	fC0 = fX;
-	fS0 = fY;
+	switch ( bandN )
+	{
+	case 3: SHEvalBatchN<3>( count, pX, pY, pZ, pSH, stride ); break;
+	case 4: SHEvalBatchN<4>( count, pX, pY, pZ, pSH, stride ); break;
+	case 5: SHEvalBatchN<5>( count, pX, pY, pZ, pSH, stride ); break;
+	case 6: SHEvalBatchN<6>( count, pX, pY, pZ, pSH, stride ); break;
+	case 7: SHEvalBatchN<7>( count, pX, pY, pZ, pSH, stride ); break;
+	case 8: SHEvalBatchN<8>( count, pX, pY, pZ, pSH, stride ); break;
+	case 9: SHEvalBatchN<9>( count, pX, pY, pZ, pSH, stride ); break;
+	case 10: SHEvalBatchN<10>( count, pX, pY, pZ, pSH, stride ); break;
+	case 11: SHEvalBatchN<11>( count, pX, pY, pZ, pSH, stride ); break;
+	case 12: SHEvalBatchN<12>( count, pX, pY, pZ, pSH, stride ); break;
+	case 13: SHEvalBatchN<13>( count, pX, pY, pZ, pSH, stride ); break;
+	case 14: SHEvalBatchN<14>( count, pX, pY, pZ, pSH, stride ); break;
+	case 15: SHEvalBatchN<15>( count, pX, pY, pZ, pSH, stride ); break;
+	case 16: SHEvalBatchN<16>( count, pX, pY, pZ, pSH, stride ); break;
+	case 17: SHEvalBatchN<17>( count, pX, pY, pZ, pSH, stride ); break;
+	case 18: SHEvalBatchN<18>( count, pX, pY, pZ, pSH, stride ); break;
+	case 19: SHEvalBatchN<19>( count, pX, pY, pZ, pSH, stride ); break;
+	case 20: SHEvalBatchN<20>( count, pX, pY, pZ, pSH, stride ); break;
+	case 21: SHEvalBatchN<21>( count, pX, pY, pZ, pSH, stride ); break;
+	default: break;
+	}
+}
 
-	fTmpA = -0.48860251190292f;
-	pSH[3] = fTmpA*fC0;
-	pSH[1] = fTmpA*fS0;
-	fTmpB = -1.092548430592079f*fZ;
-	pSH[7] = fTmpB*fC0;
-	pSH[5] = fTmpB*fS0;
-	fTmpC = -2.285228997322329f*fZ2 + 0.4570457994644658f;
-	pSH[13] = fTmpC*fC0;
-	pSH[11] = fTmpC*fS0;
-	fC1 = fX*fC0 - fY*fS0;
-	fS1 = fX*fS0 + fY*fC0;
+// Accumulates simdf::Width weighted directions per iteration in per-lane accumulators,
+// reduced into accum once at the end. Padded lanes get a zero weight.
+template<unsigned int N>
+static void SHEvalAccumulateBatchN( unsigned int count, const float *pX, const float *pY, const float *pZ, const float *pW, float *accum )
+{
+	const unsigned int W = simdf::Width;
+	simdf acc[N * N];
+	for ( unsigned int c = 0; c < N * N; ++c )
+		acc[c] = simdf::Zero();
 
-	fTmpA = 0.5462742152960395f;
-	pSH[8] = fTmpA*fC1;
-	pSH[4] = fTmpA*fS1;
-	fTmpB = 1.445305721320277f*fZ;
-	pSH[14] = fTmpB*fC1;
-	pSH[10] = fTmpB*fS1;
-	fC0 = fX*fC1 - fY*fS1;
-	fS0 = fX*fS1 + fY*fC1;
+	unsigned int i = 0;
+	for ( ; i + W <= count; i += W )
+	{
+		SHEvalAccumulate<N>( simdf::Load( pX + i ), simdf::Load( pY + i ), simdf::Load( pZ + i ), simdf::Load( pW + i ), acc );
+	}
 
-	fTmpC = -0.5900435899266435f;
-	pSH[15] = fTmpC*fC0;
-	pSH[9] = fTmpC*fS0;
+	if ( i < count )
+	{
+		const unsigned int rem = count - i;
+		alignas( 32 ) float x[W], y[W], z[W], w[W];
+		for ( unsigned int l = 0; l < W; ++l )
+		{
+			x[l] = l < rem ? pX[i + l] : 0.f;
+			y[l] = l < rem ? pY[i + l] : 0.f;
+			z[l] = l < rem ? pZ[i + l] : 1.f;
+			w[l] = l < rem ? pW[i + l] : 0.f;
+		}
+
+		SHEvalAccumulate<N>( simdf::Load( x ), simdf::Load( y ), simdf::Load( z ), simdf::Load( w ), acc );
+	}
+
+	for ( unsigned int c = 0; c < N * N; ++c )
+		accum[c] += ReduceAdd( acc[c] );
+}
+
+void SHEvalAccumulate( unsigned int bandN, const float fX, const float fY, const float fZ, const float weight, float *accum )
+{
+	assert( bandN >= 3 && bandN <= 21 );
+
+	switch ( bandN )
+	{
+	case 3: SHEvalAccumulate<3>( fX, fY, fZ, weight, accum ); break;
+	case 4: SHEvalAccumulate<4>( fX, fY, fZ, weight, accum ); break;
+	case 5: SHEvalAccumulate<5>( fX, fY, fZ, weight, accum ); break;
+	case 6: SHEvalAccumulate<6>( fX, fY, fZ, weight, accum ); break;
+	case 7: SHEvalAccumulate<7>( fX, fY, fZ, weight, accum ); break;
+	case 8: SHEvalAccumulate<8>( fX, fY, fZ, weight, accum ); break;
+	case 9: SHEvalAccumulate<9>( fX, fY, fZ, weight, accum ); break;
+	case 10: SHEvalAccumulate<10>( fX, fY, fZ, weight, accum ); break;
+	case 11: SHEvalAccumulate<11>( fX, fY, fZ, weight, accum ); break;
+	case 12: SHEvalAccumulate<12>( fX, fY, fZ, weight, accum ); break;
+	case 13: SHEvalAccumulate<13>( fX, fY, fZ, weight, accum ); break;
+	case 14: SHEvalAccumulate<14>( fX, fY, fZ, weight, accum ); break;
+	case 15: SHEvalAccumulate<15>( fX, fY, fZ, weight, accum ); break;
+	case 16: SHEvalAccumulate<16>( fX, fY, fZ, weight, accum ); break;
+	case 17: SHEvalAccumulate<17>( fX, fY, fZ, weight, accum ); break;
+	case 18: SHEvalAccumulate<18>( fX, fY, fZ, weight, accum ); break;
+	case 19: SHEvalAccumulate<19>( fX, fY, fZ, weight, accum ); break;
+	case 20: SHEvalAccumulate<20>( fX, fY, fZ, weight, accum ); break;
+	case 21: SHEvalAccumulate<21>( fX, fY, fZ, weight, accum ); break;
+	default: break;
+	}
+}
+
+void SHEvalAccumulateBatch( unsigned int bandN, unsigned int count, const float *pX, const float *pY, const float *pZ, const float *pW, float *accum )
+{
+	assert( bandN >= 3 && bandN <= 21 );
+
+	switch ( bandN )
+	{
+	case 3: SHEvalAccumulateBatchN<3>( count, pX, pY, pZ, pW, accum ); break;
+	case 4: SHEvalAccumulateBatchN<4>( count, pX, pY, pZ, pW, accum ); break;
+	case 5: SHEvalAccumulateBatchN<5>( count, pX, pY, pZ, pW, accum ); break;
+	case 6: SHEvalAccumulateBatchN<6>( count, pX, pY, pZ, pW, accum ); break;
+	case 7: SHEvalAccumulateBatchN<7>( count, pX, pY, pZ, pW, accum ); break;
+	case 8: SHEvalAccumulateBatchN<8>( count, pX, pY, pZ, pW, accum ); break;
+	case 9: SHEvalAccumulateBatchN<9>( count, pX, pY, pZ, pW, accum ); break;
+	case 10: SHEvalAccumulateBatchN<10>( count, pX, pY, pZ, pW, accum ); break;
+	case 11: SHEvalAccumulateBatchN<11>( count, pX, pY, pZ, pW, accum ); break;
+	case 12: SHEvalAccumulateBatchN<12>( count, pX, pY, pZ, pW, accum ); break;
+	case 13: SHEvalAccumulateBatchN<13>( count, pX, pY, pZ, pW, accum ); break;
+	case 14: SHEvalAccumulateBatchN<14>( count, pX, pY, pZ, pW, accum ); break;
+	case 15: SHEvalAccumulateBatchN<15>( count, pX, pY, pZ, pW, accum ); break;
+	case 16: SHEvalAccumulateBatchN<16>( count, pX, pY, pZ, pW, accum ); break;
+	case 17: SHEvalAccumulateBatchN<17>( count, pX, pY, pZ, pW, accum ); break;
+	case 18: SHEvalAccumulateBatchN<18>( count, pX, pY, pZ, pW, accum ); break;
+	case 19: SHEvalAccumulateBatchN<19>( count, pX, pY, pZ, pW, accum ); break;
+	case 20: SHEvalAccumulateBatchN<20>( count, pX, pY, pZ, pW, accum ); break;
+	case 21: SHEvalAccumulateBatchN<21>( count, pX, pY, pZ, pW, accum ); break;
+	default: break;
+	}
+}
+
+// order 3
+void SHEval3( const float fX, const float fY, const float fZ, float *pSH )
+{
+	SHKernel<3>::Eval( fX, fY, fZ, SHStore<float>{ pSH } );
+}
+
+// order 4
+void SHEval4( const float fX, const float fY, const float fZ, float *pSH )
+{
+	SHKernel<4>::Eval( fX, fY, fZ, SHStore<float>{ pSH } );
 }
 
 // order 4
@@ -146,5560 +307,103 @@ void SHEval4D( const double fX, const double fY, const double fZ, double *pSH )
 // order 5
 void SHEval5( const float fX, const float fY, const float fZ, float *pSH )
 {
-	float fC0, fC1, fS0, fS1, fTmpA, fTmpB, fTmpC;
-	float fZ2 = fZ*fZ;
-
-	pSH[0] = 0.2820947917738781f;
-	pSH[2] = 0.4886025119029199f*fZ;
-	pSH[6] = 0.9461746957575601f*fZ2 + -0.3153915652525201f;
-	pSH[12] = fZ*( 1.865881662950577f*fZ2 + -1.119528997770346f );
-	pSH[20] = 1.984313483298443f*fZ*pSH[12] + -1.006230589874905f*pSH[6];
-	fC0 = fX;
-	fS0 = fY;
-
-	fTmpA = -0.48860251190292f;
-	pSH[3] = fTmpA*fC0;
-	pSH[1] = fTmpA*fS0;
-	fTmpB = -1.092548430592079f*fZ;
-	pSH[7] = fTmpB*fC0;
-	pSH[5] = fTmpB*fS0;
-	fTmpC = -2.285228997322329f*fZ2 + 0.4570457994644658f;
-	pSH[13] = fTmpC*fC0;
-	pSH[11] = fTmpC*fS0;
-	fTmpA = fZ*( -4.683325804901025f*fZ2 + 2.007139630671868f );
-	pSH[21] = fTmpA*fC0;
-	pSH[19] = fTmpA*fS0;
-	fC1 = fX*fC0 - fY*fS0;
-	fS1 = fX*fS0 + fY*fC0;
-
-	fTmpA = 0.5462742152960395f;
-	pSH[8] = fTmpA*fC1;
-	pSH[4] = fTmpA*fS1;
-	fTmpB = 1.445305721320277f*fZ;
-	pSH[14] = fTmpB*fC1;
-	pSH[10] = fTmpB*fS1;
-	fTmpC = 3.31161143515146f*fZ2 + -0.47308734787878f;
-	pSH[22] = fTmpC*fC1;
-	pSH[18] = fTmpC*fS1;
-	fC0 = fX*fC1 - fY*fS1;
-	fS0 = fX*fS1 + fY*fC1;
-
-	fTmpA = -0.5900435899266435f;
-	pSH[15] = fTmpA*fC0;
-	pSH[9] = fTmpA*fS0;
-	fTmpB = -1.770130769779931f*fZ;
-	pSH[23] = fTmpB*fC0;
-	pSH[17] = fTmpB*fS0;
-	fC1 = fX*fC0 - fY*fS0;
-	fS1 = fX*fS0 + fY*fC0;
-
-	fTmpC = 0.6258357354491763f;
-	pSH[24] = fTmpC*fC1;
-	pSH[16] = fTmpC*fS1;
+	SHKernel<5>::Eval( fX, fY, fZ, SHStore<float>{ pSH } );
 }
 
 // order 6
 void SHEval6( const float fX, const float fY, const float fZ, float *pSH )
 {
-	float fC0, fC1, fS0, fS1, fTmpA, fTmpB, fTmpC;
-	float fZ2 = fZ*fZ;
-
-	pSH[0] = 0.2820947917738781f;
-	pSH[2] = 0.4886025119029199f*fZ;
-	pSH[6] = 0.9461746957575601f*fZ2 + -0.3153915652525201f;
-	pSH[12] = fZ*( 1.865881662950577f*fZ2 + -1.119528997770346f );
-	pSH[20] = 1.984313483298443f*fZ*pSH[12] + -1.006230589874905f*pSH[6];
-	pSH[30] = 1.98997487421324f*fZ*pSH[20] + -1.002853072844814f*pSH[12];
-	fC0 = fX;
-	fS0 = fY;
-
-	fTmpA = -0.48860251190292f;
-	pSH[3] = fTmpA*fC0;
-	pSH[1] = fTmpA*fS0;
-	fTmpB = -1.092548430592079f*fZ;
-	pSH[7] = fTmpB*fC0;
-	pSH[5] = fTmpB*fS0;
-	fTmpC = -2.285228997322329f*fZ2 + 0.4570457994644658f;
-	pSH[13] = fTmpC*fC0;
-	pSH[11] = fTmpC*fS0;
-	fTmpA = fZ*( -4.683325804901025f*fZ2 + 2.007139630671868f );
-	pSH[21] = fTmpA*fC0;
-	pSH[19] = fTmpA*fS0;
-	fTmpB = 2.03100960115899f*fZ*fTmpA + -0.991031208965115f*fTmpC;
-	pSH[31] = fTmpB*fC0;
-	pSH[29] = fTmpB*fS0;
-	fC1 = fX*fC0 - fY*fS0;
-	fS1 = fX*fS0 + fY*fC0;
-
-	fTmpA = 0.5462742152960395f;
-	pSH[8] = fTmpA*fC1;
-	pSH[4] = fTmpA*fS1;
-	fTmpB = 1.445305721320277f*fZ;
-	pSH[14] = fTmpB*fC1;
-	pSH[10] = fTmpB*fS1;
-	fTmpC = 3.31161143515146f*fZ2 + -0.47308734787878f;
-	pSH[22] = fTmpC*fC1;
-	pSH[18] = fTmpC*fS1;
-	fTmpA = fZ*( 7.190305177459987f*fZ2 + -2.396768392486662f );
-	pSH[32] = fTmpA*fC1;
-	pSH[28] = fTmpA*fS1;
-	fC0 = fX*fC1 - fY*fS1;
-	fS0 = fX*fS1 + fY*fC1;
-
-	fTmpA = -0.5900435899266435f;
-	pSH[15] = fTmpA*fC0;
-	pSH[9] = fTmpA*fS0;
-	fTmpB = -1.770130769779931f*fZ;
-	pSH[23] = fTmpB*fC0;
-	pSH[17] = fTmpB*fS0;
-	fTmpC = -4.403144694917254f*fZ2 + 0.4892382994352505f;
-	pSH[33] = fTmpC*fC0;
-	pSH[27] = fTmpC*fS0;
-	fC1 = fX*fC0 - fY*fS0;
-	fS1 = fX*fS0 + fY*fC0;
-
-	fTmpA = 0.6258357354491763f;
-	pSH[24] = fTmpA*fC1;
-	pSH[16] = fTmpA*fS1;
-	fTmpB = 2.075662314881041f*fZ;
-	pSH[34] = fTmpB*fC1;
-	pSH[26] = fTmpB*fS1;
-	fC0 = fX*fC1 - fY*fS1;
-	fS0 = fX*fS1 + fY*fC1;
-
-	fTmpC = -0.6563820568401703f;
-	pSH[35] = fTmpC*fC0;
-	pSH[25] = fTmpC*fS0;
+	SHKernel<6>::Eval( fX, fY, fZ, SHStore<float>{ pSH } );
 }
 
 // order 7
 void SHEval7( const float fX, const float fY, const float fZ, float *pSH )
 {
-	float fC0, fC1, fS0, fS1, fTmpA, fTmpB, fTmpC;
-	float fZ2 = fZ*fZ;
+	SHKernel<7>::Eval( fX, fY, fZ, SHStore<float>{ pSH } );
+}
 
-	pSH[0] = 0.2820947917738781f;
-	pSH[2] = 0.4886025119029199f*fZ;
-	pSH[6] = 0.9461746957575601f*fZ2 + -0.3153915652525201f;
-	pSH[12] = fZ*( 1.865881662950577f*fZ2 + -1.119528997770346f );
-	pSH[20] = 1.984313483298443f*fZ*pSH[12] + -1.006230589874905f*pSH[6];
-	pSH[30] = 1.98997487421324f*fZ*pSH[20] + -1.002853072844814f*pSH[12];
-	pSH[42] = 1.993043457183567f*fZ*pSH[30] + -1.001542020962219f*pSH[20];
-	fC0 = fX;
-	fS0 = fY;
+// order 8
+void SHEval8( const float fX, const float fY, const float fZ, float *pSH )
+{
+	SHKernel<8>::Eval( fX, fY, fZ, SHStore<float>{ pSH } );
+}
 
-	fTmpA = -0.48860251190292f;
-	pSH[3] = fTmpA*fC0;
-	pSH[1] = fTmpA*fS0;
-	fTmpB = -1.092548430592079f*fZ;
-	pSH[7] = fTmpB*fC0;
-	pSH[5] = fTmpB*fS0;
-	fTmpC = -2.285228997322329f*fZ2 + 0.4570457994644658f;
-	pSH[13] = fTmpC*fC0;
-	pSH[11] = fTmpC*fS0;
-	fTmpA = fZ*( -4.683325804901025f*fZ2 + 2.007139630671868f );
-	pSH[21] = fTmpA*fC0;
-	pSH[19] = fTmpA*fS0;
-	fTmpB = 2.03100960115899f*fZ*fTmpA + -0.991031208965115f*fTmpC;
-	pSH[31] = fTmpB*fC0;
-	pSH[29] = fTmpB*fS0;
-	fTmpC = 2.021314989237028f*fZ*fTmpB + -0.9952267030562385f*fTmpA;
-	pSH[43] = fTmpC*fC0;
-	pSH[41] = fTmpC*fS0;
-	fC1 = fX*fC0 - fY*fS0;
-	fS1 = fX*fS0 + fY*fC0;
+// order 9
+void SHEval9( const float fX, const float fY, const float fZ, float *pSH )
+{
+	SHKernel<9>::Eval( fX, fY, fZ, SHStore<float>{ pSH } );
+}
 
-	fTmpA = 0.5462742152960395f;
-	pSH[8] = fTmpA*fC1;
-	pSH[4] = fTmpA*fS1;
-	fTmpB = 1.445305721320277f*fZ;
-	pSH[14] = fTmpB*fC1;
-	pSH[10] = fTmpB*fS1;
-	fTmpC = 3.31161143515146f*fZ2 + -0.47308734787878f;
-	pSH[22] = fTmpC*fC1;
-	pSH[18] = fTmpC*fS1;
-	fTmpA = fZ*( 7.190305177459987f*fZ2 + -2.396768392486662f );
-	pSH[32] = fTmpA*fC1;
-	pSH[28] = fTmpA*fS1;
-	fTmpB = 2.11394181566097f*fZ*fTmpA + -0.9736101204623268f*fTmpC;
-	pSH[44] = fTmpB*fC1;
-	pSH[40] = fTmpB*fS1;
-	fC0 = fX*fC1 - fY*fS1;
-	fS0 = fX*fS1 + fY*fC1;
+// order 10
+void SHEval10( const float fX, const float fY, const float fZ, float *pSH )
+{
+	SHKernel<10>::Eval( fX, fY, fZ, SHStore<float>{ pSH } );
+}
 
-	fTmpA = -0.5900435899266435f;
-	pSH[15] = fTmpA*fC0;
-	pSH[9] = fTmpA*fS0;
-	fTmpB = -1.770130769779931f*fZ;
-	pSH[23] = fTmpB*fC0;
-	pSH[17] = fTmpB*fS0;
-	fTmpC = -4.403144694917254f*fZ2 + 0.4892382994352505f;
-	pSH[33] = fTmpC*fC0;
-	pSH[27] = fTmpC*fS0;
-	fTmpA = fZ*( -10.13325785466416f*fZ2 + 2.763615778544771f );
-	pSH[45] = fTmpA*fC0;
-	pSH[39] = fTmpA*fS0;
-	fC1 = fX*fC0 - fY*fS0;
-	fS1 = fX*fS0 + fY*fC0;
+// order 11
+void SHEval11( const float fX, const float fY, const float fZ, float *pSH )
+{
+	SHKernel<11>::Eval( fX, fY, fZ, SHStore<float>{ pSH } );
+}
 
-	fTmpA = 0.6258357354491763f;
-	pSH[24] = fTmpA*fC1;
-	pSH[16] = fTmpA*fS1;
-	fTmpB = 2.075662314881041f*fZ;
-	pSH[34] = fTmpB*fC1;
-	pSH[26] = fTmpB*fS1;
-	fTmpC = 5.550213908015966f*fZ2 + -0.5045649007287241f;
-	pSH[46] = fTmpC*fC1;
-	pSH[38] = fTmpC*fS1;
-	fC0 = fX*fC1 - fY*fS1;
-	fS0 = fX*fS1 + fY*fC1;
+// order 12
+void SHEval12( const float fX, const float fY, const float fZ, float *pSH )
+{
+	SHKernel<12>::Eval( fX, fY, fZ, SHStore<float>{ pSH } );
+}
 
-	fTmpA = -0.6563820568401703f;
-	pSH[35] = fTmpA*fC0;
-	pSH[25] = fTmpA*fS0;
-	fTmpB = -2.366619162231753f*fZ;
-	pSH[47] = fTmpB*fC0;
-	pSH[37] = fTmpB*fS0;
-	fC1 = fX*fC0 - fY*fS0;
-	fS1 = fX*fS0 + fY*fC0;
+// order 13
+void SHEval13( const float fX, const float fY, const float fZ, float *pSH )
+{
+	SHKernel<13>::Eval( fX, fY, fZ, SHStore<float>{ pSH } );
+}
 
-	fTmpC = 0.6831841051919144f;
-	pSH[48] = fTmpC*fC1;
-	pSH[36] = fTmpC*fS1;
+// order 14
+void SHEval14( const float fX, const float fY, const float fZ, float *pSH )
+{
+	SHKernel<14>::Eval( fX, fY, fZ, SHStore<float>{ pSH } );
 }
 
-// order 8
-void SHEval8( const float fX, const float fY, const float fZ, float *pSH )
+// order 15
+void SHEval15( const float fX, const float fY, const float fZ, float *pSH )
 {
-	float fC0, fC1, fS0, fS1, fTmpA, fTmpB, fTmpC;
-	float fZ2 = fZ*fZ;
+	SHKernel<15>::Eval( fX, fY, fZ, SHStore<float>{ pSH } );
+}
 
-	pSH[0] = 0.2820947917738781f;
-	pSH[2] = 0.4886025119029199f*fZ;
-	pSH[6] = 0.9461746957575601f*fZ2 + -0.3153915652525201f;
-	pSH[12] = fZ*( 1.865881662950577f*fZ2 + -1.119528997770346f );
-	pSH[20] = 1.984313483298443f*fZ*pSH[12] + -1.006230589874905f*pSH[6];
-	pSH[30] = 1.98997487421324f*fZ*pSH[20] + -1.002853072844814f*pSH[12];
-	pSH[42] = 1.993043457183567f*fZ*pSH[30] + -1.001542020962219f*pSH[20];
-	pSH[56] = 1.994891434824135f*fZ*pSH[42] + -1.000927213921958f*pSH[30];
-	fC0 = fX;
-	fS0 = fY;
-
-	fTmpA = -0.48860251190292f;
-	pSH[3] = fTmpA*fC0;
-	pSH[1] = fTmpA*fS0;
-	fTmpB = -1.092548430592079f*fZ;
-	pSH[7] = fTmpB*fC0;
-	pSH[5] = fTmpB*fS0;
-	fTmpC = -2.285228997322329f*fZ2 + 0.4570457994644658f;
-	pSH[13] = fTmpC*fC0;
-	pSH[11] = fTmpC*fS0;
-	fTmpA = fZ*( -4.683325804901025f*fZ2 + 2.007139630671868f );
-	pSH[21] = fTmpA*fC0;
-	pSH[19] = fTmpA*fS0;
-	fTmpB = 2.03100960115899f*fZ*fTmpA + -0.991031208965115f*fTmpC;
-	pSH[31] = fTmpB*fC0;
-	pSH[29] = fTmpB*fS0;
-	fTmpC = 2.021314989237028f*fZ*fTmpB + -0.9952267030562385f*fTmpA;
-	pSH[43] = fTmpC*fC0;
-	pSH[41] = fTmpC*fS0;
-	fTmpA = 2.015564437074638f*fZ*fTmpC + -0.9971550440218319f*fTmpB;
-	pSH[57] = fTmpA*fC0;
-	pSH[55] = fTmpA*fS0;
-	fC1 = fX*fC0 - fY*fS0;
-	fS1 = fX*fS0 + fY*fC0;
-
-	fTmpA = 0.5462742152960395f;
-	pSH[8] = fTmpA*fC1;
-	pSH[4] = fTmpA*fS1;
-	fTmpB = 1.445305721320277f*fZ;
-	pSH[14] = fTmpB*fC1;
-	pSH[10] = fTmpB*fS1;
-	fTmpC = 3.31161143515146f*fZ2 + -0.47308734787878f;
-	pSH[22] = fTmpC*fC1;
-	pSH[18] = fTmpC*fS1;
-	fTmpA = fZ*( 7.190305177459987f*fZ2 + -2.396768392486662f );
-	pSH[32] = fTmpA*fC1;
-	pSH[28] = fTmpA*fS1;
-	fTmpB = 2.11394181566097f*fZ*fTmpA + -0.9736101204623268f*fTmpC;
-	pSH[44] = fTmpB*fC1;
-	pSH[40] = fTmpB*fS1;
-	fTmpC = 2.081665999466133f*fZ*fTmpB + -0.9847319278346618f*fTmpA;
-	pSH[58] = fTmpC*fC1;
-	pSH[54] = fTmpC*fS1;
-	fC0 = fX*fC1 - fY*fS1;
-	fS0 = fX*fS1 + fY*fC1;
-
-	fTmpA = -0.5900435899266435f;
-	pSH[15] = fTmpA*fC0;
-	pSH[9] = fTmpA*fS0;
-	fTmpB = -1.770130769779931f*fZ;
-	pSH[23] = fTmpB*fC0;
-	pSH[17] = fTmpB*fS0;
-	fTmpC = -4.403144694917254f*fZ2 + 0.4892382994352505f;
-	pSH[33] = fTmpC*fC0;
-	pSH[27] = fTmpC*fS0;
-	fTmpA = fZ*( -10.13325785466416f*fZ2 + 2.763615778544771f );
-	pSH[45] = fTmpA*fC0;
-	pSH[39] = fTmpA*fS0;
-	fTmpB = 2.207940216581962f*fZ*fTmpA + -0.959403223600247f*fTmpC;
-	pSH[59] = fTmpB*fC0;
-	pSH[53] = fTmpB*fS0;
-	fC1 = fX*fC0 - fY*fS0;
-	fS1 = fX*fS0 + fY*fC0;
-
-	fTmpA = 0.6258357354491763f;
-	pSH[24] = fTmpA*fC1;
-	pSH[16] = fTmpA*fS1;
-	fTmpB = 2.075662314881041f*fZ;
-	pSH[34] = fTmpB*fC1;
-	pSH[26] = fTmpB*fS1;
-	fTmpC = 5.550213908015966f*fZ2 + -0.5045649007287241f;
-	pSH[46] = fTmpC*fC1;
-	pSH[38] = fTmpC*fS1;
-	fTmpA = fZ*( 13.49180504672677f*fZ2 + -3.113493472321562f );
-	pSH[60] = fTmpA*fC1;
-	pSH[52] = fTmpA*fS1;
-	fC0 = fX*fC1 - fY*fS1;
-	fS0 = fX*fS1 + fY*fC1;
-
-	fTmpA = -0.6563820568401703f;
-	pSH[35] = fTmpA*fC0;
-	pSH[25] = fTmpA*fS0;
-	fTmpB = -2.366619162231753f*fZ;
-	pSH[47] = fTmpB*fC0;
-	pSH[37] = fTmpB*fS0;
-	fTmpC = -6.745902523363385f*fZ2 + 0.5189155787202604f;
-	pSH[61] = fTmpC*fC0;
-	pSH[51] = fTmpC*fS0;
-	fC1 = fX*fC0 - fY*fS0;
-	fS1 = fX*fS0 + fY*fC0;
-
-	fTmpA = 0.6831841051919144f;
-	pSH[48] = fTmpA*fC1;
-	pSH[36] = fTmpA*fS1;
-	fTmpB = 2.645960661801901f*fZ;
-	pSH[62] = fTmpB*fC1;
-	pSH[50] = fTmpB*fS1;
-	fC0 = fX*fC1 - fY*fS1;
-	fS0 = fX*fS1 + fY*fC1;
-
-	fTmpC = -0.7071627325245963f;
-	pSH[63] = fTmpC*fC0;
-	pSH[49] = fTmpC*fS0;
+// order 16
+void SHEval16( const float fX, const float fY, const float fZ, float *pSH )
+{
+	SHKernel<16>::Eval( fX, fY, fZ, SHStore<float>{ pSH } );
 }
 
-// order 9
-void SHEval9( const float fX, const float fY, const float fZ, float *pSH )
+// order 17
+void SHEval17( const float fX, const float fY, const float fZ, float *pSH )
 {
-	float fC0, fC1, fS0, fS1, fTmpA, fTmpB, fTmpC;
-	float fZ2 = fZ*fZ;
-
-	pSH[0] = 0.2820947917738781f;
-	pSH[2] = 0.4886025119029199f*fZ;
-	pSH[6] = 0.9461746957575601f*fZ2 + -0.3153915652525201f;
-	pSH[12] = fZ*( 1.865881662950577f*fZ2 + -1.119528997770346f );
-	pSH[20] = 1.984313483298443f*fZ*pSH[12] + -1.006230589874905f*pSH[6];
-	pSH[30] = 1.98997487421324f*fZ*pSH[20] + -1.002853072844814f*pSH[12];
-	pSH[42] = 1.993043457183567f*fZ*pSH[30] + -1.001542020962219f*pSH[20];
-	pSH[56] = 1.994891434824135f*fZ*pSH[42] + -1.000927213921958f*pSH[30];
-	pSH[72] = 1.996089927833914f*fZ*pSH[56] + -1.000600781069515f*pSH[42];
-	fC0 = fX;
-	fS0 = fY;
-
-	fTmpA = -0.48860251190292f;
-	pSH[3] = fTmpA*fC0;
-	pSH[1] = fTmpA*fS0;
-	fTmpB = -1.092548430592079f*fZ;
-	pSH[7] = fTmpB*fC0;
-	pSH[5] = fTmpB*fS0;
-	fTmpC = -2.285228997322329f*fZ2 + 0.4570457994644658f;
-	pSH[13] = fTmpC*fC0;
-	pSH[11] = fTmpC*fS0;
-	fTmpA = fZ*( -4.683325804901025f*fZ2 + 2.007139630671868f );
-	pSH[21] = fTmpA*fC0;
-	pSH[19] = fTmpA*fS0;
-	fTmpB = 2.03100960115899f*fZ*fTmpA + -0.991031208965115f*fTmpC;
-	pSH[31] = fTmpB*fC0;
-	pSH[29] = fTmpB*fS0;
-	fTmpC = 2.021314989237028f*fZ*fTmpB + -0.9952267030562385f*fTmpA;
-	pSH[43] = fTmpC*fC0;
-	pSH[41] = fTmpC*fS0;
-	fTmpA = 2.015564437074638f*fZ*fTmpC + -0.9971550440218319f*fTmpB;
-	pSH[57] = fTmpA*fC0;
-	pSH[55] = fTmpA*fS0;
-	fTmpB = 2.011869540407391f*fZ*fTmpA + -0.9981668178901745f*fTmpC;
-	pSH[73] = fTmpB*fC0;
-	pSH[71] = fTmpB*fS0;
-	fC1 = fX*fC0 - fY*fS0;
-	fS1 = fX*fS0 + fY*fC0;
-
-	fTmpA = 0.5462742152960395f;
-	pSH[8] = fTmpA*fC1;
-	pSH[4] = fTmpA*fS1;
-	fTmpB = 1.445305721320277f*fZ;
-	pSH[14] = fTmpB*fC1;
-	pSH[10] = fTmpB*fS1;
-	fTmpC = 3.31161143515146f*fZ2 + -0.47308734787878f;
-	pSH[22] = fTmpC*fC1;
-	pSH[18] = fTmpC*fS1;
-	fTmpA = fZ*( 7.190305177459987f*fZ2 + -2.396768392486662f );
-	pSH[32] = fTmpA*fC1;
-	pSH[28] = fTmpA*fS1;
-	fTmpB = 2.11394181566097f*fZ*fTmpA + -0.9736101204623268f*fTmpC;
-	pSH[44] = fTmpB*fC1;
-	pSH[40] = fTmpB*fS1;
-	fTmpC = 2.081665999466133f*fZ*fTmpB + -0.9847319278346618f*fTmpA;
-	pSH[58] = fTmpC*fC1;
-	pSH[54] = fTmpC*fS1;
-	fTmpA = 2.06155281280883f*fZ*fTmpC + -0.9903379376602873f*fTmpB;
-	pSH[74] = fTmpA*fC1;
-	pSH[70] = fTmpA*fS1;
-	fC0 = fX*fC1 - fY*fS1;
-	fS0 = fX*fS1 + fY*fC1;
-
-	fTmpA = -0.5900435899266435f;
-	pSH[15] = fTmpA*fC0;
-	pSH[9] = fTmpA*fS0;
-	fTmpB = -1.770130769779931f*fZ;
-	pSH[23] = fTmpB*fC0;
-	pSH[17] = fTmpB*fS0;
-	fTmpC = -4.403144694917254f*fZ2 + 0.4892382994352505f;
-	pSH[33] = fTmpC*fC0;
-	pSH[27] = fTmpC*fS0;
-	fTmpA = fZ*( -10.13325785466416f*fZ2 + 2.763615778544771f );
-	pSH[45] = fTmpA*fC0;
-	pSH[39] = fTmpA*fS0;
-	fTmpB = 2.207940216581962f*fZ*fTmpA + -0.959403223600247f*fTmpC;
-	pSH[59] = fTmpB*fC0;
-	pSH[53] = fTmpB*fS0;
-	fTmpC = 2.15322168769582f*fZ*fTmpB + -0.9752173865600178f*fTmpA;
-	pSH[75] = fTmpC*fC0;
-	pSH[69] = fTmpC*fS0;
-	fC1 = fX*fC0 - fY*fS0;
-	fS1 = fX*fS0 + fY*fC0;
-
-	fTmpA = 0.6258357354491763f;
-	pSH[24] = fTmpA*fC1;
-	pSH[16] = fTmpA*fS1;
-	fTmpB = 2.075662314881041f*fZ;
-	pSH[34] = fTmpB*fC1;
-	pSH[26] = fTmpB*fS1;
-	fTmpC = 5.550213908015966f*fZ2 + -0.5045649007287241f;
-	pSH[46] = fTmpC*fC1;
-	pSH[38] = fTmpC*fS1;
-	fTmpA = fZ*( 13.49180504672677f*fZ2 + -3.113493472321562f );
-	pSH[60] = fTmpA*fC1;
-	pSH[52] = fTmpA*fS1;
-	fTmpB = 2.304886114323221f*fZ*fTmpA + -0.9481763873554654f*fTmpC;
-	pSH[76] = fTmpB*fC1;
-	pSH[68] = fTmpB*fS1;
-	fC0 = fX*fC1 - fY*fS1;
-	fS0 = fX*fS1 + fY*fC1;
-
-	fTmpA = -0.6563820568401703f;
-	pSH[35] = fTmpA*fC0;
-	pSH[25] = fTmpA*fS0;
-	fTmpB = -2.366619162231753f*fZ;
-	pSH[47] = fTmpB*fC0;
-	pSH[37] = fTmpB*fS0;
-	fTmpC = -6.745902523363385f*fZ2 + 0.5189155787202604f;
-	pSH[61] = fTmpC*fC0;
-	pSH[51] = fTmpC*fS0;
-	fTmpA = fZ*( -17.24955311049054f*fZ2 + 3.449910622098108f );
-	pSH[77] = fTmpA*fC0;
-	pSH[67] = fTmpA*fS0;
-	fC1 = fX*fC0 - fY*fS0;
-	fS1 = fX*fS0 + fY*fC0;
-
-	fTmpA = 0.6831841051919144f;
-	pSH[48] = fTmpA*fC1;
-	pSH[36] = fTmpA*fS1;
-	fTmpB = 2.645960661801901f*fZ;
-	pSH[62] = fTmpB*fC1;
-	pSH[50] = fTmpB*fS1;
-	fTmpC = 7.984991490893139f*fZ2 + -0.5323327660595426f;
-	pSH[78] = fTmpC*fC1;
-	pSH[66] = fTmpC*fS1;
-	fC0 = fX*fC1 - fY*fS1;
-	fS0 = fX*fS1 + fY*fC1;
-
-	fTmpA = -0.7071627325245963f;
-	pSH[63] = fTmpA*fC0;
-	pSH[49] = fTmpA*fS0;
-	fTmpB = -2.91570664069932f*fZ;
-	pSH[79] = fTmpB*fC0;
-	pSH[65] = fTmpB*fS0;
-	fC1 = fX*fC0 - fY*fS0;
-	fS1 = fX*fS0 + fY*fC0;
-
-	fTmpC = 0.72892666017483f;
-	pSH[80] = fTmpC*fC1;
-	pSH[64] = fTmpC*fS1;
+	SHKernel<17>::Eval( fX, fY, fZ, SHStore<float>{ pSH } );
 }
 
-// order 10
-void SHEval10( const float fX, const float fY, const float fZ, float *pSH )
+// order 18
+void SHEval18( const float fX, const float fY, const float fZ, float *pSH )
 {
-	float fC0, fC1, fS0, fS1, fTmpA, fTmpB, fTmpC;
-	float fZ2 = fZ*fZ;
-
-	pSH[0] = 0.2820947917738781f;
-	pSH[2] = 0.4886025119029199f*fZ;
-	pSH[6] = 0.9461746957575601f*fZ2 + -0.3153915652525201f;
-	pSH[12] = fZ*( 1.865881662950577f*fZ2 + -1.119528997770346f );
-	pSH[20] = 1.984313483298443f*fZ*pSH[12] + -1.006230589874905f*pSH[6];
-	pSH[30] = 1.98997487421324f*fZ*pSH[20] + -1.002853072844814f*pSH[12];
-	pSH[42] = 1.993043457183567f*fZ*pSH[30] + -1.001542020962219f*pSH[20];
-	pSH[56] = 1.994891434824135f*fZ*pSH[42] + -1.000927213921958f*pSH[30];
-	pSH[72] = 1.996089927833914f*fZ*pSH[56] + -1.000600781069515f*pSH[42];
-	pSH[90] = 1.996911195067937f*fZ*pSH[72] + -1.000411437993134f*pSH[56];
-	fC0 = fX;
-	fS0 = fY;
-
-	fTmpA = -0.48860251190292f;
-	pSH[3] = fTmpA*fC0;
-	pSH[1] = fTmpA*fS0;
-	fTmpB = -1.092548430592079f*fZ;
-	pSH[7] = fTmpB*fC0;
-	pSH[5] = fTmpB*fS0;
-	fTmpC = -2.285228997322329f*fZ2 + 0.4570457994644658f;
-	pSH[13] = fTmpC*fC0;
-	pSH[11] = fTmpC*fS0;
-	fTmpA = fZ*( -4.683325804901025f*fZ2 + 2.007139630671868f );
-	pSH[21] = fTmpA*fC0;
-	pSH[19] = fTmpA*fS0;
-	fTmpB = 2.03100960115899f*fZ*fTmpA + -0.991031208965115f*fTmpC;
-	pSH[31] = fTmpB*fC0;
-	pSH[29] = fTmpB*fS0;
-	fTmpC = 2.021314989237028f*fZ*fTmpB + -0.9952267030562385f*fTmpA;
-	pSH[43] = fTmpC*fC0;
-	pSH[41] = fTmpC*fS0;
-	fTmpA = 2.015564437074638f*fZ*fTmpC + -0.9971550440218319f*fTmpB;
-	pSH[57] = fTmpA*fC0;
-	pSH[55] = fTmpA*fS0;
-	fTmpB = 2.011869540407391f*fZ*fTmpA + -0.9981668178901745f*fTmpC;
-	pSH[73] = fTmpB*fC0;
-	pSH[71] = fTmpB*fS0;
-	fTmpC = 2.009353129741012f*fZ*fTmpB + -0.9987492177719088f*fTmpA;
-	pSH[91] = fTmpC*fC0;
-	pSH[89] = fTmpC*fS0;
-	fC1 = fX*fC0 - fY*fS0;
-	fS1 = fX*fS0 + fY*fC0;
+	SHKernel<18>::Eval( fX, fY, fZ, SHStore<float>{ pSH } );
+}
 
-	fTmpA = 0.5462742152960395f;
-	pSH[8] = fTmpA*fC1;
-	pSH[4] = fTmpA*fS1;
-	fTmpB = 1.445305721320277f*fZ;
-	pSH[14] = fTmpB*fC1;
-	pSH[10] = fTmpB*fS1;
-	fTmpC = 3.31161143515146f*fZ2 + -0.47308734787878f;
-	pSH[22] = fTmpC*fC1;
-	pSH[18] = fTmpC*fS1;
-	fTmpA = fZ*( 7.190305177459987f*fZ2 + -2.396768392486662f );
-	pSH[32] = fTmpA*fC1;
-	pSH[28] = fTmpA*fS1;
-	fTmpB = 2.11394181566097f*fZ*fTmpA + -0.9736101204623268f*fTmpC;
-	pSH[44] = fTmpB*fC1;
-	pSH[40] = fTmpB*fS1;
-	fTmpC = 2.081665999466133f*fZ*fTmpB + -0.9847319278346618f*fTmpA;
-	pSH[58] = fTmpC*fC1;
-	pSH[54] = fTmpC*fS1;
-	fTmpA = 2.06155281280883f*fZ*fTmpC + -0.9903379376602873f*fTmpB;
-	pSH[74] = fTmpA*fC1;
-	pSH[70] = fTmpA*fS1;
-	fTmpB = 2.048122358357819f*fZ*fTmpA + -0.9934852726704042f*fTmpC;
-	pSH[92] = fTmpB*fC1;
-	pSH[88] = fTmpB*fS1;
-	fC0 = fX*fC1 - fY*fS1;
-	fS0 = fX*fS1 + fY*fC1;
+// order 19
+void SHEval19( const float fX, const float fY, const float fZ, float *pSH )
+{
+	SHKernel<19>::Eval( fX, fY, fZ, SHStore<float>{ pSH } );
+}
 
-	fTmpA = -0.5900435899266435f;
-	pSH[15] = fTmpA*fC0;
-	pSH[9] = fTmpA*fS0;
-	fTmpB = -1.770130769779931f*fZ;
-	pSH[23] = fTmpB*fC0;
-	pSH[17] = fTmpB*fS0;
-	fTmpC = -4.403144694917254f*fZ2 + 0.4892382994352505f;
-	pSH[33] = fTmpC*fC0;
-	pSH[27] = fTmpC*fS0;
-	fTmpA = fZ*( -10.13325785466416f*fZ2 + 2.763615778544771f );
-	pSH[45] = fTmpA*fC0;
-	pSH[39] = fTmpA*fS0;
-	fTmpB = 2.207940216581962f*fZ*fTmpA + -0.959403223600247f*fTmpC;
-	pSH[59] = fTmpB*fC0;
-	pSH[53] = fTmpB*fS0;
-	fTmpC = 2.15322168769582f*fZ*fTmpB + -0.9752173865600178f*fTmpA;
-	pSH[75] = fTmpC*fC0;
-	pSH[69] = fTmpC*fS0;
-	fTmpA = 2.118044171189805f*fZ*fTmpC + -0.9836628449792094f*fTmpB;
-	pSH[93] = fTmpA*fC0;
-	pSH[87] = fTmpA*fS0;
-	fC1 = fX*fC0 - fY*fS0;
-	fS1 = fX*fS0 + fY*fC0;
+// order 20
+void SHEval20( const float fX, const float fY, const float fZ, float *pSH )
+{
+	SHKernel<20>::Eval( fX, fY, fZ, SHStore<float>{ pSH } );
+}
 
-	fTmpA = 0.6258357354491763f;
-	pSH[24] = fTmpA*fC1;
-	pSH[16] = fTmpA*fS1;
-	fTmpB = 2.075662314881041f*fZ;
-	pSH[34] = fTmpB*fC1;
-	pSH[26] = fTmpB*fS1;
-	fTmpC = 5.550213908015966f*fZ2 + -0.5045649007287241f;
-	pSH[46] = fTmpC*fC1;
-	pSH[38] = fTmpC*fS1;
-	fTmpA = fZ*( 13.49180504672677f*fZ2 + -3.113493472321562f );
-	pSH[60] = fTmpA*fC1;
-	pSH[52] = fTmpA*fS1;
-	fTmpB = 2.304886114323221f*fZ*fTmpA + -0.9481763873554654f*fTmpC;
-	pSH[76] = fTmpB*fC1;
-	pSH[68] = fTmpB*fS1;
-	fTmpC = 2.229177150706235f*fZ*fTmpB + -0.9671528397231821f*fTmpA;
-	pSH[94] = fTmpC*fC1;
-	pSH[86] = fTmpC*fS1;
-	fC0 = fX*fC1 - fY*fS1;
-	fS0 = fX*fS1 + fY*fC1;
-
-	fTmpA = -0.6563820568401703f;
-	pSH[35] = fTmpA*fC0;
-	pSH[25] = fTmpA*fS0;
-	fTmpB = -2.366619162231753f*fZ;
-	pSH[47] = fTmpB*fC0;
-	pSH[37] = fTmpB*fS0;
-	fTmpC = -6.745902523363385f*fZ2 + 0.5189155787202604f;
-	pSH[61] = fTmpC*fC0;
-	pSH[51] = fTmpC*fS0;
-	fTmpA = fZ*( -17.24955311049054f*fZ2 + 3.449910622098108f );
-	pSH[77] = fTmpA*fC0;
-	pSH[67] = fTmpA*fS0;
-	fTmpB = 2.401636346922062f*fZ*fTmpA + -0.9392246042043708f*fTmpC;
-	pSH[95] = fTmpB*fC0;
-	pSH[85] = fTmpB*fS0;
-	fC1 = fX*fC0 - fY*fS0;
-	fS1 = fX*fS0 + fY*fC0;
-
-	fTmpA = 0.6831841051919144f;
-	pSH[48] = fTmpA*fC1;
-	pSH[36] = fTmpA*fS1;
-	fTmpB = 2.645960661801901f*fZ;
-	pSH[62] = fTmpB*fC1;
-	pSH[50] = fTmpB*fS1;
-	fTmpC = 7.984991490893139f*fZ2 + -0.5323327660595426f;
-	pSH[78] = fTmpC*fC1;
-	pSH[66] = fTmpC*fS1;
-	fTmpA = fZ*( 21.39289019090864f*fZ2 + -3.775215916042701f );
-	pSH[96] = fTmpA*fC1;
-	pSH[84] = fTmpA*fS1;
-	fC0 = fX*fC1 - fY*fS1;
-	fS0 = fX*fS1 + fY*fC1;
-
-	fTmpA = -0.7071627325245963f;
-	pSH[63] = fTmpA*fC0;
-	pSH[49] = fTmpA*fS0;
-	fTmpB = -2.91570664069932f*fZ;
-	pSH[79] = fTmpB*fC0;
-	pSH[65] = fTmpB*fS0;
-	fTmpC = -9.263393182848905f*fZ2 + 0.5449054813440533f;
-	pSH[97] = fTmpC*fC0;
-	pSH[83] = fTmpC*fS0;
-	fC1 = fX*fC0 - fY*fS0;
-	fS1 = fX*fS0 + fY*fC0;
-
-	fTmpA = 0.72892666017483f;
-	pSH[80] = fTmpA*fC1;
-	pSH[64] = fTmpA*fS1;
-	fTmpB = 3.177317648954698f*fZ;
-	pSH[98] = fTmpB*fC1;
-	pSH[82] = fTmpB*fS1;
-	fC0 = fX*fC1 - fY*fS1;
-	fS0 = fX*fS1 + fY*fC1;
-
-	fTmpC = -0.7489009518531884f;
-	pSH[99] = fTmpC*fC0;
-	pSH[81] = fTmpC*fS0;
-}
-
-// order 11
-void SHEval11( const float fX, const float fY, const float fZ, float *pSH )
-{
-	float fC0, fC1, fS0, fS1, fTmpA, fTmpB, fTmpC;
-	float fZ2 = fZ*fZ;
-
-	pSH[0] = 0.2820947917738781f;
-	pSH[2] = 0.4886025119029199f*fZ;
-	pSH[6] = 0.9461746957575601f*fZ2 + -0.3153915652525201f;
-	pSH[12] = fZ*( 1.865881662950577f*fZ2 + -1.119528997770346f );
-	pSH[20] = 1.984313483298443f*fZ*pSH[12] + -1.006230589874905f*pSH[6];
-	pSH[30] = 1.98997487421324f*fZ*pSH[20] + -1.002853072844814f*pSH[12];
-	pSH[42] = 1.993043457183567f*fZ*pSH[30] + -1.001542020962219f*pSH[20];
-	pSH[56] = 1.994891434824135f*fZ*pSH[42] + -1.000927213921958f*pSH[30];
-	pSH[72] = 1.996089927833914f*fZ*pSH[56] + -1.000600781069515f*pSH[42];
-	pSH[90] = 1.996911195067937f*fZ*pSH[72] + -1.000411437993134f*pSH[56];
-	pSH[110] = 1.997498435543818f*fZ*pSH[90] + -1.00029407440718f*pSH[72];
-	fC0 = fX;
-	fS0 = fY;
-
-	fTmpA = -0.48860251190292f;
-	pSH[3] = fTmpA*fC0;
-	pSH[1] = fTmpA*fS0;
-	fTmpB = -1.092548430592079f*fZ;
-	pSH[7] = fTmpB*fC0;
-	pSH[5] = fTmpB*fS0;
-	fTmpC = -2.285228997322329f*fZ2 + 0.4570457994644658f;
-	pSH[13] = fTmpC*fC0;
-	pSH[11] = fTmpC*fS0;
-	fTmpA = fZ*( -4.683325804901025f*fZ2 + 2.007139630671868f );
-	pSH[21] = fTmpA*fC0;
-	pSH[19] = fTmpA*fS0;
-	fTmpB = 2.03100960115899f*fZ*fTmpA + -0.991031208965115f*fTmpC;
-	pSH[31] = fTmpB*fC0;
-	pSH[29] = fTmpB*fS0;
-	fTmpC = 2.021314989237028f*fZ*fTmpB + -0.9952267030562385f*fTmpA;
-	pSH[43] = fTmpC*fC0;
-	pSH[41] = fTmpC*fS0;
-	fTmpA = 2.015564437074638f*fZ*fTmpC + -0.9971550440218319f*fTmpB;
-	pSH[57] = fTmpA*fC0;
-	pSH[55] = fTmpA*fS0;
-	fTmpB = 2.011869540407391f*fZ*fTmpA + -0.9981668178901745f*fTmpC;
-	pSH[73] = fTmpB*fC0;
-	pSH[71] = fTmpB*fS0;
-	fTmpC = 2.009353129741012f*fZ*fTmpB + -0.9987492177719088f*fTmpA;
-	pSH[91] = fTmpC*fC0;
-	pSH[89] = fTmpC*fS0;
-	fTmpA = 2.007561463642653f*fZ*fTmpC + -0.9991083368712843f*fTmpB;
-	pSH[111] = fTmpA*fC0;
-	pSH[109] = fTmpA*fS0;
-	fC1 = fX*fC0 - fY*fS0;
-	fS1 = fX*fS0 + fY*fC0;
-
-	fTmpA = 0.5462742152960395f;
-	pSH[8] = fTmpA*fC1;
-	pSH[4] = fTmpA*fS1;
-	fTmpB = 1.445305721320277f*fZ;
-	pSH[14] = fTmpB*fC1;
-	pSH[10] = fTmpB*fS1;
-	fTmpC = 3.31161143515146f*fZ2 + -0.47308734787878f;
-	pSH[22] = fTmpC*fC1;
-	pSH[18] = fTmpC*fS1;
-	fTmpA = fZ*( 7.190305177459987f*fZ2 + -2.396768392486662f );
-	pSH[32] = fTmpA*fC1;
-	pSH[28] = fTmpA*fS1;
-	fTmpB = 2.11394181566097f*fZ*fTmpA + -0.9736101204623268f*fTmpC;
-	pSH[44] = fTmpB*fC1;
-	pSH[40] = fTmpB*fS1;
-	fTmpC = 2.081665999466133f*fZ*fTmpB + -0.9847319278346618f*fTmpA;
-	pSH[58] = fTmpC*fC1;
-	pSH[54] = fTmpC*fS1;
-	fTmpA = 2.06155281280883f*fZ*fTmpC + -0.9903379376602873f*fTmpB;
-	pSH[74] = fTmpA*fC1;
-	pSH[70] = fTmpA*fS1;
-	fTmpB = 2.048122358357819f*fZ*fTmpA + -0.9934852726704042f*fTmpC;
-	pSH[92] = fTmpB*fC1;
-	pSH[88] = fTmpB*fS1;
-	fTmpC = 2.038688303787511f*fZ*fTmpB + -0.9953938032404119f*fTmpA;
-	pSH[112] = fTmpC*fC1;
-	pSH[108] = fTmpC*fS1;
-	fC0 = fX*fC1 - fY*fS1;
-	fS0 = fX*fS1 + fY*fC1;
-
-	fTmpA = -0.5900435899266435f;
-	pSH[15] = fTmpA*fC0;
-	pSH[9] = fTmpA*fS0;
-	fTmpB = -1.770130769779931f*fZ;
-	pSH[23] = fTmpB*fC0;
-	pSH[17] = fTmpB*fS0;
-	fTmpC = -4.403144694917254f*fZ2 + 0.4892382994352505f;
-	pSH[33] = fTmpC*fC0;
-	pSH[27] = fTmpC*fS0;
-	fTmpA = fZ*( -10.13325785466416f*fZ2 + 2.763615778544771f );
-	pSH[45] = fTmpA*fC0;
-	pSH[39] = fTmpA*fS0;
-	fTmpB = 2.207940216581962f*fZ*fTmpA + -0.959403223600247f*fTmpC;
-	pSH[59] = fTmpB*fC0;
-	pSH[53] = fTmpB*fS0;
-	fTmpC = 2.15322168769582f*fZ*fTmpB + -0.9752173865600178f*fTmpA;
-	pSH[75] = fTmpC*fC0;
-	pSH[69] = fTmpC*fS0;
-	fTmpA = 2.118044171189805f*fZ*fTmpC + -0.9836628449792094f*fTmpB;
-	pSH[93] = fTmpA*fC0;
-	pSH[87] = fTmpA*fS0;
-	fTmpB = 2.093947321356338f*fZ*fTmpA + -0.9886230654859614f*fTmpC;
-	pSH[113] = fTmpB*fC0;
-	pSH[107] = fTmpB*fS0;
-	fC1 = fX*fC0 - fY*fS0;
-	fS1 = fX*fS0 + fY*fC0;
-
-	fTmpA = 0.6258357354491763f;
-	pSH[24] = fTmpA*fC1;
-	pSH[16] = fTmpA*fS1;
-	fTmpB = 2.075662314881041f*fZ;
-	pSH[34] = fTmpB*fC1;
-	pSH[26] = fTmpB*fS1;
-	fTmpC = 5.550213908015966f*fZ2 + -0.5045649007287241f;
-	pSH[46] = fTmpC*fC1;
-	pSH[38] = fTmpC*fS1;
-	fTmpA = fZ*( 13.49180504672677f*fZ2 + -3.113493472321562f );
-	pSH[60] = fTmpA*fC1;
-	pSH[52] = fTmpA*fS1;
-	fTmpB = 2.304886114323221f*fZ*fTmpA + -0.9481763873554654f*fTmpC;
-	pSH[76] = fTmpB*fC1;
-	pSH[68] = fTmpB*fS1;
-	fTmpC = 2.229177150706235f*fZ*fTmpB + -0.9671528397231821f*fTmpA;
-	pSH[94] = fTmpC*fC1;
-	pSH[86] = fTmpC*fS1;
-	fTmpA = 2.179449471770337f*fZ*fTmpC + -0.9776923610938036f*fTmpB;
-	pSH[114] = fTmpA*fC1;
-	pSH[106] = fTmpA*fS1;
-	fC0 = fX*fC1 - fY*fS1;
-	fS0 = fX*fS1 + fY*fC1;
-
-	fTmpA = -0.6563820568401703f;
-	pSH[35] = fTmpA*fC0;
-	pSH[25] = fTmpA*fS0;
-	fTmpB = -2.366619162231753f*fZ;
-	pSH[47] = fTmpB*fC0;
-	pSH[37] = fTmpB*fS0;
-	fTmpC = -6.745902523363385f*fZ2 + 0.5189155787202604f;
-	pSH[61] = fTmpC*fC0;
-	pSH[51] = fTmpC*fS0;
-	fTmpA = fZ*( -17.24955311049054f*fZ2 + 3.449910622098108f );
-	pSH[77] = fTmpA*fC0;
-	pSH[67] = fTmpA*fS0;
-	fTmpB = 2.401636346922062f*fZ*fTmpA + -0.9392246042043708f*fTmpC;
-	pSH[95] = fTmpB*fC0;
-	pSH[85] = fTmpB*fS0;
-	fTmpC = 2.306512518934159f*fZ*fTmpB + -0.9603920767980496f*fTmpA;
-	pSH[115] = fTmpC*fC0;
-	pSH[105] = fTmpC*fS0;
-	fC1 = fX*fC0 - fY*fS0;
-	fS1 = fX*fS0 + fY*fC0;
-
-	fTmpA = 0.6831841051919144f;
-	pSH[48] = fTmpA*fC1;
-	pSH[36] = fTmpA*fS1;
-	fTmpB = 2.645960661801901f*fZ;
-	pSH[62] = fTmpB*fC1;
-	pSH[50] = fTmpB*fS1;
-	fTmpC = 7.984991490893139f*fZ2 + -0.5323327660595426f;
-	pSH[78] = fTmpC*fC1;
-	pSH[66] = fTmpC*fS1;
-	fTmpA = fZ*( 21.39289019090864f*fZ2 + -3.775215916042701f );
-	pSH[96] = fTmpA*fC1;
-	pSH[84] = fTmpA*fS1;
-	fTmpB = 2.496873044429773f*fZ*fTmpA + -0.9319689782769534f*fTmpC;
-	pSH[116] = fTmpB*fC1;
-	pSH[104] = fTmpB*fS1;
-	fC0 = fX*fC1 - fY*fS1;
-	fS0 = fX*fS1 + fY*fC1;
-
-	fTmpA = -0.7071627325245963f;
-	pSH[63] = fTmpA*fC0;
-	pSH[49] = fTmpA*fS0;
-	fTmpB = -2.91570664069932f*fZ;
-	pSH[79] = fTmpB*fC0;
-	pSH[65] = fTmpB*fS0;
-	fTmpC = -9.263393182848905f*fZ2 + 0.5449054813440533f;
-	pSH[97] = fTmpC*fC0;
-	pSH[83] = fTmpC*fS0;
-	fTmpA = fZ*( -25.9102413133663f*fZ2 + 4.091090733689416f );
-	pSH[117] = fTmpA*fC0;
-	pSH[103] = fTmpA*fS0;
-	fC1 = fX*fC0 - fY*fS0;
-	fS1 = fX*fS0 + fY*fC0;
-
-	fTmpA = 0.72892666017483f;
-	pSH[80] = fTmpA*fC1;
-	pSH[64] = fTmpA*fS1;
-	fTmpB = 3.177317648954698f*fZ;
-	pSH[98] = fTmpB*fC1;
-	pSH[82] = fTmpB*fS1;
-	fTmpC = 10.57781172168795f*fZ2 + -0.5567269327204184f;
-	pSH[118] = fTmpC*fC1;
-	pSH[102] = fTmpC*fS1;
-	fC0 = fX*fC1 - fY*fS1;
-	fS0 = fX*fS1 + fY*fC1;
-
-	fTmpA = -0.7489009518531884f;
-	pSH[99] = fTmpA*fC0;
-	pSH[81] = fTmpA*fS0;
-	fTmpB = -3.431895299891715f*fZ;
-	pSH[119] = fTmpB*fC0;
-	pSH[101] = fTmpB*fS0;
-	fC1 = fX*fC0 - fY*fS0;
-	fS1 = fX*fS0 + fY*fC0;
-
-	fTmpC = 0.7673951182219901f;
-	pSH[120] = fTmpC*fC1;
-	pSH[100] = fTmpC*fS1;
-}
-
-// order 12
-void SHEval12( const float fX, const float fY, const float fZ, float *pSH )
+// order 21
+void SHEval21( const float fX, const float fY, const float fZ, float *pSH )
 {
-	float fC0, fC1, fS0, fS1, fTmpA, fTmpB, fTmpC;
-	float fZ2 = fZ*fZ;
-
-	pSH[0] = 0.2820947917738781f;
-	pSH[2] = 0.4886025119029199f*fZ;
-	pSH[6] = 0.9461746957575601f*fZ2 + -0.3153915652525201f;
-	pSH[12] = fZ*( 1.865881662950577f*fZ2 + -1.119528997770346f );
-	pSH[20] = 1.984313483298443f*fZ*pSH[12] + -1.006230589874905f*pSH[6];
-	pSH[30] = 1.98997487421324f*fZ*pSH[20] + -1.002853072844814f*pSH[12];
-	pSH[42] = 1.993043457183567f*fZ*pSH[30] + -1.001542020962219f*pSH[20];
-	pSH[56] = 1.994891434824135f*fZ*pSH[42] + -1.000927213921958f*pSH[30];
-	pSH[72] = 1.996089927833914f*fZ*pSH[56] + -1.000600781069515f*pSH[42];
-	pSH[90] = 1.996911195067937f*fZ*pSH[72] + -1.000411437993134f*pSH[56];
-	pSH[110] = 1.997498435543818f*fZ*pSH[90] + -1.00029407440718f*pSH[72];
-	pSH[132] = 1.997932815985082f*fZ*pSH[110] + -1.000217462218511f*pSH[90];
-	fC0 = fX;
-	fS0 = fY;
-
-	fTmpA = -0.48860251190292f;
-	pSH[3] = fTmpA*fC0;
-	pSH[1] = fTmpA*fS0;
-	fTmpB = -1.092548430592079f*fZ;
-	pSH[7] = fTmpB*fC0;
-	pSH[5] = fTmpB*fS0;
-	fTmpC = -2.285228997322329f*fZ2 + 0.4570457994644658f;
-	pSH[13] = fTmpC*fC0;
-	pSH[11] = fTmpC*fS0;
-	fTmpA = fZ*( -4.683325804901025f*fZ2 + 2.007139630671868f );
-	pSH[21] = fTmpA*fC0;
-	pSH[19] = fTmpA*fS0;
-	fTmpB = 2.03100960115899f*fZ*fTmpA + -0.991031208965115f*fTmpC;
-	pSH[31] = fTmpB*fC0;
-	pSH[29] = fTmpB*fS0;
-	fTmpC = 2.021314989237028f*fZ*fTmpB + -0.9952267030562385f*fTmpA;
-	pSH[43] = fTmpC*fC0;
-	pSH[41] = fTmpC*fS0;
-	fTmpA = 2.015564437074638f*fZ*fTmpC + -0.9971550440218319f*fTmpB;
-	pSH[57] = fTmpA*fC0;
-	pSH[55] = fTmpA*fS0;
-	fTmpB = 2.011869540407391f*fZ*fTmpA + -0.9981668178901745f*fTmpC;
-	pSH[73] = fTmpB*fC0;
-	pSH[71] = fTmpB*fS0;
-	fTmpC = 2.009353129741012f*fZ*fTmpB + -0.9987492177719088f*fTmpA;
-	pSH[91] = fTmpC*fC0;
-	pSH[89] = fTmpC*fS0;
-	fTmpA = 2.007561463642653f*fZ*fTmpC + -0.9991083368712843f*fTmpB;
-	pSH[111] = fTmpA*fC0;
-	pSH[109] = fTmpA*fS0;
-	fTmpB = 2.006240264773888f*fZ*fTmpA + -0.9993418887079215f*fTmpC;
-	pSH[133] = fTmpB*fC0;
-	pSH[131] = fTmpB*fS0;
-	fC1 = fX*fC0 - fY*fS0;
-	fS1 = fX*fS0 + fY*fC0;
-
-	fTmpA = 0.5462742152960395f;
-	pSH[8] = fTmpA*fC1;
-	pSH[4] = fTmpA*fS1;
-	fTmpB = 1.445305721320277f*fZ;
-	pSH[14] = fTmpB*fC1;
-	pSH[10] = fTmpB*fS1;
-	fTmpC = 3.31161143515146f*fZ2 + -0.47308734787878f;
-	pSH[22] = fTmpC*fC1;
-	pSH[18] = fTmpC*fS1;
-	fTmpA = fZ*( 7.190305177459987f*fZ2 + -2.396768392486662f );
-	pSH[32] = fTmpA*fC1;
-	pSH[28] = fTmpA*fS1;
-	fTmpB = 2.11394181566097f*fZ*fTmpA + -0.9736101204623268f*fTmpC;
-	pSH[44] = fTmpB*fC1;
-	pSH[40] = fTmpB*fS1;
-	fTmpC = 2.081665999466133f*fZ*fTmpB + -0.9847319278346618f*fTmpA;
-	pSH[58] = fTmpC*fC1;
-	pSH[54] = fTmpC*fS1;
-	fTmpA = 2.06155281280883f*fZ*fTmpC + -0.9903379376602873f*fTmpB;
-	pSH[74] = fTmpA*fC1;
-	pSH[70] = fTmpA*fS1;
-	fTmpB = 2.048122358357819f*fZ*fTmpA + -0.9934852726704042f*fTmpC;
-	pSH[92] = fTmpB*fC1;
-	pSH[88] = fTmpB*fS1;
-	fTmpC = 2.038688303787511f*fZ*fTmpB + -0.9953938032404119f*fTmpA;
-	pSH[112] = fTmpC*fC1;
-	pSH[108] = fTmpC*fS1;
-	fTmpA = 2.031798495964875f*fZ*fTmpC + -0.9966204702259603f*fTmpB;
-	pSH[134] = fTmpA*fC1;
-	pSH[130] = fTmpA*fS1;
-	fC0 = fX*fC1 - fY*fS1;
-	fS0 = fX*fS1 + fY*fC1;
-
-	fTmpA = -0.5900435899266435f;
-	pSH[15] = fTmpA*fC0;
-	pSH[9] = fTmpA*fS0;
-	fTmpB = -1.770130769779931f*fZ;
-	pSH[23] = fTmpB*fC0;
-	pSH[17] = fTmpB*fS0;
-	fTmpC = -4.403144694917254f*fZ2 + 0.4892382994352505f;
-	pSH[33] = fTmpC*fC0;
-	pSH[27] = fTmpC*fS0;
-	fTmpA = fZ*( -10.13325785466416f*fZ2 + 2.763615778544771f );
-	pSH[45] = fTmpA*fC0;
-	pSH[39] = fTmpA*fS0;
-	fTmpB = 2.207940216581962f*fZ*fTmpA + -0.959403223600247f*fTmpC;
-	pSH[59] = fTmpB*fC0;
-	pSH[53] = fTmpB*fS0;
-	fTmpC = 2.15322168769582f*fZ*fTmpB + -0.9752173865600178f*fTmpA;
-	pSH[75] = fTmpC*fC0;
-	pSH[69] = fTmpC*fS0;
-	fTmpA = 2.118044171189805f*fZ*fTmpC + -0.9836628449792094f*fTmpB;
-	pSH[93] = fTmpA*fC0;
-	pSH[87] = fTmpA*fS0;
-	fTmpB = 2.093947321356338f*fZ*fTmpA + -0.9886230654859614f*fTmpC;
-	pSH[113] = fTmpB*fC0;
-	pSH[107] = fTmpB*fS0;
-	fTmpC = 2.076655965729519f*fZ*fTmpB + -0.9917422203269092f*fTmpA;
-	pSH[135] = fTmpC*fC0;
-	pSH[129] = fTmpC*fS0;
-	fC1 = fX*fC0 - fY*fS0;
-	fS1 = fX*fS0 + fY*fC0;
-
-	fTmpA = 0.6258357354491763f;
-	pSH[24] = fTmpA*fC1;
-	pSH[16] = fTmpA*fS1;
-	fTmpB = 2.075662314881041f*fZ;
-	pSH[34] = fTmpB*fC1;
-	pSH[26] = fTmpB*fS1;
-	fTmpC = 5.550213908015966f*fZ2 + -0.5045649007287241f;
-	pSH[46] = fTmpC*fC1;
-	pSH[38] = fTmpC*fS1;
-	fTmpA = fZ*( 13.49180504672677f*fZ2 + -3.113493472321562f );
-	pSH[60] = fTmpA*fC1;
-	pSH[52] = fTmpA*fS1;
-	fTmpB = 2.304886114323221f*fZ*fTmpA + -0.9481763873554654f*fTmpC;
-	pSH[76] = fTmpB*fC1;
-	pSH[68] = fTmpB*fS1;
-	fTmpC = 2.229177150706235f*fZ*fTmpB + -0.9671528397231821f*fTmpA;
-	pSH[94] = fTmpC*fC1;
-	pSH[86] = fTmpC*fS1;
-	fTmpA = 2.179449471770337f*fZ*fTmpC + -0.9776923610938036f*fTmpB;
-	pSH[114] = fTmpA*fC1;
-	pSH[106] = fTmpA*fS1;
-	fTmpB = 2.144761058952722f*fZ*fTmpA + -0.9840838646332836f*fTmpC;
-	pSH[136] = fTmpB*fC1;
-	pSH[128] = fTmpB*fS1;
-	fC0 = fX*fC1 - fY*fS1;
-	fS0 = fX*fS1 + fY*fC1;
-
-	fTmpA = -0.6563820568401703f;
-	pSH[35] = fTmpA*fC0;
-	pSH[25] = fTmpA*fS0;
-	fTmpB = -2.366619162231753f*fZ;
-	pSH[47] = fTmpB*fC0;
-	pSH[37] = fTmpB*fS0;
-	fTmpC = -6.745902523363385f*fZ2 + 0.5189155787202604f;
-	pSH[61] = fTmpC*fC0;
-	pSH[51] = fTmpC*fS0;
-	fTmpA = fZ*( -17.24955311049054f*fZ2 + 3.449910622098108f );
-	pSH[77] = fTmpA*fC0;
-	pSH[67] = fTmpA*fS0;
-	fTmpB = 2.401636346922062f*fZ*fTmpA + -0.9392246042043708f*fTmpC;
-	pSH[95] = fTmpB*fC0;
-	pSH[85] = fTmpB*fS0;
-	fTmpC = 2.306512518934159f*fZ*fTmpB + -0.9603920767980496f*fTmpA;
-	pSH[115] = fTmpC*fC0;
-	pSH[105] = fTmpC*fS0;
-	fTmpA = 2.243044805615795f*fZ*fTmpC + -0.9724832565193738f*fTmpB;
-	pSH[137] = fTmpA*fC0;
-	pSH[127] = fTmpA*fS0;
-	fC1 = fX*fC0 - fY*fS0;
-	fS1 = fX*fS0 + fY*fC0;
-
-	fTmpA = 0.6831841051919144f;
-	pSH[48] = fTmpA*fC1;
-	pSH[36] = fTmpA*fS1;
-	fTmpB = 2.645960661801901f*fZ;
-	pSH[62] = fTmpB*fC1;
-	pSH[50] = fTmpB*fS1;
-	fTmpC = 7.984991490893139f*fZ2 + -0.5323327660595426f;
-	pSH[78] = fTmpC*fC1;
-	pSH[66] = fTmpC*fS1;
-	fTmpA = fZ*( 21.39289019090864f*fZ2 + -3.775215916042701f );
-	pSH[96] = fTmpA*fC1;
-	pSH[84] = fTmpA*fS1;
-	fTmpB = 2.496873044429773f*fZ*fTmpA + -0.9319689782769534f*fTmpC;
-	pSH[116] = fTmpB*fC1;
-	pSH[104] = fTmpB*fS1;
-	fTmpC = 2.383768642544085f*fZ*fTmpB + -0.9547015807880142f*fTmpA;
-	pSH[138] = fTmpC*fC1;
-	pSH[126] = fTmpC*fS1;
-	fC0 = fX*fC1 - fY*fS1;
-	fS0 = fX*fS1 + fY*fC1;
-
-	fTmpA = -0.7071627325245963f;
-	pSH[63] = fTmpA*fC0;
-	pSH[49] = fTmpA*fS0;
-	fTmpB = -2.91570664069932f*fZ;
-	pSH[79] = fTmpB*fC0;
-	pSH[65] = fTmpB*fS0;
-	fTmpC = -9.263393182848905f*fZ2 + 0.5449054813440533f;
-	pSH[97] = fTmpC*fC0;
-	pSH[83] = fTmpC*fS0;
-	fTmpA = fZ*( -25.9102413133663f*fZ2 + 4.091090733689416f );
-	pSH[117] = fTmpA*fC0;
-	pSH[103] = fTmpA*fS0;
-	fTmpB = 2.590045044653342f*fZ*fTmpA + -0.9259892765852515f*fTmpC;
-	pSH[139] = fTmpB*fC0;
-	pSH[125] = fTmpB*fS0;
-	fC1 = fX*fC0 - fY*fS0;
-	fS1 = fX*fS0 + fY*fC0;
-
-	fTmpA = 0.72892666017483f;
-	pSH[80] = fTmpA*fC1;
-	pSH[64] = fTmpA*fS1;
-	fTmpB = 3.177317648954698f*fZ;
-	pSH[98] = fTmpB*fC1;
-	pSH[82] = fTmpB*fS1;
-	fTmpC = 10.57781172168795f*fZ2 + -0.5567269327204184f;
-	pSH[118] = fTmpC*fC1;
-	pSH[102] = fTmpC*fS1;
-	fTmpA = fZ*( 30.79157970335749f*fZ2 + -4.398797100479641f );
-	pSH[140] = fTmpA*fC1;
-	pSH[124] = fTmpA*fS1;
-	fC0 = fX*fC1 - fY*fS1;
-	fS0 = fX*fS1 + fY*fC1;
-
-	fTmpA = -0.7489009518531884f;
-	pSH[99] = fTmpA*fC0;
-	pSH[81] = fTmpA*fS0;
-	fTmpB = -3.431895299891715f*fZ;
-	pSH[119] = fTmpB*fC0;
-	pSH[101] = fTmpB*fS0;
-	fTmpC = -11.92552753945219f*fZ2 + 0.5678822637834374f;
-	pSH[141] = fTmpC*fC0;
-	pSH[123] = fTmpC*fS0;
-	fC1 = fX*fC0 - fY*fS0;
-	fS1 = fX*fS0 + fY*fC0;
-
-	fTmpA = 0.7673951182219901f;
-	pSH[120] = fTmpA*fC1;
-	pSH[100] = fTmpA*fS1;
-	fTmpB = 3.680297698805312f*fZ;
-	pSH[142] = fTmpB*fC1;
-	pSH[122] = fTmpB*fS1;
-	fC0 = fX*fC1 - fY*fS1;
-	fS0 = fX*fS1 + fY*fC1;
-
-	fTmpC = -0.7846421057871971f;
-	pSH[143] = fTmpC*fC0;
-	pSH[121] = fTmpC*fS0;
-}
-
-// order 13
-void SHEval13( const float fX, const float fY, const float fZ, float *pSH )
-{
-	float fC0, fC1, fS0, fS1, fTmpA, fTmpB, fTmpC;
-	float fZ2 = fZ*fZ;
-
-	pSH[0] = 0.2820947917738781f;
-	pSH[2] = 0.4886025119029199f*fZ;
-	pSH[6] = 0.9461746957575601f*fZ2 + -0.3153915652525201f;
-	pSH[12] = fZ*( 1.865881662950577f*fZ2 + -1.119528997770346f );
-	pSH[20] = 1.984313483298443f*fZ*pSH[12] + -1.006230589874905f*pSH[6];
-	pSH[30] = 1.98997487421324f*fZ*pSH[20] + -1.002853072844814f*pSH[12];
-	pSH[42] = 1.993043457183567f*fZ*pSH[30] + -1.001542020962219f*pSH[20];
-	pSH[56] = 1.994891434824135f*fZ*pSH[42] + -1.000927213921958f*pSH[30];
-	pSH[72] = 1.996089927833914f*fZ*pSH[56] + -1.000600781069515f*pSH[42];
-	pSH[90] = 1.996911195067937f*fZ*pSH[72] + -1.000411437993134f*pSH[56];
-	pSH[110] = 1.997498435543818f*fZ*pSH[90] + -1.00029407440718f*pSH[72];
-	pSH[132] = 1.997932815985082f*fZ*pSH[110] + -1.000217462218511f*pSH[90];
-	pSH[156] = 1.998263134713633f*fZ*pSH[132] + -1.000165330248298f*pSH[110];
-	fC0 = fX;
-	fS0 = fY;
-
-	fTmpA = -0.48860251190292f;
-	pSH[3] = fTmpA*fC0;
-	pSH[1] = fTmpA*fS0;
-	fTmpB = -1.092548430592079f*fZ;
-	pSH[7] = fTmpB*fC0;
-	pSH[5] = fTmpB*fS0;
-	fTmpC = -2.285228997322329f*fZ2 + 0.4570457994644658f;
-	pSH[13] = fTmpC*fC0;
-	pSH[11] = fTmpC*fS0;
-	fTmpA = fZ*( -4.683325804901025f*fZ2 + 2.007139630671868f );
-	pSH[21] = fTmpA*fC0;
-	pSH[19] = fTmpA*fS0;
-	fTmpB = 2.03100960115899f*fZ*fTmpA + -0.991031208965115f*fTmpC;
-	pSH[31] = fTmpB*fC0;
-	pSH[29] = fTmpB*fS0;
-	fTmpC = 2.021314989237028f*fZ*fTmpB + -0.9952267030562385f*fTmpA;
-	pSH[43] = fTmpC*fC0;
-	pSH[41] = fTmpC*fS0;
-	fTmpA = 2.015564437074638f*fZ*fTmpC + -0.9971550440218319f*fTmpB;
-	pSH[57] = fTmpA*fC0;
-	pSH[55] = fTmpA*fS0;
-	fTmpB = 2.011869540407391f*fZ*fTmpA + -0.9981668178901745f*fTmpC;
-	pSH[73] = fTmpB*fC0;
-	pSH[71] = fTmpB*fS0;
-	fTmpC = 2.009353129741012f*fZ*fTmpB + -0.9987492177719088f*fTmpA;
-	pSH[91] = fTmpC*fC0;
-	pSH[89] = fTmpC*fS0;
-	fTmpA = 2.007561463642653f*fZ*fTmpC + -0.9991083368712843f*fTmpB;
-	pSH[111] = fTmpA*fC0;
-	pSH[109] = fTmpA*fS0;
-	fTmpB = 2.006240264773888f*fZ*fTmpA + -0.9993418887079215f*fTmpC;
-	pSH[133] = fTmpB*fC0;
-	pSH[131] = fTmpB*fS0;
-	fTmpC = 2.005237896355199f*fZ*fTmpB + -0.9995003746877732f*fTmpA;
-	pSH[157] = fTmpC*fC0;
-	pSH[155] = fTmpC*fS0;
-	fC1 = fX*fC0 - fY*fS0;
-	fS1 = fX*fS0 + fY*fC0;
-
-	fTmpA = 0.5462742152960395f;
-	pSH[8] = fTmpA*fC1;
-	pSH[4] = fTmpA*fS1;
-	fTmpB = 1.445305721320277f*fZ;
-	pSH[14] = fTmpB*fC1;
-	pSH[10] = fTmpB*fS1;
-	fTmpC = 3.31161143515146f*fZ2 + -0.47308734787878f;
-	pSH[22] = fTmpC*fC1;
-	pSH[18] = fTmpC*fS1;
-	fTmpA = fZ*( 7.190305177459987f*fZ2 + -2.396768392486662f );
-	pSH[32] = fTmpA*fC1;
-	pSH[28] = fTmpA*fS1;
-	fTmpB = 2.11394181566097f*fZ*fTmpA + -0.9736101204623268f*fTmpC;
-	pSH[44] = fTmpB*fC1;
-	pSH[40] = fTmpB*fS1;
-	fTmpC = 2.081665999466133f*fZ*fTmpB + -0.9847319278346618f*fTmpA;
-	pSH[58] = fTmpC*fC1;
-	pSH[54] = fTmpC*fS1;
-	fTmpA = 2.06155281280883f*fZ*fTmpC + -0.9903379376602873f*fTmpB;
-	pSH[74] = fTmpA*fC1;
-	pSH[70] = fTmpA*fS1;
-	fTmpB = 2.048122358357819f*fZ*fTmpA + -0.9934852726704042f*fTmpC;
-	pSH[92] = fTmpB*fC1;
-	pSH[88] = fTmpB*fS1;
-	fTmpC = 2.038688303787511f*fZ*fTmpB + -0.9953938032404119f*fTmpA;
-	pSH[112] = fTmpC*fC1;
-	pSH[108] = fTmpC*fS1;
-	fTmpA = 2.031798495964875f*fZ*fTmpC + -0.9966204702259603f*fTmpB;
-	pSH[134] = fTmpA*fC1;
-	pSH[130] = fTmpA*fS1;
-	fTmpB = 2.026608708444444f*fZ*fTmpA + -0.9974457174120671f*fTmpC;
-	pSH[158] = fTmpB*fC1;
-	pSH[154] = fTmpB*fS1;
-	fC0 = fX*fC1 - fY*fS1;
-	fS0 = fX*fS1 + fY*fC1;
-
-	fTmpA = -0.5900435899266435f;
-	pSH[15] = fTmpA*fC0;
-	pSH[9] = fTmpA*fS0;
-	fTmpB = -1.770130769779931f*fZ;
-	pSH[23] = fTmpB*fC0;
-	pSH[17] = fTmpB*fS0;
-	fTmpC = -4.403144694917254f*fZ2 + 0.4892382994352505f;
-	pSH[33] = fTmpC*fC0;
-	pSH[27] = fTmpC*fS0;
-	fTmpA = fZ*( -10.13325785466416f*fZ2 + 2.763615778544771f );
-	pSH[45] = fTmpA*fC0;
-	pSH[39] = fTmpA*fS0;
-	fTmpB = 2.207940216581962f*fZ*fTmpA + -0.959403223600247f*fTmpC;
-	pSH[59] = fTmpB*fC0;
-	pSH[53] = fTmpB*fS0;
-	fTmpC = 2.15322168769582f*fZ*fTmpB + -0.9752173865600178f*fTmpA;
-	pSH[75] = fTmpC*fC0;
-	pSH[69] = fTmpC*fS0;
-	fTmpA = 2.118044171189805f*fZ*fTmpC + -0.9836628449792094f*fTmpB;
-	pSH[93] = fTmpA*fC0;
-	pSH[87] = fTmpA*fS0;
-	fTmpB = 2.093947321356338f*fZ*fTmpA + -0.9886230654859614f*fTmpC;
-	pSH[113] = fTmpB*fC0;
-	pSH[107] = fTmpB*fS0;
-	fTmpC = 2.076655965729519f*fZ*fTmpB + -0.9917422203269092f*fTmpA;
-	pSH[135] = fTmpC*fC0;
-	pSH[129] = fTmpC*fS0;
-	fTmpA = 2.063797291222968f*fZ*fTmpC + -0.9938079899999066f*fTmpB;
-	pSH[159] = fTmpA*fC0;
-	pSH[153] = fTmpA*fS0;
-	fC1 = fX*fC0 - fY*fS0;
-	fS1 = fX*fS0 + fY*fC0;
-
-	fTmpA = 0.6258357354491763f;
-	pSH[24] = fTmpA*fC1;
-	pSH[16] = fTmpA*fS1;
-	fTmpB = 2.075662314881041f*fZ;
-	pSH[34] = fTmpB*fC1;
-	pSH[26] = fTmpB*fS1;
-	fTmpC = 5.550213908015966f*fZ2 + -0.5045649007287241f;
-	pSH[46] = fTmpC*fC1;
-	pSH[38] = fTmpC*fS1;
-	fTmpA = fZ*( 13.49180504672677f*fZ2 + -3.113493472321562f );
-	pSH[60] = fTmpA*fC1;
-	pSH[52] = fTmpA*fS1;
-	fTmpB = 2.304886114323221f*fZ*fTmpA + -0.9481763873554654f*fTmpC;
-	pSH[76] = fTmpB*fC1;
-	pSH[68] = fTmpB*fS1;
-	fTmpC = 2.229177150706235f*fZ*fTmpB + -0.9671528397231821f*fTmpA;
-	pSH[94] = fTmpC*fC1;
-	pSH[86] = fTmpC*fS1;
-	fTmpA = 2.179449471770337f*fZ*fTmpC + -0.9776923610938036f*fTmpB;
-	pSH[114] = fTmpA*fC1;
-	pSH[106] = fTmpA*fS1;
-	fTmpB = 2.144761058952722f*fZ*fTmpA + -0.9840838646332836f*fTmpC;
-	pSH[136] = fTmpB*fC1;
-	pSH[128] = fTmpB*fS1;
-	fTmpC = 2.119478119726646f*fZ*fTmpB + -0.9882117688026186f*fTmpA;
-	pSH[160] = fTmpC*fC1;
-	pSH[152] = fTmpC*fS1;
-	fC0 = fX*fC1 - fY*fS1;
-	fS0 = fX*fS1 + fY*fC1;
-
-	fTmpA = -0.6563820568401703f;
-	pSH[35] = fTmpA*fC0;
-	pSH[25] = fTmpA*fS0;
-	fTmpB = -2.366619162231753f*fZ;
-	pSH[47] = fTmpB*fC0;
-	pSH[37] = fTmpB*fS0;
-	fTmpC = -6.745902523363385f*fZ2 + 0.5189155787202604f;
-	pSH[61] = fTmpC*fC0;
-	pSH[51] = fTmpC*fS0;
-	fTmpA = fZ*( -17.24955311049054f*fZ2 + 3.449910622098108f );
-	pSH[77] = fTmpA*fC0;
-	pSH[67] = fTmpA*fS0;
-	fTmpB = 2.401636346922062f*fZ*fTmpA + -0.9392246042043708f*fTmpC;
-	pSH[95] = fTmpB*fC0;
-	pSH[85] = fTmpB*fS0;
-	fTmpC = 2.306512518934159f*fZ*fTmpB + -0.9603920767980496f*fTmpA;
-	pSH[115] = fTmpC*fC0;
-	pSH[105] = fTmpC*fS0;
-	fTmpA = 2.243044805615795f*fZ*fTmpC + -0.9724832565193738f*fTmpB;
-	pSH[137] = fTmpA*fC0;
-	pSH[127] = fTmpA*fS0;
-	fTmpB = 2.198165774710643f*fZ*fTmpA + -0.9799919151000504f*fTmpC;
-	pSH[161] = fTmpB*fC0;
-	pSH[151] = fTmpB*fS0;
-	fC1 = fX*fC0 - fY*fS0;
-	fS1 = fX*fS0 + fY*fC0;
-
-	fTmpA = 0.6831841051919144f;
-	pSH[48] = fTmpA*fC1;
-	pSH[36] = fTmpA*fS1;
-	fTmpB = 2.645960661801901f*fZ;
-	pSH[62] = fTmpB*fC1;
-	pSH[50] = fTmpB*fS1;
-	fTmpC = 7.984991490893139f*fZ2 + -0.5323327660595426f;
-	pSH[78] = fTmpC*fC1;
-	pSH[66] = fTmpC*fS1;
-	fTmpA = fZ*( 21.39289019090864f*fZ2 + -3.775215916042701f );
-	pSH[96] = fTmpA*fC1;
-	pSH[84] = fTmpA*fS1;
-	fTmpB = 2.496873044429773f*fZ*fTmpA + -0.9319689782769534f*fTmpC;
-	pSH[116] = fTmpB*fC1;
-	pSH[104] = fTmpB*fS1;
-	fTmpC = 2.383768642544085f*fZ*fTmpB + -0.9547015807880142f*fTmpA;
-	pSH[138] = fTmpC*fC1;
-	pSH[126] = fTmpC*fS1;
-	fTmpA = 2.307395517477243f*fZ*fTmpC + -0.9679611839405133f*fTmpB;
-	pSH[162] = fTmpA*fC1;
-	pSH[150] = fTmpA*fS1;
-	fC0 = fX*fC1 - fY*fS1;
-	fS0 = fX*fS1 + fY*fC1;
-
-	fTmpA = -0.7071627325245963f;
-	pSH[63] = fTmpA*fC0;
-	pSH[49] = fTmpA*fS0;
-	fTmpB = -2.91570664069932f*fZ;
-	pSH[79] = fTmpB*fC0;
-	pSH[65] = fTmpB*fS0;
-	fTmpC = -9.263393182848905f*fZ2 + 0.5449054813440533f;
-	pSH[97] = fTmpC*fC0;
-	pSH[83] = fTmpC*fS0;
-	fTmpA = fZ*( -25.9102413133663f*fZ2 + 4.091090733689416f );
-	pSH[117] = fTmpA*fC0;
-	pSH[103] = fTmpA*fS0;
-	fTmpB = 2.590045044653342f*fZ*fTmpA + -0.9259892765852515f*fTmpC;
-	pSH[139] = fTmpB*fC0;
-	pSH[125] = fTmpB*fS0;
-	fTmpC = 2.460209661583209f*fZ*fTmpB + -0.9498713802919554f*fTmpA;
-	pSH[163] = fTmpC*fC0;
-	pSH[149] = fTmpC*fS0;
-	fC1 = fX*fC0 - fY*fS0;
-	fS1 = fX*fS0 + fY*fC0;
-
-	fTmpA = 0.72892666017483f;
-	pSH[80] = fTmpA*fC1;
-	pSH[64] = fTmpA*fS1;
-	fTmpB = 3.177317648954698f*fZ;
-	pSH[98] = fTmpB*fC1;
-	pSH[82] = fTmpB*fS1;
-	fTmpC = 10.57781172168795f*fZ2 + -0.5567269327204184f;
-	pSH[118] = fTmpC*fC1;
-	pSH[102] = fTmpC*fS1;
-	fTmpA = fZ*( 30.79157970335749f*fZ2 + -4.398797100479641f );
-	pSH[140] = fTmpA*fC1;
-	pSH[124] = fTmpA*fS1;
-	fTmpB = 2.680951323690902f*fZ*fTmpA + -0.9209854970162591f*fTmpC;
-	pSH[164] = fTmpB*fC1;
-	pSH[148] = fTmpB*fS1;
-	fC0 = fX*fC1 - fY*fS1;
-	fS0 = fX*fS1 + fY*fC1;
-
-	fTmpA = -0.7489009518531884f;
-	pSH[99] = fTmpA*fC0;
-	pSH[81] = fTmpA*fS0;
-	fTmpB = -3.431895299891715f*fZ;
-	pSH[119] = fTmpB*fC0;
-	pSH[101] = fTmpB*fS0;
-	fTmpC = -11.92552753945219f*fZ2 + 0.5678822637834374f;
-	pSH[141] = fTmpC*fC0;
-	pSH[123] = fTmpC*fS0;
-	fTmpA = fZ*( -36.02809068931077f*fZ2 + 4.699316176866623f );
-	pSH[165] = fTmpA*fC0;
-	pSH[147] = fTmpA*fS0;
-	fC1 = fX*fC0 - fY*fS0;
-	fS1 = fX*fS0 + fY*fC0;
-
-	fTmpA = 0.7673951182219901f;
-	pSH[120] = fTmpA*fC1;
-	pSH[100] = fTmpA*fS1;
-	fTmpB = 3.680297698805312f*fZ;
-	pSH[142] = fTmpB*fC1;
-	pSH[122] = fTmpB*fS1;
-	fTmpC = 13.30425420025764f*fZ2 + -0.5784458347938103f;
-	pSH[166] = fTmpC*fC1;
-	pSH[146] = fTmpC*fS1;
-	fC0 = fX*fC1 - fY*fS1;
-	fS0 = fX*fS1 + fY*fC1;
-
-	fTmpA = -0.7846421057871971f;
-	pSH[143] = fTmpA*fC0;
-	pSH[121] = fTmpA*fS0;
-	fTmpB = -3.923210528935984f*fZ;
-	pSH[167] = fTmpB*fC0;
-	pSH[145] = fTmpB*fS0;
-	fC1 = fX*fC0 - fY*fS0;
-	fS1 = fX*fS0 + fY*fC0;
-
-	fTmpC = 0.8008219957839717f;
-	pSH[168] = fTmpC*fC1;
-	pSH[144] = fTmpC*fS1;
-}
-
-// order 14
-void SHEval14( const float fX, const float fY, const float fZ, float *pSH )
-{
-	float fC0, fC1, fS0, fS1, fTmpA, fTmpB, fTmpC;
-	float fZ2 = fZ*fZ;
-
-	pSH[0] = 0.2820947917738781f;
-	pSH[2] = 0.4886025119029199f*fZ;
-	pSH[6] = 0.9461746957575601f*fZ2 + -0.3153915652525201f;
-	pSH[12] = fZ*( 1.865881662950577f*fZ2 + -1.119528997770346f );
-	pSH[20] = 1.984313483298443f*fZ*pSH[12] + -1.006230589874905f*pSH[6];
-	pSH[30] = 1.98997487421324f*fZ*pSH[20] + -1.002853072844814f*pSH[12];
-	pSH[42] = 1.993043457183567f*fZ*pSH[30] + -1.001542020962219f*pSH[20];
-	pSH[56] = 1.994891434824135f*fZ*pSH[42] + -1.000927213921958f*pSH[30];
-	pSH[72] = 1.996089927833914f*fZ*pSH[56] + -1.000600781069515f*pSH[42];
-	pSH[90] = 1.996911195067937f*fZ*pSH[72] + -1.000411437993134f*pSH[56];
-	pSH[110] = 1.997498435543818f*fZ*pSH[90] + -1.00029407440718f*pSH[72];
-	pSH[132] = 1.997932815985082f*fZ*pSH[110] + -1.000217462218511f*pSH[90];
-	pSH[156] = 1.998263134713633f*fZ*pSH[132] + -1.000165330248298f*pSH[110];
-	pSH[182] = 1.998520162579474f*fZ*pSH[156] + -1.000128625635621f*pSH[132];
-	fC0 = fX;
-	fS0 = fY;
-
-	fTmpA = -0.48860251190292f;
-	pSH[3] = fTmpA*fC0;
-	pSH[1] = fTmpA*fS0;
-	fTmpB = -1.092548430592079f*fZ;
-	pSH[7] = fTmpB*fC0;
-	pSH[5] = fTmpB*fS0;
-	fTmpC = -2.285228997322329f*fZ2 + 0.4570457994644658f;
-	pSH[13] = fTmpC*fC0;
-	pSH[11] = fTmpC*fS0;
-	fTmpA = fZ*( -4.683325804901025f*fZ2 + 2.007139630671868f );
-	pSH[21] = fTmpA*fC0;
-	pSH[19] = fTmpA*fS0;
-	fTmpB = 2.03100960115899f*fZ*fTmpA + -0.991031208965115f*fTmpC;
-	pSH[31] = fTmpB*fC0;
-	pSH[29] = fTmpB*fS0;
-	fTmpC = 2.021314989237028f*fZ*fTmpB + -0.9952267030562385f*fTmpA;
-	pSH[43] = fTmpC*fC0;
-	pSH[41] = fTmpC*fS0;
-	fTmpA = 2.015564437074638f*fZ*fTmpC + -0.9971550440218319f*fTmpB;
-	pSH[57] = fTmpA*fC0;
-	pSH[55] = fTmpA*fS0;
-	fTmpB = 2.011869540407391f*fZ*fTmpA + -0.9981668178901745f*fTmpC;
-	pSH[73] = fTmpB*fC0;
-	pSH[71] = fTmpB*fS0;
-	fTmpC = 2.009353129741012f*fZ*fTmpB + -0.9987492177719088f*fTmpA;
-	pSH[91] = fTmpC*fC0;
-	pSH[89] = fTmpC*fS0;
-	fTmpA = 2.007561463642653f*fZ*fTmpC + -0.9991083368712843f*fTmpB;
-	pSH[111] = fTmpA*fC0;
-	pSH[109] = fTmpA*fS0;
-	fTmpB = 2.006240264773888f*fZ*fTmpA + -0.9993418887079215f*fTmpC;
-	pSH[133] = fTmpB*fC0;
-	pSH[131] = fTmpB*fS0;
-	fTmpC = 2.005237896355199f*fZ*fTmpB + -0.9995003746877732f*fTmpA;
-	pSH[157] = fTmpC*fC0;
-	pSH[155] = fTmpC*fS0;
-	fTmpA = 2.004459314343183f*fZ*fTmpC + -0.9996117258638336f*fTmpB;
-	pSH[183] = fTmpA*fC0;
-	pSH[181] = fTmpA*fS0;
-	fC1 = fX*fC0 - fY*fS0;
-	fS1 = fX*fS0 + fY*fC0;
-
-	fTmpA = 0.5462742152960395f;
-	pSH[8] = fTmpA*fC1;
-	pSH[4] = fTmpA*fS1;
-	fTmpB = 1.445305721320277f*fZ;
-	pSH[14] = fTmpB*fC1;
-	pSH[10] = fTmpB*fS1;
-	fTmpC = 3.31161143515146f*fZ2 + -0.47308734787878f;
-	pSH[22] = fTmpC*fC1;
-	pSH[18] = fTmpC*fS1;
-	fTmpA = fZ*( 7.190305177459987f*fZ2 + -2.396768392486662f );
-	pSH[32] = fTmpA*fC1;
-	pSH[28] = fTmpA*fS1;
-	fTmpB = 2.11394181566097f*fZ*fTmpA + -0.9736101204623268f*fTmpC;
-	pSH[44] = fTmpB*fC1;
-	pSH[40] = fTmpB*fS1;
-	fTmpC = 2.081665999466133f*fZ*fTmpB + -0.9847319278346618f*fTmpA;
-	pSH[58] = fTmpC*fC1;
-	pSH[54] = fTmpC*fS1;
-	fTmpA = 2.06155281280883f*fZ*fTmpC + -0.9903379376602873f*fTmpB;
-	pSH[74] = fTmpA*fC1;
-	pSH[70] = fTmpA*fS1;
-	fTmpB = 2.048122358357819f*fZ*fTmpA + -0.9934852726704042f*fTmpC;
-	pSH[92] = fTmpB*fC1;
-	pSH[88] = fTmpB*fS1;
-	fTmpC = 2.038688303787511f*fZ*fTmpB + -0.9953938032404119f*fTmpA;
-	pSH[112] = fTmpC*fC1;
-	pSH[108] = fTmpC*fS1;
-	fTmpA = 2.031798495964875f*fZ*fTmpC + -0.9966204702259603f*fTmpB;
-	pSH[134] = fTmpA*fC1;
-	pSH[130] = fTmpA*fS1;
-	fTmpB = 2.026608708444444f*fZ*fTmpA + -0.9974457174120671f*fTmpC;
-	pSH[158] = fTmpB*fC1;
-	pSH[154] = fTmpB*fS1;
-	fTmpC = 2.022599587389726f*fZ*fTmpB + -0.9980217586956907f*fTmpA;
-	pSH[184] = fTmpC*fC1;
-	pSH[180] = fTmpC*fS1;
-	fC0 = fX*fC1 - fY*fS1;
-	fS0 = fX*fS1 + fY*fC1;
-
-	fTmpA = -0.5900435899266435f;
-	pSH[15] = fTmpA*fC0;
-	pSH[9] = fTmpA*fS0;
-	fTmpB = -1.770130769779931f*fZ;
-	pSH[23] = fTmpB*fC0;
-	pSH[17] = fTmpB*fS0;
-	fTmpC = -4.403144694917254f*fZ2 + 0.4892382994352505f;
-	pSH[33] = fTmpC*fC0;
-	pSH[27] = fTmpC*fS0;
-	fTmpA = fZ*( -10.13325785466416f*fZ2 + 2.763615778544771f );
-	pSH[45] = fTmpA*fC0;
-	pSH[39] = fTmpA*fS0;
-	fTmpB = 2.207940216581962f*fZ*fTmpA + -0.959403223600247f*fTmpC;
-	pSH[59] = fTmpB*fC0;
-	pSH[53] = fTmpB*fS0;
-	fTmpC = 2.15322168769582f*fZ*fTmpB + -0.9752173865600178f*fTmpA;
-	pSH[75] = fTmpC*fC0;
-	pSH[69] = fTmpC*fS0;
-	fTmpA = 2.118044171189805f*fZ*fTmpC + -0.9836628449792094f*fTmpB;
-	pSH[93] = fTmpA*fC0;
-	pSH[87] = fTmpA*fS0;
-	fTmpB = 2.093947321356338f*fZ*fTmpA + -0.9886230654859614f*fTmpC;
-	pSH[113] = fTmpB*fC0;
-	pSH[107] = fTmpB*fS0;
-	fTmpC = 2.076655965729519f*fZ*fTmpB + -0.9917422203269092f*fTmpA;
-	pSH[135] = fTmpC*fC0;
-	pSH[129] = fTmpC*fS0;
-	fTmpA = 2.063797291222968f*fZ*fTmpC + -0.9938079899999066f*fTmpB;
-	pSH[159] = fTmpA*fC0;
-	pSH[153] = fTmpA*fS0;
-	fTmpB = 2.053959590644373f*fZ*fTmpA + -0.9952332040455557f*fTmpC;
-	pSH[185] = fTmpB*fC0;
-	pSH[179] = fTmpB*fS0;
-	fC1 = fX*fC0 - fY*fS0;
-	fS1 = fX*fS0 + fY*fC0;
-
-	fTmpA = 0.6258357354491763f;
-	pSH[24] = fTmpA*fC1;
-	pSH[16] = fTmpA*fS1;
-	fTmpB = 2.075662314881041f*fZ;
-	pSH[34] = fTmpB*fC1;
-	pSH[26] = fTmpB*fS1;
-	fTmpC = 5.550213908015966f*fZ2 + -0.5045649007287241f;
-	pSH[46] = fTmpC*fC1;
-	pSH[38] = fTmpC*fS1;
-	fTmpA = fZ*( 13.49180504672677f*fZ2 + -3.113493472321562f );
-	pSH[60] = fTmpA*fC1;
-	pSH[52] = fTmpA*fS1;
-	fTmpB = 2.304886114323221f*fZ*fTmpA + -0.9481763873554654f*fTmpC;
-	pSH[76] = fTmpB*fC1;
-	pSH[68] = fTmpB*fS1;
-	fTmpC = 2.229177150706235f*fZ*fTmpB + -0.9671528397231821f*fTmpA;
-	pSH[94] = fTmpC*fC1;
-	pSH[86] = fTmpC*fS1;
-	fTmpA = 2.179449471770337f*fZ*fTmpC + -0.9776923610938036f*fTmpB;
-	pSH[114] = fTmpA*fC1;
-	pSH[106] = fTmpA*fS1;
-	fTmpB = 2.144761058952722f*fZ*fTmpA + -0.9840838646332836f*fTmpC;
-	pSH[136] = fTmpB*fC1;
-	pSH[128] = fTmpB*fS1;
-	fTmpC = 2.119478119726646f*fZ*fTmpB + -0.9882117688026186f*fTmpA;
-	pSH[160] = fTmpC*fC1;
-	pSH[152] = fTmpC*fS1;
-	fTmpA = 2.100420126042015f*fZ*fTmpC + -0.9910081668184009f*fTmpB;
-	pSH[186] = fTmpA*fC1;
-	pSH[178] = fTmpA*fS1;
-	fC0 = fX*fC1 - fY*fS1;
-	fS0 = fX*fS1 + fY*fC1;
-
-	fTmpA = -0.6563820568401703f;
-	pSH[35] = fTmpA*fC0;
-	pSH[25] = fTmpA*fS0;
-	fTmpB = -2.366619162231753f*fZ;
-	pSH[47] = fTmpB*fC0;
-	pSH[37] = fTmpB*fS0;
-	fTmpC = -6.745902523363385f*fZ2 + 0.5189155787202604f;
-	pSH[61] = fTmpC*fC0;
-	pSH[51] = fTmpC*fS0;
-	fTmpA = fZ*( -17.24955311049054f*fZ2 + 3.449910622098108f );
-	pSH[77] = fTmpA*fC0;
-	pSH[67] = fTmpA*fS0;
-	fTmpB = 2.401636346922062f*fZ*fTmpA + -0.9392246042043708f*fTmpC;
-	pSH[95] = fTmpB*fC0;
-	pSH[85] = fTmpB*fS0;
-	fTmpC = 2.306512518934159f*fZ*fTmpB + -0.9603920767980496f*fTmpA;
-	pSH[115] = fTmpC*fC0;
-	pSH[105] = fTmpC*fS0;
-	fTmpA = 2.243044805615795f*fZ*fTmpC + -0.9724832565193738f*fTmpB;
-	pSH[137] = fTmpA*fC0;
-	pSH[127] = fTmpA*fS0;
-	fTmpB = 2.198165774710643f*fZ*fTmpA + -0.9799919151000504f*fTmpC;
-	pSH[161] = fTmpB*fC0;
-	pSH[151] = fTmpB*fS0;
-	fTmpC = 2.165063509461097f*fZ*fTmpB + -0.9849409604906143f*fTmpA;
-	pSH[187] = fTmpC*fC0;
-	pSH[177] = fTmpC*fS0;
-	fC1 = fX*fC0 - fY*fS0;
-	fS1 = fX*fS0 + fY*fC0;
-
-	fTmpA = 0.6831841051919144f;
-	pSH[48] = fTmpA*fC1;
-	pSH[36] = fTmpA*fS1;
-	fTmpB = 2.645960661801901f*fZ;
-	pSH[62] = fTmpB*fC1;
-	pSH[50] = fTmpB*fS1;
-	fTmpC = 7.984991490893139f*fZ2 + -0.5323327660595426f;
-	pSH[78] = fTmpC*fC1;
-	pSH[66] = fTmpC*fS1;
-	fTmpA = fZ*( 21.39289019090864f*fZ2 + -3.775215916042701f );
-	pSH[96] = fTmpA*fC1;
-	pSH[84] = fTmpA*fS1;
-	fTmpB = 2.496873044429773f*fZ*fTmpA + -0.9319689782769534f*fTmpC;
-	pSH[116] = fTmpB*fC1;
-	pSH[104] = fTmpB*fS1;
-	fTmpC = 2.383768642544085f*fZ*fTmpB + -0.9547015807880142f*fTmpA;
-	pSH[138] = fTmpC*fC1;
-	pSH[126] = fTmpC*fS1;
-	fTmpA = 2.307395517477243f*fZ*fTmpC + -0.9679611839405133f*fTmpB;
-	pSH[162] = fTmpA*fC1;
-	pSH[150] = fTmpA*fS1;
-	fTmpB = 2.252817784447915f*fZ*fTmpA + -0.9763466069791972f*fTmpC;
-	pSH[188] = fTmpB*fC1;
-	pSH[176] = fTmpB*fS1;
-	fC0 = fX*fC1 - fY*fS1;
-	fS0 = fX*fS1 + fY*fC1;
-
-	fTmpA = -0.7071627325245963f;
-	pSH[63] = fTmpA*fC0;
-	pSH[49] = fTmpA*fS0;
-	fTmpB = -2.91570664069932f*fZ;
-	pSH[79] = fTmpB*fC0;
-	pSH[65] = fTmpB*fS0;
-	fTmpC = -9.263393182848905f*fZ2 + 0.5449054813440533f;
-	pSH[97] = fTmpC*fC0;
-	pSH[83] = fTmpC*fS0;
-	fTmpA = fZ*( -25.9102413133663f*fZ2 + 4.091090733689416f );
-	pSH[117] = fTmpA*fC0;
-	pSH[103] = fTmpA*fS0;
-	fTmpB = 2.590045044653342f*fZ*fTmpA + -0.9259892765852515f*fTmpC;
-	pSH[139] = fTmpB*fC0;
-	pSH[125] = fTmpB*fS0;
-	fTmpC = 2.460209661583209f*fZ*fTmpB + -0.9498713802919554f*fTmpA;
-	pSH[163] = fTmpC*fC0;
-	pSH[149] = fTmpC*fS0;
-	fTmpA = 2.371708245126284f*fZ*fTmpC + -0.9640268803757269f*fTmpB;
-	pSH[189] = fTmpA*fC0;
-	pSH[175] = fTmpA*fS0;
-	fC1 = fX*fC0 - fY*fS0;
-	fS1 = fX*fS0 + fY*fC0;
-
-	fTmpA = 0.72892666017483f;
-	pSH[80] = fTmpA*fC1;
-	pSH[64] = fTmpA*fS1;
-	fTmpB = 3.177317648954698f*fZ;
-	pSH[98] = fTmpB*fC1;
-	pSH[82] = fTmpB*fS1;
-	fTmpC = 10.57781172168795f*fZ2 + -0.5567269327204184f;
-	pSH[118] = fTmpC*fC1;
-	pSH[102] = fTmpC*fS1;
-	fTmpA = fZ*( 30.79157970335749f*fZ2 + -4.398797100479641f );
-	pSH[140] = fTmpA*fC1;
-	pSH[124] = fTmpA*fS1;
-	fTmpB = 2.680951323690902f*fZ*fTmpA + -0.9209854970162591f*fTmpC;
-	pSH[164] = fTmpB*fC1;
-	pSH[148] = fTmpB*fS1;
-	fTmpC = 2.53546276418555f*fZ*fTmpB + -0.9457324874869209f*fTmpA;
-	pSH[190] = fTmpC*fC1;
-	pSH[174] = fTmpC*fS1;
-	fC0 = fX*fC1 - fY*fS1;
-	fS0 = fX*fS1 + fY*fC1;
-
-	fTmpA = -0.7489009518531884f;
-	pSH[99] = fTmpA*fC0;
-	pSH[81] = fTmpA*fS0;
-	fTmpB = -3.431895299891715f*fZ;
-	pSH[119] = fTmpB*fC0;
-	pSH[101] = fTmpB*fS0;
-	fTmpC = -11.92552753945219f*fZ2 + 0.5678822637834374f;
-	pSH[141] = fTmpC*fC0;
-	pSH[123] = fTmpC*fS0;
-	fTmpA = fZ*( -36.02809068931077f*fZ2 + 4.699316176866623f );
-	pSH[165] = fTmpA*fC0;
-	pSH[147] = fTmpA*fS0;
-	fTmpB = 2.769558547034986f*fZ*fTmpA + -0.9167415228748209f*fTmpC;
-	pSH[191] = fTmpB*fC0;
-	pSH[173] = fTmpB*fS0;
-	fC1 = fX*fC0 - fY*fS0;
-	fS1 = fX*fS0 + fY*fC0;
-
-	fTmpA = 0.7673951182219901f;
-	pSH[120] = fTmpA*fC1;
-	pSH[100] = fTmpA*fS1;
-	fTmpB = 3.680297698805312f*fZ;
-	pSH[142] = fTmpB*fC1;
-	pSH[122] = fTmpB*fS1;
-	fTmpC = 13.30425420025764f*fZ2 + -0.5784458347938103f;
-	pSH[166] = fTmpC*fC1;
-	pSH[146] = fTmpC*fS1;
-	fTmpA = fZ*( 41.61193153549645f*fZ2 + -4.993431784259574f );
-	pSH[192] = fTmpA*fC1;
-	pSH[172] = fTmpA*fS1;
-	fC0 = fX*fC1 - fY*fS1;
-	fS0 = fX*fS1 + fY*fC1;
-
-	fTmpA = -0.7846421057871971f;
-	pSH[143] = fTmpA*fC0;
-	pSH[121] = fTmpA*fS0;
-	fTmpB = -3.923210528935984f*fZ;
-	pSH[167] = fTmpB*fC0;
-	pSH[145] = fTmpB*fS0;
-	fTmpC = -14.71203948350994f*fZ2 + 0.5884815793403977f;
-	pSH[193] = fTmpC*fC0;
-	pSH[171] = fTmpC*fS0;
-	fC1 = fX*fC0 - fY*fS0;
-	fS1 = fX*fS0 + fY*fC0;
-
-	fTmpA = 0.8008219957839717f;
-	pSH[168] = fTmpA*fC1;
-	pSH[144] = fTmpA*fS1;
-	fTmpB = 4.161193153549645f*fZ;
-	pSH[194] = fTmpB*fC1;
-	pSH[170] = fTmpB*fS1;
-	fC0 = fX*fC1 - fY*fS1;
-	fS0 = fX*fS1 + fY*fC1;
-
-	fTmpC = -0.8160771188376284f;
-	pSH[195] = fTmpC*fC0;
-	pSH[169] = fTmpC*fS0;
-}
-
-// order 15
-void SHEval15( const float fX, const float fY, const float fZ, float *pSH )
-{
-	float fC0, fC1, fS0, fS1, fTmpA, fTmpB, fTmpC;
-	float fZ2 = fZ*fZ;
-
-	pSH[0] = 0.2820947917738781f;
-	pSH[2] = 0.4886025119029199f*fZ;
-	pSH[6] = 0.9461746957575601f*fZ2 + -0.3153915652525201f;
-	pSH[12] = fZ*( 1.865881662950577f*fZ2 + -1.119528997770346f );
-	pSH[20] = 1.984313483298443f*fZ*pSH[12] + -1.006230589874905f*pSH[6];
-	pSH[30] = 1.98997487421324f*fZ*pSH[20] + -1.002853072844814f*pSH[12];
-	pSH[42] = 1.993043457183567f*fZ*pSH[30] + -1.001542020962219f*pSH[20];
-	pSH[56] = 1.994891434824135f*fZ*pSH[42] + -1.000927213921958f*pSH[30];
-	pSH[72] = 1.996089927833914f*fZ*pSH[56] + -1.000600781069515f*pSH[42];
-	pSH[90] = 1.996911195067937f*fZ*pSH[72] + -1.000411437993134f*pSH[56];
-	pSH[110] = 1.997498435543818f*fZ*pSH[90] + -1.00029407440718f*pSH[72];
-	pSH[132] = 1.997932815985082f*fZ*pSH[110] + -1.000217462218511f*pSH[90];
-	pSH[156] = 1.998263134713633f*fZ*pSH[132] + -1.000165330248298f*pSH[110];
-	pSH[182] = 1.998520162579474f*fZ*pSH[156] + -1.000128625635621f*pSH[132];
-	pSH[210] = 1.998724082804747f*fZ*pSH[182] + -1.000102035610694f*pSH[156];
-	fC0 = fX;
-	fS0 = fY;
-
-	fTmpA = -0.48860251190292f;
-	pSH[3] = fTmpA*fC0;
-	pSH[1] = fTmpA*fS0;
-	fTmpB = -1.092548430592079f*fZ;
-	pSH[7] = fTmpB*fC0;
-	pSH[5] = fTmpB*fS0;
-	fTmpC = -2.285228997322329f*fZ2 + 0.4570457994644658f;
-	pSH[13] = fTmpC*fC0;
-	pSH[11] = fTmpC*fS0;
-	fTmpA = fZ*( -4.683325804901025f*fZ2 + 2.007139630671868f );
-	pSH[21] = fTmpA*fC0;
-	pSH[19] = fTmpA*fS0;
-	fTmpB = 2.03100960115899f*fZ*fTmpA + -0.991031208965115f*fTmpC;
-	pSH[31] = fTmpB*fC0;
-	pSH[29] = fTmpB*fS0;
-	fTmpC = 2.021314989237028f*fZ*fTmpB + -0.9952267030562385f*fTmpA;
-	pSH[43] = fTmpC*fC0;
-	pSH[41] = fTmpC*fS0;
-	fTmpA = 2.015564437074638f*fZ*fTmpC + -0.9971550440218319f*fTmpB;
-	pSH[57] = fTmpA*fC0;
-	pSH[55] = fTmpA*fS0;
-	fTmpB = 2.011869540407391f*fZ*fTmpA + -0.9981668178901745f*fTmpC;
-	pSH[73] = fTmpB*fC0;
-	pSH[71] = fTmpB*fS0;
-	fTmpC = 2.009353129741012f*fZ*fTmpB + -0.9987492177719088f*fTmpA;
-	pSH[91] = fTmpC*fC0;
-	pSH[89] = fTmpC*fS0;
-	fTmpA = 2.007561463642653f*fZ*fTmpC + -0.9991083368712843f*fTmpB;
-	pSH[111] = fTmpA*fC0;
-	pSH[109] = fTmpA*fS0;
-	fTmpB = 2.006240264773888f*fZ*fTmpA + -0.9993418887079215f*fTmpC;
-	pSH[133] = fTmpB*fC0;
-	pSH[131] = fTmpB*fS0;
-	fTmpC = 2.005237896355199f*fZ*fTmpB + -0.9995003746877732f*fTmpA;
-	pSH[157] = fTmpC*fC0;
-	pSH[155] = fTmpC*fS0;
-	fTmpA = 2.004459314343183f*fZ*fTmpC + -0.9996117258638336f*fTmpB;
-	pSH[183] = fTmpA*fC0;
-	pSH[181] = fTmpA*fS0;
-	fTmpB = 2.003842462716222f*fZ*fTmpA + -0.9996922603404586f*fTmpC;
-	pSH[211] = fTmpB*fC0;
-	pSH[209] = fTmpB*fS0;
-	fC1 = fX*fC0 - fY*fS0;
-	fS1 = fX*fS0 + fY*fC0;
-
-	fTmpA = 0.5462742152960395f;
-	pSH[8] = fTmpA*fC1;
-	pSH[4] = fTmpA*fS1;
-	fTmpB = 1.445305721320277f*fZ;
-	pSH[14] = fTmpB*fC1;
-	pSH[10] = fTmpB*fS1;
-	fTmpC = 3.31161143515146f*fZ2 + -0.47308734787878f;
-	pSH[22] = fTmpC*fC1;
-	pSH[18] = fTmpC*fS1;
-	fTmpA = fZ*( 7.190305177459987f*fZ2 + -2.396768392486662f );
-	pSH[32] = fTmpA*fC1;
-	pSH[28] = fTmpA*fS1;
-	fTmpB = 2.11394181566097f*fZ*fTmpA + -0.9736101204623268f*fTmpC;
-	pSH[44] = fTmpB*fC1;
-	pSH[40] = fTmpB*fS1;
-	fTmpC = 2.081665999466133f*fZ*fTmpB + -0.9847319278346618f*fTmpA;
-	pSH[58] = fTmpC*fC1;
-	pSH[54] = fTmpC*fS1;
-	fTmpA = 2.06155281280883f*fZ*fTmpC + -0.9903379376602873f*fTmpB;
-	pSH[74] = fTmpA*fC1;
-	pSH[70] = fTmpA*fS1;
-	fTmpB = 2.048122358357819f*fZ*fTmpA + -0.9934852726704042f*fTmpC;
-	pSH[92] = fTmpB*fC1;
-	pSH[88] = fTmpB*fS1;
-	fTmpC = 2.038688303787511f*fZ*fTmpB + -0.9953938032404119f*fTmpA;
-	pSH[112] = fTmpC*fC1;
-	pSH[108] = fTmpC*fS1;
-	fTmpA = 2.031798495964875f*fZ*fTmpC + -0.9966204702259603f*fTmpB;
-	pSH[134] = fTmpA*fC1;
-	pSH[130] = fTmpA*fS1;
-	fTmpB = 2.026608708444444f*fZ*fTmpA + -0.9974457174120671f*fTmpC;
-	pSH[158] = fTmpB*fC1;
-	pSH[154] = fTmpB*fS1;
-	fTmpC = 2.022599587389726f*fZ*fTmpB + -0.9980217586956907f*fTmpA;
-	pSH[184] = fTmpC*fC1;
-	pSH[180] = fTmpC*fS1;
-	fTmpA = 2.019436802675439f*fZ*fTmpC + -0.998436277385793f*fTmpB;
-	pSH[212] = fTmpA*fC1;
-	pSH[208] = fTmpA*fS1;
-	fC0 = fX*fC1 - fY*fS1;
-	fS0 = fX*fS1 + fY*fC1;
-
-	fTmpA = -0.5900435899266435f;
-	pSH[15] = fTmpA*fC0;
-	pSH[9] = fTmpA*fS0;
-	fTmpB = -1.770130769779931f*fZ;
-	pSH[23] = fTmpB*fC0;
-	pSH[17] = fTmpB*fS0;
-	fTmpC = -4.403144694917254f*fZ2 + 0.4892382994352505f;
-	pSH[33] = fTmpC*fC0;
-	pSH[27] = fTmpC*fS0;
-	fTmpA = fZ*( -10.13325785466416f*fZ2 + 2.763615778544771f );
-	pSH[45] = fTmpA*fC0;
-	pSH[39] = fTmpA*fS0;
-	fTmpB = 2.207940216581962f*fZ*fTmpA + -0.959403223600247f*fTmpC;
-	pSH[59] = fTmpB*fC0;
-	pSH[53] = fTmpB*fS0;
-	fTmpC = 2.15322168769582f*fZ*fTmpB + -0.9752173865600178f*fTmpA;
-	pSH[75] = fTmpC*fC0;
-	pSH[69] = fTmpC*fS0;
-	fTmpA = 2.118044171189805f*fZ*fTmpC + -0.9836628449792094f*fTmpB;
-	pSH[93] = fTmpA*fC0;
-	pSH[87] = fTmpA*fS0;
-	fTmpB = 2.093947321356338f*fZ*fTmpA + -0.9886230654859614f*fTmpC;
-	pSH[113] = fTmpB*fC0;
-	pSH[107] = fTmpB*fS0;
-	fTmpC = 2.076655965729519f*fZ*fTmpB + -0.9917422203269092f*fTmpA;
-	pSH[135] = fTmpC*fC0;
-	pSH[129] = fTmpC*fS0;
-	fTmpA = 2.063797291222968f*fZ*fTmpC + -0.9938079899999066f*fTmpB;
-	pSH[159] = fTmpA*fC0;
-	pSH[153] = fTmpA*fS0;
-	fTmpB = 2.053959590644373f*fZ*fTmpA + -0.9952332040455557f*fTmpC;
-	pSH[185] = fTmpB*fC0;
-	pSH[179] = fTmpB*fS0;
-	fTmpC = 2.046256527271464f*fZ*fTmpB + -0.9962496519366806f*fTmpA;
-	pSH[213] = fTmpC*fC0;
-	pSH[207] = fTmpC*fS0;
-	fC1 = fX*fC0 - fY*fS0;
-	fS1 = fX*fS0 + fY*fC0;
-
-	fTmpA = 0.6258357354491763f;
-	pSH[24] = fTmpA*fC1;
-	pSH[16] = fTmpA*fS1;
-	fTmpB = 2.075662314881041f*fZ;
-	pSH[34] = fTmpB*fC1;
-	pSH[26] = fTmpB*fS1;
-	fTmpC = 5.550213908015966f*fZ2 + -0.5045649007287241f;
-	pSH[46] = fTmpC*fC1;
-	pSH[38] = fTmpC*fS1;
-	fTmpA = fZ*( 13.49180504672677f*fZ2 + -3.113493472321562f );
-	pSH[60] = fTmpA*fC1;
-	pSH[52] = fTmpA*fS1;
-	fTmpB = 2.304886114323221f*fZ*fTmpA + -0.9481763873554654f*fTmpC;
-	pSH[76] = fTmpB*fC1;
-	pSH[68] = fTmpB*fS1;
-	fTmpC = 2.229177150706235f*fZ*fTmpB + -0.9671528397231821f*fTmpA;
-	pSH[94] = fTmpC*fC1;
-	pSH[86] = fTmpC*fS1;
-	fTmpA = 2.179449471770337f*fZ*fTmpC + -0.9776923610938036f*fTmpB;
-	pSH[114] = fTmpA*fC1;
-	pSH[106] = fTmpA*fS1;
-	fTmpB = 2.144761058952722f*fZ*fTmpA + -0.9840838646332836f*fTmpC;
-	pSH[136] = fTmpB*fC1;
-	pSH[128] = fTmpB*fS1;
-	fTmpC = 2.119478119726646f*fZ*fTmpB + -0.9882117688026186f*fTmpA;
-	pSH[160] = fTmpC*fC1;
-	pSH[152] = fTmpC*fS1;
-	fTmpA = 2.100420126042015f*fZ*fTmpC + -0.9910081668184009f*fTmpB;
-	pSH[186] = fTmpA*fC1;
-	pSH[178] = fTmpA*fS1;
-	fTmpB = 2.085665361461421f*fZ*fTmpA + -0.9929753269845127f*fTmpC;
-	pSH[214] = fTmpB*fC1;
-	pSH[206] = fTmpB*fS1;
-	fC0 = fX*fC1 - fY*fS1;
-	fS0 = fX*fS1 + fY*fC1;
-
-	fTmpA = -0.6563820568401703f;
-	pSH[35] = fTmpA*fC0;
-	pSH[25] = fTmpA*fS0;
-	fTmpB = -2.366619162231753f*fZ;
-	pSH[47] = fTmpB*fC0;
-	pSH[37] = fTmpB*fS0;
-	fTmpC = -6.745902523363385f*fZ2 + 0.5189155787202604f;
-	pSH[61] = fTmpC*fC0;
-	pSH[51] = fTmpC*fS0;
-	fTmpA = fZ*( -17.24955311049054f*fZ2 + 3.449910622098108f );
-	pSH[77] = fTmpA*fC0;
-	pSH[67] = fTmpA*fS0;
-	fTmpB = 2.401636346922062f*fZ*fTmpA + -0.9392246042043708f*fTmpC;
-	pSH[95] = fTmpB*fC0;
-	pSH[85] = fTmpB*fS0;
-	fTmpC = 2.306512518934159f*fZ*fTmpB + -0.9603920767980496f*fTmpA;
-	pSH[115] = fTmpC*fC0;
-	pSH[105] = fTmpC*fS0;
-	fTmpA = 2.243044805615795f*fZ*fTmpC + -0.9724832565193738f*fTmpB;
-	pSH[137] = fTmpA*fC0;
-	pSH[127] = fTmpA*fS0;
-	fTmpB = 2.198165774710643f*fZ*fTmpA + -0.9799919151000504f*fTmpC;
-	pSH[161] = fTmpB*fC0;
-	pSH[151] = fTmpB*fS0;
-	fTmpC = 2.165063509461097f*fZ*fTmpB + -0.9849409604906143f*fTmpA;
-	pSH[187] = fTmpC*fC0;
-	pSH[177] = fTmpC*fS0;
-	fTmpA = 2.139847510553276f*fZ*fTmpC + -0.9883532289941477f*fTmpB;
-	pSH[215] = fTmpA*fC0;
-	pSH[205] = fTmpA*fS0;
-	fC1 = fX*fC0 - fY*fS0;
-	fS1 = fX*fS0 + fY*fC0;
-
-	fTmpA = 0.6831841051919144f;
-	pSH[48] = fTmpA*fC1;
-	pSH[36] = fTmpA*fS1;
-	fTmpB = 2.645960661801901f*fZ;
-	pSH[62] = fTmpB*fC1;
-	pSH[50] = fTmpB*fS1;
-	fTmpC = 7.984991490893139f*fZ2 + -0.5323327660595426f;
-	pSH[78] = fTmpC*fC1;
-	pSH[66] = fTmpC*fS1;
-	fTmpA = fZ*( 21.39289019090864f*fZ2 + -3.775215916042701f );
-	pSH[96] = fTmpA*fC1;
-	pSH[84] = fTmpA*fS1;
-	fTmpB = 2.496873044429773f*fZ*fTmpA + -0.9319689782769534f*fTmpC;
-	pSH[116] = fTmpB*fC1;
-	pSH[104] = fTmpB*fS1;
-	fTmpC = 2.383768642544085f*fZ*fTmpB + -0.9547015807880142f*fTmpA;
-	pSH[138] = fTmpC*fC1;
-	pSH[126] = fTmpC*fS1;
-	fTmpA = 2.307395517477243f*fZ*fTmpC + -0.9679611839405133f*fTmpB;
-	pSH[162] = fTmpA*fC1;
-	pSH[150] = fTmpA*fS1;
-	fTmpB = 2.252817784447915f*fZ*fTmpA + -0.9763466069791972f*fTmpC;
-	pSH[188] = fTmpB*fC1;
-	pSH[176] = fTmpB*fS1;
-	fTmpC = 2.212182180562893f*fZ*fTmpB + -0.9819623210693983f*fTmpA;
-	pSH[216] = fTmpC*fC1;
-	pSH[204] = fTmpC*fS1;
-	fC0 = fX*fC1 - fY*fS1;
-	fS0 = fX*fS1 + fY*fC1;
-
-	fTmpA = -0.7071627325245963f;
-	pSH[63] = fTmpA*fC0;
-	pSH[49] = fTmpA*fS0;
-	fTmpB = -2.91570664069932f*fZ;
-	pSH[79] = fTmpB*fC0;
-	pSH[65] = fTmpB*fS0;
-	fTmpC = -9.263393182848905f*fZ2 + 0.5449054813440533f;
-	pSH[97] = fTmpC*fC0;
-	pSH[83] = fTmpC*fS0;
-	fTmpA = fZ*( -25.9102413133663f*fZ2 + 4.091090733689416f );
-	pSH[117] = fTmpA*fC0;
-	pSH[103] = fTmpA*fS0;
-	fTmpB = 2.590045044653342f*fZ*fTmpA + -0.9259892765852515f*fTmpC;
-	pSH[139] = fTmpB*fC0;
-	pSH[125] = fTmpB*fS0;
-	fTmpC = 2.460209661583209f*fZ*fTmpB + -0.9498713802919554f*fTmpA;
-	pSH[163] = fTmpC*fC0;
-	pSH[149] = fTmpC*fS0;
-	fTmpA = 2.371708245126284f*fZ*fTmpC + -0.9640268803757269f*fTmpB;
-	pSH[189] = fTmpA*fC0;
-	pSH[175] = fTmpA*fS0;
-	fTmpB = 2.307927774486216f*fZ*fTmpA + -0.9731077923386515f*fTmpC;
-	pSH[217] = fTmpB*fC0;
-	pSH[203] = fTmpB*fS0;
-	fC1 = fX*fC0 - fY*fS0;
-	fS1 = fX*fS0 + fY*fC0;
-
-	fTmpA = 0.72892666017483f;
-	pSH[80] = fTmpA*fC1;
-	pSH[64] = fTmpA*fS1;
-	fTmpB = 3.177317648954698f*fZ;
-	pSH[98] = fTmpB*fC1;
-	pSH[82] = fTmpB*fS1;
-	fTmpC = 10.57781172168795f*fZ2 + -0.5567269327204184f;
-	pSH[118] = fTmpC*fC1;
-	pSH[102] = fTmpC*fS1;
-	fTmpA = fZ*( 30.79157970335749f*fZ2 + -4.398797100479641f );
-	pSH[140] = fTmpA*fC1;
-	pSH[124] = fTmpA*fS1;
-	fTmpB = 2.680951323690902f*fZ*fTmpA + -0.9209854970162591f*fTmpC;
-	pSH[164] = fTmpB*fC1;
-	pSH[148] = fTmpB*fS1;
-	fTmpC = 2.53546276418555f*fZ*fTmpB + -0.9457324874869209f*fTmpA;
-	pSH[190] = fTmpC*fC1;
-	pSH[174] = fTmpC*fS1;
-	fTmpA = 2.435532422657966f*fZ*fTmpC + -0.9605869417846947f*fTmpB;
-	pSH[218] = fTmpA*fC1;
-	pSH[202] = fTmpA*fS1;
-	fC0 = fX*fC1 - fY*fS1;
-	fS0 = fX*fS1 + fY*fC1;
-
-	fTmpA = -0.7489009518531884f;
-	pSH[99] = fTmpA*fC0;
-	pSH[81] = fTmpA*fS0;
-	fTmpB = -3.431895299891715f*fZ;
-	pSH[119] = fTmpB*fC0;
-	pSH[101] = fTmpB*fS0;
-	fTmpC = -11.92552753945219f*fZ2 + 0.5678822637834374f;
-	pSH[141] = fTmpC*fC0;
-	pSH[123] = fTmpC*fS0;
-	fTmpA = fZ*( -36.02809068931077f*fZ2 + 4.699316176866623f );
-	pSH[165] = fTmpA*fC0;
-	pSH[147] = fTmpA*fS0;
-	fTmpB = 2.769558547034986f*fZ*fTmpA + -0.9167415228748209f*fTmpC;
-	pSH[191] = fTmpB*fC0;
-	pSH[173] = fTmpB*fS0;
-	fTmpC = 2.609347744585592f*fZ*fTmpB + -0.9421529461361585f*fTmpA;
-	pSH[219] = fTmpC*fC0;
-	pSH[201] = fTmpC*fS0;
-	fC1 = fX*fC0 - fY*fS0;
-	fS1 = fX*fS0 + fY*fC0;
-
-	fTmpA = 0.7673951182219901f;
-	pSH[120] = fTmpA*fC1;
-	pSH[100] = fTmpA*fS1;
-	fTmpB = 3.680297698805312f*fZ;
-	pSH[142] = fTmpB*fC1;
-	pSH[122] = fTmpB*fS1;
-	fTmpC = 13.30425420025764f*fZ2 + -0.5784458347938103f;
-	pSH[166] = fTmpC*fC1;
-	pSH[146] = fTmpC*fS1;
-	fTmpA = fZ*( 41.61193153549645f*fZ2 + -4.993431784259574f );
-	pSH[192] = fTmpA*fC1;
-	pSH[172] = fTmpA*fS1;
-	fTmpB = 2.855914914698966f*fZ*fTmpA + -0.9130991183874837f*fTmpC;
-	pSH[220] = fTmpB*fC1;
-	pSH[200] = fTmpB*fS1;
-	fC0 = fX*fC1 - fY*fS1;
-	fS0 = fX*fS1 + fY*fC1;
-
-	fTmpA = -0.7846421057871971f;
-	pSH[143] = fTmpA*fC0;
-	pSH[121] = fTmpA*fS0;
-	fTmpB = -3.923210528935984f*fZ;
-	pSH[167] = fTmpB*fC0;
-	pSH[145] = fTmpB*fS0;
-	fTmpC = -14.71203948350994f*fZ2 + 0.5884815793403977f;
-	pSH[193] = fTmpC*fC0;
-	pSH[171] = fTmpC*fS0;
-	fTmpA = fZ*( -47.53605436066262f*fZ2 + 5.281783817851402f );
-	pSH[221] = fTmpA*fC0;
-	pSH[199] = fTmpA*fS0;
-	fC1 = fX*fC0 - fY*fS0;
-	fS1 = fX*fS0 + fY*fC0;
-
-	fTmpA = 0.8008219957839717f;
-	pSH[168] = fTmpA*fC1;
-	pSH[144] = fTmpA*fS1;
-	fTmpB = 4.161193153549645f*fZ;
-	pSH[194] = fTmpB*fC1;
-	pSH[170] = fTmpB*fS1;
-	fTmpC = 16.1471947939282f*fZ2 + -0.5980442516269705f;
-	pSH[222] = fTmpC*fC1;
-	pSH[198] = fTmpC*fS1;
-	fC0 = fX*fC1 - fY*fS1;
-	fS0 = fX*fS1 + fY*fC1;
-
-	fTmpA = -0.8160771188376284f;
-	pSH[195] = fTmpA*fC0;
-	pSH[169] = fTmpA*fS0;
-	fTmpB = -4.394709780272119f*fZ;
-	pSH[223] = fTmpB*fC0;
-	pSH[197] = fTmpB*fS0;
-	fC1 = fX*fC0 - fY*fS0;
-	fS1 = fX*fS0 + fY*fC0;
-
-	fTmpC = 0.830522083064524f;
-	pSH[224] = fTmpC*fC1;
-	pSH[196] = fTmpC*fS1;
-}
-
-// order 16
-void SHEval16( const float fX, const float fY, const float fZ, float *pSH )
-{
-	float fC0, fC1, fS0, fS1, fTmpA, fTmpB, fTmpC;
-	float fZ2 = fZ*fZ;
-
-	pSH[0] = 0.2820947917738781f;
-	pSH[2] = 0.4886025119029199f*fZ;
-	pSH[6] = 0.9461746957575601f*fZ2 + -0.3153915652525201f;
-	pSH[12] = fZ*( 1.865881662950577f*fZ2 + -1.119528997770346f );
-	pSH[20] = 1.984313483298443f*fZ*pSH[12] + -1.006230589874905f*pSH[6];
-	pSH[30] = 1.98997487421324f*fZ*pSH[20] + -1.002853072844814f*pSH[12];
-	pSH[42] = 1.993043457183567f*fZ*pSH[30] + -1.001542020962219f*pSH[20];
-	pSH[56] = 1.994891434824135f*fZ*pSH[42] + -1.000927213921958f*pSH[30];
-	pSH[72] = 1.996089927833914f*fZ*pSH[56] + -1.000600781069515f*pSH[42];
-	pSH[90] = 1.996911195067937f*fZ*pSH[72] + -1.000411437993134f*pSH[56];
-	pSH[110] = 1.997498435543818f*fZ*pSH[90] + -1.00029407440718f*pSH[72];
-	pSH[132] = 1.997932815985082f*fZ*pSH[110] + -1.000217462218511f*pSH[90];
-	pSH[156] = 1.998263134713633f*fZ*pSH[132] + -1.000165330248298f*pSH[110];
-	pSH[182] = 1.998520162579474f*fZ*pSH[156] + -1.000128625635621f*pSH[132];
-	pSH[210] = 1.998724082804747f*fZ*pSH[182] + -1.000102035610694f*pSH[156];
-	pSH[240] = 1.998888580075327f*fZ*pSH[210] + -1.00008230114001f*pSH[182];
-	fC0 = fX;
-	fS0 = fY;
-
-	fTmpA = -0.48860251190292f;
-	pSH[3] = fTmpA*fC0;
-	pSH[1] = fTmpA*fS0;
-	fTmpB = -1.092548430592079f*fZ;
-	pSH[7] = fTmpB*fC0;
-	pSH[5] = fTmpB*fS0;
-	fTmpC = -2.285228997322329f*fZ2 + 0.4570457994644658f;
-	pSH[13] = fTmpC*fC0;
-	pSH[11] = fTmpC*fS0;
-	fTmpA = fZ*( -4.683325804901025f*fZ2 + 2.007139630671868f );
-	pSH[21] = fTmpA*fC0;
-	pSH[19] = fTmpA*fS0;
-	fTmpB = 2.03100960115899f*fZ*fTmpA + -0.991031208965115f*fTmpC;
-	pSH[31] = fTmpB*fC0;
-	pSH[29] = fTmpB*fS0;
-	fTmpC = 2.021314989237028f*fZ*fTmpB + -0.9952267030562385f*fTmpA;
-	pSH[43] = fTmpC*fC0;
-	pSH[41] = fTmpC*fS0;
-	fTmpA = 2.015564437074638f*fZ*fTmpC + -0.9971550440218319f*fTmpB;
-	pSH[57] = fTmpA*fC0;
-	pSH[55] = fTmpA*fS0;
-	fTmpB = 2.011869540407391f*fZ*fTmpA + -0.9981668178901745f*fTmpC;
-	pSH[73] = fTmpB*fC0;
-	pSH[71] = fTmpB*fS0;
-	fTmpC = 2.009353129741012f*fZ*fTmpB + -0.9987492177719088f*fTmpA;
-	pSH[91] = fTmpC*fC0;
-	pSH[89] = fTmpC*fS0;
-	fTmpA = 2.007561463642653f*fZ*fTmpC + -0.9991083368712843f*fTmpB;
-	pSH[111] = fTmpA*fC0;
-	pSH[109] = fTmpA*fS0;
-	fTmpB = 2.006240264773888f*fZ*fTmpA + -0.9993418887079215f*fTmpC;
-	pSH[133] = fTmpB*fC0;
-	pSH[131] = fTmpB*fS0;
-	fTmpC = 2.005237896355199f*fZ*fTmpB + -0.9995003746877732f*fTmpA;
-	pSH[157] = fTmpC*fC0;
-	pSH[155] = fTmpC*fS0;
-	fTmpA = 2.004459314343183f*fZ*fTmpC + -0.9996117258638336f*fTmpB;
-	pSH[183] = fTmpA*fC0;
-	pSH[181] = fTmpA*fS0;
-	fTmpB = 2.003842462716222f*fZ*fTmpA + -0.9996922603404586f*fTmpC;
-	pSH[211] = fTmpB*fC0;
-	pSH[209] = fTmpB*fS0;
-	fTmpC = 2.003345416333104f*fZ*fTmpB + -0.9997519533634172f*fTmpA;
-	pSH[241] = fTmpC*fC0;
-	pSH[239] = fTmpC*fS0;
-	fC1 = fX*fC0 - fY*fS0;
-	fS1 = fX*fS0 + fY*fC0;
-
-	fTmpA = 0.5462742152960395f;
-	pSH[8] = fTmpA*fC1;
-	pSH[4] = fTmpA*fS1;
-	fTmpB = 1.445305721320277f*fZ;
-	pSH[14] = fTmpB*fC1;
-	pSH[10] = fTmpB*fS1;
-	fTmpC = 3.31161143515146f*fZ2 + -0.47308734787878f;
-	pSH[22] = fTmpC*fC1;
-	pSH[18] = fTmpC*fS1;
-	fTmpA = fZ*( 7.190305177459987f*fZ2 + -2.396768392486662f );
-	pSH[32] = fTmpA*fC1;
-	pSH[28] = fTmpA*fS1;
-	fTmpB = 2.11394181566097f*fZ*fTmpA + -0.9736101204623268f*fTmpC;
-	pSH[44] = fTmpB*fC1;
-	pSH[40] = fTmpB*fS1;
-	fTmpC = 2.081665999466133f*fZ*fTmpB + -0.9847319278346618f*fTmpA;
-	pSH[58] = fTmpC*fC1;
-	pSH[54] = fTmpC*fS1;
-	fTmpA = 2.06155281280883f*fZ*fTmpC + -0.9903379376602873f*fTmpB;
-	pSH[74] = fTmpA*fC1;
-	pSH[70] = fTmpA*fS1;
-	fTmpB = 2.048122358357819f*fZ*fTmpA + -0.9934852726704042f*fTmpC;
-	pSH[92] = fTmpB*fC1;
-	pSH[88] = fTmpB*fS1;
-	fTmpC = 2.038688303787511f*fZ*fTmpB + -0.9953938032404119f*fTmpA;
-	pSH[112] = fTmpC*fC1;
-	pSH[108] = fTmpC*fS1;
-	fTmpA = 2.031798495964875f*fZ*fTmpC + -0.9966204702259603f*fTmpB;
-	pSH[134] = fTmpA*fC1;
-	pSH[130] = fTmpA*fS1;
-	fTmpB = 2.026608708444444f*fZ*fTmpA + -0.9974457174120671f*fTmpC;
-	pSH[158] = fTmpB*fC1;
-	pSH[154] = fTmpB*fS1;
-	fTmpC = 2.022599587389726f*fZ*fTmpB + -0.9980217586956907f*fTmpA;
-	pSH[184] = fTmpC*fC1;
-	pSH[180] = fTmpC*fS1;
-	fTmpA = 2.019436802675439f*fZ*fTmpC + -0.998436277385793f*fTmpB;
-	pSH[212] = fTmpA*fC1;
-	pSH[208] = fTmpA*fS1;
-	fTmpB = 2.016896949069888f*fZ*fTmpA + -0.998742296068792f*fTmpC;
-	pSH[242] = fTmpB*fC1;
-	pSH[238] = fTmpB*fS1;
-	fC0 = fX*fC1 - fY*fS1;
-	fS0 = fX*fS1 + fY*fC1;
-
-	fTmpA = -0.5900435899266435f;
-	pSH[15] = fTmpA*fC0;
-	pSH[9] = fTmpA*fS0;
-	fTmpB = -1.770130769779931f*fZ;
-	pSH[23] = fTmpB*fC0;
-	pSH[17] = fTmpB*fS0;
-	fTmpC = -4.403144694917254f*fZ2 + 0.4892382994352505f;
-	pSH[33] = fTmpC*fC0;
-	pSH[27] = fTmpC*fS0;
-	fTmpA = fZ*( -10.13325785466416f*fZ2 + 2.763615778544771f );
-	pSH[45] = fTmpA*fC0;
-	pSH[39] = fTmpA*fS0;
-	fTmpB = 2.207940216581962f*fZ*fTmpA + -0.959403223600247f*fTmpC;
-	pSH[59] = fTmpB*fC0;
-	pSH[53] = fTmpB*fS0;
-	fTmpC = 2.15322168769582f*fZ*fTmpB + -0.9752173865600178f*fTmpA;
-	pSH[75] = fTmpC*fC0;
-	pSH[69] = fTmpC*fS0;
-	fTmpA = 2.118044171189805f*fZ*fTmpC + -0.9836628449792094f*fTmpB;
-	pSH[93] = fTmpA*fC0;
-	pSH[87] = fTmpA*fS0;
-	fTmpB = 2.093947321356338f*fZ*fTmpA + -0.9886230654859614f*fTmpC;
-	pSH[113] = fTmpB*fC0;
-	pSH[107] = fTmpB*fS0;
-	fTmpC = 2.076655965729519f*fZ*fTmpB + -0.9917422203269092f*fTmpA;
-	pSH[135] = fTmpC*fC0;
-	pSH[129] = fTmpC*fS0;
-	fTmpA = 2.063797291222968f*fZ*fTmpC + -0.9938079899999066f*fTmpB;
-	pSH[159] = fTmpA*fC0;
-	pSH[153] = fTmpA*fS0;
-	fTmpB = 2.053959590644373f*fZ*fTmpA + -0.9952332040455557f*fTmpC;
-	pSH[185] = fTmpB*fC0;
-	pSH[179] = fTmpB*fS0;
-	fTmpC = 2.046256527271464f*fZ*fTmpB + -0.9962496519366806f*fTmpA;
-	pSH[213] = fTmpC*fC0;
-	pSH[207] = fTmpC*fS0;
-	fTmpA = 2.040107114108727f*fZ*fTmpC + -0.9969947985109489f*fTmpB;
-	pSH[243] = fTmpA*fC0;
-	pSH[237] = fTmpA*fS0;
-	fC1 = fX*fC0 - fY*fS0;
-	fS1 = fX*fS0 + fY*fC0;
-
-	fTmpA = 0.6258357354491763f;
-	pSH[24] = fTmpA*fC1;
-	pSH[16] = fTmpA*fS1;
-	fTmpB = 2.075662314881041f*fZ;
-	pSH[34] = fTmpB*fC1;
-	pSH[26] = fTmpB*fS1;
-	fTmpC = 5.550213908015966f*fZ2 + -0.5045649007287241f;
-	pSH[46] = fTmpC*fC1;
-	pSH[38] = fTmpC*fS1;
-	fTmpA = fZ*( 13.49180504672677f*fZ2 + -3.113493472321562f );
-	pSH[60] = fTmpA*fC1;
-	pSH[52] = fTmpA*fS1;
-	fTmpB = 2.304886114323221f*fZ*fTmpA + -0.9481763873554654f*fTmpC;
-	pSH[76] = fTmpB*fC1;
-	pSH[68] = fTmpB*fS1;
-	fTmpC = 2.229177150706235f*fZ*fTmpB + -0.9671528397231821f*fTmpA;
-	pSH[94] = fTmpC*fC1;
-	pSH[86] = fTmpC*fS1;
-	fTmpA = 2.179449471770337f*fZ*fTmpC + -0.9776923610938036f*fTmpB;
-	pSH[114] = fTmpA*fC1;
-	pSH[106] = fTmpA*fS1;
-	fTmpB = 2.144761058952722f*fZ*fTmpA + -0.9840838646332836f*fTmpC;
-	pSH[136] = fTmpB*fC1;
-	pSH[128] = fTmpB*fS1;
-	fTmpC = 2.119478119726646f*fZ*fTmpB + -0.9882117688026186f*fTmpA;
-	pSH[160] = fTmpC*fC1;
-	pSH[152] = fTmpC*fS1;
-	fTmpA = 2.100420126042015f*fZ*fTmpC + -0.9910081668184009f*fTmpB;
-	pSH[186] = fTmpA*fC1;
-	pSH[178] = fTmpA*fS1;
-	fTmpB = 2.085665361461421f*fZ*fTmpA + -0.9929753269845127f*fTmpC;
-	pSH[214] = fTmpB*fC1;
-	pSH[206] = fTmpB*fS1;
-	fTmpC = 2.073990213742235f*fZ*fTmpB + -0.9944021951292297f*fTmpA;
-	pSH[244] = fTmpC*fC1;
-	pSH[236] = fTmpC*fS1;
-	fC0 = fX*fC1 - fY*fS1;
-	fS0 = fX*fS1 + fY*fC1;
-
-	fTmpA = -0.6563820568401703f;
-	pSH[35] = fTmpA*fC0;
-	pSH[25] = fTmpA*fS0;
-	fTmpB = -2.366619162231753f*fZ;
-	pSH[47] = fTmpB*fC0;
-	pSH[37] = fTmpB*fS0;
-	fTmpC = -6.745902523363385f*fZ2 + 0.5189155787202604f;
-	pSH[61] = fTmpC*fC0;
-	pSH[51] = fTmpC*fS0;
-	fTmpA = fZ*( -17.24955311049054f*fZ2 + 3.449910622098108f );
-	pSH[77] = fTmpA*fC0;
-	pSH[67] = fTmpA*fS0;
-	fTmpB = 2.401636346922062f*fZ*fTmpA + -0.9392246042043708f*fTmpC;
-	pSH[95] = fTmpB*fC0;
-	pSH[85] = fTmpB*fS0;
-	fTmpC = 2.306512518934159f*fZ*fTmpB + -0.9603920767980496f*fTmpA;
-	pSH[115] = fTmpC*fC0;
-	pSH[105] = fTmpC*fS0;
-	fTmpA = 2.243044805615795f*fZ*fTmpC + -0.9724832565193738f*fTmpB;
-	pSH[137] = fTmpA*fC0;
-	pSH[127] = fTmpA*fS0;
-	fTmpB = 2.198165774710643f*fZ*fTmpA + -0.9799919151000504f*fTmpC;
-	pSH[161] = fTmpB*fC0;
-	pSH[151] = fTmpB*fS0;
-	fTmpC = 2.165063509461097f*fZ*fTmpB + -0.9849409604906143f*fTmpA;
-	pSH[187] = fTmpC*fC0;
-	pSH[177] = fTmpC*fS0;
-	fTmpA = 2.139847510553276f*fZ*fTmpC + -0.9883532289941477f*fTmpB;
-	pSH[215] = fTmpA*fC0;
-	pSH[205] = fTmpA*fS0;
-	fTmpB = 2.120141504711419f*fZ*fTmpA + -0.99079092984679f*fTmpC;
-	pSH[245] = fTmpB*fC0;
-	pSH[235] = fTmpB*fS0;
-	fC1 = fX*fC0 - fY*fS0;
-	fS1 = fX*fS0 + fY*fC0;
-
-	fTmpA = 0.6831841051919144f;
-	pSH[48] = fTmpA*fC1;
-	pSH[36] = fTmpA*fS1;
-	fTmpB = 2.645960661801901f*fZ;
-	pSH[62] = fTmpB*fC1;
-	pSH[50] = fTmpB*fS1;
-	fTmpC = 7.984991490893139f*fZ2 + -0.5323327660595426f;
-	pSH[78] = fTmpC*fC1;
-	pSH[66] = fTmpC*fS1;
-	fTmpA = fZ*( 21.39289019090864f*fZ2 + -3.775215916042701f );
-	pSH[96] = fTmpA*fC1;
-	pSH[84] = fTmpA*fS1;
-	fTmpB = 2.496873044429773f*fZ*fTmpA + -0.9319689782769534f*fTmpC;
-	pSH[116] = fTmpB*fC1;
-	pSH[104] = fTmpB*fS1;
-	fTmpC = 2.383768642544085f*fZ*fTmpB + -0.9547015807880142f*fTmpA;
-	pSH[138] = fTmpC*fC1;
-	pSH[126] = fTmpC*fS1;
-	fTmpA = 2.307395517477243f*fZ*fTmpC + -0.9679611839405133f*fTmpB;
-	pSH[162] = fTmpA*fC1;
-	pSH[150] = fTmpA*fS1;
-	fTmpB = 2.252817784447915f*fZ*fTmpA + -0.9763466069791972f*fTmpC;
-	pSH[188] = fTmpB*fC1;
-	pSH[176] = fTmpB*fS1;
-	fTmpC = 2.212182180562893f*fZ*fTmpB + -0.9819623210693983f*fTmpA;
-	pSH[216] = fTmpC*fC1;
-	pSH[204] = fTmpC*fS1;
-	fTmpA = 2.180966243804281f*fZ*fTmpC + -0.9858890750350997f*fTmpB;
-	pSH[246] = fTmpA*fC1;
-	pSH[234] = fTmpA*fS1;
-	fC0 = fX*fC1 - fY*fS1;
-	fS0 = fX*fS1 + fY*fC1;
-
-	fTmpA = -0.7071627325245963f;
-	pSH[63] = fTmpA*fC0;
-	pSH[49] = fTmpA*fS0;
-	fTmpB = -2.91570664069932f*fZ;
-	pSH[79] = fTmpB*fC0;
-	pSH[65] = fTmpB*fS0;
-	fTmpC = -9.263393182848905f*fZ2 + 0.5449054813440533f;
-	pSH[97] = fTmpC*fC0;
-	pSH[83] = fTmpC*fS0;
-	fTmpA = fZ*( -25.9102413133663f*fZ2 + 4.091090733689416f );
-	pSH[117] = fTmpA*fC0;
-	pSH[103] = fTmpA*fS0;
-	fTmpB = 2.590045044653342f*fZ*fTmpA + -0.9259892765852515f*fTmpC;
-	pSH[139] = fTmpB*fC0;
-	pSH[125] = fTmpB*fS0;
-	fTmpC = 2.460209661583209f*fZ*fTmpB + -0.9498713802919554f*fTmpA;
-	pSH[163] = fTmpC*fC0;
-	pSH[149] = fTmpC*fS0;
-	fTmpA = 2.371708245126284f*fZ*fTmpC + -0.9640268803757269f*fTmpB;
-	pSH[189] = fTmpA*fC0;
-	pSH[175] = fTmpA*fS0;
-	fTmpB = 2.307927774486216f*fZ*fTmpA + -0.9731077923386515f*fTmpC;
-	pSH[217] = fTmpB*fC0;
-	pSH[203] = fTmpB*fS0;
-	fTmpC = 2.260078437898682f*fZ*fTmpB + -0.9792674029419375f*fTmpA;
-	pSH[247] = fTmpC*fC0;
-	pSH[233] = fTmpC*fS0;
-	fC1 = fX*fC0 - fY*fS0;
-	fS1 = fX*fS0 + fY*fC0;
-
-	fTmpA = 0.72892666017483f;
-	pSH[80] = fTmpA*fC1;
-	pSH[64] = fTmpA*fS1;
-	fTmpB = 3.177317648954698f*fZ;
-	pSH[98] = fTmpB*fC1;
-	pSH[82] = fTmpB*fS1;
-	fTmpC = 10.57781172168795f*fZ2 + -0.5567269327204184f;
-	pSH[118] = fTmpC*fC1;
-	pSH[102] = fTmpC*fS1;
-	fTmpA = fZ*( 30.79157970335749f*fZ2 + -4.398797100479641f );
-	pSH[140] = fTmpA*fC1;
-	pSH[124] = fTmpA*fS1;
-	fTmpB = 2.680951323690902f*fZ*fTmpA + -0.9209854970162591f*fTmpC;
-	pSH[164] = fTmpB*fC1;
-	pSH[148] = fTmpB*fS1;
-	fTmpC = 2.53546276418555f*fZ*fTmpB + -0.9457324874869209f*fTmpA;
-	pSH[190] = fTmpC*fC1;
-	pSH[174] = fTmpC*fS1;
-	fTmpA = 2.435532422657966f*fZ*fTmpC + -0.9605869417846947f*fTmpB;
-	pSH[218] = fTmpA*fC1;
-	pSH[202] = fTmpA*fS1;
-	fTmpB = 2.363017336304797f*fZ*fTmpA + -0.9702261872276653f*fTmpC;
-	pSH[248] = fTmpB*fC1;
-	pSH[232] = fTmpB*fS1;
-	fC0 = fX*fC1 - fY*fS1;
-	fS0 = fX*fS1 + fY*fC1;
-
-	fTmpA = -0.7489009518531884f;
-	pSH[99] = fTmpA*fC0;
-	pSH[81] = fTmpA*fS0;
-	fTmpB = -3.431895299891715f*fZ;
-	pSH[119] = fTmpB*fC0;
-	pSH[101] = fTmpB*fS0;
-	fTmpC = -11.92552753945219f*fZ2 + 0.5678822637834374f;
-	pSH[141] = fTmpC*fC0;
-	pSH[123] = fTmpC*fS0;
-	fTmpA = fZ*( -36.02809068931077f*fZ2 + 4.699316176866623f );
-	pSH[165] = fTmpA*fC0;
-	pSH[147] = fTmpA*fS0;
-	fTmpB = 2.769558547034986f*fZ*fTmpA + -0.9167415228748209f*fTmpC;
-	pSH[191] = fTmpB*fC0;
-	pSH[173] = fTmpB*fS0;
-	fTmpC = 2.609347744585592f*fZ*fTmpB + -0.9421529461361585f*fTmpA;
-	pSH[219] = fTmpC*fC0;
-	pSH[201] = fTmpC*fS0;
-	fTmpA = 2.498610725094158f*fZ*fTmpC + -0.9575614175146977f*fTmpB;
-	pSH[249] = fTmpA*fC0;
-	pSH[231] = fTmpA*fS0;
-	fC1 = fX*fC0 - fY*fS0;
-	fS1 = fX*fS0 + fY*fC0;
-
-	fTmpA = 0.7673951182219901f;
-	pSH[120] = fTmpA*fC1;
-	pSH[100] = fTmpA*fS1;
-	fTmpB = 3.680297698805312f*fZ;
-	pSH[142] = fTmpB*fC1;
-	pSH[122] = fTmpB*fS1;
-	fTmpC = 13.30425420025764f*fZ2 + -0.5784458347938103f;
-	pSH[166] = fTmpC*fC1;
-	pSH[146] = fTmpC*fS1;
-	fTmpA = fZ*( 41.61193153549645f*fZ2 + -4.993431784259574f );
-	pSH[192] = fTmpA*fC1;
-	pSH[172] = fTmpA*fS1;
-	fTmpB = 2.855914914698966f*fZ*fTmpA + -0.9130991183874837f*fTmpC;
-	pSH[220] = fTmpB*fC1;
-	pSH[200] = fTmpB*fS1;
-	fTmpC = 2.681790446697877f*fZ*fTmpB + -0.9390302326218141f*fTmpA;
-	pSH[250] = fTmpC*fC1;
-	pSH[230] = fTmpC*fS1;
-	fC0 = fX*fC1 - fY*fS1;
-	fS0 = fX*fS1 + fY*fC1;
-
-	fTmpA = -0.7846421057871971f;
-	pSH[143] = fTmpA*fC0;
-	pSH[121] = fTmpA*fS0;
-	fTmpB = -3.923210528935984f*fZ;
-	pSH[167] = fTmpB*fC0;
-	pSH[145] = fTmpB*fS0;
-	fTmpC = -14.71203948350994f*fZ2 + 0.5884815793403977f;
-	pSH[193] = fTmpC*fC0;
-	pSH[171] = fTmpC*fS0;
-	fTmpA = fZ*( -47.53605436066262f*fZ2 + 5.281783817851402f );
-	pSH[221] = fTmpA*fC0;
-	pSH[199] = fTmpA*fS0;
-	fTmpB = 2.940107271721691f*fZ*fTmpA + -0.9099403568319481f*fTmpC;
-	pSH[251] = fTmpB*fC0;
-	pSH[229] = fTmpB*fS0;
-	fC1 = fX*fC0 - fY*fS0;
-	fS1 = fX*fS0 + fY*fC0;
-
-	fTmpA = 0.8008219957839717f;
-	pSH[168] = fTmpA*fC1;
-	pSH[144] = fTmpA*fS1;
-	fTmpB = 4.161193153549645f*fZ;
-	pSH[194] = fTmpB*fC1;
-	pSH[170] = fTmpB*fS1;
-	fTmpC = 16.1471947939282f*fZ2 + -0.5980442516269705f;
-	pSH[222] = fTmpC*fC1;
-	pSH[198] = fTmpC*fS1;
-	fTmpA = fZ*( 53.79407212305809f*fZ2 + -5.564904012730148f );
-	pSH[252] = fTmpA*fC1;
-	pSH[228] = fTmpA*fS1;
-	fC0 = fX*fC1 - fY*fS1;
-	fS0 = fX*fS1 + fY*fC1;
-
-	fTmpA = -0.8160771188376284f;
-	pSH[195] = fTmpA*fC0;
-	pSH[169] = fTmpA*fS0;
-	fTmpB = -4.394709780272119f*fZ;
-	pSH[223] = fTmpB*fC0;
-	pSH[197] = fTmpB*fS0;
-	fTmpC = -17.60824338884482f*fZ2 + 0.6071808065118906f;
-	pSH[253] = fTmpC*fC0;
-	pSH[227] = fTmpC*fS0;
-	fC1 = fX*fC0 - fY*fS0;
-	fS1 = fX*fS0 + fY*fC0;
-
-	fTmpA = 0.830522083064524f;
-	pSH[224] = fTmpA*fC1;
-	pSH[196] = fTmpA*fS1;
-	fTmpB = 4.624151256630013f*fZ;
-	pSH[254] = fTmpB*fC1;
-	pSH[226] = fTmpB*fS1;
-	fC0 = fX*fC1 - fY*fS1;
-	fS0 = fX*fS1 + fY*fC1;
-
-	fTmpC = -0.8442506508573726f;
-	pSH[255] = fTmpC*fC0;
-	pSH[225] = fTmpC*fS0;
-}
-
-// order 17
-void SHEval17( const float fX, const float fY, const float fZ, float *pSH )
-{
-	float fC0, fC1, fS0, fS1, fTmpA, fTmpB, fTmpC;
-	float fZ2 = fZ*fZ;
-
-	pSH[0] = 0.2820947917738781f;
-	pSH[2] = 0.4886025119029199f*fZ;
-	pSH[6] = 0.9461746957575601f*fZ2 + -0.3153915652525201f;
-	pSH[12] = fZ*( 1.865881662950577f*fZ2 + -1.119528997770346f );
-	pSH[20] = 1.984313483298443f*fZ*pSH[12] + -1.006230589874905f*pSH[6];
-	pSH[30] = 1.98997487421324f*fZ*pSH[20] + -1.002853072844814f*pSH[12];
-	pSH[42] = 1.993043457183567f*fZ*pSH[30] + -1.001542020962219f*pSH[20];
-	pSH[56] = 1.994891434824135f*fZ*pSH[42] + -1.000927213921958f*pSH[30];
-	pSH[72] = 1.996089927833914f*fZ*pSH[56] + -1.000600781069515f*pSH[42];
-	pSH[90] = 1.996911195067937f*fZ*pSH[72] + -1.000411437993134f*pSH[56];
-	pSH[110] = 1.997498435543818f*fZ*pSH[90] + -1.00029407440718f*pSH[72];
-	pSH[132] = 1.997932815985082f*fZ*pSH[110] + -1.000217462218511f*pSH[90];
-	pSH[156] = 1.998263134713633f*fZ*pSH[132] + -1.000165330248298f*pSH[110];
-	pSH[182] = 1.998520162579474f*fZ*pSH[156] + -1.000128625635621f*pSH[132];
-	pSH[210] = 1.998724082804747f*fZ*pSH[182] + -1.000102035610694f*pSH[156];
-	pSH[240] = 1.998888580075327f*fZ*pSH[210] + -1.00008230114001f*pSH[182];
-	pSH[272] = 1.999023198964935f*fZ*pSH[240] + -1.00006734687013f*pSH[210];
-	fC0 = fX;
-	fS0 = fY;
-
-	fTmpA = -0.48860251190292f;
-	pSH[3] = fTmpA*fC0;
-	pSH[1] = fTmpA*fS0;
-	fTmpB = -1.092548430592079f*fZ;
-	pSH[7] = fTmpB*fC0;
-	pSH[5] = fTmpB*fS0;
-	fTmpC = -2.285228997322329f*fZ2 + 0.4570457994644658f;
-	pSH[13] = fTmpC*fC0;
-	pSH[11] = fTmpC*fS0;
-	fTmpA = fZ*( -4.683325804901025f*fZ2 + 2.007139630671868f );
-	pSH[21] = fTmpA*fC0;
-	pSH[19] = fTmpA*fS0;
-	fTmpB = 2.03100960115899f*fZ*fTmpA + -0.991031208965115f*fTmpC;
-	pSH[31] = fTmpB*fC0;
-	pSH[29] = fTmpB*fS0;
-	fTmpC = 2.021314989237028f*fZ*fTmpB + -0.9952267030562385f*fTmpA;
-	pSH[43] = fTmpC*fC0;
-	pSH[41] = fTmpC*fS0;
-	fTmpA = 2.015564437074638f*fZ*fTmpC + -0.9971550440218319f*fTmpB;
-	pSH[57] = fTmpA*fC0;
-	pSH[55] = fTmpA*fS0;
-	fTmpB = 2.011869540407391f*fZ*fTmpA + -0.9981668178901745f*fTmpC;
-	pSH[73] = fTmpB*fC0;
-	pSH[71] = fTmpB*fS0;
-	fTmpC = 2.009353129741012f*fZ*fTmpB + -0.9987492177719088f*fTmpA;
-	pSH[91] = fTmpC*fC0;
-	pSH[89] = fTmpC*fS0;
-	fTmpA = 2.007561463642653f*fZ*fTmpC + -0.9991083368712843f*fTmpB;
-	pSH[111] = fTmpA*fC0;
-	pSH[109] = fTmpA*fS0;
-	fTmpB = 2.006240264773888f*fZ*fTmpA + -0.9993418887079215f*fTmpC;
-	pSH[133] = fTmpB*fC0;
-	pSH[131] = fTmpB*fS0;
-	fTmpC = 2.005237896355199f*fZ*fTmpB + -0.9995003746877732f*fTmpA;
-	pSH[157] = fTmpC*fC0;
-	pSH[155] = fTmpC*fS0;
-	fTmpA = 2.004459314343183f*fZ*fTmpC + -0.9996117258638336f*fTmpB;
-	pSH[183] = fTmpA*fC0;
-	pSH[181] = fTmpA*fS0;
-	fTmpB = 2.003842462716222f*fZ*fTmpA + -0.9996922603404586f*fTmpC;
-	pSH[211] = fTmpB*fC0;
-	pSH[209] = fTmpB*fS0;
-	fTmpC = 2.003345416333104f*fZ*fTmpB + -0.9997519533634172f*fTmpA;
-	pSH[241] = fTmpC*fC0;
-	pSH[239] = fTmpC*fS0;
-	fTmpA = 2.002939017015334f*fZ*fTmpC + -0.9997971396672504f*fTmpB;
-	pSH[273] = fTmpA*fC0;
-	pSH[271] = fTmpA*fS0;
-	fC1 = fX*fC0 - fY*fS0;
-	fS1 = fX*fS0 + fY*fC0;
-
-	fTmpA = 0.5462742152960395f;
-	pSH[8] = fTmpA*fC1;
-	pSH[4] = fTmpA*fS1;
-	fTmpB = 1.445305721320277f*fZ;
-	pSH[14] = fTmpB*fC1;
-	pSH[10] = fTmpB*fS1;
-	fTmpC = 3.31161143515146f*fZ2 + -0.47308734787878f;
-	pSH[22] = fTmpC*fC1;
-	pSH[18] = fTmpC*fS1;
-	fTmpA = fZ*( 7.190305177459987f*fZ2 + -2.396768392486662f );
-	pSH[32] = fTmpA*fC1;
-	pSH[28] = fTmpA*fS1;
-	fTmpB = 2.11394181566097f*fZ*fTmpA + -0.9736101204623268f*fTmpC;
-	pSH[44] = fTmpB*fC1;
-	pSH[40] = fTmpB*fS1;
-	fTmpC = 2.081665999466133f*fZ*fTmpB + -0.9847319278346618f*fTmpA;
-	pSH[58] = fTmpC*fC1;
-	pSH[54] = fTmpC*fS1;
-	fTmpA = 2.06155281280883f*fZ*fTmpC + -0.9903379376602873f*fTmpB;
-	pSH[74] = fTmpA*fC1;
-	pSH[70] = fTmpA*fS1;
-	fTmpB = 2.048122358357819f*fZ*fTmpA + -0.9934852726704042f*fTmpC;
-	pSH[92] = fTmpB*fC1;
-	pSH[88] = fTmpB*fS1;
-	fTmpC = 2.038688303787511f*fZ*fTmpB + -0.9953938032404119f*fTmpA;
-	pSH[112] = fTmpC*fC1;
-	pSH[108] = fTmpC*fS1;
-	fTmpA = 2.031798495964875f*fZ*fTmpC + -0.9966204702259603f*fTmpB;
-	pSH[134] = fTmpA*fC1;
-	pSH[130] = fTmpA*fS1;
-	fTmpB = 2.026608708444444f*fZ*fTmpA + -0.9974457174120671f*fTmpC;
-	pSH[158] = fTmpB*fC1;
-	pSH[154] = fTmpB*fS1;
-	fTmpC = 2.022599587389726f*fZ*fTmpB + -0.9980217586956907f*fTmpA;
-	pSH[184] = fTmpC*fC1;
-	pSH[180] = fTmpC*fS1;
-	fTmpA = 2.019436802675439f*fZ*fTmpC + -0.998436277385793f*fTmpB;
-	pSH[212] = fTmpA*fC1;
-	pSH[208] = fTmpA*fS1;
-	fTmpB = 2.016896949069888f*fZ*fTmpA + -0.998742296068792f*fTmpC;
-	pSH[242] = fTmpB*fC1;
-	pSH[238] = fTmpB*fS1;
-	fTmpC = 2.014825999813336f*fZ*fTmpB + -0.9989732002631536f*fTmpA;
-	pSH[274] = fTmpC*fC1;
-	pSH[270] = fTmpC*fS1;
-	fC0 = fX*fC1 - fY*fS1;
-	fS0 = fX*fS1 + fY*fC1;
-
-	fTmpA = -0.5900435899266435f;
-	pSH[15] = fTmpA*fC0;
-	pSH[9] = fTmpA*fS0;
-	fTmpB = -1.770130769779931f*fZ;
-	pSH[23] = fTmpB*fC0;
-	pSH[17] = fTmpB*fS0;
-	fTmpC = -4.403144694917254f*fZ2 + 0.4892382994352505f;
-	pSH[33] = fTmpC*fC0;
-	pSH[27] = fTmpC*fS0;
-	fTmpA = fZ*( -10.13325785466416f*fZ2 + 2.763615778544771f );
-	pSH[45] = fTmpA*fC0;
-	pSH[39] = fTmpA*fS0;
-	fTmpB = 2.207940216581962f*fZ*fTmpA + -0.959403223600247f*fTmpC;
-	pSH[59] = fTmpB*fC0;
-	pSH[53] = fTmpB*fS0;
-	fTmpC = 2.15322168769582f*fZ*fTmpB + -0.9752173865600178f*fTmpA;
-	pSH[75] = fTmpC*fC0;
-	pSH[69] = fTmpC*fS0;
-	fTmpA = 2.118044171189805f*fZ*fTmpC + -0.9836628449792094f*fTmpB;
-	pSH[93] = fTmpA*fC0;
-	pSH[87] = fTmpA*fS0;
-	fTmpB = 2.093947321356338f*fZ*fTmpA + -0.9886230654859614f*fTmpC;
-	pSH[113] = fTmpB*fC0;
-	pSH[107] = fTmpB*fS0;
-	fTmpC = 2.076655965729519f*fZ*fTmpB + -0.9917422203269092f*fTmpA;
-	pSH[135] = fTmpC*fC0;
-	pSH[129] = fTmpC*fS0;
-	fTmpA = 2.063797291222968f*fZ*fTmpC + -0.9938079899999066f*fTmpB;
-	pSH[159] = fTmpA*fC0;
-	pSH[153] = fTmpA*fS0;
-	fTmpB = 2.053959590644373f*fZ*fTmpA + -0.9952332040455557f*fTmpC;
-	pSH[185] = fTmpB*fC0;
-	pSH[179] = fTmpB*fS0;
-	fTmpC = 2.046256527271464f*fZ*fTmpB + -0.9962496519366806f*fTmpA;
-	pSH[213] = fTmpC*fC0;
-	pSH[207] = fTmpC*fS0;
-	fTmpA = 2.040107114108727f*fZ*fTmpC + -0.9969947985109489f*fTmpB;
-	pSH[243] = fTmpA*fC0;
-	pSH[237] = fTmpA*fS0;
-	fTmpB = 2.035116803738375f*fZ*fTmpA + -0.9975538978635777f*fTmpC;
-	pSH[275] = fTmpB*fC0;
-	pSH[269] = fTmpB*fS0;
-	fC1 = fX*fC0 - fY*fS0;
-	fS1 = fX*fS0 + fY*fC0;
-
-	fTmpA = 0.6258357354491763f;
-	pSH[24] = fTmpA*fC1;
-	pSH[16] = fTmpA*fS1;
-	fTmpB = 2.075662314881041f*fZ;
-	pSH[34] = fTmpB*fC1;
-	pSH[26] = fTmpB*fS1;
-	fTmpC = 5.550213908015966f*fZ2 + -0.5045649007287241f;
-	pSH[46] = fTmpC*fC1;
-	pSH[38] = fTmpC*fS1;
-	fTmpA = fZ*( 13.49180504672677f*fZ2 + -3.113493472321562f );
-	pSH[60] = fTmpA*fC1;
-	pSH[52] = fTmpA*fS1;
-	fTmpB = 2.304886114323221f*fZ*fTmpA + -0.9481763873554654f*fTmpC;
-	pSH[76] = fTmpB*fC1;
-	pSH[68] = fTmpB*fS1;
-	fTmpC = 2.229177150706235f*fZ*fTmpB + -0.9671528397231821f*fTmpA;
-	pSH[94] = fTmpC*fC1;
-	pSH[86] = fTmpC*fS1;
-	fTmpA = 2.179449471770337f*fZ*fTmpC + -0.9776923610938036f*fTmpB;
-	pSH[114] = fTmpA*fC1;
-	pSH[106] = fTmpA*fS1;
-	fTmpB = 2.144761058952722f*fZ*fTmpA + -0.9840838646332836f*fTmpC;
-	pSH[136] = fTmpB*fC1;
-	pSH[128] = fTmpB*fS1;
-	fTmpC = 2.119478119726646f*fZ*fTmpB + -0.9882117688026186f*fTmpA;
-	pSH[160] = fTmpC*fC1;
-	pSH[152] = fTmpC*fS1;
-	fTmpA = 2.100420126042015f*fZ*fTmpC + -0.9910081668184009f*fTmpB;
-	pSH[186] = fTmpA*fC1;
-	pSH[178] = fTmpA*fS1;
-	fTmpB = 2.085665361461421f*fZ*fTmpA + -0.9929753269845127f*fTmpC;
-	pSH[214] = fTmpB*fC1;
-	pSH[206] = fTmpB*fS1;
-	fTmpC = 2.073990213742235f*fZ*fTmpB + -0.9944021951292297f*fTmpA;
-	pSH[244] = fTmpC*fC1;
-	pSH[236] = fTmpC*fS1;
-	fTmpA = 2.064582282206258f*fZ*fTmpC + -0.9954638496008124f*fTmpB;
-	pSH[276] = fTmpA*fC1;
-	pSH[268] = fTmpA*fS1;
-	fC0 = fX*fC1 - fY*fS1;
-	fS0 = fX*fS1 + fY*fC1;
-
-	fTmpA = -0.6563820568401703f;
-	pSH[35] = fTmpA*fC0;
-	pSH[25] = fTmpA*fS0;
-	fTmpB = -2.366619162231753f*fZ;
-	pSH[47] = fTmpB*fC0;
-	pSH[37] = fTmpB*fS0;
-	fTmpC = -6.745902523363385f*fZ2 + 0.5189155787202604f;
-	pSH[61] = fTmpC*fC0;
-	pSH[51] = fTmpC*fS0;
-	fTmpA = fZ*( -17.24955311049054f*fZ2 + 3.449910622098108f );
-	pSH[77] = fTmpA*fC0;
-	pSH[67] = fTmpA*fS0;
-	fTmpB = 2.401636346922062f*fZ*fTmpA + -0.9392246042043708f*fTmpC;
-	pSH[95] = fTmpB*fC0;
-	pSH[85] = fTmpB*fS0;
-	fTmpC = 2.306512518934159f*fZ*fTmpB + -0.9603920767980496f*fTmpA;
-	pSH[115] = fTmpC*fC0;
-	pSH[105] = fTmpC*fS0;
-	fTmpA = 2.243044805615795f*fZ*fTmpC + -0.9724832565193738f*fTmpB;
-	pSH[137] = fTmpA*fC0;
-	pSH[127] = fTmpA*fS0;
-	fTmpB = 2.198165774710643f*fZ*fTmpA + -0.9799919151000504f*fTmpC;
-	pSH[161] = fTmpB*fC0;
-	pSH[151] = fTmpB*fS0;
-	fTmpC = 2.165063509461097f*fZ*fTmpB + -0.9849409604906143f*fTmpA;
-	pSH[187] = fTmpC*fC0;
-	pSH[177] = fTmpC*fS0;
-	fTmpA = 2.139847510553276f*fZ*fTmpC + -0.9883532289941477f*fTmpB;
-	pSH[215] = fTmpA*fC0;
-	pSH[205] = fTmpA*fS0;
-	fTmpB = 2.120141504711419f*fZ*fTmpA + -0.99079092984679f*fTmpC;
-	pSH[245] = fTmpB*fC0;
-	pSH[235] = fTmpB*fS0;
-	fTmpC = 2.104417123236605f*fZ*fTmpB + -0.9925833339709304f*fTmpA;
-	pSH[277] = fTmpC*fC0;
-	pSH[267] = fTmpC*fS0;
-	fC1 = fX*fC0 - fY*fS0;
-	fS1 = fX*fS0 + fY*fC0;
-
-	fTmpA = 0.6831841051919144f;
-	pSH[48] = fTmpA*fC1;
-	pSH[36] = fTmpA*fS1;
-	fTmpB = 2.645960661801901f*fZ;
-	pSH[62] = fTmpB*fC1;
-	pSH[50] = fTmpB*fS1;
-	fTmpC = 7.984991490893139f*fZ2 + -0.5323327660595426f;
-	pSH[78] = fTmpC*fC1;
-	pSH[66] = fTmpC*fS1;
-	fTmpA = fZ*( 21.39289019090864f*fZ2 + -3.775215916042701f );
-	pSH[96] = fTmpA*fC1;
-	pSH[84] = fTmpA*fS1;
-	fTmpB = 2.496873044429773f*fZ*fTmpA + -0.9319689782769534f*fTmpC;
-	pSH[116] = fTmpB*fC1;
-	pSH[104] = fTmpB*fS1;
-	fTmpC = 2.383768642544085f*fZ*fTmpB + -0.9547015807880142f*fTmpA;
-	pSH[138] = fTmpC*fC1;
-	pSH[126] = fTmpC*fS1;
-	fTmpA = 2.307395517477243f*fZ*fTmpC + -0.9679611839405133f*fTmpB;
-	pSH[162] = fTmpA*fC1;
-	pSH[150] = fTmpA*fS1;
-	fTmpB = 2.252817784447915f*fZ*fTmpA + -0.9763466069791972f*fTmpC;
-	pSH[188] = fTmpB*fC1;
-	pSH[176] = fTmpB*fS1;
-	fTmpC = 2.212182180562893f*fZ*fTmpB + -0.9819623210693983f*fTmpA;
-	pSH[216] = fTmpC*fC1;
-	pSH[204] = fTmpC*fS1;
-	fTmpA = 2.180966243804281f*fZ*fTmpC + -0.9858890750350997f*fTmpB;
-	pSH[246] = fTmpA*fC1;
-	pSH[234] = fTmpA*fS1;
-	fTmpB = 2.156385865284782f*fZ*fTmpA + -0.9887295924045926f*fTmpC;
-	pSH[278] = fTmpB*fC1;
-	pSH[266] = fTmpB*fS1;
-	fC0 = fX*fC1 - fY*fS1;
-	fS0 = fX*fS1 + fY*fC1;
-
-	fTmpA = -0.7071627325245963f;
-	pSH[63] = fTmpA*fC0;
-	pSH[49] = fTmpA*fS0;
-	fTmpB = -2.91570664069932f*fZ;
-	pSH[79] = fTmpB*fC0;
-	pSH[65] = fTmpB*fS0;
-	fTmpC = -9.263393182848905f*fZ2 + 0.5449054813440533f;
-	pSH[97] = fTmpC*fC0;
-	pSH[83] = fTmpC*fS0;
-	fTmpA = fZ*( -25.9102413133663f*fZ2 + 4.091090733689416f );
-	pSH[117] = fTmpA*fC0;
-	pSH[103] = fTmpA*fS0;
-	fTmpB = 2.590045044653342f*fZ*fTmpA + -0.9259892765852515f*fTmpC;
-	pSH[139] = fTmpB*fC0;
-	pSH[125] = fTmpB*fS0;
-	fTmpC = 2.460209661583209f*fZ*fTmpB + -0.9498713802919554f*fTmpA;
-	pSH[163] = fTmpC*fC0;
-	pSH[149] = fTmpC*fS0;
-	fTmpA = 2.371708245126284f*fZ*fTmpC + -0.9640268803757269f*fTmpB;
-	pSH[189] = fTmpA*fC0;
-	pSH[175] = fTmpA*fS0;
-	fTmpB = 2.307927774486216f*fZ*fTmpA + -0.9731077923386515f*fTmpC;
-	pSH[217] = fTmpB*fC0;
-	pSH[203] = fTmpB*fS0;
-	fTmpC = 2.260078437898682f*fZ*fTmpB + -0.9792674029419375f*fTmpA;
-	pSH[247] = fTmpC*fC0;
-	pSH[233] = fTmpC*fS0;
-	fTmpA = 2.223067472099586f*fZ*fTmpC + -0.9836240348217709f*fTmpB;
-	pSH[279] = fTmpA*fC0;
-	pSH[265] = fTmpA*fS0;
-	fC1 = fX*fC0 - fY*fS0;
-	fS1 = fX*fS0 + fY*fC0;
-
-	fTmpA = 0.72892666017483f;
-	pSH[80] = fTmpA*fC1;
-	pSH[64] = fTmpA*fS1;
-	fTmpB = 3.177317648954698f*fZ;
-	pSH[98] = fTmpB*fC1;
-	pSH[82] = fTmpB*fS1;
-	fTmpC = 10.57781172168795f*fZ2 + -0.5567269327204184f;
-	pSH[118] = fTmpC*fC1;
-	pSH[102] = fTmpC*fS1;
-	fTmpA = fZ*( 30.79157970335749f*fZ2 + -4.398797100479641f );
-	pSH[140] = fTmpA*fC1;
-	pSH[124] = fTmpA*fS1;
-	fTmpB = 2.680951323690902f*fZ*fTmpA + -0.9209854970162591f*fTmpC;
-	pSH[164] = fTmpB*fC1;
-	pSH[148] = fTmpB*fS1;
-	fTmpC = 2.53546276418555f*fZ*fTmpB + -0.9457324874869209f*fTmpA;
-	pSH[190] = fTmpC*fC1;
-	pSH[174] = fTmpC*fS1;
-	fTmpA = 2.435532422657966f*fZ*fTmpC + -0.9605869417846947f*fTmpB;
-	pSH[218] = fTmpA*fC1;
-	pSH[202] = fTmpA*fS1;
-	fTmpB = 2.363017336304797f*fZ*fTmpA + -0.9702261872276653f*fTmpC;
-	pSH[248] = fTmpB*fC1;
-	pSH[232] = fTmpB*fS1;
-	fTmpC = 2.308273164077423f*fZ*fTmpB + -0.9768329366922968f*fTmpA;
-	pSH[280] = fTmpC*fC1;
-	pSH[264] = fTmpC*fS1;
-	fC0 = fX*fC1 - fY*fS1;
-	fS0 = fX*fS1 + fY*fC1;
-
-	fTmpA = -0.7489009518531884f;
-	pSH[99] = fTmpA*fC0;
-	pSH[81] = fTmpA*fS0;
-	fTmpB = -3.431895299891715f*fZ;
-	pSH[119] = fTmpB*fC0;
-	pSH[101] = fTmpB*fS0;
-	fTmpC = -11.92552753945219f*fZ2 + 0.5678822637834374f;
-	pSH[141] = fTmpC*fC0;
-	pSH[123] = fTmpC*fS0;
-	fTmpA = fZ*( -36.02809068931077f*fZ2 + 4.699316176866623f );
-	pSH[165] = fTmpA*fC0;
-	pSH[147] = fTmpA*fS0;
-	fTmpB = 2.769558547034986f*fZ*fTmpA + -0.9167415228748209f*fTmpC;
-	pSH[191] = fTmpB*fC0;
-	pSH[173] = fTmpB*fS0;
-	fTmpC = 2.609347744585592f*fZ*fTmpB + -0.9421529461361585f*fTmpA;
-	pSH[219] = fTmpC*fC0;
-	pSH[201] = fTmpC*fS0;
-	fTmpA = 2.498610725094158f*fZ*fTmpC + -0.9575614175146977f*fTmpB;
-	pSH[249] = fTmpA*fC0;
-	pSH[231] = fTmpA*fS0;
-	fTmpB = 2.417791199776004f*fZ*fTmpA + -0.9676542149977727f*fTmpC;
-	pSH[281] = fTmpB*fC0;
-	pSH[263] = fTmpB*fS0;
-	fC1 = fX*fC0 - fY*fS0;
-	fS1 = fX*fS0 + fY*fC0;
-
-	fTmpA = 0.7673951182219901f;
-	pSH[120] = fTmpA*fC1;
-	pSH[100] = fTmpA*fS1;
-	fTmpB = 3.680297698805312f*fZ;
-	pSH[142] = fTmpB*fC1;
-	pSH[122] = fTmpB*fS1;
-	fTmpC = 13.30425420025764f*fZ2 + -0.5784458347938103f;
-	pSH[166] = fTmpC*fC1;
-	pSH[146] = fTmpC*fS1;
-	fTmpA = fZ*( 41.61193153549645f*fZ2 + -4.993431784259574f );
-	pSH[192] = fTmpA*fC1;
-	pSH[172] = fTmpA*fS1;
-	fTmpB = 2.855914914698966f*fZ*fTmpA + -0.9130991183874837f*fTmpC;
-	pSH[220] = fTmpB*fC1;
-	pSH[200] = fTmpB*fS1;
-	fTmpC = 2.681790446697877f*fZ*fTmpB + -0.9390302326218141f*fTmpA;
-	pSH[250] = fTmpC*fC1;
-	pSH[230] = fTmpC*fS1;
-	fTmpA = 2.560799154110355f*fZ*fTmpC + -0.9548841361798045f*fTmpB;
-	pSH[282] = fTmpA*fC1;
-	pSH[262] = fTmpA*fS1;
-	fC0 = fX*fC1 - fY*fS1;
-	fS0 = fX*fS1 + fY*fC1;
-
-	fTmpA = -0.7846421057871971f;
-	pSH[143] = fTmpA*fC0;
-	pSH[121] = fTmpA*fS0;
-	fTmpB = -3.923210528935984f*fZ;
-	pSH[167] = fTmpB*fC0;
-	pSH[145] = fTmpB*fS0;
-	fTmpC = -14.71203948350994f*fZ2 + 0.5884815793403977f;
-	pSH[193] = fTmpC*fC0;
-	pSH[171] = fTmpC*fS0;
-	fTmpA = fZ*( -47.53605436066262f*fZ2 + 5.281783817851402f );
-	pSH[221] = fTmpA*fC0;
-	pSH[199] = fTmpA*fS0;
-	fTmpB = 2.940107271721691f*fZ*fTmpA + -0.9099403568319481f*fTmpC;
-	pSH[251] = fTmpB*fC0;
-	pSH[229] = fTmpB*fS0;
-	fTmpC = 2.752776376275011f*fZ*fTmpB + -0.9362843331437419f*fTmpA;
-	pSH[283] = fTmpC*fC0;
-	pSH[261] = fTmpC*fS0;
-	fC1 = fX*fC0 - fY*fS0;
-	fS1 = fX*fS0 + fY*fC0;
-
-	fTmpA = 0.8008219957839717f;
-	pSH[168] = fTmpA*fC1;
-	pSH[144] = fTmpA*fS1;
-	fTmpB = 4.161193153549645f*fZ;
-	pSH[194] = fTmpB*fC1;
-	pSH[170] = fTmpB*fS1;
-	fTmpC = 16.1471947939282f*fZ2 + -0.5980442516269705f;
-	pSH[222] = fTmpC*fC1;
-	pSH[198] = fTmpC*fS1;
-	fTmpA = fZ*( 53.79407212305809f*fZ2 + -5.564904012730148f );
-	pSH[252] = fTmpA*fC1;
-	pSH[228] = fTmpA*fS1;
-	fTmpB = 3.022238999720004f*fZ*fTmpA + -0.9071758265604122f*fTmpC;
-	pSH[284] = fTmpB*fC1;
-	pSH[260] = fTmpB*fS1;
-	fC0 = fX*fC1 - fY*fS1;
-	fS0 = fX*fS1 + fY*fC1;
-
-	fTmpA = -0.8160771188376284f;
-	pSH[195] = fTmpA*fC0;
-	pSH[169] = fTmpA*fS0;
-	fTmpB = -4.394709780272119f*fZ;
-	pSH[223] = fTmpB*fC0;
-	pSH[197] = fTmpB*fS0;
-	fTmpC = -17.60824338884482f*fZ2 + 0.6071808065118906f;
-	pSH[253] = fTmpC*fC0;
-	pSH[227] = fTmpC*fS0;
-	fTmpA = fZ*( -60.38015494295203f*fZ2 + 5.843240800930841f );
-	pSH[285] = fTmpA*fC0;
-	pSH[259] = fTmpA*fS0;
-	fC1 = fX*fC0 - fY*fS0;
-	fS1 = fX*fS0 + fY*fC0;
-
-	fTmpA = 0.830522083064524f;
-	pSH[224] = fTmpA*fC1;
-	pSH[196] = fTmpA*fS1;
-	fTmpB = 4.624151256630013f*fZ;
-	pSH[254] = fTmpB*fC1;
-	pSH[226] = fTmpB*fS1;
-	fTmpC = 19.09388150936025f*fZ2 + -0.6159316615922662f;
-	pSH[286] = fTmpC*fC1;
-	pSH[258] = fTmpC*fS1;
-	fC0 = fX*fC1 - fY*fS1;
-	fS0 = fX*fS1 + fY*fC1;
-
-	fTmpA = -0.8442506508573726f;
-	pSH[255] = fTmpA*fC0;
-	pSH[225] = fTmpA*fS0;
-	fTmpB = -4.849850753230682f*fZ;
-	pSH[287] = fTmpB*fC0;
-	pSH[257] = fTmpB*fS0;
-	fC1 = fX*fC0 - fY*fS0;
-	fS1 = fX*fS0 + fY*fC0;
-
-	fTmpC = 0.8573405888380252f;
-	pSH[288] = fTmpC*fC1;
-	pSH[256] = fTmpC*fS1;
-}
-
-// order 18
-void SHEval18( const float fX, const float fY, const float fZ, float *pSH )
-{
-	float fC0, fC1, fS0, fS1, fTmpA, fTmpB, fTmpC;
-	float fZ2 = fZ*fZ;
-
-	pSH[0] = 0.2820947917738781f;
-	pSH[2] = 0.4886025119029199f*fZ;
-	pSH[6] = 0.9461746957575601f*fZ2 + -0.3153915652525201f;
-	pSH[12] = fZ*( 1.865881662950577f*fZ2 + -1.119528997770346f );
-	pSH[20] = 1.984313483298443f*fZ*pSH[12] + -1.006230589874905f*pSH[6];
-	pSH[30] = 1.98997487421324f*fZ*pSH[20] + -1.002853072844814f*pSH[12];
-	pSH[42] = 1.993043457183567f*fZ*pSH[30] + -1.001542020962219f*pSH[20];
-	pSH[56] = 1.994891434824135f*fZ*pSH[42] + -1.000927213921958f*pSH[30];
-	pSH[72] = 1.996089927833914f*fZ*pSH[56] + -1.000600781069515f*pSH[42];
-	pSH[90] = 1.996911195067937f*fZ*pSH[72] + -1.000411437993134f*pSH[56];
-	pSH[110] = 1.997498435543818f*fZ*pSH[90] + -1.00029407440718f*pSH[72];
-	pSH[132] = 1.997932815985082f*fZ*pSH[110] + -1.000217462218511f*pSH[90];
-	pSH[156] = 1.998263134713633f*fZ*pSH[132] + -1.000165330248298f*pSH[110];
-	pSH[182] = 1.998520162579474f*fZ*pSH[156] + -1.000128625635621f*pSH[132];
-	pSH[210] = 1.998724082804747f*fZ*pSH[182] + -1.000102035610694f*pSH[156];
-	pSH[240] = 1.998888580075327f*fZ*pSH[210] + -1.00008230114001f*pSH[182];
-	pSH[272] = 1.999023198964935f*fZ*pSH[240] + -1.00006734687013f*pSH[210];
-	pSH[306] = 1.999134760937227f*fZ*pSH[272] + -1.000055808242921f*pSH[240];
-	fC0 = fX;
-	fS0 = fY;
-
-	fTmpA = -0.48860251190292f;
-	pSH[3] = fTmpA*fC0;
-	pSH[1] = fTmpA*fS0;
-	fTmpB = -1.092548430592079f*fZ;
-	pSH[7] = fTmpB*fC0;
-	pSH[5] = fTmpB*fS0;
-	fTmpC = -2.285228997322329f*fZ2 + 0.4570457994644658f;
-	pSH[13] = fTmpC*fC0;
-	pSH[11] = fTmpC*fS0;
-	fTmpA = fZ*( -4.683325804901025f*fZ2 + 2.007139630671868f );
-	pSH[21] = fTmpA*fC0;
-	pSH[19] = fTmpA*fS0;
-	fTmpB = 2.03100960115899f*fZ*fTmpA + -0.991031208965115f*fTmpC;
-	pSH[31] = fTmpB*fC0;
-	pSH[29] = fTmpB*fS0;
-	fTmpC = 2.021314989237028f*fZ*fTmpB + -0.9952267030562385f*fTmpA;
-	pSH[43] = fTmpC*fC0;
-	pSH[41] = fTmpC*fS0;
-	fTmpA = 2.015564437074638f*fZ*fTmpC + -0.9971550440218319f*fTmpB;
-	pSH[57] = fTmpA*fC0;
-	pSH[55] = fTmpA*fS0;
-	fTmpB = 2.011869540407391f*fZ*fTmpA + -0.9981668178901745f*fTmpC;
-	pSH[73] = fTmpB*fC0;
-	pSH[71] = fTmpB*fS0;
-	fTmpC = 2.009353129741012f*fZ*fTmpB + -0.9987492177719088f*fTmpA;
-	pSH[91] = fTmpC*fC0;
-	pSH[89] = fTmpC*fS0;
-	fTmpA = 2.007561463642653f*fZ*fTmpC + -0.9991083368712843f*fTmpB;
-	pSH[111] = fTmpA*fC0;
-	pSH[109] = fTmpA*fS0;
-	fTmpB = 2.006240264773888f*fZ*fTmpA + -0.9993418887079215f*fTmpC;
-	pSH[133] = fTmpB*fC0;
-	pSH[131] = fTmpB*fS0;
-	fTmpC = 2.005237896355199f*fZ*fTmpB + -0.9995003746877732f*fTmpA;
-	pSH[157] = fTmpC*fC0;
-	pSH[155] = fTmpC*fS0;
-	fTmpA = 2.004459314343183f*fZ*fTmpC + -0.9996117258638336f*fTmpB;
-	pSH[183] = fTmpA*fC0;
-	pSH[181] = fTmpA*fS0;
-	fTmpB = 2.003842462716222f*fZ*fTmpA + -0.9996922603404586f*fTmpC;
-	pSH[211] = fTmpB*fC0;
-	pSH[209] = fTmpB*fS0;
-	fTmpC = 2.003345416333104f*fZ*fTmpB + -0.9997519533634172f*fTmpA;
-	pSH[241] = fTmpC*fC0;
-	pSH[239] = fTmpC*fS0;
-	fTmpA = 2.002939017015334f*fZ*fTmpC + -0.9997971396672504f*fTmpB;
-	pSH[273] = fTmpA*fC0;
-	pSH[271] = fTmpA*fS0;
-	fTmpB = 2.002602473449653f*fZ*fTmpA + -0.9998319751311335f*fTmpC;
-	pSH[307] = fTmpB*fC0;
-	pSH[305] = fTmpB*fS0;
-	fC1 = fX*fC0 - fY*fS0;
-	fS1 = fX*fS0 + fY*fC0;
-
-	fTmpA = 0.5462742152960395f;
-	pSH[8] = fTmpA*fC1;
-	pSH[4] = fTmpA*fS1;
-	fTmpB = 1.445305721320277f*fZ;
-	pSH[14] = fTmpB*fC1;
-	pSH[10] = fTmpB*fS1;
-	fTmpC = 3.31161143515146f*fZ2 + -0.47308734787878f;
-	pSH[22] = fTmpC*fC1;
-	pSH[18] = fTmpC*fS1;
-	fTmpA = fZ*( 7.190305177459987f*fZ2 + -2.396768392486662f );
-	pSH[32] = fTmpA*fC1;
-	pSH[28] = fTmpA*fS1;
-	fTmpB = 2.11394181566097f*fZ*fTmpA + -0.9736101204623268f*fTmpC;
-	pSH[44] = fTmpB*fC1;
-	pSH[40] = fTmpB*fS1;
-	fTmpC = 2.081665999466133f*fZ*fTmpB + -0.9847319278346618f*fTmpA;
-	pSH[58] = fTmpC*fC1;
-	pSH[54] = fTmpC*fS1;
-	fTmpA = 2.06155281280883f*fZ*fTmpC + -0.9903379376602873f*fTmpB;
-	pSH[74] = fTmpA*fC1;
-	pSH[70] = fTmpA*fS1;
-	fTmpB = 2.048122358357819f*fZ*fTmpA + -0.9934852726704042f*fTmpC;
-	pSH[92] = fTmpB*fC1;
-	pSH[88] = fTmpB*fS1;
-	fTmpC = 2.038688303787511f*fZ*fTmpB + -0.9953938032404119f*fTmpA;
-	pSH[112] = fTmpC*fC1;
-	pSH[108] = fTmpC*fS1;
-	fTmpA = 2.031798495964875f*fZ*fTmpC + -0.9966204702259603f*fTmpB;
-	pSH[134] = fTmpA*fC1;
-	pSH[130] = fTmpA*fS1;
-	fTmpB = 2.026608708444444f*fZ*fTmpA + -0.9974457174120671f*fTmpC;
-	pSH[158] = fTmpB*fC1;
-	pSH[154] = fTmpB*fS1;
-	fTmpC = 2.022599587389726f*fZ*fTmpB + -0.9980217586956907f*fTmpA;
-	pSH[184] = fTmpC*fC1;
-	pSH[180] = fTmpC*fS1;
-	fTmpA = 2.019436802675439f*fZ*fTmpC + -0.998436277385793f*fTmpB;
-	pSH[212] = fTmpA*fC1;
-	pSH[208] = fTmpA*fS1;
-	fTmpB = 2.016896949069888f*fZ*fTmpA + -0.998742296068792f*fTmpC;
-	pSH[242] = fTmpB*fC1;
-	pSH[238] = fTmpB*fS1;
-	fTmpC = 2.014825999813336f*fZ*fTmpB + -0.9989732002631536f*fTmpA;
-	pSH[274] = fTmpC*fC1;
-	pSH[270] = fTmpC*fS1;
-	fTmpA = 2.013114894621608f*fZ*fTmpC + -0.9991507429465936f*fTmpB;
-	pSH[308] = fTmpA*fC1;
-	pSH[304] = fTmpA*fS1;
-	fC0 = fX*fC1 - fY*fS1;
-	fS0 = fX*fS1 + fY*fC1;
-
-	fTmpA = -0.5900435899266435f;
-	pSH[15] = fTmpA*fC0;
-	pSH[9] = fTmpA*fS0;
-	fTmpB = -1.770130769779931f*fZ;
-	pSH[23] = fTmpB*fC0;
-	pSH[17] = fTmpB*fS0;
-	fTmpC = -4.403144694917254f*fZ2 + 0.4892382994352505f;
-	pSH[33] = fTmpC*fC0;
-	pSH[27] = fTmpC*fS0;
-	fTmpA = fZ*( -10.13325785466416f*fZ2 + 2.763615778544771f );
-	pSH[45] = fTmpA*fC0;
-	pSH[39] = fTmpA*fS0;
-	fTmpB = 2.207940216581962f*fZ*fTmpA + -0.959403223600247f*fTmpC;
-	pSH[59] = fTmpB*fC0;
-	pSH[53] = fTmpB*fS0;
-	fTmpC = 2.15322168769582f*fZ*fTmpB + -0.9752173865600178f*fTmpA;
-	pSH[75] = fTmpC*fC0;
-	pSH[69] = fTmpC*fS0;
-	fTmpA = 2.118044171189805f*fZ*fTmpC + -0.9836628449792094f*fTmpB;
-	pSH[93] = fTmpA*fC0;
-	pSH[87] = fTmpA*fS0;
-	fTmpB = 2.093947321356338f*fZ*fTmpA + -0.9886230654859614f*fTmpC;
-	pSH[113] = fTmpB*fC0;
-	pSH[107] = fTmpB*fS0;
-	fTmpC = 2.076655965729519f*fZ*fTmpB + -0.9917422203269092f*fTmpA;
-	pSH[135] = fTmpC*fC0;
-	pSH[129] = fTmpC*fS0;
-	fTmpA = 2.063797291222968f*fZ*fTmpC + -0.9938079899999066f*fTmpB;
-	pSH[159] = fTmpA*fC0;
-	pSH[153] = fTmpA*fS0;
-	fTmpB = 2.053959590644373f*fZ*fTmpA + -0.9952332040455557f*fTmpC;
-	pSH[185] = fTmpB*fC0;
-	pSH[179] = fTmpB*fS0;
-	fTmpC = 2.046256527271464f*fZ*fTmpB + -0.9962496519366806f*fTmpA;
-	pSH[213] = fTmpC*fC0;
-	pSH[207] = fTmpC*fS0;
-	fTmpA = 2.040107114108727f*fZ*fTmpC + -0.9969947985109489f*fTmpB;
-	pSH[243] = fTmpA*fC0;
-	pSH[237] = fTmpA*fS0;
-	fTmpB = 2.035116803738375f*fZ*fTmpA + -0.9975538978635777f*fTmpC;
-	pSH[275] = fTmpB*fC0;
-	pSH[269] = fTmpB*fS0;
-	fTmpC = 2.03100960115899f*fZ*fTmpB + -0.9979818344716921f*fTmpA;
-	pSH[309] = fTmpC*fC0;
-	pSH[303] = fTmpC*fS0;
-	fC1 = fX*fC0 - fY*fS0;
-	fS1 = fX*fS0 + fY*fC0;
-
-	fTmpA = 0.6258357354491763f;
-	pSH[24] = fTmpA*fC1;
-	pSH[16] = fTmpA*fS1;
-	fTmpB = 2.075662314881041f*fZ;
-	pSH[34] = fTmpB*fC1;
-	pSH[26] = fTmpB*fS1;
-	fTmpC = 5.550213908015966f*fZ2 + -0.5045649007287241f;
-	pSH[46] = fTmpC*fC1;
-	pSH[38] = fTmpC*fS1;
-	fTmpA = fZ*( 13.49180504672677f*fZ2 + -3.113493472321562f );
-	pSH[60] = fTmpA*fC1;
-	pSH[52] = fTmpA*fS1;
-	fTmpB = 2.304886114323221f*fZ*fTmpA + -0.9481763873554654f*fTmpC;
-	pSH[76] = fTmpB*fC1;
-	pSH[68] = fTmpB*fS1;
-	fTmpC = 2.229177150706235f*fZ*fTmpB + -0.9671528397231821f*fTmpA;
-	pSH[94] = fTmpC*fC1;
-	pSH[86] = fTmpC*fS1;
-	fTmpA = 2.179449471770337f*fZ*fTmpC + -0.9776923610938036f*fTmpB;
-	pSH[114] = fTmpA*fC1;
-	pSH[106] = fTmpA*fS1;
-	fTmpB = 2.144761058952722f*fZ*fTmpA + -0.9840838646332836f*fTmpC;
-	pSH[136] = fTmpB*fC1;
-	pSH[128] = fTmpB*fS1;
-	fTmpC = 2.119478119726646f*fZ*fTmpB + -0.9882117688026186f*fTmpA;
-	pSH[160] = fTmpC*fC1;
-	pSH[152] = fTmpC*fS1;
-	fTmpA = 2.100420126042015f*fZ*fTmpC + -0.9910081668184009f*fTmpB;
-	pSH[186] = fTmpA*fC1;
-	pSH[178] = fTmpA*fS1;
-	fTmpB = 2.085665361461421f*fZ*fTmpA + -0.9929753269845127f*fTmpC;
-	pSH[214] = fTmpB*fC1;
-	pSH[206] = fTmpB*fS1;
-	fTmpC = 2.073990213742235f*fZ*fTmpB + -0.9944021951292297f*fTmpA;
-	pSH[244] = fTmpC*fC1;
-	pSH[236] = fTmpC*fS1;
-	fTmpA = 2.064582282206258f*fZ*fTmpC + -0.9954638496008124f*fTmpB;
-	pSH[276] = fTmpA*fC1;
-	pSH[268] = fTmpA*fS1;
-	fTmpB = 2.056883378018606f*fZ*fTmpA + -0.996270962773436f*fTmpC;
-	pSH[310] = fTmpB*fC1;
-	pSH[302] = fTmpB*fS1;
-	fC0 = fX*fC1 - fY*fS1;
-	fS0 = fX*fS1 + fY*fC1;
-
-	fTmpA = -0.6563820568401703f;
-	pSH[35] = fTmpA*fC0;
-	pSH[25] = fTmpA*fS0;
-	fTmpB = -2.366619162231753f*fZ;
-	pSH[47] = fTmpB*fC0;
-	pSH[37] = fTmpB*fS0;
-	fTmpC = -6.745902523363385f*fZ2 + 0.5189155787202604f;
-	pSH[61] = fTmpC*fC0;
-	pSH[51] = fTmpC*fS0;
-	fTmpA = fZ*( -17.24955311049054f*fZ2 + 3.449910622098108f );
-	pSH[77] = fTmpA*fC0;
-	pSH[67] = fTmpA*fS0;
-	fTmpB = 2.401636346922062f*fZ*fTmpA + -0.9392246042043708f*fTmpC;
-	pSH[95] = fTmpB*fC0;
-	pSH[85] = fTmpB*fS0;
-	fTmpC = 2.306512518934159f*fZ*fTmpB + -0.9603920767980496f*fTmpA;
-	pSH[115] = fTmpC*fC0;
-	pSH[105] = fTmpC*fS0;
-	fTmpA = 2.243044805615795f*fZ*fTmpC + -0.9724832565193738f*fTmpB;
-	pSH[137] = fTmpA*fC0;
-	pSH[127] = fTmpA*fS0;
-	fTmpB = 2.198165774710643f*fZ*fTmpA + -0.9799919151000504f*fTmpC;
-	pSH[161] = fTmpB*fC0;
-	pSH[151] = fTmpB*fS0;
-	fTmpC = 2.165063509461097f*fZ*fTmpB + -0.9849409604906143f*fTmpA;
-	pSH[187] = fTmpC*fC0;
-	pSH[177] = fTmpC*fS0;
-	fTmpA = 2.139847510553276f*fZ*fTmpC + -0.9883532289941477f*fTmpB;
-	pSH[215] = fTmpA*fC0;
-	pSH[205] = fTmpA*fS0;
-	fTmpB = 2.120141504711419f*fZ*fTmpA + -0.99079092984679f*fTmpC;
-	pSH[245] = fTmpB*fC0;
-	pSH[235] = fTmpB*fS0;
-	fTmpC = 2.104417123236605f*fZ*fTmpB + -0.9925833339709304f*fTmpA;
-	pSH[277] = fTmpC*fC0;
-	pSH[267] = fTmpC*fS0;
-	fTmpA = 2.091650066335189f*fZ*fTmpC + -0.9939332099323633f*fTmpB;
-	pSH[311] = fTmpA*fC0;
-	pSH[301] = fTmpA*fS0;
-	fC1 = fX*fC0 - fY*fS0;
-	fS1 = fX*fS0 + fY*fC0;
-
-	fTmpA = 0.6831841051919144f;
-	pSH[48] = fTmpA*fC1;
-	pSH[36] = fTmpA*fS1;
-	fTmpB = 2.645960661801901f*fZ;
-	pSH[62] = fTmpB*fC1;
-	pSH[50] = fTmpB*fS1;
-	fTmpC = 7.984991490893139f*fZ2 + -0.5323327660595426f;
-	pSH[78] = fTmpC*fC1;
-	pSH[66] = fTmpC*fS1;
-	fTmpA = fZ*( 21.39289019090864f*fZ2 + -3.775215916042701f );
-	pSH[96] = fTmpA*fC1;
-	pSH[84] = fTmpA*fS1;
-	fTmpB = 2.496873044429773f*fZ*fTmpA + -0.9319689782769534f*fTmpC;
-	pSH[116] = fTmpB*fC1;
-	pSH[104] = fTmpB*fS1;
-	fTmpC = 2.383768642544085f*fZ*fTmpB + -0.9547015807880142f*fTmpA;
-	pSH[138] = fTmpC*fC1;
-	pSH[126] = fTmpC*fS1;
-	fTmpA = 2.307395517477243f*fZ*fTmpC + -0.9679611839405133f*fTmpB;
-	pSH[162] = fTmpA*fC1;
-	pSH[150] = fTmpA*fS1;
-	fTmpB = 2.252817784447915f*fZ*fTmpA + -0.9763466069791972f*fTmpC;
-	pSH[188] = fTmpB*fC1;
-	pSH[176] = fTmpB*fS1;
-	fTmpC = 2.212182180562893f*fZ*fTmpB + -0.9819623210693983f*fTmpA;
-	pSH[216] = fTmpC*fC1;
-	pSH[204] = fTmpC*fS1;
-	fTmpA = 2.180966243804281f*fZ*fTmpC + -0.9858890750350997f*fTmpB;
-	pSH[246] = fTmpA*fC1;
-	pSH[234] = fTmpA*fS1;
-	fTmpB = 2.156385865284782f*fZ*fTmpA + -0.9887295924045926f*fTmpC;
-	pSH[278] = fTmpB*fC1;
-	pSH[266] = fTmpB*fS1;
-	fTmpC = 2.13663693483576f*fZ*fTmpB + -0.9908416528011255f*fTmpA;
-	pSH[312] = fTmpC*fC1;
-	pSH[300] = fTmpC*fS1;
-	fC0 = fX*fC1 - fY*fS1;
-	fS0 = fX*fS1 + fY*fC1;
-
-	fTmpA = -0.7071627325245963f;
-	pSH[63] = fTmpA*fC0;
-	pSH[49] = fTmpA*fS0;
-	fTmpB = -2.91570664069932f*fZ;
-	pSH[79] = fTmpB*fC0;
-	pSH[65] = fTmpB*fS0;
-	fTmpC = -9.263393182848905f*fZ2 + 0.5449054813440533f;
-	pSH[97] = fTmpC*fC0;
-	pSH[83] = fTmpC*fS0;
-	fTmpA = fZ*( -25.9102413133663f*fZ2 + 4.091090733689416f );
-	pSH[117] = fTmpA*fC0;
-	pSH[103] = fTmpA*fS0;
-	fTmpB = 2.590045044653342f*fZ*fTmpA + -0.9259892765852515f*fTmpC;
-	pSH[139] = fTmpB*fC0;
-	pSH[125] = fTmpB*fS0;
-	fTmpC = 2.460209661583209f*fZ*fTmpB + -0.9498713802919554f*fTmpA;
-	pSH[163] = fTmpC*fC0;
-	pSH[149] = fTmpC*fS0;
-	fTmpA = 2.371708245126284f*fZ*fTmpC + -0.9640268803757269f*fTmpB;
-	pSH[189] = fTmpA*fC0;
-	pSH[175] = fTmpA*fS0;
-	fTmpB = 2.307927774486216f*fZ*fTmpA + -0.9731077923386515f*fTmpC;
-	pSH[217] = fTmpB*fC0;
-	pSH[203] = fTmpB*fS0;
-	fTmpC = 2.260078437898682f*fZ*fTmpB + -0.9792674029419375f*fTmpA;
-	pSH[247] = fTmpC*fC0;
-	pSH[233] = fTmpC*fS0;
-	fTmpA = 2.223067472099586f*fZ*fTmpC + -0.9836240348217709f*fTmpB;
-	pSH[279] = fTmpA*fC0;
-	pSH[265] = fTmpA*fS0;
-	fTmpB = 2.19374109684803f*fZ*fTmpA + -0.9868081488215654f*fTmpC;
-	pSH[313] = fTmpB*fC0;
-	pSH[299] = fTmpB*fS0;
-	fC1 = fX*fC0 - fY*fS0;
-	fS1 = fX*fS0 + fY*fC0;
-
-	fTmpA = 0.72892666017483f;
-	pSH[80] = fTmpA*fC1;
-	pSH[64] = fTmpA*fS1;
-	fTmpB = 3.177317648954698f*fZ;
-	pSH[98] = fTmpB*fC1;
-	pSH[82] = fTmpB*fS1;
-	fTmpC = 10.57781172168795f*fZ2 + -0.5567269327204184f;
-	pSH[118] = fTmpC*fC1;
-	pSH[102] = fTmpC*fS1;
-	fTmpA = fZ*( 30.79157970335749f*fZ2 + -4.398797100479641f );
-	pSH[140] = fTmpA*fC1;
-	pSH[124] = fTmpA*fS1;
-	fTmpB = 2.680951323690902f*fZ*fTmpA + -0.9209854970162591f*fTmpC;
-	pSH[164] = fTmpB*fC1;
-	pSH[148] = fTmpB*fS1;
-	fTmpC = 2.53546276418555f*fZ*fTmpB + -0.9457324874869209f*fTmpA;
-	pSH[190] = fTmpC*fC1;
-	pSH[174] = fTmpC*fS1;
-	fTmpA = 2.435532422657966f*fZ*fTmpC + -0.9605869417846947f*fTmpB;
-	pSH[218] = fTmpA*fC1;
-	pSH[202] = fTmpA*fS1;
-	fTmpB = 2.363017336304797f*fZ*fTmpA + -0.9702261872276653f*fTmpC;
-	pSH[248] = fTmpB*fC1;
-	pSH[232] = fTmpB*fS1;
-	fTmpC = 2.308273164077423f*fZ*fTmpB + -0.9768329366922968f*fTmpA;
-	pSH[280] = fTmpC*fC1;
-	pSH[264] = fTmpC*fS1;
-	fTmpA = 2.265686062395524f*fZ*fTmpC + -0.9815502331592888f*fTmpB;
-	pSH[314] = fTmpA*fC1;
-	pSH[298] = fTmpA*fS1;
-	fC0 = fX*fC1 - fY*fS1;
-	fS0 = fX*fS1 + fY*fC1;
-
-	fTmpA = -0.7489009518531884f;
-	pSH[99] = fTmpA*fC0;
-	pSH[81] = fTmpA*fS0;
-	fTmpB = -3.431895299891715f*fZ;
-	pSH[119] = fTmpB*fC0;
-	pSH[101] = fTmpB*fS0;
-	fTmpC = -11.92552753945219f*fZ2 + 0.5678822637834374f;
-	pSH[141] = fTmpC*fC0;
-	pSH[123] = fTmpC*fS0;
-	fTmpA = fZ*( -36.02809068931077f*fZ2 + 4.699316176866623f );
-	pSH[165] = fTmpA*fC0;
-	pSH[147] = fTmpA*fS0;
-	fTmpB = 2.769558547034986f*fZ*fTmpA + -0.9167415228748209f*fTmpC;
-	pSH[191] = fTmpB*fC0;
-	pSH[173] = fTmpB*fS0;
-	fTmpC = 2.609347744585592f*fZ*fTmpB + -0.9421529461361585f*fTmpA;
-	pSH[219] = fTmpC*fC0;
-	pSH[201] = fTmpC*fS0;
-	fTmpA = 2.498610725094158f*fZ*fTmpC + -0.9575614175146977f*fTmpB;
-	pSH[249] = fTmpA*fC0;
-	pSH[231] = fTmpA*fS0;
-	fTmpB = 2.417791199776004f*fZ*fTmpA + -0.9676542149977727f*fTmpC;
-	pSH[281] = fTmpB*fC0;
-	pSH[263] = fTmpB*fS0;
-	fTmpC = 2.356455943866682f*fZ*fTmpB + -0.9746316985871221f*fTmpA;
-	pSH[315] = fTmpC*fC0;
-	pSH[297] = fTmpC*fS0;
-	fC1 = fX*fC0 - fY*fS0;
-	fS1 = fX*fS0 + fY*fC0;
-
-	fTmpA = 0.7673951182219901f;
-	pSH[120] = fTmpA*fC1;
-	pSH[100] = fTmpA*fS1;
-	fTmpB = 3.680297698805312f*fZ;
-	pSH[142] = fTmpB*fC1;
-	pSH[122] = fTmpB*fS1;
-	fTmpC = 13.30425420025764f*fZ2 + -0.5784458347938103f;
-	pSH[166] = fTmpC*fC1;
-	pSH[146] = fTmpC*fS1;
-	fTmpA = fZ*( 41.61193153549645f*fZ2 + -4.993431784259574f );
-	pSH[192] = fTmpA*fC1;
-	pSH[172] = fTmpA*fS1;
-	fTmpB = 2.855914914698966f*fZ*fTmpA + -0.9130991183874837f*fTmpC;
-	pSH[220] = fTmpB*fC1;
-	pSH[200] = fTmpB*fS1;
-	fTmpC = 2.681790446697877f*fZ*fTmpB + -0.9390302326218141f*fTmpA;
-	pSH[250] = fTmpC*fC1;
-	pSH[230] = fTmpC*fS1;
-	fTmpA = 2.560799154110355f*fZ*fTmpC + -0.9548841361798045f*fTmpB;
-	pSH[282] = fTmpA*fC1;
-	pSH[262] = fTmpA*fS1;
-	fTmpB = 2.472066162365221f*fZ*fTmpA + -0.9653494919339113f*fTmpC;
-	pSH[316] = fTmpB*fC1;
-	pSH[296] = fTmpB*fS1;
-	fC0 = fX*fC1 - fY*fS1;
-	fS0 = fX*fS1 + fY*fC1;
-
-	fTmpA = -0.7846421057871971f;
-	pSH[143] = fTmpA*fC0;
-	pSH[121] = fTmpA*fS0;
-	fTmpB = -3.923210528935984f*fZ;
-	pSH[167] = fTmpB*fC0;
-	pSH[145] = fTmpB*fS0;
-	fTmpC = -14.71203948350994f*fZ2 + 0.5884815793403977f;
-	pSH[193] = fTmpC*fC0;
-	pSH[171] = fTmpC*fS0;
-	fTmpA = fZ*( -47.53605436066262f*fZ2 + 5.281783817851402f );
-	pSH[221] = fTmpA*fC0;
-	pSH[199] = fTmpA*fS0;
-	fTmpB = 2.940107271721691f*fZ*fTmpA + -0.9099403568319481f*fTmpC;
-	pSH[251] = fTmpB*fC0;
-	pSH[229] = fTmpB*fS0;
-	fTmpC = 2.752776376275011f*fZ*fTmpB + -0.9362843331437419f*fTmpA;
-	pSH[283] = fTmpC*fC0;
-	pSH[261] = fTmpC*fS0;
-	fTmpA = 2.622022120425379f*fZ*fTmpC + -0.9525009525014289f*fTmpB;
-	pSH[317] = fTmpA*fC0;
-	pSH[295] = fTmpA*fS0;
-	fC1 = fX*fC0 - fY*fS0;
-	fS1 = fX*fS0 + fY*fC0;
-
-	fTmpA = 0.8008219957839717f;
-	pSH[168] = fTmpA*fC1;
-	pSH[144] = fTmpA*fS1;
-	fTmpB = 4.161193153549645f*fZ;
-	pSH[194] = fTmpB*fC1;
-	pSH[170] = fTmpB*fS1;
-	fTmpC = 16.1471947939282f*fZ2 + -0.5980442516269705f;
-	pSH[222] = fTmpC*fC1;
-	pSH[198] = fTmpC*fS1;
-	fTmpA = fZ*( 53.79407212305809f*fZ2 + -5.564904012730148f );
-	pSH[252] = fTmpA*fC1;
-	pSH[228] = fTmpA*fS1;
-	fTmpB = 3.022238999720004f*fZ*fTmpA + -0.9071758265604122f*fTmpC;
-	pSH[284] = fTmpB*fC1;
-	pSH[260] = fTmpB*fS1;
-	fTmpC = 2.822324793743503f*fZ*fTmpB + -0.9338522843510981f*fTmpA;
-	pSH[318] = fTmpC*fC1;
-	pSH[294] = fTmpC*fS1;
-	fC0 = fX*fC1 - fY*fS1;
-	fS0 = fX*fS1 + fY*fC1;
-
-	fTmpA = -0.8160771188376284f;
-	pSH[195] = fTmpA*fC0;
-	pSH[169] = fTmpA*fS0;
-	fTmpB = -4.394709780272119f*fZ;
-	pSH[223] = fTmpB*fC0;
-	pSH[197] = fTmpB*fS0;
-	fTmpC = -17.60824338884482f*fZ2 + 0.6071808065118906f;
-	pSH[253] = fTmpC*fC0;
-	pSH[227] = fTmpC*fS0;
-	fTmpA = fZ*( -60.38015494295203f*fZ2 + 5.843240800930841f );
-	pSH[285] = fTmpA*fC0;
-	pSH[259] = fTmpA*fS0;
-	fTmpB = 3.102418411497714f*fZ*fTmpA + -0.9047366396343047f*fTmpC;
-	pSH[319] = fTmpB*fC0;
-	pSH[293] = fTmpB*fS0;
-	fC1 = fX*fC0 - fY*fS0;
-	fS1 = fX*fS0 + fY*fC0;
-
-	fTmpA = 0.830522083064524f;
-	pSH[224] = fTmpA*fC1;
-	pSH[196] = fTmpA*fS1;
-	fTmpB = 4.624151256630013f*fZ;
-	pSH[254] = fTmpB*fC1;
-	pSH[226] = fTmpB*fS1;
-	fTmpC = 19.09388150936025f*fZ2 + -0.6159316615922662f;
-	pSH[286] = fTmpC*fC1;
-	pSH[258] = fTmpC*fS1;
-	fTmpA = fZ*( 67.28894837384407f*fZ2 + -6.117177124894916f );
-	pSH[320] = fTmpA*fC1;
-	pSH[292] = fTmpA*fS1;
-	fC0 = fX*fC1 - fY*fS1;
-	fS0 = fX*fS1 + fY*fC1;
-
-	fTmpA = -0.8442506508573726f;
-	pSH[255] = fTmpA*fC0;
-	pSH[225] = fTmpA*fS0;
-	fTmpB = -4.849850753230682f*fZ;
-	pSH[287] = fTmpB*fC0;
-	pSH[257] = fTmpB*fS0;
-	fTmpC = -20.60294860554973f*fZ2 + 0.6243317759257494f;
-	pSH[321] = fTmpC*fC0;
-	pSH[291] = fTmpC*fS0;
-	fC1 = fX*fC0 - fY*fS0;
-	fS1 = fX*fS0 + fY*fC0;
-
-	fTmpA = 0.8573405888380252f;
-	pSH[288] = fTmpA*fC1;
-	pSH[256] = fTmpA*fS1;
-	fTmpB = 5.07209532485536f*fZ;
-	pSH[322] = fTmpB*fC1;
-	pSH[290] = fTmpB*fS1;
-	fC0 = fX*fC1 - fY*fS1;
-	fS0 = fX*fS1 + fY*fC1;
-
-	fTmpC = -0.8698571719206282f;
-	pSH[323] = fTmpC*fC0;
-	pSH[289] = fTmpC*fS0;
-}
-
-// order 19
-void SHEval19( const float fX, const float fY, const float fZ, float *pSH )
-{
-	float fC0, fC1, fS0, fS1, fTmpA, fTmpB, fTmpC;
-	float fZ2 = fZ*fZ;
-
-	pSH[0] = 0.2820947917738781f;
-	pSH[2] = 0.4886025119029199f*fZ;
-	pSH[6] = 0.9461746957575601f*fZ2 + -0.3153915652525201f;
-	pSH[12] = fZ*( 1.865881662950577f*fZ2 + -1.119528997770346f );
-	pSH[20] = 1.984313483298443f*fZ*pSH[12] + -1.006230589874905f*pSH[6];
-	pSH[30] = 1.98997487421324f*fZ*pSH[20] + -1.002853072844814f*pSH[12];
-	pSH[42] = 1.993043457183567f*fZ*pSH[30] + -1.001542020962219f*pSH[20];
-	pSH[56] = 1.994891434824135f*fZ*pSH[42] + -1.000927213921958f*pSH[30];
-	pSH[72] = 1.996089927833914f*fZ*pSH[56] + -1.000600781069515f*pSH[42];
-	pSH[90] = 1.996911195067937f*fZ*pSH[72] + -1.000411437993134f*pSH[56];
-	pSH[110] = 1.997498435543818f*fZ*pSH[90] + -1.00029407440718f*pSH[72];
-	pSH[132] = 1.997932815985082f*fZ*pSH[110] + -1.000217462218511f*pSH[90];
-	pSH[156] = 1.998263134713633f*fZ*pSH[132] + -1.000165330248298f*pSH[110];
-	pSH[182] = 1.998520162579474f*fZ*pSH[156] + -1.000128625635621f*pSH[132];
-	pSH[210] = 1.998724082804747f*fZ*pSH[182] + -1.000102035610694f*pSH[156];
-	pSH[240] = 1.998888580075327f*fZ*pSH[210] + -1.00008230114001f*pSH[182];
-	pSH[272] = 1.999023198964935f*fZ*pSH[240] + -1.00006734687013f*pSH[210];
-	pSH[306] = 1.999134760937227f*fZ*pSH[272] + -1.000055808242921f*pSH[240];
-	pSH[342] = 1.999228246160731f*fZ*pSH[306] + -1.000046762842271f*pSH[272];
-	fC0 = fX;
-	fS0 = fY;
-
-	fTmpA = -0.48860251190292f;
-	pSH[3] = fTmpA*fC0;
-	pSH[1] = fTmpA*fS0;
-	fTmpB = -1.092548430592079f*fZ;
-	pSH[7] = fTmpB*fC0;
-	pSH[5] = fTmpB*fS0;
-	fTmpC = -2.285228997322329f*fZ2 + 0.4570457994644658f;
-	pSH[13] = fTmpC*fC0;
-	pSH[11] = fTmpC*fS0;
-	fTmpA = fZ*( -4.683325804901025f*fZ2 + 2.007139630671868f );
-	pSH[21] = fTmpA*fC0;
-	pSH[19] = fTmpA*fS0;
-	fTmpB = 2.03100960115899f*fZ*fTmpA + -0.991031208965115f*fTmpC;
-	pSH[31] = fTmpB*fC0;
-	pSH[29] = fTmpB*fS0;
-	fTmpC = 2.021314989237028f*fZ*fTmpB + -0.9952267030562385f*fTmpA;
-	pSH[43] = fTmpC*fC0;
-	pSH[41] = fTmpC*fS0;
-	fTmpA = 2.015564437074638f*fZ*fTmpC + -0.9971550440218319f*fTmpB;
-	pSH[57] = fTmpA*fC0;
-	pSH[55] = fTmpA*fS0;
-	fTmpB = 2.011869540407391f*fZ*fTmpA + -0.9981668178901745f*fTmpC;
-	pSH[73] = fTmpB*fC0;
-	pSH[71] = fTmpB*fS0;
-	fTmpC = 2.009353129741012f*fZ*fTmpB + -0.9987492177719088f*fTmpA;
-	pSH[91] = fTmpC*fC0;
-	pSH[89] = fTmpC*fS0;
-	fTmpA = 2.007561463642653f*fZ*fTmpC + -0.9991083368712843f*fTmpB;
-	pSH[111] = fTmpA*fC0;
-	pSH[109] = fTmpA*fS0;
-	fTmpB = 2.006240264773888f*fZ*fTmpA + -0.9993418887079215f*fTmpC;
-	pSH[133] = fTmpB*fC0;
-	pSH[131] = fTmpB*fS0;
-	fTmpC = 2.005237896355199f*fZ*fTmpB + -0.9995003746877732f*fTmpA;
-	pSH[157] = fTmpC*fC0;
-	pSH[155] = fTmpC*fS0;
-	fTmpA = 2.004459314343183f*fZ*fTmpC + -0.9996117258638336f*fTmpB;
-	pSH[183] = fTmpA*fC0;
-	pSH[181] = fTmpA*fS0;
-	fTmpB = 2.003842462716222f*fZ*fTmpA + -0.9996922603404586f*fTmpC;
-	pSH[211] = fTmpB*fC0;
-	pSH[209] = fTmpB*fS0;
-	fTmpC = 2.003345416333104f*fZ*fTmpB + -0.9997519533634172f*fTmpA;
-	pSH[241] = fTmpC*fC0;
-	pSH[239] = fTmpC*fS0;
-	fTmpA = 2.002939017015334f*fZ*fTmpC + -0.9997971396672504f*fTmpB;
-	pSH[273] = fTmpA*fC0;
-	pSH[271] = fTmpA*fS0;
-	fTmpB = 2.002602473449653f*fZ*fTmpA + -0.9998319751311335f*fTmpC;
-	pSH[307] = fTmpB*fC0;
-	pSH[305] = fTmpB*fS0;
-	fTmpC = 2.002320635087347f*fZ*fTmpB + -0.9998592639497642f*fTmpA;
-	pSH[343] = fTmpC*fC0;
-	pSH[341] = fTmpC*fS0;
-	fC1 = fX*fC0 - fY*fS0;
-	fS1 = fX*fS0 + fY*fC0;
-
-	fTmpA = 0.5462742152960395f;
-	pSH[8] = fTmpA*fC1;
-	pSH[4] = fTmpA*fS1;
-	fTmpB = 1.445305721320277f*fZ;
-	pSH[14] = fTmpB*fC1;
-	pSH[10] = fTmpB*fS1;
-	fTmpC = 3.31161143515146f*fZ2 + -0.47308734787878f;
-	pSH[22] = fTmpC*fC1;
-	pSH[18] = fTmpC*fS1;
-	fTmpA = fZ*( 7.190305177459987f*fZ2 + -2.396768392486662f );
-	pSH[32] = fTmpA*fC1;
-	pSH[28] = fTmpA*fS1;
-	fTmpB = 2.11394181566097f*fZ*fTmpA + -0.9736101204623268f*fTmpC;
-	pSH[44] = fTmpB*fC1;
-	pSH[40] = fTmpB*fS1;
-	fTmpC = 2.081665999466133f*fZ*fTmpB + -0.9847319278346618f*fTmpA;
-	pSH[58] = fTmpC*fC1;
-	pSH[54] = fTmpC*fS1;
-	fTmpA = 2.06155281280883f*fZ*fTmpC + -0.9903379376602873f*fTmpB;
-	pSH[74] = fTmpA*fC1;
-	pSH[70] = fTmpA*fS1;
-	fTmpB = 2.048122358357819f*fZ*fTmpA + -0.9934852726704042f*fTmpC;
-	pSH[92] = fTmpB*fC1;
-	pSH[88] = fTmpB*fS1;
-	fTmpC = 2.038688303787511f*fZ*fTmpB + -0.9953938032404119f*fTmpA;
-	pSH[112] = fTmpC*fC1;
-	pSH[108] = fTmpC*fS1;
-	fTmpA = 2.031798495964875f*fZ*fTmpC + -0.9966204702259603f*fTmpB;
-	pSH[134] = fTmpA*fC1;
-	pSH[130] = fTmpA*fS1;
-	fTmpB = 2.026608708444444f*fZ*fTmpA + -0.9974457174120671f*fTmpC;
-	pSH[158] = fTmpB*fC1;
-	pSH[154] = fTmpB*fS1;
-	fTmpC = 2.022599587389726f*fZ*fTmpB + -0.9980217586956907f*fTmpA;
-	pSH[184] = fTmpC*fC1;
-	pSH[180] = fTmpC*fS1;
-	fTmpA = 2.019436802675439f*fZ*fTmpC + -0.998436277385793f*fTmpB;
-	pSH[212] = fTmpA*fC1;
-	pSH[208] = fTmpA*fS1;
-	fTmpB = 2.016896949069888f*fZ*fTmpA + -0.998742296068792f*fTmpC;
-	pSH[242] = fTmpB*fC1;
-	pSH[238] = fTmpB*fS1;
-	fTmpC = 2.014825999813336f*fZ*fTmpB + -0.9989732002631536f*fTmpA;
-	pSH[274] = fTmpC*fC1;
-	pSH[270] = fTmpC*fS1;
-	fTmpA = 2.013114894621608f*fZ*fTmpC + -0.9991507429465936f*fTmpB;
-	pSH[308] = fTmpA*fC1;
-	pSH[304] = fTmpA*fS1;
-	fTmpB = 2.011684617428885f*fZ*fTmpA + -0.9992895203365968f*fTmpC;
-	pSH[344] = fTmpB*fC1;
-	pSH[340] = fTmpB*fS1;
-	fC0 = fX*fC1 - fY*fS1;
-	fS0 = fX*fS1 + fY*fC1;
-
-	fTmpA = -0.5900435899266435f;
-	pSH[15] = fTmpA*fC0;
-	pSH[9] = fTmpA*fS0;
-	fTmpB = -1.770130769779931f*fZ;
-	pSH[23] = fTmpB*fC0;
-	pSH[17] = fTmpB*fS0;
-	fTmpC = -4.403144694917254f*fZ2 + 0.4892382994352505f;
-	pSH[33] = fTmpC*fC0;
-	pSH[27] = fTmpC*fS0;
-	fTmpA = fZ*( -10.13325785466416f*fZ2 + 2.763615778544771f );
-	pSH[45] = fTmpA*fC0;
-	pSH[39] = fTmpA*fS0;
-	fTmpB = 2.207940216581962f*fZ*fTmpA + -0.959403223600247f*fTmpC;
-	pSH[59] = fTmpB*fC0;
-	pSH[53] = fTmpB*fS0;
-	fTmpC = 2.15322168769582f*fZ*fTmpB + -0.9752173865600178f*fTmpA;
-	pSH[75] = fTmpC*fC0;
-	pSH[69] = fTmpC*fS0;
-	fTmpA = 2.118044171189805f*fZ*fTmpC + -0.9836628449792094f*fTmpB;
-	pSH[93] = fTmpA*fC0;
-	pSH[87] = fTmpA*fS0;
-	fTmpB = 2.093947321356338f*fZ*fTmpA + -0.9886230654859614f*fTmpC;
-	pSH[113] = fTmpB*fC0;
-	pSH[107] = fTmpB*fS0;
-	fTmpC = 2.076655965729519f*fZ*fTmpB + -0.9917422203269092f*fTmpA;
-	pSH[135] = fTmpC*fC0;
-	pSH[129] = fTmpC*fS0;
-	fTmpA = 2.063797291222968f*fZ*fTmpC + -0.9938079899999066f*fTmpB;
-	pSH[159] = fTmpA*fC0;
-	pSH[153] = fTmpA*fS0;
-	fTmpB = 2.053959590644373f*fZ*fTmpA + -0.9952332040455557f*fTmpC;
-	pSH[185] = fTmpB*fC0;
-	pSH[179] = fTmpB*fS0;
-	fTmpC = 2.046256527271464f*fZ*fTmpB + -0.9962496519366806f*fTmpA;
-	pSH[213] = fTmpC*fC0;
-	pSH[207] = fTmpC*fS0;
-	fTmpA = 2.040107114108727f*fZ*fTmpC + -0.9969947985109489f*fTmpB;
-	pSH[243] = fTmpA*fC0;
-	pSH[237] = fTmpA*fS0;
-	fTmpB = 2.035116803738375f*fZ*fTmpA + -0.9975538978635777f*fTmpC;
-	pSH[275] = fTmpB*fC0;
-	pSH[269] = fTmpB*fS0;
-	fTmpC = 2.03100960115899f*fZ*fTmpB + -0.9979818344716921f*fTmpA;
-	pSH[309] = fTmpC*fC0;
-	pSH[303] = fTmpC*fS0;
-	fTmpA = 2.027587510099407f*fZ*fTmpC + -0.9983150788368354f*fTmpB;
-	pSH[345] = fTmpA*fC0;
-	pSH[339] = fTmpA*fS0;
-	fC1 = fX*fC0 - fY*fS0;
-	fS1 = fX*fS0 + fY*fC0;
-
-	fTmpA = 0.6258357354491763f;
-	pSH[24] = fTmpA*fC1;
-	pSH[16] = fTmpA*fS1;
-	fTmpB = 2.075662314881041f*fZ;
-	pSH[34] = fTmpB*fC1;
-	pSH[26] = fTmpB*fS1;
-	fTmpC = 5.550213908015966f*fZ2 + -0.5045649007287241f;
-	pSH[46] = fTmpC*fC1;
-	pSH[38] = fTmpC*fS1;
-	fTmpA = fZ*( 13.49180504672677f*fZ2 + -3.113493472321562f );
-	pSH[60] = fTmpA*fC1;
-	pSH[52] = fTmpA*fS1;
-	fTmpB = 2.304886114323221f*fZ*fTmpA + -0.9481763873554654f*fTmpC;
-	pSH[76] = fTmpB*fC1;
-	pSH[68] = fTmpB*fS1;
-	fTmpC = 2.229177150706235f*fZ*fTmpB + -0.9671528397231821f*fTmpA;
-	pSH[94] = fTmpC*fC1;
-	pSH[86] = fTmpC*fS1;
-	fTmpA = 2.179449471770337f*fZ*fTmpC + -0.9776923610938036f*fTmpB;
-	pSH[114] = fTmpA*fC1;
-	pSH[106] = fTmpA*fS1;
-	fTmpB = 2.144761058952722f*fZ*fTmpA + -0.9840838646332836f*fTmpC;
-	pSH[136] = fTmpB*fC1;
-	pSH[128] = fTmpB*fS1;
-	fTmpC = 2.119478119726646f*fZ*fTmpB + -0.9882117688026186f*fTmpA;
-	pSH[160] = fTmpC*fC1;
-	pSH[152] = fTmpC*fS1;
-	fTmpA = 2.100420126042015f*fZ*fTmpC + -0.9910081668184009f*fTmpB;
-	pSH[186] = fTmpA*fC1;
-	pSH[178] = fTmpA*fS1;
-	fTmpB = 2.085665361461421f*fZ*fTmpA + -0.9929753269845127f*fTmpC;
-	pSH[214] = fTmpB*fC1;
-	pSH[206] = fTmpB*fS1;
-	fTmpC = 2.073990213742235f*fZ*fTmpB + -0.9944021951292297f*fTmpA;
-	pSH[244] = fTmpC*fC1;
-	pSH[236] = fTmpC*fS1;
-	fTmpA = 2.064582282206258f*fZ*fTmpC + -0.9954638496008124f*fTmpB;
-	pSH[276] = fTmpA*fC1;
-	pSH[268] = fTmpA*fS1;
-	fTmpB = 2.056883378018606f*fZ*fTmpA + -0.996270962773436f*fTmpC;
-	pSH[310] = fTmpB*fC1;
-	pSH[302] = fTmpB*fS1;
-	fTmpC = 2.050498830661811f*fZ*fTmpB + -0.9968960090664231f*fTmpA;
-	pSH[346] = fTmpC*fC1;
-	pSH[338] = fTmpC*fS1;
-	fC0 = fX*fC1 - fY*fS1;
-	fS0 = fX*fS1 + fY*fC1;
-
-	fTmpA = -0.6563820568401703f;
-	pSH[35] = fTmpA*fC0;
-	pSH[25] = fTmpA*fS0;
-	fTmpB = -2.366619162231753f*fZ;
-	pSH[47] = fTmpB*fC0;
-	pSH[37] = fTmpB*fS0;
-	fTmpC = -6.745902523363385f*fZ2 + 0.5189155787202604f;
-	pSH[61] = fTmpC*fC0;
-	pSH[51] = fTmpC*fS0;
-	fTmpA = fZ*( -17.24955311049054f*fZ2 + 3.449910622098108f );
-	pSH[77] = fTmpA*fC0;
-	pSH[67] = fTmpA*fS0;
-	fTmpB = 2.401636346922062f*fZ*fTmpA + -0.9392246042043708f*fTmpC;
-	pSH[95] = fTmpB*fC0;
-	pSH[85] = fTmpB*fS0;
-	fTmpC = 2.306512518934159f*fZ*fTmpB + -0.9603920767980496f*fTmpA;
-	pSH[115] = fTmpC*fC0;
-	pSH[105] = fTmpC*fS0;
-	fTmpA = 2.243044805615795f*fZ*fTmpC + -0.9724832565193738f*fTmpB;
-	pSH[137] = fTmpA*fC0;
-	pSH[127] = fTmpA*fS0;
-	fTmpB = 2.198165774710643f*fZ*fTmpA + -0.9799919151000504f*fTmpC;
-	pSH[161] = fTmpB*fC0;
-	pSH[151] = fTmpB*fS0;
-	fTmpC = 2.165063509461097f*fZ*fTmpB + -0.9849409604906143f*fTmpA;
-	pSH[187] = fTmpC*fC0;
-	pSH[177] = fTmpC*fS0;
-	fTmpA = 2.139847510553276f*fZ*fTmpC + -0.9883532289941477f*fTmpB;
-	pSH[215] = fTmpA*fC0;
-	pSH[205] = fTmpA*fS0;
-	fTmpB = 2.120141504711419f*fZ*fTmpA + -0.99079092984679f*fTmpC;
-	pSH[245] = fTmpB*fC0;
-	pSH[235] = fTmpB*fS0;
-	fTmpC = 2.104417123236605f*fZ*fTmpB + -0.9925833339709304f*fTmpA;
-	pSH[277] = fTmpC*fC0;
-	pSH[267] = fTmpC*fS0;
-	fTmpA = 2.091650066335189f*fZ*fTmpC + -0.9939332099323633f*fTmpB;
-	pSH[311] = fTmpA*fC0;
-	pSH[301] = fTmpA*fS0;
-	fTmpB = 2.081130384894173f*fZ*fTmpA + -0.9949706303122452f*fTmpC;
-	pSH[347] = fTmpB*fC0;
-	pSH[337] = fTmpB*fS0;
-	fC1 = fX*fC0 - fY*fS0;
-	fS1 = fX*fS0 + fY*fC0;
-
-	fTmpA = 0.6831841051919144f;
-	pSH[48] = fTmpA*fC1;
-	pSH[36] = fTmpA*fS1;
-	fTmpB = 2.645960661801901f*fZ;
-	pSH[62] = fTmpB*fC1;
-	pSH[50] = fTmpB*fS1;
-	fTmpC = 7.984991490893139f*fZ2 + -0.5323327660595426f;
-	pSH[78] = fTmpC*fC1;
-	pSH[66] = fTmpC*fS1;
-	fTmpA = fZ*( 21.39289019090864f*fZ2 + -3.775215916042701f );
-	pSH[96] = fTmpA*fC1;
-	pSH[84] = fTmpA*fS1;
-	fTmpB = 2.496873044429773f*fZ*fTmpA + -0.9319689782769534f*fTmpC;
-	pSH[116] = fTmpB*fC1;
-	pSH[104] = fTmpB*fS1;
-	fTmpC = 2.383768642544085f*fZ*fTmpB + -0.9547015807880142f*fTmpA;
-	pSH[138] = fTmpC*fC1;
-	pSH[126] = fTmpC*fS1;
-	fTmpA = 2.307395517477243f*fZ*fTmpC + -0.9679611839405133f*fTmpB;
-	pSH[162] = fTmpA*fC1;
-	pSH[150] = fTmpA*fS1;
-	fTmpB = 2.252817784447915f*fZ*fTmpA + -0.9763466069791972f*fTmpC;
-	pSH[188] = fTmpB*fC1;
-	pSH[176] = fTmpB*fS1;
-	fTmpC = 2.212182180562893f*fZ*fTmpB + -0.9819623210693983f*fTmpA;
-	pSH[216] = fTmpC*fC1;
-	pSH[204] = fTmpC*fS1;
-	fTmpA = 2.180966243804281f*fZ*fTmpC + -0.9858890750350997f*fTmpB;
-	pSH[246] = fTmpA*fC1;
-	pSH[234] = fTmpA*fS1;
-	fTmpB = 2.156385865284782f*fZ*fTmpA + -0.9887295924045926f*fTmpC;
-	pSH[278] = fTmpB*fC1;
-	pSH[266] = fTmpB*fS1;
-	fTmpC = 2.13663693483576f*fZ*fTmpB + -0.9908416528011255f*fTmpA;
-	pSH[312] = fTmpC*fC1;
-	pSH[300] = fTmpC*fS1;
-	fTmpA = 2.120501774999912f*fZ*fTmpC + -0.9924483380527693f*fTmpB;
-	pSH[348] = fTmpA*fC1;
-	pSH[336] = fTmpA*fS1;
-	fC0 = fX*fC1 - fY*fS1;
-	fS0 = fX*fS1 + fY*fC1;
-
-	fTmpA = -0.7071627325245963f;
-	pSH[63] = fTmpA*fC0;
-	pSH[49] = fTmpA*fS0;
-	fTmpB = -2.91570664069932f*fZ;
-	pSH[79] = fTmpB*fC0;
-	pSH[65] = fTmpB*fS0;
-	fTmpC = -9.263393182848905f*fZ2 + 0.5449054813440533f;
-	pSH[97] = fTmpC*fC0;
-	pSH[83] = fTmpC*fS0;
-	fTmpA = fZ*( -25.9102413133663f*fZ2 + 4.091090733689416f );
-	pSH[117] = fTmpA*fC0;
-	pSH[103] = fTmpA*fS0;
-	fTmpB = 2.590045044653342f*fZ*fTmpA + -0.9259892765852515f*fTmpC;
-	pSH[139] = fTmpB*fC0;
-	pSH[125] = fTmpB*fS0;
-	fTmpC = 2.460209661583209f*fZ*fTmpB + -0.9498713802919554f*fTmpA;
-	pSH[163] = fTmpC*fC0;
-	pSH[149] = fTmpC*fS0;
-	fTmpA = 2.371708245126284f*fZ*fTmpC + -0.9640268803757269f*fTmpB;
-	pSH[189] = fTmpA*fC0;
-	pSH[175] = fTmpA*fS0;
-	fTmpB = 2.307927774486216f*fZ*fTmpA + -0.9731077923386515f*fTmpC;
-	pSH[217] = fTmpB*fC0;
-	pSH[203] = fTmpB*fS0;
-	fTmpC = 2.260078437898682f*fZ*fTmpB + -0.9792674029419375f*fTmpA;
-	pSH[247] = fTmpC*fC0;
-	pSH[233] = fTmpC*fS0;
-	fTmpA = 2.223067472099586f*fZ*fTmpC + -0.9836240348217709f*fTmpB;
-	pSH[279] = fTmpA*fC0;
-	pSH[265] = fTmpA*fS0;
-	fTmpB = 2.19374109684803f*fZ*fTmpA + -0.9868081488215654f*fTmpC;
-	pSH[313] = fTmpB*fC0;
-	pSH[299] = fTmpB*fS0;
-	fTmpC = 2.170043987823959f*fZ*fTmpB + -0.9891978551807596f*fTmpA;
-	pSH[349] = fTmpC*fC0;
-	pSH[335] = fTmpC*fS0;
-	fC1 = fX*fC0 - fY*fS0;
-	fS1 = fX*fS0 + fY*fC0;
-
-	fTmpA = 0.72892666017483f;
-	pSH[80] = fTmpA*fC1;
-	pSH[64] = fTmpA*fS1;
-	fTmpB = 3.177317648954698f*fZ;
-	pSH[98] = fTmpB*fC1;
-	pSH[82] = fTmpB*fS1;
-	fTmpC = 10.57781172168795f*fZ2 + -0.5567269327204184f;
-	pSH[118] = fTmpC*fC1;
-	pSH[102] = fTmpC*fS1;
-	fTmpA = fZ*( 30.79157970335749f*fZ2 + -4.398797100479641f );
-	pSH[140] = fTmpA*fC1;
-	pSH[124] = fTmpA*fS1;
-	fTmpB = 2.680951323690902f*fZ*fTmpA + -0.9209854970162591f*fTmpC;
-	pSH[164] = fTmpB*fC1;
-	pSH[148] = fTmpB*fS1;
-	fTmpC = 2.53546276418555f*fZ*fTmpB + -0.9457324874869209f*fTmpA;
-	pSH[190] = fTmpC*fC1;
-	pSH[174] = fTmpC*fS1;
-	fTmpA = 2.435532422657966f*fZ*fTmpC + -0.9605869417846947f*fTmpB;
-	pSH[218] = fTmpA*fC1;
-	pSH[202] = fTmpA*fS1;
-	fTmpB = 2.363017336304797f*fZ*fTmpA + -0.9702261872276653f*fTmpC;
-	pSH[248] = fTmpB*fC1;
-	pSH[232] = fTmpB*fS1;
-	fTmpC = 2.308273164077423f*fZ*fTmpB + -0.9768329366922968f*fTmpA;
-	pSH[280] = fTmpC*fC1;
-	pSH[264] = fTmpC*fS1;
-	fTmpA = 2.265686062395524f*fZ*fTmpC + -0.9815502331592888f*fTmpB;
-	pSH[314] = fTmpA*fC1;
-	pSH[298] = fTmpA*fS1;
-	fTmpB = 2.231763704062155f*fZ*fTmpA + -0.9850277764000974f*fTmpC;
-	pSH[350] = fTmpB*fC1;
-	pSH[334] = fTmpB*fS1;
-	fC0 = fX*fC1 - fY*fS1;
-	fS0 = fX*fS1 + fY*fC1;
-
-	fTmpA = -0.7489009518531884f;
-	pSH[99] = fTmpA*fC0;
-	pSH[81] = fTmpA*fS0;
-	fTmpB = -3.431895299891715f*fZ;
-	pSH[119] = fTmpB*fC0;
-	pSH[101] = fTmpB*fS0;
-	fTmpC = -11.92552753945219f*fZ2 + 0.5678822637834374f;
-	pSH[141] = fTmpC*fC0;
-	pSH[123] = fTmpC*fS0;
-	fTmpA = fZ*( -36.02809068931077f*fZ2 + 4.699316176866623f );
-	pSH[165] = fTmpA*fC0;
-	pSH[147] = fTmpA*fS0;
-	fTmpB = 2.769558547034986f*fZ*fTmpA + -0.9167415228748209f*fTmpC;
-	pSH[191] = fTmpB*fC0;
-	pSH[173] = fTmpB*fS0;
-	fTmpC = 2.609347744585592f*fZ*fTmpB + -0.9421529461361585f*fTmpA;
-	pSH[219] = fTmpC*fC0;
-	pSH[201] = fTmpC*fS0;
-	fTmpA = 2.498610725094158f*fZ*fTmpC + -0.9575614175146977f*fTmpB;
-	pSH[249] = fTmpA*fC0;
-	pSH[231] = fTmpA*fS0;
-	fTmpB = 2.417791199776004f*fZ*fTmpA + -0.9676542149977727f*fTmpC;
-	pSH[281] = fTmpB*fC0;
-	pSH[263] = fTmpB*fS0;
-	fTmpC = 2.356455943866682f*fZ*fTmpB + -0.9746316985871221f*fTmpA;
-	pSH[315] = fTmpC*fC0;
-	pSH[297] = fTmpC*fS0;
-	fTmpA = 2.308509932184803f*fZ*fTmpC + -0.9796533383929068f*fTmpB;
-	pSH[351] = fTmpA*fC0;
-	pSH[333] = fTmpA*fS0;
-	fC1 = fX*fC0 - fY*fS0;
-	fS1 = fX*fS0 + fY*fC0;
-
-	fTmpA = 0.7673951182219901f;
-	pSH[120] = fTmpA*fC1;
-	pSH[100] = fTmpA*fS1;
-	fTmpB = 3.680297698805312f*fZ;
-	pSH[142] = fTmpB*fC1;
-	pSH[122] = fTmpB*fS1;
-	fTmpC = 13.30425420025764f*fZ2 + -0.5784458347938103f;
-	pSH[166] = fTmpC*fC1;
-	pSH[146] = fTmpC*fS1;
-	fTmpA = fZ*( 41.61193153549645f*fZ2 + -4.993431784259574f );
-	pSH[192] = fTmpA*fC1;
-	pSH[172] = fTmpA*fS1;
-	fTmpB = 2.855914914698966f*fZ*fTmpA + -0.9130991183874837f*fTmpC;
-	pSH[220] = fTmpB*fC1;
-	pSH[200] = fTmpB*fS1;
-	fTmpC = 2.681790446697877f*fZ*fTmpB + -0.9390302326218141f*fTmpA;
-	pSH[250] = fTmpC*fC1;
-	pSH[230] = fTmpC*fS1;
-	fTmpA = 2.560799154110355f*fZ*fTmpC + -0.9548841361798045f*fTmpB;
-	pSH[282] = fTmpA*fC1;
-	pSH[262] = fTmpA*fS1;
-	fTmpB = 2.472066162365221f*fZ*fTmpA + -0.9653494919339113f*fTmpC;
-	pSH[316] = fTmpB*fC1;
-	pSH[296] = fTmpB*fS1;
-	fTmpC = 2.404423007708918f*fZ*fTmpB + -0.9726369966604846f*fTmpA;
-	pSH[352] = fTmpC*fC1;
-	pSH[332] = fTmpC*fS1;
-	fC0 = fX*fC1 - fY*fS1;
-	fS0 = fX*fS1 + fY*fC1;
-
-	fTmpA = -0.7846421057871971f;
-	pSH[143] = fTmpA*fC0;
-	pSH[121] = fTmpA*fS0;
-	fTmpB = -3.923210528935984f*fZ;
-	pSH[167] = fTmpB*fC0;
-	pSH[145] = fTmpB*fS0;
-	fTmpC = -14.71203948350994f*fZ2 + 0.5884815793403977f;
-	pSH[193] = fTmpC*fC0;
-	pSH[171] = fTmpC*fS0;
-	fTmpA = fZ*( -47.53605436066262f*fZ2 + 5.281783817851402f );
-	pSH[221] = fTmpA*fC0;
-	pSH[199] = fTmpA*fS0;
-	fTmpB = 2.940107271721691f*fZ*fTmpA + -0.9099403568319481f*fTmpC;
-	pSH[251] = fTmpB*fC0;
-	pSH[229] = fTmpB*fS0;
-	fTmpC = 2.752776376275011f*fZ*fTmpB + -0.9362843331437419f*fTmpA;
-	pSH[283] = fTmpC*fC0;
-	pSH[261] = fTmpC*fS0;
-	fTmpA = 2.622022120425379f*fZ*fTmpC + -0.9525009525014289f*fTmpB;
-	pSH[317] = fTmpA*fC0;
-	pSH[295] = fTmpA*fS0;
-	fTmpB = 2.525729665824827f*fZ*fTmpA + -0.9632754987646973f*fTmpC;
-	pSH[353] = fTmpB*fC0;
-	pSH[331] = fTmpB*fS0;
-	fC1 = fX*fC0 - fY*fS0;
-	fS1 = fX*fS0 + fY*fC0;
-
-	fTmpA = 0.8008219957839717f;
-	pSH[168] = fTmpA*fC1;
-	pSH[144] = fTmpA*fS1;
-	fTmpB = 4.161193153549645f*fZ;
-	pSH[194] = fTmpB*fC1;
-	pSH[170] = fTmpB*fS1;
-	fTmpC = 16.1471947939282f*fZ2 + -0.5980442516269705f;
-	pSH[222] = fTmpC*fC1;
-	pSH[198] = fTmpC*fS1;
-	fTmpA = fZ*( 53.79407212305809f*fZ2 + -5.564904012730148f );
-	pSH[252] = fTmpA*fC1;
-	pSH[228] = fTmpA*fS1;
-	fTmpB = 3.022238999720004f*fZ*fTmpA + -0.9071758265604122f*fTmpC;
-	pSH[284] = fTmpB*fC1;
-	pSH[260] = fTmpB*fS1;
-	fTmpC = 2.822324793743503f*fZ*fTmpB + -0.9338522843510981f*fTmpA;
-	pSH[318] = fTmpC*fC1;
-	pSH[294] = fTmpC*fS1;
-	fTmpA = 2.682246156571846f*fZ*fTmpC + -0.950367641072997f*fTmpB;
-	pSH[354] = fTmpA*fC1;
-	pSH[330] = fTmpA*fS1;
-	fC0 = fX*fC1 - fY*fS1;
-	fS0 = fX*fS1 + fY*fC1;
-
-	fTmpA = -0.8160771188376284f;
-	pSH[195] = fTmpA*fC0;
-	pSH[169] = fTmpA*fS0;
-	fTmpB = -4.394709780272119f*fZ;
-	pSH[223] = fTmpB*fC0;
-	pSH[197] = fTmpB*fS0;
-	fTmpC = -17.60824338884482f*fZ2 + 0.6071808065118906f;
-	pSH[253] = fTmpC*fC0;
-	pSH[227] = fTmpC*fS0;
-	fTmpA = fZ*( -60.38015494295203f*fZ2 + 5.843240800930841f );
-	pSH[285] = fTmpA*fC0;
-	pSH[259] = fTmpA*fS0;
-	fTmpB = 3.102418411497714f*fZ*fTmpA + -0.9047366396343047f*fTmpC;
-	pSH[319] = fTmpB*fC0;
-	pSH[293] = fTmpB*fS0;
-	fTmpC = 2.890473786367456f*fZ*fTmpB + -0.9316840615873149f*fTmpA;
-	pSH[355] = fTmpC*fC0;
-	pSH[329] = fTmpC*fS0;
-	fC1 = fX*fC0 - fY*fS0;
-	fS1 = fX*fS0 + fY*fC0;
-
-	fTmpA = 0.830522083064524f;
-	pSH[224] = fTmpA*fC1;
-	pSH[196] = fTmpA*fS1;
-	fTmpB = 4.624151256630013f*fZ;
-	pSH[254] = fTmpB*fC1;
-	pSH[226] = fTmpB*fS1;
-	fTmpC = 19.09388150936025f*fZ2 + -0.6159316615922662f;
-	pSH[286] = fTmpC*fC1;
-	pSH[258] = fTmpC*fS1;
-	fTmpA = fZ*( 67.28894837384407f*fZ2 + -6.117177124894916f );
-	pSH[320] = fTmpA*fC1;
-	pSH[292] = fTmpA*fS1;
-	fTmpB = 3.180752662499868f*fZ*fTmpA + -0.9025689346627115f*fTmpC;
-	pSH[356] = fTmpB*fC1;
-	pSH[328] = fTmpB*fS1;
-	fC0 = fX*fC1 - fY*fS1;
-	fS0 = fX*fS1 + fY*fC1;
-
-	fTmpA = -0.8442506508573726f;
-	pSH[255] = fTmpA*fC0;
-	pSH[225] = fTmpA*fS0;
-	fTmpB = -4.849850753230682f*fZ;
-	pSH[287] = fTmpB*fC0;
-	pSH[257] = fTmpB*fS0;
-	fTmpC = -20.60294860554973f*fZ2 + 0.6243317759257494f;
-	pSH[321] = fTmpC*fC0;
-	pSH[291] = fTmpC*fS0;
-	fTmpA = fZ*( -74.51550792153199f*fZ2 + 6.387043536131314f );
-	pSH[357] = fTmpA*fC0;
-	pSH[327] = fTmpA*fS0;
-	fC1 = fX*fC0 - fY*fS0;
-	fS1 = fX*fS0 + fY*fC0;
-
-	fTmpA = 0.8573405888380252f;
-	pSH[288] = fTmpA*fC1;
-	pSH[256] = fTmpA*fS1;
-	fTmpB = 5.07209532485536f*fZ;
-	pSH[322] = fTmpB*fC1;
-	pSH[290] = fTmpB*fS1;
-	fTmpC = 22.13440412464915f*fZ2 + -0.632411546418547f;
-	pSH[358] = fTmpC*fC1;
-	pSH[326] = fTmpC*fS1;
-	fC0 = fX*fC1 - fY*fS1;
-	fS0 = fX*fS1 + fY*fC1;
-
-	fTmpA = -0.8698571719206282f;
-	pSH[323] = fTmpA*fC0;
-	pSH[289] = fTmpA*fS0;
-	fTmpB = -5.291134612069974f*fZ;
-	pSH[359] = fTmpB*fC0;
-	pSH[325] = fTmpB*fS0;
-	fC1 = fX*fC0 - fY*fS0;
-	fS1 = fX*fS0 + fY*fC0;
-
-	fTmpC = 0.8818557686783287f;
-	pSH[360] = fTmpC*fC1;
-	pSH[324] = fTmpC*fS1;
-}
-
-// order 20
-void SHEval20( const float fX, const float fY, const float fZ, float *pSH )
-{
-	float fC0, fC1, fS0, fS1, fTmpA, fTmpB, fTmpC;
-	float fZ2 = fZ*fZ;
-
-	pSH[0] = 0.2820947917738781f;
-	pSH[2] = 0.4886025119029199f*fZ;
-	pSH[6] = 0.9461746957575601f*fZ2 + -0.3153915652525201f;
-	pSH[12] = fZ*( 1.865881662950577f*fZ2 + -1.119528997770346f );
-	pSH[20] = 1.984313483298443f*fZ*pSH[12] + -1.006230589874905f*pSH[6];
-	pSH[30] = 1.98997487421324f*fZ*pSH[20] + -1.002853072844814f*pSH[12];
-	pSH[42] = 1.993043457183567f*fZ*pSH[30] + -1.001542020962219f*pSH[20];
-	pSH[56] = 1.994891434824135f*fZ*pSH[42] + -1.000927213921958f*pSH[30];
-	pSH[72] = 1.996089927833914f*fZ*pSH[56] + -1.000600781069515f*pSH[42];
-	pSH[90] = 1.996911195067937f*fZ*pSH[72] + -1.000411437993134f*pSH[56];
-	pSH[110] = 1.997498435543818f*fZ*pSH[90] + -1.00029407440718f*pSH[72];
-	pSH[132] = 1.997932815985082f*fZ*pSH[110] + -1.000217462218511f*pSH[90];
-	pSH[156] = 1.998263134713633f*fZ*pSH[132] + -1.000165330248298f*pSH[110];
-	pSH[182] = 1.998520162579474f*fZ*pSH[156] + -1.000128625635621f*pSH[132];
-	pSH[210] = 1.998724082804747f*fZ*pSH[182] + -1.000102035610694f*pSH[156];
-	pSH[240] = 1.998888580075327f*fZ*pSH[210] + -1.00008230114001f*pSH[182];
-	pSH[272] = 1.999023198964935f*fZ*pSH[240] + -1.00006734687013f*pSH[210];
-	pSH[306] = 1.999134760937227f*fZ*pSH[272] + -1.000055808242921f*pSH[240];
-	pSH[342] = 1.999228246160731f*fZ*pSH[306] + -1.000046762842271f*pSH[272];
-	pSH[380] = 1.999307359286587f*fZ*pSH[342] + -1.000039571832785f*pSH[306];
-	fC0 = fX;
-	fS0 = fY;
-
-	fTmpA = -0.48860251190292f;
-	pSH[3] = fTmpA*fC0;
-	pSH[1] = fTmpA*fS0;
-	fTmpB = -1.092548430592079f*fZ;
-	pSH[7] = fTmpB*fC0;
-	pSH[5] = fTmpB*fS0;
-	fTmpC = -2.285228997322329f*fZ2 + 0.4570457994644658f;
-	pSH[13] = fTmpC*fC0;
-	pSH[11] = fTmpC*fS0;
-	fTmpA = fZ*( -4.683325804901025f*fZ2 + 2.007139630671868f );
-	pSH[21] = fTmpA*fC0;
-	pSH[19] = fTmpA*fS0;
-	fTmpB = 2.03100960115899f*fZ*fTmpA + -0.991031208965115f*fTmpC;
-	pSH[31] = fTmpB*fC0;
-	pSH[29] = fTmpB*fS0;
-	fTmpC = 2.021314989237028f*fZ*fTmpB + -0.9952267030562385f*fTmpA;
-	pSH[43] = fTmpC*fC0;
-	pSH[41] = fTmpC*fS0;
-	fTmpA = 2.015564437074638f*fZ*fTmpC + -0.9971550440218319f*fTmpB;
-	pSH[57] = fTmpA*fC0;
-	pSH[55] = fTmpA*fS0;
-	fTmpB = 2.011869540407391f*fZ*fTmpA + -0.9981668178901745f*fTmpC;
-	pSH[73] = fTmpB*fC0;
-	pSH[71] = fTmpB*fS0;
-	fTmpC = 2.009353129741012f*fZ*fTmpB + -0.9987492177719088f*fTmpA;
-	pSH[91] = fTmpC*fC0;
-	pSH[89] = fTmpC*fS0;
-	fTmpA = 2.007561463642653f*fZ*fTmpC + -0.9991083368712843f*fTmpB;
-	pSH[111] = fTmpA*fC0;
-	pSH[109] = fTmpA*fS0;
-	fTmpB = 2.006240264773888f*fZ*fTmpA + -0.9993418887079215f*fTmpC;
-	pSH[133] = fTmpB*fC0;
-	pSH[131] = fTmpB*fS0;
-	fTmpC = 2.005237896355199f*fZ*fTmpB + -0.9995003746877732f*fTmpA;
-	pSH[157] = fTmpC*fC0;
-	pSH[155] = fTmpC*fS0;
-	fTmpA = 2.004459314343183f*fZ*fTmpC + -0.9996117258638336f*fTmpB;
-	pSH[183] = fTmpA*fC0;
-	pSH[181] = fTmpA*fS0;
-	fTmpB = 2.003842462716222f*fZ*fTmpA + -0.9996922603404586f*fTmpC;
-	pSH[211] = fTmpB*fC0;
-	pSH[209] = fTmpB*fS0;
-	fTmpC = 2.003345416333104f*fZ*fTmpB + -0.9997519533634172f*fTmpA;
-	pSH[241] = fTmpC*fC0;
-	pSH[239] = fTmpC*fS0;
-	fTmpA = 2.002939017015334f*fZ*fTmpC + -0.9997971396672504f*fTmpB;
-	pSH[273] = fTmpA*fC0;
-	pSH[271] = fTmpA*fS0;
-	fTmpB = 2.002602473449653f*fZ*fTmpA + -0.9998319751311335f*fTmpC;
-	pSH[307] = fTmpB*fC0;
-	pSH[305] = fTmpB*fS0;
-	fTmpC = 2.002320635087347f*fZ*fTmpB + -0.9998592639497642f*fTmpA;
-	pSH[343] = fTmpC*fC0;
-	pSH[341] = fTmpC*fS0;
-	fTmpA = 2.0020822493927f*fZ*fTmpC + -0.9998809452939409f*fTmpB;
-	pSH[381] = fTmpA*fC0;
-	pSH[379] = fTmpA*fS0;
-	fC1 = fX*fC0 - fY*fS0;
-	fS1 = fX*fS0 + fY*fC0;
-
-	fTmpA = 0.5462742152960395f;
-	pSH[8] = fTmpA*fC1;
-	pSH[4] = fTmpA*fS1;
-	fTmpB = 1.445305721320277f*fZ;
-	pSH[14] = fTmpB*fC1;
-	pSH[10] = fTmpB*fS1;
-	fTmpC = 3.31161143515146f*fZ2 + -0.47308734787878f;
-	pSH[22] = fTmpC*fC1;
-	pSH[18] = fTmpC*fS1;
-	fTmpA = fZ*( 7.190305177459987f*fZ2 + -2.396768392486662f );
-	pSH[32] = fTmpA*fC1;
-	pSH[28] = fTmpA*fS1;
-	fTmpB = 2.11394181566097f*fZ*fTmpA + -0.9736101204623268f*fTmpC;
-	pSH[44] = fTmpB*fC1;
-	pSH[40] = fTmpB*fS1;
-	fTmpC = 2.081665999466133f*fZ*fTmpB + -0.9847319278346618f*fTmpA;
-	pSH[58] = fTmpC*fC1;
-	pSH[54] = fTmpC*fS1;
-	fTmpA = 2.06155281280883f*fZ*fTmpC + -0.9903379376602873f*fTmpB;
-	pSH[74] = fTmpA*fC1;
-	pSH[70] = fTmpA*fS1;
-	fTmpB = 2.048122358357819f*fZ*fTmpA + -0.9934852726704042f*fTmpC;
-	pSH[92] = fTmpB*fC1;
-	pSH[88] = fTmpB*fS1;
-	fTmpC = 2.038688303787511f*fZ*fTmpB + -0.9953938032404119f*fTmpA;
-	pSH[112] = fTmpC*fC1;
-	pSH[108] = fTmpC*fS1;
-	fTmpA = 2.031798495964875f*fZ*fTmpC + -0.9966204702259603f*fTmpB;
-	pSH[134] = fTmpA*fC1;
-	pSH[130] = fTmpA*fS1;
-	fTmpB = 2.026608708444444f*fZ*fTmpA + -0.9974457174120671f*fTmpC;
-	pSH[158] = fTmpB*fC1;
-	pSH[154] = fTmpB*fS1;
-	fTmpC = 2.022599587389726f*fZ*fTmpB + -0.9980217586956907f*fTmpA;
-	pSH[184] = fTmpC*fC1;
-	pSH[180] = fTmpC*fS1;
-	fTmpA = 2.019436802675439f*fZ*fTmpC + -0.998436277385793f*fTmpB;
-	pSH[212] = fTmpA*fC1;
-	pSH[208] = fTmpA*fS1;
-	fTmpB = 2.016896949069888f*fZ*fTmpA + -0.998742296068792f*fTmpC;
-	pSH[242] = fTmpB*fC1;
-	pSH[238] = fTmpB*fS1;
-	fTmpC = 2.014825999813336f*fZ*fTmpB + -0.9989732002631536f*fTmpA;
-	pSH[274] = fTmpC*fC1;
-	pSH[270] = fTmpC*fS1;
-	fTmpA = 2.013114894621608f*fZ*fTmpC + -0.9991507429465936f*fTmpB;
-	pSH[308] = fTmpA*fC1;
-	pSH[304] = fTmpA*fS1;
-	fTmpB = 2.011684617428885f*fZ*fTmpA + -0.9992895203365968f*fTmpC;
-	pSH[344] = fTmpB*fC1;
-	pSH[340] = fTmpB*fS1;
-	fTmpC = 2.010476761050147f*fZ*fTmpB + -0.9993995796516643f*fTmpA;
-	pSH[382] = fTmpC*fC1;
-	pSH[378] = fTmpC*fS1;
-	fC0 = fX*fC1 - fY*fS1;
-	fS0 = fX*fS1 + fY*fC1;
-
-	fTmpA = -0.5900435899266435f;
-	pSH[15] = fTmpA*fC0;
-	pSH[9] = fTmpA*fS0;
-	fTmpB = -1.770130769779931f*fZ;
-	pSH[23] = fTmpB*fC0;
-	pSH[17] = fTmpB*fS0;
-	fTmpC = -4.403144694917254f*fZ2 + 0.4892382994352505f;
-	pSH[33] = fTmpC*fC0;
-	pSH[27] = fTmpC*fS0;
-	fTmpA = fZ*( -10.13325785466416f*fZ2 + 2.763615778544771f );
-	pSH[45] = fTmpA*fC0;
-	pSH[39] = fTmpA*fS0;
-	fTmpB = 2.207940216581962f*fZ*fTmpA + -0.959403223600247f*fTmpC;
-	pSH[59] = fTmpB*fC0;
-	pSH[53] = fTmpB*fS0;
-	fTmpC = 2.15322168769582f*fZ*fTmpB + -0.9752173865600178f*fTmpA;
-	pSH[75] = fTmpC*fC0;
-	pSH[69] = fTmpC*fS0;
-	fTmpA = 2.118044171189805f*fZ*fTmpC + -0.9836628449792094f*fTmpB;
-	pSH[93] = fTmpA*fC0;
-	pSH[87] = fTmpA*fS0;
-	fTmpB = 2.093947321356338f*fZ*fTmpA + -0.9886230654859614f*fTmpC;
-	pSH[113] = fTmpB*fC0;
-	pSH[107] = fTmpB*fS0;
-	fTmpC = 2.076655965729519f*fZ*fTmpB + -0.9917422203269092f*fTmpA;
-	pSH[135] = fTmpC*fC0;
-	pSH[129] = fTmpC*fS0;
-	fTmpA = 2.063797291222968f*fZ*fTmpC + -0.9938079899999066f*fTmpB;
-	pSH[159] = fTmpA*fC0;
-	pSH[153] = fTmpA*fS0;
-	fTmpB = 2.053959590644373f*fZ*fTmpA + -0.9952332040455557f*fTmpC;
-	pSH[185] = fTmpB*fC0;
-	pSH[179] = fTmpB*fS0;
-	fTmpC = 2.046256527271464f*fZ*fTmpB + -0.9962496519366806f*fTmpA;
-	pSH[213] = fTmpC*fC0;
-	pSH[207] = fTmpC*fS0;
-	fTmpA = 2.040107114108727f*fZ*fTmpC + -0.9969947985109489f*fTmpB;
-	pSH[243] = fTmpA*fC0;
-	pSH[237] = fTmpA*fS0;
-	fTmpB = 2.035116803738375f*fZ*fTmpA + -0.9975538978635777f*fTmpC;
-	pSH[275] = fTmpB*fC0;
-	pSH[269] = fTmpB*fS0;
-	fTmpC = 2.03100960115899f*fZ*fTmpB + -0.9979818344716921f*fTmpA;
-	pSH[309] = fTmpC*fC0;
-	pSH[303] = fTmpC*fS0;
-	fTmpA = 2.027587510099407f*fZ*fTmpC + -0.9983150788368354f*fTmpB;
-	pSH[345] = fTmpA*fC0;
-	pSH[339] = fTmpA*fS0;
-	fTmpB = 2.024705365770985f*fZ*fTmpA + -0.9985785351734189f*fTmpC;
-	pSH[383] = fTmpB*fC0;
-	pSH[377] = fTmpB*fS0;
-	fC1 = fX*fC0 - fY*fS0;
-	fS1 = fX*fS0 + fY*fC0;
-
-	fTmpA = 0.6258357354491763f;
-	pSH[24] = fTmpA*fC1;
-	pSH[16] = fTmpA*fS1;
-	fTmpB = 2.075662314881041f*fZ;
-	pSH[34] = fTmpB*fC1;
-	pSH[26] = fTmpB*fS1;
-	fTmpC = 5.550213908015966f*fZ2 + -0.5045649007287241f;
-	pSH[46] = fTmpC*fC1;
-	pSH[38] = fTmpC*fS1;
-	fTmpA = fZ*( 13.49180504672677f*fZ2 + -3.113493472321562f );
-	pSH[60] = fTmpA*fC1;
-	pSH[52] = fTmpA*fS1;
-	fTmpB = 2.304886114323221f*fZ*fTmpA + -0.9481763873554654f*fTmpC;
-	pSH[76] = fTmpB*fC1;
-	pSH[68] = fTmpB*fS1;
-	fTmpC = 2.229177150706235f*fZ*fTmpB + -0.9671528397231821f*fTmpA;
-	pSH[94] = fTmpC*fC1;
-	pSH[86] = fTmpC*fS1;
-	fTmpA = 2.179449471770337f*fZ*fTmpC + -0.9776923610938036f*fTmpB;
-	pSH[114] = fTmpA*fC1;
-	pSH[106] = fTmpA*fS1;
-	fTmpB = 2.144761058952722f*fZ*fTmpA + -0.9840838646332836f*fTmpC;
-	pSH[136] = fTmpB*fC1;
-	pSH[128] = fTmpB*fS1;
-	fTmpC = 2.119478119726646f*fZ*fTmpB + -0.9882117688026186f*fTmpA;
-	pSH[160] = fTmpC*fC1;
-	pSH[152] = fTmpC*fS1;
-	fTmpA = 2.100420126042015f*fZ*fTmpC + -0.9910081668184009f*fTmpB;
-	pSH[186] = fTmpA*fC1;
-	pSH[178] = fTmpA*fS1;
-	fTmpB = 2.085665361461421f*fZ*fTmpA + -0.9929753269845127f*fTmpC;
-	pSH[214] = fTmpB*fC1;
-	pSH[206] = fTmpB*fS1;
-	fTmpC = 2.073990213742235f*fZ*fTmpB + -0.9944021951292297f*fTmpA;
-	pSH[244] = fTmpC*fC1;
-	pSH[236] = fTmpC*fS1;
-	fTmpA = 2.064582282206258f*fZ*fTmpC + -0.9954638496008124f*fTmpB;
-	pSH[276] = fTmpA*fC1;
-	pSH[268] = fTmpA*fS1;
-	fTmpB = 2.056883378018606f*fZ*fTmpA + -0.996270962773436f*fTmpC;
-	pSH[310] = fTmpB*fC1;
-	pSH[302] = fTmpB*fS1;
-	fTmpC = 2.050498830661811f*fZ*fTmpB + -0.9968960090664231f*fTmpA;
-	pSH[346] = fTmpC*fC1;
-	pSH[338] = fTmpC*fS1;
-	fTmpA = 2.045142707894041f*fZ*fTmpC + -0.9973878927958029f*fTmpB;
-	pSH[384] = fTmpA*fC1;
-	pSH[376] = fTmpA*fS1;
-	fC0 = fX*fC1 - fY*fS1;
-	fS0 = fX*fS1 + fY*fC1;
-
-	fTmpA = -0.6563820568401703f;
-	pSH[35] = fTmpA*fC0;
-	pSH[25] = fTmpA*fS0;
-	fTmpB = -2.366619162231753f*fZ;
-	pSH[47] = fTmpB*fC0;
-	pSH[37] = fTmpB*fS0;
-	fTmpC = -6.745902523363385f*fZ2 + 0.5189155787202604f;
-	pSH[61] = fTmpC*fC0;
-	pSH[51] = fTmpC*fS0;
-	fTmpA = fZ*( -17.24955311049054f*fZ2 + 3.449910622098108f );
-	pSH[77] = fTmpA*fC0;
-	pSH[67] = fTmpA*fS0;
-	fTmpB = 2.401636346922062f*fZ*fTmpA + -0.9392246042043708f*fTmpC;
-	pSH[95] = fTmpB*fC0;
-	pSH[85] = fTmpB*fS0;
-	fTmpC = 2.306512518934159f*fZ*fTmpB + -0.9603920767980496f*fTmpA;
-	pSH[115] = fTmpC*fC0;
-	pSH[105] = fTmpC*fS0;
-	fTmpA = 2.243044805615795f*fZ*fTmpC + -0.9724832565193738f*fTmpB;
-	pSH[137] = fTmpA*fC0;
-	pSH[127] = fTmpA*fS0;
-	fTmpB = 2.198165774710643f*fZ*fTmpA + -0.9799919151000504f*fTmpC;
-	pSH[161] = fTmpB*fC0;
-	pSH[151] = fTmpB*fS0;
-	fTmpC = 2.165063509461097f*fZ*fTmpB + -0.9849409604906143f*fTmpA;
-	pSH[187] = fTmpC*fC0;
-	pSH[177] = fTmpC*fS0;
-	fTmpA = 2.139847510553276f*fZ*fTmpC + -0.9883532289941477f*fTmpB;
-	pSH[215] = fTmpA*fC0;
-	pSH[205] = fTmpA*fS0;
-	fTmpB = 2.120141504711419f*fZ*fTmpA + -0.99079092984679f*fTmpC;
-	pSH[245] = fTmpB*fC0;
-	pSH[235] = fTmpB*fS0;
-	fTmpC = 2.104417123236605f*fZ*fTmpB + -0.9925833339709304f*fTmpA;
-	pSH[277] = fTmpC*fC0;
-	pSH[267] = fTmpC*fS0;
-	fTmpA = 2.091650066335189f*fZ*fTmpC + -0.9939332099323633f*fTmpB;
-	pSH[311] = fTmpA*fC0;
-	pSH[301] = fTmpA*fS0;
-	fTmpB = 2.081130384894173f*fZ*fTmpA + -0.9949706303122452f*fTmpC;
-	pSH[347] = fTmpB*fC0;
-	pSH[337] = fTmpB*fS0;
-	fTmpC = 2.072352010914858f*fZ*fTmpB + -0.9957819202280493f*fTmpA;
-	pSH[385] = fTmpC*fC0;
-	pSH[375] = fTmpC*fS0;
-	fC1 = fX*fC0 - fY*fS0;
-	fS1 = fX*fS0 + fY*fC0;
-
-	fTmpA = 0.6831841051919144f;
-	pSH[48] = fTmpA*fC1;
-	pSH[36] = fTmpA*fS1;
-	fTmpB = 2.645960661801901f*fZ;
-	pSH[62] = fTmpB*fC1;
-	pSH[50] = fTmpB*fS1;
-	fTmpC = 7.984991490893139f*fZ2 + -0.5323327660595426f;
-	pSH[78] = fTmpC*fC1;
-	pSH[66] = fTmpC*fS1;
-	fTmpA = fZ*( 21.39289019090864f*fZ2 + -3.775215916042701f );
-	pSH[96] = fTmpA*fC1;
-	pSH[84] = fTmpA*fS1;
-	fTmpB = 2.496873044429773f*fZ*fTmpA + -0.9319689782769534f*fTmpC;
-	pSH[116] = fTmpB*fC1;
-	pSH[104] = fTmpB*fS1;
-	fTmpC = 2.383768642544085f*fZ*fTmpB + -0.9547015807880142f*fTmpA;
-	pSH[138] = fTmpC*fC1;
-	pSH[126] = fTmpC*fS1;
-	fTmpA = 2.307395517477243f*fZ*fTmpC + -0.9679611839405133f*fTmpB;
-	pSH[162] = fTmpA*fC1;
-	pSH[150] = fTmpA*fS1;
-	fTmpB = 2.252817784447915f*fZ*fTmpA + -0.9763466069791972f*fTmpC;
-	pSH[188] = fTmpB*fC1;
-	pSH[176] = fTmpB*fS1;
-	fTmpC = 2.212182180562893f*fZ*fTmpB + -0.9819623210693983f*fTmpA;
-	pSH[216] = fTmpC*fC1;
-	pSH[204] = fTmpC*fS1;
-	fTmpA = 2.180966243804281f*fZ*fTmpC + -0.9858890750350997f*fTmpB;
-	pSH[246] = fTmpA*fC1;
-	pSH[234] = fTmpA*fS1;
-	fTmpB = 2.156385865284782f*fZ*fTmpA + -0.9887295924045926f*fTmpC;
-	pSH[278] = fTmpB*fC1;
-	pSH[266] = fTmpB*fS1;
-	fTmpC = 2.13663693483576f*fZ*fTmpB + -0.9908416528011255f*fTmpA;
-	pSH[312] = fTmpC*fC1;
-	pSH[300] = fTmpC*fS1;
-	fTmpA = 2.120501774999912f*fZ*fTmpC + -0.9924483380527693f*fTmpB;
-	pSH[348] = fTmpA*fC1;
-	pSH[336] = fTmpA*fS1;
-	fTmpB = 2.107130750570548f*fZ*fTmpA + -0.9936944054529902f*fTmpC;
-	pSH[386] = fTmpB*fC1;
-	pSH[374] = fTmpB*fS1;
-	fC0 = fX*fC1 - fY*fS1;
-	fS0 = fX*fS1 + fY*fC1;
-
-	fTmpA = -0.7071627325245963f;
-	pSH[63] = fTmpA*fC0;
-	pSH[49] = fTmpA*fS0;
-	fTmpB = -2.91570664069932f*fZ;
-	pSH[79] = fTmpB*fC0;
-	pSH[65] = fTmpB*fS0;
-	fTmpC = -9.263393182848905f*fZ2 + 0.5449054813440533f;
-	pSH[97] = fTmpC*fC0;
-	pSH[83] = fTmpC*fS0;
-	fTmpA = fZ*( -25.9102413133663f*fZ2 + 4.091090733689416f );
-	pSH[117] = fTmpA*fC0;
-	pSH[103] = fTmpA*fS0;
-	fTmpB = 2.590045044653342f*fZ*fTmpA + -0.9259892765852515f*fTmpC;
-	pSH[139] = fTmpB*fC0;
-	pSH[125] = fTmpB*fS0;
-	fTmpC = 2.460209661583209f*fZ*fTmpB + -0.9498713802919554f*fTmpA;
-	pSH[163] = fTmpC*fC0;
-	pSH[149] = fTmpC*fS0;
-	fTmpA = 2.371708245126284f*fZ*fTmpC + -0.9640268803757269f*fTmpB;
-	pSH[189] = fTmpA*fC0;
-	pSH[175] = fTmpA*fS0;
-	fTmpB = 2.307927774486216f*fZ*fTmpA + -0.9731077923386515f*fTmpC;
-	pSH[217] = fTmpB*fC0;
-	pSH[203] = fTmpB*fS0;
-	fTmpC = 2.260078437898682f*fZ*fTmpB + -0.9792674029419375f*fTmpA;
-	pSH[247] = fTmpC*fC0;
-	pSH[233] = fTmpC*fS0;
-	fTmpA = 2.223067472099586f*fZ*fTmpC + -0.9836240348217709f*fTmpB;
-	pSH[279] = fTmpA*fC0;
-	pSH[265] = fTmpA*fS0;
-	fTmpB = 2.19374109684803f*fZ*fTmpA + -0.9868081488215654f*fTmpC;
-	pSH[313] = fTmpB*fC0;
-	pSH[299] = fTmpB*fS0;
-	fTmpC = 2.170043987823959f*fZ*fTmpB + -0.9891978551807596f*fTmpA;
-	pSH[349] = fTmpC*fC0;
-	pSH[335] = fTmpC*fS0;
-	fTmpA = 2.150581316760656f*fZ*fTmpC + -0.9910312089651149f*fTmpB;
-	pSH[387] = fTmpA*fC0;
-	pSH[373] = fTmpA*fS0;
-	fC1 = fX*fC0 - fY*fS0;
-	fS1 = fX*fS0 + fY*fC0;
-
-	fTmpA = 0.72892666017483f;
-	pSH[80] = fTmpA*fC1;
-	pSH[64] = fTmpA*fS1;
-	fTmpB = 3.177317648954698f*fZ;
-	pSH[98] = fTmpB*fC1;
-	pSH[82] = fTmpB*fS1;
-	fTmpC = 10.57781172168795f*fZ2 + -0.5567269327204184f;
-	pSH[118] = fTmpC*fC1;
-	pSH[102] = fTmpC*fS1;
-	fTmpA = fZ*( 30.79157970335749f*fZ2 + -4.398797100479641f );
-	pSH[140] = fTmpA*fC1;
-	pSH[124] = fTmpA*fS1;
-	fTmpB = 2.680951323690902f*fZ*fTmpA + -0.9209854970162591f*fTmpC;
-	pSH[164] = fTmpB*fC1;
-	pSH[148] = fTmpB*fS1;
-	fTmpC = 2.53546276418555f*fZ*fTmpB + -0.9457324874869209f*fTmpA;
-	pSH[190] = fTmpC*fC1;
-	pSH[174] = fTmpC*fS1;
-	fTmpA = 2.435532422657966f*fZ*fTmpC + -0.9605869417846947f*fTmpB;
-	pSH[218] = fTmpA*fC1;
-	pSH[202] = fTmpA*fS1;
-	fTmpB = 2.363017336304797f*fZ*fTmpA + -0.9702261872276653f*fTmpC;
-	pSH[248] = fTmpB*fC1;
-	pSH[232] = fTmpB*fS1;
-	fTmpC = 2.308273164077423f*fZ*fTmpB + -0.9768329366922968f*fTmpA;
-	pSH[280] = fTmpC*fC1;
-	pSH[264] = fTmpC*fS1;
-	fTmpA = 2.265686062395524f*fZ*fTmpC + -0.9815502331592888f*fTmpB;
-	pSH[314] = fTmpA*fC1;
-	pSH[298] = fTmpA*fS1;
-	fTmpB = 2.231763704062155f*fZ*fTmpA + -0.9850277764000974f*fTmpC;
-	pSH[350] = fTmpB*fC1;
-	pSH[334] = fTmpB*fS1;
-	fTmpC = 2.20422001138404f*fZ*fTmpB + -0.9876583293168622f*fTmpA;
-	pSH[388] = fTmpC*fC1;
-	pSH[372] = fTmpC*fS1;
-	fC0 = fX*fC1 - fY*fS1;
-	fS0 = fX*fS1 + fY*fC1;
-
-	fTmpA = -0.7489009518531884f;
-	pSH[99] = fTmpA*fC0;
-	pSH[81] = fTmpA*fS0;
-	fTmpB = -3.431895299891715f*fZ;
-	pSH[119] = fTmpB*fC0;
-	pSH[101] = fTmpB*fS0;
-	fTmpC = -11.92552753945219f*fZ2 + 0.5678822637834374f;
-	pSH[141] = fTmpC*fC0;
-	pSH[123] = fTmpC*fS0;
-	fTmpA = fZ*( -36.02809068931077f*fZ2 + 4.699316176866623f );
-	pSH[165] = fTmpA*fC0;
-	pSH[147] = fTmpA*fS0;
-	fTmpB = 2.769558547034986f*fZ*fTmpA + -0.9167415228748209f*fTmpC;
-	pSH[191] = fTmpB*fC0;
-	pSH[173] = fTmpB*fS0;
-	fTmpC = 2.609347744585592f*fZ*fTmpB + -0.9421529461361585f*fTmpA;
-	pSH[219] = fTmpC*fC0;
-	pSH[201] = fTmpC*fS0;
-	fTmpA = 2.498610725094158f*fZ*fTmpC + -0.9575614175146977f*fTmpB;
-	pSH[249] = fTmpA*fC0;
-	pSH[231] = fTmpA*fS0;
-	fTmpB = 2.417791199776004f*fZ*fTmpA + -0.9676542149977727f*fTmpC;
-	pSH[281] = fTmpB*fC0;
-	pSH[263] = fTmpB*fS0;
-	fTmpC = 2.356455943866682f*fZ*fTmpB + -0.9746316985871221f*fTmpA;
-	pSH[315] = fTmpC*fC0;
-	pSH[297] = fTmpC*fS0;
-	fTmpA = 2.308509932184803f*fZ*fTmpC + -0.9796533383929068f*fTmpB;
-	pSH[351] = fTmpA*fC0;
-	pSH[333] = fTmpA*fS0;
-	fTmpB = 2.27014788693852f*fZ*fTmpA + -0.9833823347643229f*fTmpC;
-	pSH[389] = fTmpB*fC0;
-	pSH[371] = fTmpB*fS0;
-	fC1 = fX*fC0 - fY*fS0;
-	fS1 = fX*fS0 + fY*fC0;
-
-	fTmpA = 0.7673951182219901f;
-	pSH[120] = fTmpA*fC1;
-	pSH[100] = fTmpA*fS1;
-	fTmpB = 3.680297698805312f*fZ;
-	pSH[142] = fTmpB*fC1;
-	pSH[122] = fTmpB*fS1;
-	fTmpC = 13.30425420025764f*fZ2 + -0.5784458347938103f;
-	pSH[166] = fTmpC*fC1;
-	pSH[146] = fTmpC*fS1;
-	fTmpA = fZ*( 41.61193153549645f*fZ2 + -4.993431784259574f );
-	pSH[192] = fTmpA*fC1;
-	pSH[172] = fTmpA*fS1;
-	fTmpB = 2.855914914698966f*fZ*fTmpA + -0.9130991183874837f*fTmpC;
-	pSH[220] = fTmpB*fC1;
-	pSH[200] = fTmpB*fS1;
-	fTmpC = 2.681790446697877f*fZ*fTmpB + -0.9390302326218141f*fTmpA;
-	pSH[250] = fTmpC*fC1;
-	pSH[230] = fTmpC*fS1;
-	fTmpA = 2.560799154110355f*fZ*fTmpC + -0.9548841361798045f*fTmpB;
-	pSH[282] = fTmpA*fC1;
-	pSH[262] = fTmpA*fS1;
-	fTmpB = 2.472066162365221f*fZ*fTmpA + -0.9653494919339113f*fTmpC;
-	pSH[316] = fTmpB*fC1;
-	pSH[296] = fTmpB*fS1;
-	fTmpC = 2.404423007708918f*fZ*fTmpB + -0.9726369966604846f*fTmpA;
-	pSH[352] = fTmpC*fC1;
-	pSH[332] = fTmpC*fS1;
-	fTmpA = 2.351326355949746f*fZ*fTmpC + -0.9779170921302378f*fTmpB;
-	pSH[390] = fTmpA*fC1;
-	pSH[370] = fTmpA*fS1;
-	fC0 = fX*fC1 - fY*fS1;
-	fS0 = fX*fS1 + fY*fC1;
-
-	fTmpA = -0.7846421057871971f;
-	pSH[143] = fTmpA*fC0;
-	pSH[121] = fTmpA*fS0;
-	fTmpB = -3.923210528935984f*fZ;
-	pSH[167] = fTmpB*fC0;
-	pSH[145] = fTmpB*fS0;
-	fTmpC = -14.71203948350994f*fZ2 + 0.5884815793403977f;
-	pSH[193] = fTmpC*fC0;
-	pSH[171] = fTmpC*fS0;
-	fTmpA = fZ*( -47.53605436066262f*fZ2 + 5.281783817851402f );
-	pSH[221] = fTmpA*fC0;
-	pSH[199] = fTmpA*fS0;
-	fTmpB = 2.940107271721691f*fZ*fTmpA + -0.9099403568319481f*fTmpC;
-	pSH[251] = fTmpB*fC0;
-	pSH[229] = fTmpB*fS0;
-	fTmpC = 2.752776376275011f*fZ*fTmpB + -0.9362843331437419f*fTmpA;
-	pSH[283] = fTmpC*fC0;
-	pSH[261] = fTmpC*fS0;
-	fTmpA = 2.622022120425379f*fZ*fTmpC + -0.9525009525014289f*fTmpB;
-	pSH[317] = fTmpA*fC0;
-	pSH[295] = fTmpA*fS0;
-	fTmpB = 2.525729665824827f*fZ*fTmpA + -0.9632754987646973f*fTmpC;
-	pSH[353] = fTmpB*fC0;
-	pSH[331] = fTmpB*fS0;
-	fTmpC = 2.452039967047845f*fZ*fTmpB + -0.9708243919473798f*fTmpA;
-	pSH[391] = fTmpC*fC0;
-	pSH[369] = fTmpC*fS0;
-	fC1 = fX*fC0 - fY*fS0;
-	fS1 = fX*fS0 + fY*fC0;
-
-	fTmpA = 0.8008219957839717f;
-	pSH[168] = fTmpA*fC1;
-	pSH[144] = fTmpA*fS1;
-	fTmpB = 4.161193153549645f*fZ;
-	pSH[194] = fTmpB*fC1;
-	pSH[170] = fTmpB*fS1;
-	fTmpC = 16.1471947939282f*fZ2 + -0.5980442516269705f;
-	pSH[222] = fTmpC*fC1;
-	pSH[198] = fTmpC*fS1;
-	fTmpA = fZ*( 53.79407212305809f*fZ2 + -5.564904012730148f );
-	pSH[252] = fTmpA*fC1;
-	pSH[228] = fTmpA*fS1;
-	fTmpB = 3.022238999720004f*fZ*fTmpA + -0.9071758265604122f*fTmpC;
-	pSH[284] = fTmpB*fC1;
-	pSH[260] = fTmpB*fS1;
-	fTmpC = 2.822324793743503f*fZ*fTmpB + -0.9338522843510981f*fTmpA;
-	pSH[318] = fTmpC*fC1;
-	pSH[294] = fTmpC*fS1;
-	fTmpA = 2.682246156571846f*fZ*fTmpC + -0.950367641072997f*fTmpB;
-	pSH[354] = fTmpA*fC1;
-	pSH[330] = fTmpA*fS1;
-	fTmpB = 2.5787147157554f*fZ*fTmpA + -0.9614012157076702f*fTmpC;
-	pSH[392] = fTmpB*fC1;
-	pSH[368] = fTmpB*fS1;
-	fC0 = fX*fC1 - fY*fS1;
-	fS0 = fX*fS1 + fY*fC1;
-
-	fTmpA = -0.8160771188376284f;
-	pSH[195] = fTmpA*fC0;
-	pSH[169] = fTmpA*fS0;
-	fTmpB = -4.394709780272119f*fZ;
-	pSH[223] = fTmpB*fC0;
-	pSH[197] = fTmpB*fS0;
-	fTmpC = -17.60824338884482f*fZ2 + 0.6071808065118906f;
-	pSH[253] = fTmpC*fC0;
-	pSH[227] = fTmpC*fS0;
-	fTmpA = fZ*( -60.38015494295203f*fZ2 + 5.843240800930841f );
-	pSH[285] = fTmpA*fC0;
-	pSH[259] = fTmpA*fS0;
-	fTmpB = 3.102418411497714f*fZ*fTmpA + -0.9047366396343047f*fTmpC;
-	pSH[319] = fTmpB*fC0;
-	pSH[293] = fTmpB*fS0;
-	fTmpC = 2.890473786367456f*fZ*fTmpB + -0.9316840615873149f*fTmpA;
-	pSH[355] = fTmpC*fC0;
-	pSH[329] = fTmpC*fS0;
-	fTmpA = 2.741464024932663f*fZ*fTmpC + -0.9484479803492502f*fTmpB;
-	pSH[393] = fTmpA*fC0;
-	pSH[367] = fTmpA*fS0;
-	fC1 = fX*fC0 - fY*fS0;
-	fS1 = fX*fS0 + fY*fC0;
-
-	fTmpA = 0.830522083064524f;
-	pSH[224] = fTmpA*fC1;
-	pSH[196] = fTmpA*fS1;
-	fTmpB = 4.624151256630013f*fZ;
-	pSH[254] = fTmpB*fC1;
-	pSH[226] = fTmpB*fS1;
-	fTmpC = 19.09388150936025f*fZ2 + -0.6159316615922662f;
-	pSH[286] = fTmpC*fC1;
-	pSH[258] = fTmpC*fS1;
-	fTmpA = fZ*( 67.28894837384407f*fZ2 + -6.117177124894916f );
-	pSH[320] = fTmpA*fC1;
-	pSH[292] = fTmpA*fS1;
-	fTmpB = 3.180752662499868f*fZ*fTmpA + -0.9025689346627115f*fTmpC;
-	pSH[356] = fTmpB*fC1;
-	pSH[328] = fTmpB*fS1;
-	fTmpC = 2.957271469692044f*fZ*fTmpB + -0.9297395250367622f*fTmpA;
-	pSH[394] = fTmpC*fC1;
-	pSH[366] = fTmpC*fS1;
-	fC0 = fX*fC1 - fY*fS1;
-	fS0 = fX*fS1 + fY*fC1;
-
-	fTmpA = -0.8442506508573726f;
-	pSH[255] = fTmpA*fC0;
-	pSH[225] = fTmpA*fS0;
-	fTmpB = -4.849850753230682f*fZ;
-	pSH[287] = fTmpB*fC0;
-	pSH[257] = fTmpB*fS0;
-	fTmpC = -20.60294860554973f*fZ2 + 0.6243317759257494f;
-	pSH[321] = fTmpC*fC0;
-	pSH[291] = fTmpC*fS0;
-	fTmpA = fZ*( -74.51550792153199f*fZ2 + 6.387043536131314f );
-	pSH[357] = fTmpA*fC0;
-	pSH[327] = fTmpA*fS0;
-	fTmpB = 3.257344642135227f*fZ*fTmpA + -0.9006300315787349f*fTmpC;
-	pSH[395] = fTmpB*fC0;
-	pSH[365] = fTmpB*fS0;
-	fC1 = fX*fC0 - fY*fS0;
-	fS1 = fX*fS0 + fY*fC0;
-
-	fTmpA = 0.8573405888380252f;
-	pSH[288] = fTmpA*fC1;
-	pSH[256] = fTmpA*fS1;
-	fTmpB = 5.07209532485536f*fZ;
-	pSH[322] = fTmpB*fC1;
-	pSH[290] = fTmpB*fS1;
-	fTmpC = 22.13440412464915f*fZ2 + -0.632411546418547f;
-	pSH[358] = fTmpC*fC1;
-	pSH[326] = fTmpC*fS1;
-	fTmpA = fZ*( 82.05524583274547f*fZ2 + -6.653128040492876f );
-	pSH[396] = fTmpA*fC1;
-	pSH[364] = fTmpA*fS1;
-	fC0 = fX*fC1 - fY*fS1;
-	fS0 = fX*fS1 + fY*fC1;
-
-	fTmpA = -0.8698571719206282f;
-	pSH[323] = fTmpA*fC0;
-	pSH[289] = fTmpA*fS0;
-	fTmpB = -5.291134612069974f*fZ;
-	pSH[359] = fTmpB*fC0;
-	pSH[325] = fTmpB*fS0;
-	fTmpC = -23.68730913497825f*fZ2 + 0.6401975441886013f;
-	pSH[397] = fTmpC*fC0;
-	pSH[363] = fTmpC*fS0;
-	fC1 = fX*fC0 - fY*fS0;
-	fS1 = fX*fS0 + fY*fC0;
-
-	fTmpA = 0.8818557686783287f;
-	pSH[360] = fTmpA*fC1;
-	pSH[324] = fTmpA*fS1;
-	fTmpB = 5.507187510272244f*fZ;
-	pSH[398] = fTmpB*fC1;
-	pSH[362] = fTmpB*fS1;
-	fC0 = fX*fC1 - fY*fS1;
-	fS0 = fX*fS1 + fY*fC1;
-
-	fTmpC = -0.8933837843499494f;
-	pSH[399] = fTmpC*fC0;
-	pSH[361] = fTmpC*fS0;
-}
-
-// order 21
-void SHEval21( const float fX, const float fY, const float fZ, float *pSH )
-{
-	float fC0, fC1, fS0, fS1, fTmpA, fTmpB, fTmpC;
-	float fZ2 = fZ*fZ;
-
-	pSH[0] = 0.2820947917738781f;
-	pSH[2] = 0.4886025119029199f*fZ;
-	pSH[6] = 0.9461746957575601f*fZ2 + -0.3153915652525201f;
-	pSH[12] = fZ*( 1.865881662950577f*fZ2 + -1.119528997770346f );
-	pSH[20] = 1.984313483298443f*fZ*pSH[12] + -1.006230589874905f*pSH[6];
-	pSH[30] = 1.98997487421324f*fZ*pSH[20] + -1.002853072844814f*pSH[12];
-	pSH[42] = 1.993043457183567f*fZ*pSH[30] + -1.001542020962219f*pSH[20];
-	pSH[56] = 1.994891434824135f*fZ*pSH[42] + -1.000927213921958f*pSH[30];
-	pSH[72] = 1.996089927833914f*fZ*pSH[56] + -1.000600781069515f*pSH[42];
-	pSH[90] = 1.996911195067937f*fZ*pSH[72] + -1.000411437993134f*pSH[56];
-	pSH[110] = 1.997498435543818f*fZ*pSH[90] + -1.00029407440718f*pSH[72];
-	pSH[132] = 1.997932815985082f*fZ*pSH[110] + -1.000217462218511f*pSH[90];
-	pSH[156] = 1.998263134713633f*fZ*pSH[132] + -1.000165330248298f*pSH[110];
-	pSH[182] = 1.998520162579474f*fZ*pSH[156] + -1.000128625635621f*pSH[132];
-	pSH[210] = 1.998724082804747f*fZ*pSH[182] + -1.000102035610694f*pSH[156];
-	pSH[240] = 1.998888580075327f*fZ*pSH[210] + -1.00008230114001f*pSH[182];
-	pSH[272] = 1.999023198964935f*fZ*pSH[240] + -1.00006734687013f*pSH[210];
-	pSH[306] = 1.999134760937227f*fZ*pSH[272] + -1.000055808242921f*pSH[240];
-	pSH[342] = 1.999228246160731f*fZ*pSH[306] + -1.000046762842271f*pSH[272];
-	pSH[380] = 1.999307359286587f*fZ*pSH[342] + -1.000039571832785f*pSH[306];
-	pSH[420] = 1.999374902313221f*fZ*pSH[380] + -1.000033783213131f*pSH[342];
-	fC0 = fX;
-	fS0 = fY;
-
-	fTmpA = -0.48860251190292f;
-	pSH[3] = fTmpA*fC0;
-	pSH[1] = fTmpA*fS0;
-	fTmpB = -1.092548430592079f*fZ;
-	pSH[7] = fTmpB*fC0;
-	pSH[5] = fTmpB*fS0;
-	fTmpC = -2.285228997322329f*fZ2 + 0.4570457994644658f;
-	pSH[13] = fTmpC*fC0;
-	pSH[11] = fTmpC*fS0;
-	fTmpA = fZ*( -4.683325804901025f*fZ2 + 2.007139630671868f );
-	pSH[21] = fTmpA*fC0;
-	pSH[19] = fTmpA*fS0;
-	fTmpB = 2.03100960115899f*fZ*fTmpA + -0.991031208965115f*fTmpC;
-	pSH[31] = fTmpB*fC0;
-	pSH[29] = fTmpB*fS0;
-	fTmpC = 2.021314989237028f*fZ*fTmpB + -0.9952267030562385f*fTmpA;
-	pSH[43] = fTmpC*fC0;
-	pSH[41] = fTmpC*fS0;
-	fTmpA = 2.015564437074638f*fZ*fTmpC + -0.9971550440218319f*fTmpB;
-	pSH[57] = fTmpA*fC0;
-	pSH[55] = fTmpA*fS0;
-	fTmpB = 2.011869540407391f*fZ*fTmpA + -0.9981668178901745f*fTmpC;
-	pSH[73] = fTmpB*fC0;
-	pSH[71] = fTmpB*fS0;
-	fTmpC = 2.009353129741012f*fZ*fTmpB + -0.9987492177719088f*fTmpA;
-	pSH[91] = fTmpC*fC0;
-	pSH[89] = fTmpC*fS0;
-	fTmpA = 2.007561463642653f*fZ*fTmpC + -0.9991083368712843f*fTmpB;
-	pSH[111] = fTmpA*fC0;
-	pSH[109] = fTmpA*fS0;
-	fTmpB = 2.006240264773888f*fZ*fTmpA + -0.9993418887079215f*fTmpC;
-	pSH[133] = fTmpB*fC0;
-	pSH[131] = fTmpB*fS0;
-	fTmpC = 2.005237896355199f*fZ*fTmpB + -0.9995003746877732f*fTmpA;
-	pSH[157] = fTmpC*fC0;
-	pSH[155] = fTmpC*fS0;
-	fTmpA = 2.004459314343183f*fZ*fTmpC + -0.9996117258638336f*fTmpB;
-	pSH[183] = fTmpA*fC0;
-	pSH[181] = fTmpA*fS0;
-	fTmpB = 2.003842462716222f*fZ*fTmpA + -0.9996922603404586f*fTmpC;
-	pSH[211] = fTmpB*fC0;
-	pSH[209] = fTmpB*fS0;
-	fTmpC = 2.003345416333104f*fZ*fTmpB + -0.9997519533634172f*fTmpA;
-	pSH[241] = fTmpC*fC0;
-	pSH[239] = fTmpC*fS0;
-	fTmpA = 2.002939017015334f*fZ*fTmpC + -0.9997971396672504f*fTmpB;
-	pSH[273] = fTmpA*fC0;
-	pSH[271] = fTmpA*fS0;
-	fTmpB = 2.002602473449653f*fZ*fTmpA + -0.9998319751311335f*fTmpC;
-	pSH[307] = fTmpB*fC0;
-	pSH[305] = fTmpB*fS0;
-	fTmpC = 2.002320635087347f*fZ*fTmpB + -0.9998592639497642f*fTmpA;
-	pSH[343] = fTmpC*fC0;
-	pSH[341] = fTmpC*fS0;
-	fTmpA = 2.0020822493927f*fZ*fTmpC + -0.9998809452939409f*fTmpB;
-	pSH[381] = fTmpA*fC0;
-	pSH[379] = fTmpA*fS0;
-	fTmpB = 2.001878816760016f*fZ*fTmpA + -0.999898389472887f*fTmpC;
-	pSH[421] = fTmpB*fC0;
-	pSH[419] = fTmpB*fS0;
-	fC1 = fX*fC0 - fY*fS0;
-	fS1 = fX*fS0 + fY*fC0;
-
-	fTmpA = 0.5462742152960395f;
-	pSH[8] = fTmpA*fC1;
-	pSH[4] = fTmpA*fS1;
-	fTmpB = 1.445305721320277f*fZ;
-	pSH[14] = fTmpB*fC1;
-	pSH[10] = fTmpB*fS1;
-	fTmpC = 3.31161143515146f*fZ2 + -0.47308734787878f;
-	pSH[22] = fTmpC*fC1;
-	pSH[18] = fTmpC*fS1;
-	fTmpA = fZ*( 7.190305177459987f*fZ2 + -2.396768392486662f );
-	pSH[32] = fTmpA*fC1;
-	pSH[28] = fTmpA*fS1;
-	fTmpB = 2.11394181566097f*fZ*fTmpA + -0.9736101204623268f*fTmpC;
-	pSH[44] = fTmpB*fC1;
-	pSH[40] = fTmpB*fS1;
-	fTmpC = 2.081665999466133f*fZ*fTmpB + -0.9847319278346618f*fTmpA;
-	pSH[58] = fTmpC*fC1;
-	pSH[54] = fTmpC*fS1;
-	fTmpA = 2.06155281280883f*fZ*fTmpC + -0.9903379376602873f*fTmpB;
-	pSH[74] = fTmpA*fC1;
-	pSH[70] = fTmpA*fS1;
-	fTmpB = 2.048122358357819f*fZ*fTmpA + -0.9934852726704042f*fTmpC;
-	pSH[92] = fTmpB*fC1;
-	pSH[88] = fTmpB*fS1;
-	fTmpC = 2.038688303787511f*fZ*fTmpB + -0.9953938032404119f*fTmpA;
-	pSH[112] = fTmpC*fC1;
-	pSH[108] = fTmpC*fS1;
-	fTmpA = 2.031798495964875f*fZ*fTmpC + -0.9966204702259603f*fTmpB;
-	pSH[134] = fTmpA*fC1;
-	pSH[130] = fTmpA*fS1;
-	fTmpB = 2.026608708444444f*fZ*fTmpA + -0.9974457174120671f*fTmpC;
-	pSH[158] = fTmpB*fC1;
-	pSH[154] = fTmpB*fS1;
-	fTmpC = 2.022599587389726f*fZ*fTmpB + -0.9980217586956907f*fTmpA;
-	pSH[184] = fTmpC*fC1;
-	pSH[180] = fTmpC*fS1;
-	fTmpA = 2.019436802675439f*fZ*fTmpC + -0.998436277385793f*fTmpB;
-	pSH[212] = fTmpA*fC1;
-	pSH[208] = fTmpA*fS1;
-	fTmpB = 2.016896949069888f*fZ*fTmpA + -0.998742296068792f*fTmpC;
-	pSH[242] = fTmpB*fC1;
-	pSH[238] = fTmpB*fS1;
-	fTmpC = 2.014825999813336f*fZ*fTmpB + -0.9989732002631536f*fTmpA;
-	pSH[274] = fTmpC*fC1;
-	pSH[270] = fTmpC*fS1;
-	fTmpA = 2.013114894621608f*fZ*fTmpC + -0.9991507429465936f*fTmpB;
-	pSH[308] = fTmpA*fC1;
-	pSH[304] = fTmpA*fS1;
-	fTmpB = 2.011684617428885f*fZ*fTmpA + -0.9992895203365968f*fTmpC;
-	pSH[344] = fTmpB*fC1;
-	pSH[340] = fTmpB*fS1;
-	fTmpC = 2.010476761050147f*fZ*fTmpB + -0.9993995796516643f*fTmpA;
-	pSH[382] = fTmpC*fC1;
-	pSH[378] = fTmpC*fS1;
-	fTmpA = 2.00944738370498f*fZ*fTmpC + -0.9994879934127519f*fTmpB;
-	pSH[422] = fTmpA*fC1;
-	pSH[418] = fTmpA*fS1;
-	fC0 = fX*fC1 - fY*fS1;
-	fS0 = fX*fS1 + fY*fC1;
-
-	fTmpA = -0.5900435899266435f;
-	pSH[15] = fTmpA*fC0;
-	pSH[9] = fTmpA*fS0;
-	fTmpB = -1.770130769779931f*fZ;
-	pSH[23] = fTmpB*fC0;
-	pSH[17] = fTmpB*fS0;
-	fTmpC = -4.403144694917254f*fZ2 + 0.4892382994352505f;
-	pSH[33] = fTmpC*fC0;
-	pSH[27] = fTmpC*fS0;
-	fTmpA = fZ*( -10.13325785466416f*fZ2 + 2.763615778544771f );
-	pSH[45] = fTmpA*fC0;
-	pSH[39] = fTmpA*fS0;
-	fTmpB = 2.207940216581962f*fZ*fTmpA + -0.959403223600247f*fTmpC;
-	pSH[59] = fTmpB*fC0;
-	pSH[53] = fTmpB*fS0;
-	fTmpC = 2.15322168769582f*fZ*fTmpB + -0.9752173865600178f*fTmpA;
-	pSH[75] = fTmpC*fC0;
-	pSH[69] = fTmpC*fS0;
-	fTmpA = 2.118044171189805f*fZ*fTmpC + -0.9836628449792094f*fTmpB;
-	pSH[93] = fTmpA*fC0;
-	pSH[87] = fTmpA*fS0;
-	fTmpB = 2.093947321356338f*fZ*fTmpA + -0.9886230654859614f*fTmpC;
-	pSH[113] = fTmpB*fC0;
-	pSH[107] = fTmpB*fS0;
-	fTmpC = 2.076655965729519f*fZ*fTmpB + -0.9917422203269092f*fTmpA;
-	pSH[135] = fTmpC*fC0;
-	pSH[129] = fTmpC*fS0;
-	fTmpA = 2.063797291222968f*fZ*fTmpC + -0.9938079899999066f*fTmpB;
-	pSH[159] = fTmpA*fC0;
-	pSH[153] = fTmpA*fS0;
-	fTmpB = 2.053959590644373f*fZ*fTmpA + -0.9952332040455557f*fTmpC;
-	pSH[185] = fTmpB*fC0;
-	pSH[179] = fTmpB*fS0;
-	fTmpC = 2.046256527271464f*fZ*fTmpB + -0.9962496519366806f*fTmpA;
-	pSH[213] = fTmpC*fC0;
-	pSH[207] = fTmpC*fS0;
-	fTmpA = 2.040107114108727f*fZ*fTmpC + -0.9969947985109489f*fTmpB;
-	pSH[243] = fTmpA*fC0;
-	pSH[237] = fTmpA*fS0;
-	fTmpB = 2.035116803738375f*fZ*fTmpA + -0.9975538978635777f*fTmpC;
-	pSH[275] = fTmpB*fC0;
-	pSH[269] = fTmpB*fS0;
-	fTmpC = 2.03100960115899f*fZ*fTmpB + -0.9979818344716921f*fTmpA;
-	pSH[309] = fTmpC*fC0;
-	pSH[303] = fTmpC*fS0;
-	fTmpA = 2.027587510099407f*fZ*fTmpC + -0.9983150788368354f*fTmpB;
-	pSH[345] = fTmpA*fC0;
-	pSH[339] = fTmpA*fS0;
-	fTmpB = 2.024705365770985f*fZ*fTmpA + -0.9985785351734189f*fTmpC;
-	pSH[383] = fTmpB*fC0;
-	pSH[377] = fTmpB*fS0;
-	fTmpC = 2.022254698720258f*fZ*fTmpB + -0.9987896179403895f*fTmpA;
-	pSH[423] = fTmpC*fC0;
-	pSH[417] = fTmpC*fS0;
-	fC1 = fX*fC0 - fY*fS0;
-	fS1 = fX*fS0 + fY*fC0;
-
-	fTmpA = 0.6258357354491763f;
-	pSH[24] = fTmpA*fC1;
-	pSH[16] = fTmpA*fS1;
-	fTmpB = 2.075662314881041f*fZ;
-	pSH[34] = fTmpB*fC1;
-	pSH[26] = fTmpB*fS1;
-	fTmpC = 5.550213908015966f*fZ2 + -0.5045649007287241f;
-	pSH[46] = fTmpC*fC1;
-	pSH[38] = fTmpC*fS1;
-	fTmpA = fZ*( 13.49180504672677f*fZ2 + -3.113493472321562f );
-	pSH[60] = fTmpA*fC1;
-	pSH[52] = fTmpA*fS1;
-	fTmpB = 2.304886114323221f*fZ*fTmpA + -0.9481763873554654f*fTmpC;
-	pSH[76] = fTmpB*fC1;
-	pSH[68] = fTmpB*fS1;
-	fTmpC = 2.229177150706235f*fZ*fTmpB + -0.9671528397231821f*fTmpA;
-	pSH[94] = fTmpC*fC1;
-	pSH[86] = fTmpC*fS1;
-	fTmpA = 2.179449471770337f*fZ*fTmpC + -0.9776923610938036f*fTmpB;
-	pSH[114] = fTmpA*fC1;
-	pSH[106] = fTmpA*fS1;
-	fTmpB = 2.144761058952722f*fZ*fTmpA + -0.9840838646332836f*fTmpC;
-	pSH[136] = fTmpB*fC1;
-	pSH[128] = fTmpB*fS1;
-	fTmpC = 2.119478119726646f*fZ*fTmpB + -0.9882117688026186f*fTmpA;
-	pSH[160] = fTmpC*fC1;
-	pSH[152] = fTmpC*fS1;
-	fTmpA = 2.100420126042015f*fZ*fTmpC + -0.9910081668184009f*fTmpB;
-	pSH[186] = fTmpA*fC1;
-	pSH[178] = fTmpA*fS1;
-	fTmpB = 2.085665361461421f*fZ*fTmpA + -0.9929753269845127f*fTmpC;
-	pSH[214] = fTmpB*fC1;
-	pSH[206] = fTmpB*fS1;
-	fTmpC = 2.073990213742235f*fZ*fTmpB + -0.9944021951292297f*fTmpA;
-	pSH[244] = fTmpC*fC1;
-	pSH[236] = fTmpC*fS1;
-	fTmpA = 2.064582282206258f*fZ*fTmpC + -0.9954638496008124f*fTmpB;
-	pSH[276] = fTmpA*fC1;
-	pSH[268] = fTmpA*fS1;
-	fTmpB = 2.056883378018606f*fZ*fTmpA + -0.996270962773436f*fTmpC;
-	pSH[310] = fTmpB*fC1;
-	pSH[302] = fTmpB*fS1;
-	fTmpC = 2.050498830661811f*fZ*fTmpB + -0.9968960090664231f*fTmpA;
-	pSH[346] = fTmpC*fC1;
-	pSH[338] = fTmpC*fS1;
-	fTmpA = 2.045142707894041f*fZ*fTmpC + -0.9973878927958029f*fTmpB;
-	pSH[384] = fTmpA*fC1;
-	pSH[376] = fTmpA*fS1;
-	fTmpB = 2.040603464664314f*fZ*fTmpA + -0.9977804760458977f*fTmpC;
-	pSH[424] = fTmpB*fC1;
-	pSH[416] = fTmpB*fS1;
-	fC0 = fX*fC1 - fY*fS1;
-	fS0 = fX*fS1 + fY*fC1;
-
-	fTmpA = -0.6563820568401703f;
-	pSH[35] = fTmpA*fC0;
-	pSH[25] = fTmpA*fS0;
-	fTmpB = -2.366619162231753f*fZ;
-	pSH[47] = fTmpB*fC0;
-	pSH[37] = fTmpB*fS0;
-	fTmpC = -6.745902523363385f*fZ2 + 0.5189155787202604f;
-	pSH[61] = fTmpC*fC0;
-	pSH[51] = fTmpC*fS0;
-	fTmpA = fZ*( -17.24955311049054f*fZ2 + 3.449910622098108f );
-	pSH[77] = fTmpA*fC0;
-	pSH[67] = fTmpA*fS0;
-	fTmpB = 2.401636346922062f*fZ*fTmpA + -0.9392246042043708f*fTmpC;
-	pSH[95] = fTmpB*fC0;
-	pSH[85] = fTmpB*fS0;
-	fTmpC = 2.306512518934159f*fZ*fTmpB + -0.9603920767980496f*fTmpA;
-	pSH[115] = fTmpC*fC0;
-	pSH[105] = fTmpC*fS0;
-	fTmpA = 2.243044805615795f*fZ*fTmpC + -0.9724832565193738f*fTmpB;
-	pSH[137] = fTmpA*fC0;
-	pSH[127] = fTmpA*fS0;
-	fTmpB = 2.198165774710643f*fZ*fTmpA + -0.9799919151000504f*fTmpC;
-	pSH[161] = fTmpB*fC0;
-	pSH[151] = fTmpB*fS0;
-	fTmpC = 2.165063509461097f*fZ*fTmpB + -0.9849409604906143f*fTmpA;
-	pSH[187] = fTmpC*fC0;
-	pSH[177] = fTmpC*fS0;
-	fTmpA = 2.139847510553276f*fZ*fTmpC + -0.9883532289941477f*fTmpB;
-	pSH[215] = fTmpA*fC0;
-	pSH[205] = fTmpA*fS0;
-	fTmpB = 2.120141504711419f*fZ*fTmpA + -0.99079092984679f*fTmpC;
-	pSH[245] = fTmpB*fC0;
-	pSH[235] = fTmpB*fS0;
-	fTmpC = 2.104417123236605f*fZ*fTmpB + -0.9925833339709304f*fTmpA;
-	pSH[277] = fTmpC*fC0;
-	pSH[267] = fTmpC*fS0;
-	fTmpA = 2.091650066335189f*fZ*fTmpC + -0.9939332099323633f*fTmpB;
-	pSH[311] = fTmpA*fC0;
-	pSH[301] = fTmpA*fS0;
-	fTmpB = 2.081130384894173f*fZ*fTmpA + -0.9949706303122452f*fTmpC;
-	pSH[347] = fTmpB*fC0;
-	pSH[337] = fTmpB*fS0;
-	fTmpC = 2.072352010914858f*fZ*fTmpB + -0.9957819202280493f*fTmpA;
-	pSH[385] = fTmpC*fC0;
-	pSH[375] = fTmpC*fS0;
-	fTmpA = 2.064945519862449f*fZ*fTmpC + -0.9964260458583293f*fTmpB;
-	pSH[425] = fTmpA*fC0;
-	pSH[415] = fTmpA*fS0;
-	fC1 = fX*fC0 - fY*fS0;
-	fS1 = fX*fS0 + fY*fC0;
-
-	fTmpA = 0.6831841051919144f;
-	pSH[48] = fTmpA*fC1;
-	pSH[36] = fTmpA*fS1;
-	fTmpB = 2.645960661801901f*fZ;
-	pSH[62] = fTmpB*fC1;
-	pSH[50] = fTmpB*fS1;
-	fTmpC = 7.984991490893139f*fZ2 + -0.5323327660595426f;
-	pSH[78] = fTmpC*fC1;
-	pSH[66] = fTmpC*fS1;
-	fTmpA = fZ*( 21.39289019090864f*fZ2 + -3.775215916042701f );
-	pSH[96] = fTmpA*fC1;
-	pSH[84] = fTmpA*fS1;
-	fTmpB = 2.496873044429773f*fZ*fTmpA + -0.9319689782769534f*fTmpC;
-	pSH[116] = fTmpB*fC1;
-	pSH[104] = fTmpB*fS1;
-	fTmpC = 2.383768642544085f*fZ*fTmpB + -0.9547015807880142f*fTmpA;
-	pSH[138] = fTmpC*fC1;
-	pSH[126] = fTmpC*fS1;
-	fTmpA = 2.307395517477243f*fZ*fTmpC + -0.9679611839405133f*fTmpB;
-	pSH[162] = fTmpA*fC1;
-	pSH[150] = fTmpA*fS1;
-	fTmpB = 2.252817784447915f*fZ*fTmpA + -0.9763466069791972f*fTmpC;
-	pSH[188] = fTmpB*fC1;
-	pSH[176] = fTmpB*fS1;
-	fTmpC = 2.212182180562893f*fZ*fTmpB + -0.9819623210693983f*fTmpA;
-	pSH[216] = fTmpC*fC1;
-	pSH[204] = fTmpC*fS1;
-	fTmpA = 2.180966243804281f*fZ*fTmpC + -0.9858890750350997f*fTmpB;
-	pSH[246] = fTmpA*fC1;
-	pSH[234] = fTmpA*fS1;
-	fTmpB = 2.156385865284782f*fZ*fTmpA + -0.9887295924045926f*fTmpC;
-	pSH[278] = fTmpB*fC1;
-	pSH[266] = fTmpB*fS1;
-	fTmpC = 2.13663693483576f*fZ*fTmpB + -0.9908416528011255f*fTmpA;
-	pSH[312] = fTmpC*fC1;
-	pSH[300] = fTmpC*fS1;
-	fTmpA = 2.120501774999912f*fZ*fTmpC + -0.9924483380527693f*fTmpB;
-	pSH[348] = fTmpA*fC1;
-	pSH[336] = fTmpA*fS1;
-	fTmpB = 2.107130750570548f*fZ*fTmpA + -0.9936944054529902f*fTmpC;
-	pSH[386] = fTmpB*fC1;
-	pSH[374] = fTmpB*fS1;
-	fTmpC = 2.095914393017316f*fZ*fTmpB + -0.9946769522725655f*fTmpA;
-	pSH[426] = fTmpC*fC1;
-	pSH[414] = fTmpC*fS1;
-	fC0 = fX*fC1 - fY*fS1;
-	fS0 = fX*fS1 + fY*fC1;
-
-	fTmpA = -0.7071627325245963f;
-	pSH[63] = fTmpA*fC0;
-	pSH[49] = fTmpA*fS0;
-	fTmpB = -2.91570664069932f*fZ;
-	pSH[79] = fTmpB*fC0;
-	pSH[65] = fTmpB*fS0;
-	fTmpC = -9.263393182848905f*fZ2 + 0.5449054813440533f;
-	pSH[97] = fTmpC*fC0;
-	pSH[83] = fTmpC*fS0;
-	fTmpA = fZ*( -25.9102413133663f*fZ2 + 4.091090733689416f );
-	pSH[117] = fTmpA*fC0;
-	pSH[103] = fTmpA*fS0;
-	fTmpB = 2.590045044653342f*fZ*fTmpA + -0.9259892765852515f*fTmpC;
-	pSH[139] = fTmpB*fC0;
-	pSH[125] = fTmpB*fS0;
-	fTmpC = 2.460209661583209f*fZ*fTmpB + -0.9498713802919554f*fTmpA;
-	pSH[163] = fTmpC*fC0;
-	pSH[149] = fTmpC*fS0;
-	fTmpA = 2.371708245126284f*fZ*fTmpC + -0.9640268803757269f*fTmpB;
-	pSH[189] = fTmpA*fC0;
-	pSH[175] = fTmpA*fS0;
-	fTmpB = 2.307927774486216f*fZ*fTmpA + -0.9731077923386515f*fTmpC;
-	pSH[217] = fTmpB*fC0;
-	pSH[203] = fTmpB*fS0;
-	fTmpC = 2.260078437898682f*fZ*fTmpB + -0.9792674029419375f*fTmpA;
-	pSH[247] = fTmpC*fC0;
-	pSH[233] = fTmpC*fS0;
-	fTmpA = 2.223067472099586f*fZ*fTmpC + -0.9836240348217709f*fTmpB;
-	pSH[279] = fTmpA*fC0;
-	pSH[265] = fTmpA*fS0;
-	fTmpB = 2.19374109684803f*fZ*fTmpA + -0.9868081488215654f*fTmpC;
-	pSH[313] = fTmpB*fC0;
-	pSH[299] = fTmpB*fS0;
-	fTmpC = 2.170043987823959f*fZ*fTmpB + -0.9891978551807596f*fTmpA;
-	pSH[349] = fTmpC*fC0;
-	pSH[335] = fTmpC*fS0;
-	fTmpA = 2.150581316760656f*fZ*fTmpC + -0.9910312089651149f*fTmpB;
-	pSH[387] = fTmpA*fC0;
-	pSH[373] = fTmpA*fS0;
-	fTmpB = 2.13437474581095f*fZ*fTmpA + -0.9924640975798494f*fTmpC;
-	pSH[427] = fTmpB*fC0;
-	pSH[413] = fTmpB*fS0;
-	fC1 = fX*fC0 - fY*fS0;
-	fS1 = fX*fS0 + fY*fC0;
-
-	fTmpA = 0.72892666017483f;
-	pSH[80] = fTmpA*fC1;
-	pSH[64] = fTmpA*fS1;
-	fTmpB = 3.177317648954698f*fZ;
-	pSH[98] = fTmpB*fC1;
-	pSH[82] = fTmpB*fS1;
-	fTmpC = 10.57781172168795f*fZ2 + -0.5567269327204184f;
-	pSH[118] = fTmpC*fC1;
-	pSH[102] = fTmpC*fS1;
-	fTmpA = fZ*( 30.79157970335749f*fZ2 + -4.398797100479641f );
-	pSH[140] = fTmpA*fC1;
-	pSH[124] = fTmpA*fS1;
-	fTmpB = 2.680951323690902f*fZ*fTmpA + -0.9209854970162591f*fTmpC;
-	pSH[164] = fTmpB*fC1;
-	pSH[148] = fTmpB*fS1;
-	fTmpC = 2.53546276418555f*fZ*fTmpB + -0.9457324874869209f*fTmpA;
-	pSH[190] = fTmpC*fC1;
-	pSH[174] = fTmpC*fS1;
-	fTmpA = 2.435532422657966f*fZ*fTmpC + -0.9605869417846947f*fTmpB;
-	pSH[218] = fTmpA*fC1;
-	pSH[202] = fTmpA*fS1;
-	fTmpB = 2.363017336304797f*fZ*fTmpA + -0.9702261872276653f*fTmpC;
-	pSH[248] = fTmpB*fC1;
-	pSH[232] = fTmpB*fS1;
-	fTmpC = 2.308273164077423f*fZ*fTmpB + -0.9768329366922968f*fTmpA;
-	pSH[280] = fTmpC*fC1;
-	pSH[264] = fTmpC*fS1;
-	fTmpA = 2.265686062395524f*fZ*fTmpC + -0.9815502331592888f*fTmpB;
-	pSH[314] = fTmpA*fC1;
-	pSH[298] = fTmpA*fS1;
-	fTmpB = 2.231763704062155f*fZ*fTmpA + -0.9850277764000974f*fTmpC;
-	pSH[350] = fTmpB*fC1;
-	pSH[334] = fTmpB*fS1;
-	fTmpC = 2.20422001138404f*fZ*fTmpB + -0.9876583293168622f*fTmpA;
-	pSH[388] = fTmpC*fC1;
-	pSH[372] = fTmpC*fS1;
-	fTmpA = 2.181496864867922f*fZ*fTmpC + -0.9896910714907037f*fTmpB;
-	pSH[428] = fTmpA*fC1;
-	pSH[412] = fTmpA*fS1;
-	fC0 = fX*fC1 - fY*fS1;
-	fS0 = fX*fS1 + fY*fC1;
-
-	fTmpA = -0.7489009518531884f;
-	pSH[99] = fTmpA*fC0;
-	pSH[81] = fTmpA*fS0;
-	fTmpB = -3.431895299891715f*fZ;
-	pSH[119] = fTmpB*fC0;
-	pSH[101] = fTmpB*fS0;
-	fTmpC = -11.92552753945219f*fZ2 + 0.5678822637834374f;
-	pSH[141] = fTmpC*fC0;
-	pSH[123] = fTmpC*fS0;
-	fTmpA = fZ*( -36.02809068931077f*fZ2 + 4.699316176866623f );
-	pSH[165] = fTmpA*fC0;
-	pSH[147] = fTmpA*fS0;
-	fTmpB = 2.769558547034986f*fZ*fTmpA + -0.9167415228748209f*fTmpC;
-	pSH[191] = fTmpB*fC0;
-	pSH[173] = fTmpB*fS0;
-	fTmpC = 2.609347744585592f*fZ*fTmpB + -0.9421529461361585f*fTmpA;
-	pSH[219] = fTmpC*fC0;
-	pSH[201] = fTmpC*fS0;
-	fTmpA = 2.498610725094158f*fZ*fTmpC + -0.9575614175146977f*fTmpB;
-	pSH[249] = fTmpA*fC0;
-	pSH[231] = fTmpA*fS0;
-	fTmpB = 2.417791199776004f*fZ*fTmpA + -0.9676542149977727f*fTmpC;
-	pSH[281] = fTmpB*fC0;
-	pSH[263] = fTmpB*fS0;
-	fTmpC = 2.356455943866682f*fZ*fTmpB + -0.9746316985871221f*fTmpA;
-	pSH[315] = fTmpC*fC0;
-	pSH[297] = fTmpC*fS0;
-	fTmpA = 2.308509932184803f*fZ*fTmpC + -0.9796533383929068f*fTmpB;
-	pSH[351] = fTmpA*fC0;
-	pSH[333] = fTmpA*fS0;
-	fTmpB = 2.27014788693852f*fZ*fTmpA + -0.9833823347643229f*fTmpC;
-	pSH[389] = fTmpB*fC0;
-	pSH[371] = fTmpB*fS0;
-	fTmpC = 2.23887006879653f*fZ*fTmpB + -0.9862221230951737f*fTmpA;
-	pSH[429] = fTmpC*fC0;
-	pSH[411] = fTmpC*fS0;
-	fC1 = fX*fC0 - fY*fS0;
-	fS1 = fX*fS0 + fY*fC0;
-
-	fTmpA = 0.7673951182219901f;
-	pSH[120] = fTmpA*fC1;
-	pSH[100] = fTmpA*fS1;
-	fTmpB = 3.680297698805312f*fZ;
-	pSH[142] = fTmpB*fC1;
-	pSH[122] = fTmpB*fS1;
-	fTmpC = 13.30425420025764f*fZ2 + -0.5784458347938103f;
-	pSH[166] = fTmpC*fC1;
-	pSH[146] = fTmpC*fS1;
-	fTmpA = fZ*( 41.61193153549645f*fZ2 + -4.993431784259574f );
-	pSH[192] = fTmpA*fC1;
-	pSH[172] = fTmpA*fS1;
-	fTmpB = 2.855914914698966f*fZ*fTmpA + -0.9130991183874837f*fTmpC;
-	pSH[220] = fTmpB*fC1;
-	pSH[200] = fTmpB*fS1;
-	fTmpC = 2.681790446697877f*fZ*fTmpB + -0.9390302326218141f*fTmpA;
-	pSH[250] = fTmpC*fC1;
-	pSH[230] = fTmpC*fS1;
-	fTmpA = 2.560799154110355f*fZ*fTmpC + -0.9548841361798045f*fTmpB;
-	pSH[282] = fTmpA*fC1;
-	pSH[262] = fTmpA*fS1;
-	fTmpB = 2.472066162365221f*fZ*fTmpA + -0.9653494919339113f*fTmpC;
-	pSH[316] = fTmpB*fC1;
-	pSH[296] = fTmpB*fS1;
-	fTmpC = 2.404423007708918f*fZ*fTmpB + -0.9726369966604846f*fTmpA;
-	pSH[352] = fTmpC*fC1;
-	pSH[332] = fTmpC*fS1;
-	fTmpA = 2.351326355949746f*fZ*fTmpC + -0.9779170921302378f*fTmpB;
-	pSH[390] = fTmpA*fC1;
-	pSH[370] = fTmpA*fS1;
-	fTmpB = 2.308679276123039f*fZ*fTmpA + -0.9818625433603494f*fTmpC;
-	pSH[430] = fTmpB*fC1;
-	pSH[410] = fTmpB*fS1;
-	fC0 = fX*fC1 - fY*fS1;
-	fS0 = fX*fS1 + fY*fC1;
-
-	fTmpA = -0.7846421057871971f;
-	pSH[143] = fTmpA*fC0;
-	pSH[121] = fTmpA*fS0;
-	fTmpB = -3.923210528935984f*fZ;
-	pSH[167] = fTmpB*fC0;
-	pSH[145] = fTmpB*fS0;
-	fTmpC = -14.71203948350994f*fZ2 + 0.5884815793403977f;
-	pSH[193] = fTmpC*fC0;
-	pSH[171] = fTmpC*fS0;
-	fTmpA = fZ*( -47.53605436066262f*fZ2 + 5.281783817851402f );
-	pSH[221] = fTmpA*fC0;
-	pSH[199] = fTmpA*fS0;
-	fTmpB = 2.940107271721691f*fZ*fTmpA + -0.9099403568319481f*fTmpC;
-	pSH[251] = fTmpB*fC0;
-	pSH[229] = fTmpB*fS0;
-	fTmpC = 2.752776376275011f*fZ*fTmpB + -0.9362843331437419f*fTmpA;
-	pSH[283] = fTmpC*fC0;
-	pSH[261] = fTmpC*fS0;
-	fTmpA = 2.622022120425379f*fZ*fTmpC + -0.9525009525014289f*fTmpB;
-	pSH[317] = fTmpA*fC0;
-	pSH[295] = fTmpA*fS0;
-	fTmpB = 2.525729665824827f*fZ*fTmpA + -0.9632754987646973f*fTmpC;
-	pSH[353] = fTmpB*fC0;
-	pSH[331] = fTmpB*fS0;
-	fTmpC = 2.452039967047845f*fZ*fTmpB + -0.9708243919473798f*fTmpA;
-	pSH[391] = fTmpC*fC0;
-	pSH[369] = fTmpC*fS0;
-	fTmpA = 2.393988887964797f*fZ*fTmpC + -0.9763253944213071f*fTmpB;
-	pSH[431] = fTmpA*fC0;
-	pSH[409] = fTmpA*fS0;
-	fC1 = fX*fC0 - fY*fS0;
-	fS1 = fX*fS0 + fY*fC0;
-
-	fTmpA = 0.8008219957839717f;
-	pSH[168] = fTmpA*fC1;
-	pSH[144] = fTmpA*fS1;
-	fTmpB = 4.161193153549645f*fZ;
-	pSH[194] = fTmpB*fC1;
-	pSH[170] = fTmpB*fS1;
-	fTmpC = 16.1471947939282f*fZ2 + -0.5980442516269705f;
-	pSH[222] = fTmpC*fC1;
-	pSH[198] = fTmpC*fS1;
-	fTmpA = fZ*( 53.79407212305809f*fZ2 + -5.564904012730148f );
-	pSH[252] = fTmpA*fC1;
-	pSH[228] = fTmpA*fS1;
-	fTmpB = 3.022238999720004f*fZ*fTmpA + -0.9071758265604122f*fTmpC;
-	pSH[284] = fTmpB*fC1;
-	pSH[260] = fTmpB*fS1;
-	fTmpC = 2.822324793743503f*fZ*fTmpB + -0.9338522843510981f*fTmpA;
-	pSH[318] = fTmpC*fC1;
-	pSH[294] = fTmpC*fS1;
-	fTmpA = 2.682246156571846f*fZ*fTmpC + -0.950367641072997f*fTmpB;
-	pSH[354] = fTmpA*fC1;
-	pSH[330] = fTmpA*fS1;
-	fTmpB = 2.5787147157554f*fZ*fTmpA + -0.9614012157076702f*fTmpC;
-	pSH[392] = fTmpB*fC1;
-	pSH[368] = fTmpB*fS1;
-	fTmpC = 2.499218627891526f*fZ*fTmpB + -0.9691722052935243f*fTmpA;
-	pSH[432] = fTmpC*fC1;
-	pSH[408] = fTmpC*fS1;
-	fC0 = fX*fC1 - fY*fS1;
-	fS0 = fX*fS1 + fY*fC1;
-
-	fTmpA = -0.8160771188376284f;
-	pSH[195] = fTmpA*fC0;
-	pSH[169] = fTmpA*fS0;
-	fTmpB = -4.394709780272119f*fZ;
-	pSH[223] = fTmpB*fC0;
-	pSH[197] = fTmpB*fS0;
-	fTmpC = -17.60824338884482f*fZ2 + 0.6071808065118906f;
-	pSH[253] = fTmpC*fC0;
-	pSH[227] = fTmpC*fS0;
-	fTmpA = fZ*( -60.38015494295203f*fZ2 + 5.843240800930841f );
-	pSH[285] = fTmpA*fC0;
-	pSH[259] = fTmpA*fS0;
-	fTmpB = 3.102418411497714f*fZ*fTmpA + -0.9047366396343047f*fTmpC;
-	pSH[319] = fTmpB*fC0;
-	pSH[293] = fTmpB*fS0;
-	fTmpC = 2.890473786367456f*fZ*fTmpB + -0.9316840615873149f*fTmpA;
-	pSH[355] = fTmpC*fC0;
-	pSH[329] = fTmpC*fS0;
-	fTmpA = 2.741464024932663f*fZ*fTmpC + -0.9484479803492502f*fTmpB;
-	pSH[393] = fTmpA*fC0;
-	pSH[367] = fTmpA*fS0;
-	fTmpB = 2.630984211674012f*fZ*fTmpA + -0.9597004329606822f*fTmpC;
-	pSH[433] = fTmpB*fC0;
-	pSH[407] = fTmpB*fS0;
-	fC1 = fX*fC0 - fY*fS0;
-	fS1 = fX*fS0 + fY*fC0;
-
-	fTmpA = 0.830522083064524f;
-	pSH[224] = fTmpA*fC1;
-	pSH[196] = fTmpA*fS1;
-	fTmpB = 4.624151256630013f*fZ;
-	pSH[254] = fTmpB*fC1;
-	pSH[226] = fTmpB*fS1;
-	fTmpC = 19.09388150936025f*fZ2 + -0.6159316615922662f;
-	pSH[286] = fTmpC*fC1;
-	pSH[258] = fTmpC*fS1;
-	fTmpA = fZ*( 67.28894837384407f*fZ2 + -6.117177124894916f );
-	pSH[320] = fTmpA*fC1;
-	pSH[292] = fTmpA*fS1;
-	fTmpB = 3.180752662499868f*fZ*fTmpA + -0.9025689346627115f*fTmpC;
-	pSH[356] = fTmpB*fC1;
-	pSH[328] = fTmpB*fS1;
-	fTmpC = 2.957271469692044f*fZ*fTmpB + -0.9297395250367622f*fTmpA;
-	pSH[394] = fTmpC*fC1;
-	pSH[366] = fTmpC*fS1;
-	fTmpA = 2.799684856214652f*fZ*fTmpC + -0.9467121584567262f*fTmpB;
-	pSH[434] = fTmpA*fC1;
-	pSH[406] = fTmpA*fS1;
-	fC0 = fX*fC1 - fY*fS1;
-	fS0 = fX*fS1 + fY*fC1;
-
-	fTmpA = -0.8442506508573726f;
-	pSH[255] = fTmpA*fC0;
-	pSH[225] = fTmpA*fS0;
-	fTmpB = -4.849850753230682f*fZ;
-	pSH[287] = fTmpB*fC0;
-	pSH[257] = fTmpB*fS0;
-	fTmpC = -20.60294860554973f*fZ2 + 0.6243317759257494f;
-	pSH[321] = fTmpC*fC0;
-	pSH[291] = fTmpC*fS0;
-	fTmpA = fZ*( -74.51550792153199f*fZ2 + 6.387043536131314f );
-	pSH[357] = fTmpA*fC0;
-	pSH[327] = fTmpA*fS0;
-	fTmpB = 3.257344642135227f*fZ*fTmpA + -0.9006300315787349f*fTmpC;
-	pSH[395] = fTmpB*fC0;
-	pSH[365] = fTmpB*fS0;
-	fTmpC = 3.022770725202766f*fZ*fTmpB + -0.9279861535380262f*fTmpA;
-	pSH[435] = fTmpC*fC0;
-	pSH[405] = fTmpC*fS0;
-	fC1 = fX*fC0 - fY*fS0;
-	fS1 = fX*fS0 + fY*fC0;
-
-	fTmpA = 0.8573405888380252f;
-	pSH[288] = fTmpA*fC1;
-	pSH[256] = fTmpA*fS1;
-	fTmpB = 5.07209532485536f*fZ;
-	pSH[322] = fTmpB*fC1;
-	pSH[290] = fTmpB*fS1;
-	fTmpC = 22.13440412464915f*fZ2 + -0.632411546418547f;
-	pSH[358] = fTmpC*fC1;
-	pSH[326] = fTmpC*fS1;
-	fTmpA = fZ*( 82.05524583274547f*fZ2 + -6.653128040492876f );
-	pSH[396] = fTmpA*fC1;
-	pSH[364] = fTmpA*fS1;
-	fTmpB = 3.332291503855366f*fZ*fTmpA + -0.8988856965685321f*fTmpC;
-	pSH[436] = fTmpB*fC1;
-	pSH[404] = fTmpB*fS1;
-	fC0 = fX*fC1 - fY*fS1;
-	fS0 = fX*fS1 + fY*fC1;
-
-	fTmpA = -0.8698571719206282f;
-	pSH[323] = fTmpA*fC0;
-	pSH[289] = fTmpA*fS0;
-	fTmpB = -5.291134612069974f*fZ;
-	pSH[359] = fTmpB*fC0;
-	pSH[325] = fTmpB*fS0;
-	fTmpC = -23.68730913497825f*fZ2 + 0.6401975441886013f;
-	pSH[397] = fTmpC*fC0;
-	pSH[363] = fTmpC*fS0;
-	fTmpA = fZ*( -89.90388731214063f*fZ2 + 6.915683639395432f );
-	pSH[437] = fTmpA*fC0;
-	pSH[403] = fTmpA*fS0;
-	fC1 = fX*fC0 - fY*fS0;
-	fS1 = fX*fS0 + fY*fC0;
-
-	fTmpA = 0.8818557686783287f;
-	pSH[360] = fTmpA*fC1;
-	pSH[324] = fTmpA*fS1;
-	fTmpB = 5.507187510272244f*fZ;
-	pSH[398] = fTmpB*fC1;
-	pSH[362] = fTmpB*fS1;
-	fTmpC = 25.26081157877712f*fZ2 + -0.6477131174045414f;
-	pSH[438] = fTmpC*fC1;
-	pSH[402] = fTmpC*fS1;
-	fC0 = fX*fC1 - fY*fS1;
-	fS0 = fX*fS1 + fY*fC1;
-
-	fTmpA = -0.8933837843499494f;
-	pSH[399] = fTmpA*fC0;
-	pSH[361] = fTmpA*fS0;
-	fTmpB = -5.720447362900642f*fZ;
-	pSH[439] = fTmpB*fC0;
-	pSH[401] = fTmpB*fS0;
-	fC1 = fX*fC0 - fY*fS0;
-	fS1 = fX*fS0 + fY*fC0;
-
-	fTmpC = 0.9044821450934909f;
-	pSH[440] = fTmpC*fC1;
-	pSH[400] = fTmpC*fS1;
+	SHKernel<21>::Eval( fX, fY, fZ, SHStore<float>{ pSH } );
 }
 
 
@@ -3,7 +3,29 @@
 // From Peter Pike Sloan's Efficient SH Evaluation paper
 // @ http://jcgt.org/published/0002/02/06/paper.pdf
 
+/// Expands X(N) for every band count supported by the kernels below (3 to 21)
+#define SH_FOR_EACH_BAND( X ) X(3) X(4) X(5) X(6) X(7) X(8) X(9) X(10) X(11) X(12) X(13) X(14) X(15) X(16) X(17) X(18) X(19) X(20) X(21)
+
+/// Runtime band dispatch, bandN in [3, 21]
 void SHEval(unsigned int bandN, const float fX, const float fY, const float fZ, float *pSH);
+
+/// Compile-time band front end, no dispatch. Instantiated for every band of SH_FOR_EACH_BAND
+template<unsigned int N>
+void SHEval(const float fX, const float fY, const float fZ, float *pSH);
+
+/// Batched evaluation of count directions given as SoA arrays (pX, pY, pZ), for bands 3 to 21.
+/// Output is coefficient-major : pSH[c * stride + i] is the c-th basis value of direction i (stride >= count).
+/// simdf::Width directions are evaluated per pass (see simd.h). Avoid strides multiple of 4 KiB : all the rows
+/// then alias in L1, padding the stride by a couple of SIMD packets is enough. Writing N * N rows is memory bound
+/// at high bands : when only a projection is needed, SHEvalAccumulateBatch is faster still.
+void SHEvalBatch(unsigned int bandN, unsigned int count, const float *pX, const float *pY, const float *pZ, float *pSH, unsigned int stride);
+
+/// Fused evaluation and projection, without an intermediate basis vector : accum[c] += weight * Y_c(fX, fY, fZ)
+void SHEvalAccumulate(unsigned int bandN, const float fX, const float fY, const float fZ, const float weight, float *accum);
+
+/// Batched fused projection of count weighted SoA directions into accum (bands 3 to 21)
+void SHEvalAccumulateBatch(unsigned int bandN, unsigned int count, const float *pX, const float *pY, const float *pZ, const float *pW, float *accum);
+
 void SHEval3(const float fX, const float fY, const float fZ, float *pSH);
 void SHEval4(const float fX, const float fY, const float fZ, float *pSH);
 void SHEval5(const float fX, const float fY, const float fZ, float *pSH);
@@ -22,6 +44,7 @@ void SHEval17(const float fX, const float fY, const float fZ, float *pSH);
 void SHEval18(const float fX, const float fY, const float fZ, float *pSH);
 void SHEval19(const float fX, const float fY, const float fZ, float *pSH);
 void SHEval20(const float fX, const float fY, const float fZ, float *pSH);
+void SHEval21(const float fX, const float fY, const float fZ, float *pSH);
 
 void SHEval4D(const double fX, const double fY, const double fZ, double *pSH);
 void SHEval11D(const double fX, const double fY, const double fZ, double *pSH);
@@ -0,0 +1,5934 @@
+// Lane-generic SH evaluation kernels, from Peter Pike Sloan's Efficient SH Evaluation code.
+// T is either float (scalar path) or simdf (simdf::Width directions evaluated at once).
+// Each basis value c is handed to the output policy O as out( c, value ), so the same kernel
+// either stores the basis (SHStore) or projects it straight into an accumulator (SHAccumulate).
+// Included by the translation units that want the kernels inlined in their loops (SHEval.cpp, geometry.cpp).
+
+template<typename T>
+struct SHStore
+{
+	T *pSH;
+
+	FORCEINLINE void operator()( unsigned int c, const T &v ) const
+	{
+		pSH[c] = v;
+	}
+};
+
+template<typename T>
+struct SHAccumulate
+{
+	T *pAcc;
+	T fW;
+
+	FORCEINLINE void operator()( unsigned int c, const T &v ) const
+	{
+		pAcc[c] += v * fW;
+	}
+};
+
+template<unsigned int N>
+struct SHKernel;
+
+// order 3
+template<>
+struct SHKernel<3>
+{
+	template<typename T, typename O>
+	static FORCEINLINE void Eval( const T fX, const T fY, const T fZ, const O &out )
+	{
+		T fC0, fC1, fS0, fS1, fTmpA, fTmpB, fTmpC;
+		T fZ2 = fZ*fZ;
+
+		out( 0, 0.2820947917738781f );
+		out( 2, 0.4886025119029199f*fZ );
+		out( 6, 0.9461746957575601f*fZ2 + -0.3153915652525201f );
+		fC0 = fX;
+		fS0 = fY;
+
+		fTmpA = -0.48860251190292f;
+		out( 3, fTmpA*fC0 );
+		out( 1, fTmpA*fS0 );
+		fTmpB = -1.092548430592079f*fZ;
+		out( 7, fTmpB*fC0 );
+		out( 5, fTmpB*fS0 );
+		fC1 = fX*fC0 - fY*fS0;
+		fS1 = fX*fS0 + fY*fC0;
+
+		fTmpC = 0.5462742152960395f;
+		out( 8, fTmpC*fC1 );
+		out( 4, fTmpC*fS1 );
+	}
+};
+
+// order 4
+template<>
+struct SHKernel<4>
+{
+	template<typename T, typename O>
+	static FORCEINLINE void Eval( const T fX, const T fY, const T fZ, const O &out )
+	{
+		T fC0, fC1, fS0, fS1, fTmpA, fTmpB, fTmpC;
+		T fZ2 = fZ*fZ;
+
+		out( 0, 0.2820947917738781f );
+		out( 2, 0.4886025119029199f*fZ );
+		out( 6, 0.9461746957575601f*fZ2 + -0.3153915652525201f );
+		out( 12, fZ*( 1.865881662950577f*fZ2 + -1.119528997770346f ) );
+		fC0 = fX;
+		fS0 = fY;
+
+		fTmpA = -0.48860251190292f;
+		out( 3, fTmpA*fC0 );
+		out( 1, fTmpA*fS0 );
+		fTmpB = -1.092548430592079f*fZ;
+		out( 7, fTmpB*fC0 );
+		out( 5, fTmpB*fS0 );
+		fTmpC = -2.285228997322329f*fZ2 + 0.4570457994644658f;
+		out( 13, fTmpC*fC0 );
+		out( 11, fTmpC*fS0 );
+		fC1 = fX*fC0 - fY*fS0;
+		fS1 = fX*fS0 + fY*fC0;
+
+		fTmpA = 0.5462742152960395f;
+		out( 8, fTmpA*fC1 );
+		out( 4, fTmpA*fS1 );
+		fTmpB = 1.445305721320277f*fZ;
+		out( 14, fTmpB*fC1 );
+		out( 10, fTmpB*fS1 );
+		fC0 = fX*fC1 - fY*fS1;
+		fS0 = fX*fS1 + fY*fC1;
+
+		fTmpC = -0.5900435899266435f;
+		out( 15, fTmpC*fC0 );
+		out( 9, fTmpC*fS0 );
+	}
+};
+
+// order 5
+template<>
+struct SHKernel<5>
+{
+	template<typename T, typename O>
+	static FORCEINLINE void Eval( const T fX, const T fY, const T fZ, const O &out )
+	{
+		T fC0, fC1, fS0, fS1, fTmpA, fTmpB, fTmpC;
+		T fZ2 = fZ*fZ;
+
+		out( 0, 0.2820947917738781f );
+		out( 2, 0.4886025119029199f*fZ );
+		const T fP6 = 0.9461746957575601f*fZ2 + -0.3153915652525201f;
+		out( 6, fP6 );
+		const T fP12 = fZ*( 1.865881662950577f*fZ2 + -1.119528997770346f );
+		out( 12, fP12 );
+		out( 20, 1.984313483298443f*fZ*fP12 + -1.006230589874905f*fP6 );
+		fC0 = fX;
+		fS0 = fY;
+
+		fTmpA = -0.48860251190292f;
+		out( 3, fTmpA*fC0 );
+		out( 1, fTmpA*fS0 );
+		fTmpB = -1.092548430592079f*fZ;
+		out( 7, fTmpB*fC0 );
+		out( 5, fTmpB*fS0 );
+		fTmpC = -2.285228997322329f*fZ2 + 0.4570457994644658f;
+		out( 13, fTmpC*fC0 );
+		out( 11, fTmpC*fS0 );
+		fTmpA = fZ*( -4.683325804901025f*fZ2 + 2.007139630671868f );
+		out( 21, fTmpA*fC0 );
+		out( 19, fTmpA*fS0 );
+		fC1 = fX*fC0 - fY*fS0;
+		fS1 = fX*fS0 + fY*fC0;
+
+		fTmpA = 0.5462742152960395f;
+		out( 8, fTmpA*fC1 );
+		out( 4, fTmpA*fS1 );
+		fTmpB = 1.445305721320277f*fZ;
+		out( 14, fTmpB*fC1 );
+		out( 10, fTmpB*fS1 );
+		fTmpC = 3.31161143515146f*fZ2 + -0.47308734787878f;
+		out( 22, fTmpC*fC1 );
+		out( 18, fTmpC*fS1 );
+		fC0 = fX*fC1 - fY*fS1;
+		fS0 = fX*fS1 + fY*fC1;
+
+		fTmpA = -0.5900435899266435f;
+		out( 15, fTmpA*fC0 );
+		out( 9, fTmpA*fS0 );
+		fTmpB = -1.770130769779931f*fZ;
+		out( 23, fTmpB*fC0 );
+		out( 17, fTmpB*fS0 );
+		fC1 = fX*fC0 - fY*fS0;
+		fS1 = fX*fS0 + fY*fC0;
+
+		fTmpC = 0.6258357354491763f;
+		out( 24, fTmpC*fC1 );
+		out( 16, fTmpC*fS1 );
+	}
+};
+
+// order 6
+template<>
+struct SHKernel<6>
+{
+	template<typename T, typename O>
+	static FORCEINLINE void Eval( const T fX, const T fY, const T fZ, const O &out )
+	{
+		T fC0, fC1, fS0, fS1, fTmpA, fTmpB, fTmpC;
+		T fZ2 = fZ*fZ;
+
+		out( 0, 0.2820947917738781f );
+		out( 2, 0.4886025119029199f*fZ );
+		const T fP6 = 0.9461746957575601f*fZ2 + -0.3153915652525201f;
+		out( 6, fP6 );
+		const T fP12 = fZ*( 1.865881662950577f*fZ2 + -1.119528997770346f );
+		out( 12, fP12 );
+		const T fP20 = 1.984313483298443f*fZ*fP12 + -1.006230589874905f*fP6;
+		out( 20, fP20 );
+		out( 30, 1.98997487421324f*fZ*fP20 + -1.002853072844814f*fP12 );
+		fC0 = fX;
+		fS0 = fY;
+
+		fTmpA = -0.48860251190292f;
+		out( 3, fTmpA*fC0 );
+		out( 1, fTmpA*fS0 );
+		fTmpB = -1.092548430592079f*fZ;
+		out( 7, fTmpB*fC0 );
+		out( 5, fTmpB*fS0 );
+		fTmpC = -2.285228997322329f*fZ2 + 0.4570457994644658f;
+		out( 13, fTmpC*fC0 );
+		out( 11, fTmpC*fS0 );
+		fTmpA = fZ*( -4.683325804901025f*fZ2 + 2.007139630671868f );
+		out( 21, fTmpA*fC0 );
+		out( 19, fTmpA*fS0 );
+		fTmpB = 2.03100960115899f*fZ*fTmpA + -0.991031208965115f*fTmpC;
+		out( 31, fTmpB*fC0 );
+		out( 29, fTmpB*fS0 );
+		fC1 = fX*fC0 - fY*fS0;
+		fS1 = fX*fS0 + fY*fC0;
+
+		fTmpA = 0.5462742152960395f;
+		out( 8, fTmpA*fC1 );
+		out( 4, fTmpA*fS1 );
+		fTmpB = 1.445305721320277f*fZ;
+		out( 14, fTmpB*fC1 );
+		out( 10, fTmpB*fS1 );
+		fTmpC = 3.31161143515146f*fZ2 + -0.47308734787878f;
+		out( 22, fTmpC*fC1 );
+		out( 18, fTmpC*fS1 );
+		fTmpA = fZ*( 7.190305177459987f*fZ2 + -2.396768392486662f );
+		out( 32, fTmpA*fC1 );
+		out( 28, fTmpA*fS1 );
+		fC0 = fX*fC1 - fY*fS1;
+		fS0 = fX*fS1 + fY*fC1;
+
+		fTmpA = -0.5900435899266435f;
+		out( 15, fTmpA*fC0 );
+		out( 9, fTmpA*fS0 );
+		fTmpB = -1.770130769779931f*fZ;
+		out( 23, fTmpB*fC0 );
+		out( 17, fTmpB*fS0 );
+		fTmpC = -4.403144694917254f*fZ2 + 0.4892382994352505f;
+		out( 33, fTmpC*fC0 );
+		out( 27, fTmpC*fS0 );
+		fC1 = fX*fC0 - fY*fS0;
+		fS1 = fX*fS0 + fY*fC0;
+
+		fTmpA = 0.6258357354491763f;
+		out( 24, fTmpA*fC1 );
+		out( 16, fTmpA*fS1 );
+		fTmpB = 2.075662314881041f*fZ;
+		out( 34, fTmpB*fC1 );
+		out( 26, fTmpB*fS1 );
+		fC0 = fX*fC1 - fY*fS1;
+		fS0 = fX*fS1 + fY*fC1;
+
+		fTmpC = -0.6563820568401703f;
+		out( 35, fTmpC*fC0 );
+		out( 25, fTmpC*fS0 );
+	}
+};
+
+// order 7
+template<>
+struct SHKernel<7>
+{
+	template<typename T, typename O>
+	static FORCEINLINE void Eval( const T fX, const T fY, const T fZ, const O &out )
+	{
+		T fC0, fC1, fS0, fS1, fTmpA, fTmpB, fTmpC;
+		T fZ2 = fZ*fZ;
+
+		out( 0, 0.2820947917738781f );
+		out( 2, 0.4886025119029199f*fZ );
+		const T fP6 = 0.9461746957575601f*fZ2 + -0.3153915652525201f;
+		out( 6, fP6 );
+		const T fP12 = fZ*( 1.865881662950577f*fZ2 + -1.119528997770346f );
+		out( 12, fP12 );
+		const T fP20 = 1.984313483298443f*fZ*fP12 + -1.006230589874905f*fP6;
+		out( 20, fP20 );
+		const T fP30 = 1.98997487421324f*fZ*fP20 + -1.002853072844814f*fP12;
+		out( 30, fP30 );
+		out( 42, 1.993043457183567f*fZ*fP30 + -1.001542020962219f*fP20 );
+		fC0 = fX;
+		fS0 = fY;
+
+		fTmpA = -0.48860251190292f;
+		out( 3, fTmpA*fC0 );
+		out( 1, fTmpA*fS0 );
+		fTmpB = -1.092548430592079f*fZ;
+		out( 7, fTmpB*fC0 );
+		out( 5, fTmpB*fS0 );
+		fTmpC = -2.285228997322329f*fZ2 + 0.4570457994644658f;
+		out( 13, fTmpC*fC0 );
+		out( 11, fTmpC*fS0 );
+		fTmpA = fZ*( -4.683325804901025f*fZ2 + 2.007139630671868f );
+		out( 21, fTmpA*fC0 );
+		out( 19, fTmpA*fS0 );
+		fTmpB = 2.03100960115899f*fZ*fTmpA + -0.991031208965115f*fTmpC;
+		out( 31, fTmpB*fC0 );
+		out( 29, fTmpB*fS0 );
+		fTmpC = 2.021314989237028f*fZ*fTmpB + -0.9952267030562385f*fTmpA;
+		out( 43, fTmpC*fC0 );
+		out( 41, fTmpC*fS0 );
+		fC1 = fX*fC0 - fY*fS0;
+		fS1 = fX*fS0 + fY*fC0;
+
+		fTmpA = 0.5462742152960395f;
+		out( 8, fTmpA*fC1 );
+		out( 4, fTmpA*fS1 );
+		fTmpB = 1.445305721320277f*fZ;
+		out( 14, fTmpB*fC1 );
+		out( 10, fTmpB*fS1 );
+		fTmpC = 3.31161143515146f*fZ2 + -0.47308734787878f;
+		out( 22, fTmpC*fC1 );
+		out( 18, fTmpC*fS1 );
+		fTmpA = fZ*( 7.190305177459987f*fZ2 + -2.396768392486662f );
+		out( 32, fTmpA*fC1 );
+		out( 28, fTmpA*fS1 );
+		fTmpB = 2.11394181566097f*fZ*fTmpA + -0.9736101204623268f*fTmpC;
+		out( 44, fTmpB*fC1 );
+		out( 40, fTmpB*fS1 );
+		fC0 = fX*fC1 - fY*fS1;
+		fS0 = fX*fS1 + fY*fC1;
+
+		fTmpA = -0.5900435899266435f;
+		out( 15, fTmpA*fC0 );
+		out( 9, fTmpA*fS0 );
+		fTmpB = -1.770130769779931f*fZ;
+		out( 23, fTmpB*fC0 );
+		out( 17, fTmpB*fS0 );
+		fTmpC = -4.403144694917254f*fZ2 + 0.4892382994352505f;
+		out( 33, fTmpC*fC0 );
+		out( 27, fTmpC*fS0 );
+		fTmpA = fZ*( -10.13325785466416f*fZ2 + 2.763615778544771f );
+		out( 45, fTmpA*fC0 );
+		out( 39, fTmpA*fS0 );
+		fC1 = fX*fC0 - fY*fS0;
+		fS1 = fX*fS0 + fY*fC0;
+
+		fTmpA = 0.6258357354491763f;
+		out( 24, fTmpA*fC1 );
+		out( 16, fTmpA*fS1 );
+		fTmpB = 2.075662314881041f*fZ;
+		out( 34, fTmpB*fC1 );
+		out( 26, fTmpB*fS1 );
+		fTmpC = 5.550213908015966f*fZ2 + -0.5045649007287241f;
+		out( 46, fTmpC*fC1 );
+		out( 38, fTmpC*fS1 );
+		fC0 = fX*fC1 - fY*fS1;
+		fS0 = fX*fS1 + fY*fC1;
+
+		fTmpA = -0.6563820568401703f;
+		out( 35, fTmpA*fC0 );
+		out( 25, fTmpA*fS0 );
+		fTmpB = -2.366619162231753f*fZ;
+		out( 47, fTmpB*fC0 );
+		out( 37, fTmpB*fS0 );
+		fC1 = fX*fC0 - fY*fS0;
+		fS1 = fX*fS0 + fY*fC0;
+
+		fTmpC = 0.6831841051919144f;
+		out( 48, fTmpC*fC1 );
+		out( 36, fTmpC*fS1 );
+	}
+};
+
+// order 8
+template<>
+struct SHKernel<8>
+{
+	template<typename T, typename O>
+	static FORCEINLINE void Eval( const T fX, const T fY, const T fZ, const O &out )
+	{
+		T fC0, fC1, fS0, fS1, fTmpA, fTmpB, fTmpC;
+		T fZ2 = fZ*fZ;
+
+		out( 0, 0.2820947917738781f );
+		out( 2, 0.4886025119029199f*fZ );
+		const T fP6 = 0.9461746957575601f*fZ2 + -0.3153915652525201f;
+		out( 6, fP6 );
+		const T fP12 = fZ*( 1.865881662950577f*fZ2 + -1.119528997770346f );
+		out( 12, fP12 );
+		const T fP20 = 1.984313483298443f*fZ*fP12 + -1.006230589874905f*fP6;
+		out( 20, fP20 );
+		const T fP30 = 1.98997487421324f*fZ*fP20 + -1.002853072844814f*fP12;
+		out( 30, fP30 );
+		const T fP42 = 1.993043457183567f*fZ*fP30 + -1.001542020962219f*fP20;
+		out( 42, fP42 );
+		out( 56, 1.994891434824135f*fZ*fP42 + -1.000927213921958f*fP30 );
+		fC0 = fX;
+		fS0 = fY;
+
+		fTmpA = -0.48860251190292f;
+		out( 3, fTmpA*fC0 );
+		out( 1, fTmpA*fS0 );
+		fTmpB = -1.092548430592079f*fZ;
+		out( 7, fTmpB*fC0 );
+		out( 5, fTmpB*fS0 );
+		fTmpC = -2.285228997322329f*fZ2 + 0.4570457994644658f;
+		out( 13, fTmpC*fC0 );
+		out( 11, fTmpC*fS0 );
+		fTmpA = fZ*( -4.683325804901025f*fZ2 + 2.007139630671868f );
+		out( 21, fTmpA*fC0 );
+		out( 19, fTmpA*fS0 );
+		fTmpB = 2.03100960115899f*fZ*fTmpA + -0.991031208965115f*fTmpC;
+		out( 31, fTmpB*fC0 );
+		out( 29, fTmpB*fS0 );
+		fTmpC = 2.021314989237028f*fZ*fTmpB + -0.9952267030562385f*fTmpA;
+		out( 43, fTmpC*fC0 );
+		out( 41, fTmpC*fS0 );
+		fTmpA = 2.015564437074638f*fZ*fTmpC + -0.9971550440218319f*fTmpB;
+		out( 57, fTmpA*fC0 );
+		out( 55, fTmpA*fS0 );
+		fC1 = fX*fC0 - fY*fS0;
+		fS1 = fX*fS0 + fY*fC0;
+
+		fTmpA = 0.5462742152960395f;
+		out( 8, fTmpA*fC1 );
+		out( 4, fTmpA*fS1 );
+		fTmpB = 1.445305721320277f*fZ;
+		out( 14, fTmpB*fC1 );
+		out( 10, fTmpB*fS1 );
+		fTmpC = 3.31161143515146f*fZ2 + -0.47308734787878f;
+		out( 22, fTmpC*fC1 );
+		out( 18, fTmpC*fS1 );
+		fTmpA = fZ*( 7.190305177459987f*fZ2 + -2.396768392486662f );
+		out( 32, fTmpA*fC1 );
+		out( 28, fTmpA*fS1 );
+		fTmpB = 2.11394181566097f*fZ*fTmpA + -0.9736101204623268f*fTmpC;
+		out( 44, fTmpB*fC1 );
+		out( 40, fTmpB*fS1 );
+		fTmpC = 2.081665999466133f*fZ*fTmpB + -0.9847319278346618f*fTmpA;
+		out( 58, fTmpC*fC1 );
+		out( 54, fTmpC*fS1 );
+		fC0 = fX*fC1 - fY*fS1;
+		fS0 = fX*fS1 + fY*fC1;
+
+		fTmpA = -0.5900435899266435f;
+		out( 15, fTmpA*fC0 );
+		out( 9, fTmpA*fS0 );
+		fTmpB = -1.770130769779931f*fZ;
+		out( 23, fTmpB*fC0 );
+		out( 17, fTmpB*fS0 );
+		fTmpC = -4.403144694917254f*fZ2 + 0.4892382994352505f;
+		out( 33, fTmpC*fC0 );
+		out( 27, fTmpC*fS0 );
+		fTmpA = fZ*( -10.13325785466416f*fZ2 + 2.763615778544771f );
+		out( 45, fTmpA*fC0 );
+		out( 39, fTmpA*fS0 );
+		fTmpB = 2.207940216581962f*fZ*fTmpA + -0.959403223600247f*fTmpC;
+		out( 59, fTmpB*fC0 );
+		out( 53, fTmpB*fS0 );
+		fC1 = fX*fC0 - fY*fS0;
+		fS1 = fX*fS0 + fY*fC0;
+
+		fTmpA = 0.6258357354491763f;
+		out( 24, fTmpA*fC1 );
+		out( 16, fTmpA*fS1 );
+		fTmpB = 2.075662314881041f*fZ;
+		out( 34, fTmpB*fC1 );
+		out( 26, fTmpB*fS1 );
+		fTmpC = 5.550213908015966f*fZ2 + -0.5045649007287241f;
+		out( 46, fTmpC*fC1 );
+		out( 38, fTmpC*fS1 );
+		fTmpA = fZ*( 13.49180504672677f*fZ2 + -3.113493472321562f );
+		out( 60, fTmpA*fC1 );
+		out( 52, fTmpA*fS1 );
+		fC0 = fX*fC1 - fY*fS1;
+		fS0 = fX*fS1 + fY*fC1;
+
+		fTmpA = -0.6563820568401703f;
+		out( 35, fTmpA*fC0 );
+		out( 25, fTmpA*fS0 );
+		fTmpB = -2.366619162231753f*fZ;
+		out( 47, fTmpB*fC0 );
+		out( 37, fTmpB*fS0 );
+		fTmpC = -6.745902523363385f*fZ2 + 0.5189155787202604f;
+		out( 61, fTmpC*fC0 );
+		out( 51, fTmpC*fS0 );
+		fC1 = fX*fC0 - fY*fS0;
+		fS1 = fX*fS0 + fY*fC0;
+
+		fTmpA = 0.6831841051919144f;
+		out( 48, fTmpA*fC1 );
+		out( 36, fTmpA*fS1 );
+		fTmpB = 2.645960661801901f*fZ;
+		out( 62, fTmpB*fC1 );
+		out( 50, fTmpB*fS1 );
+		fC0 = fX*fC1 - fY*fS1;
+		fS0 = fX*fS1 + fY*fC1;
+
+		fTmpC = -0.7071627325245963f;
+		out( 63, fTmpC*fC0 );
+		out( 49, fTmpC*fS0 );
+	}
+};
+
+// order 9
+template<>
+struct SHKernel<9>
+{
+	template<typename T, typename O>
+	static FORCEINLINE void Eval( const T fX, const T fY, const T fZ, const O &out )
+	{
+		T fC0, fC1, fS0, fS1, fTmpA, fTmpB, fTmpC;
+		T fZ2 = fZ*fZ;
+
+		out( 0, 0.2820947917738781f );
+		out( 2, 0.4886025119029199f*fZ );
+		const T fP6 = 0.9461746957575601f*fZ2 + -0.3153915652525201f;
+		out( 6, fP6 );
+		const T fP12 = fZ*( 1.865881662950577f*fZ2 + -1.119528997770346f );
+		out( 12, fP12 );
+		const T fP20 = 1.984313483298443f*fZ*fP12 + -1.006230589874905f*fP6;
+		out( 20, fP20 );
+		const T fP30 = 1.98997487421324f*fZ*fP20 + -1.002853072844814f*fP12;
+		out( 30, fP30 );
+		const T fP42 = 1.993043457183567f*fZ*fP30 + -1.001542020962219f*fP20;
+		out( 42, fP42 );
+		const T fP56 = 1.994891434824135f*fZ*fP42 + -1.000927213921958f*fP30;
+		out( 56, fP56 );
+		out( 72, 1.996089927833914f*fZ*fP56 + -1.000600781069515f*fP42 );
+		fC0 = fX;
+		fS0 = fY;
+
+		fTmpA = -0.48860251190292f;
+		out( 3, fTmpA*fC0 );
+		out( 1, fTmpA*fS0 );
+		fTmpB = -1.092548430592079f*fZ;
+		out( 7, fTmpB*fC0 );
+		out( 5, fTmpB*fS0 );
+		fTmpC = -2.285228997322329f*fZ2 + 0.4570457994644658f;
+		out( 13, fTmpC*fC0 );
+		out( 11, fTmpC*fS0 );
+		fTmpA = fZ*( -4.683325804901025f*fZ2 + 2.007139630671868f );
+		out( 21, fTmpA*fC0 );
+		out( 19, fTmpA*fS0 );
+		fTmpB = 2.03100960115899f*fZ*fTmpA + -0.991031208965115f*fTmpC;
+		out( 31, fTmpB*fC0 );
+		out( 29, fTmpB*fS0 );
+		fTmpC = 2.021314989237028f*fZ*fTmpB + -0.9952267030562385f*fTmpA;
+		out( 43, fTmpC*fC0 );
+		out( 41, fTmpC*fS0 );
+		fTmpA = 2.015564437074638f*fZ*fTmpC + -0.9971550440218319f*fTmpB;
+		out( 57, fTmpA*fC0 );
+		out( 55, fTmpA*fS0 );
+		fTmpB = 2.011869540407391f*fZ*fTmpA + -0.9981668178901745f*fTmpC;
+		out( 73, fTmpB*fC0 );
+		out( 71, fTmpB*fS0 );
+		fC1 = fX*fC0 - fY*fS0;
+		fS1 = fX*fS0 + fY*fC0;
+
+		fTmpA = 0.5462742152960395f;
+		out( 8, fTmpA*fC1 );
+		out( 4, fTmpA*fS1 );
+		fTmpB = 1.445305721320277f*fZ;
+		out( 14, fTmpB*fC1 );
+		out( 10, fTmpB*fS1 );
+		fTmpC = 3.31161143515146f*fZ2 + -0.47308734787878f;
+		out( 22, fTmpC*fC1 );
+		out( 18, fTmpC*fS1 );
+		fTmpA = fZ*( 7.190305177459987f*fZ2 + -2.396768392486662f );
+		out( 32, fTmpA*fC1 );
+		out( 28, fTmpA*fS1 );
+		fTmpB = 2.11394181566097f*fZ*fTmpA + -0.9736101204623268f*fTmpC;
+		out( 44, fTmpB*fC1 );
+		out( 40, fTmpB*fS1 );
+		fTmpC = 2.081665999466133f*fZ*fTmpB + -0.9847319278346618f*fTmpA;
+		out( 58, fTmpC*fC1 );
+		out( 54, fTmpC*fS1 );
+		fTmpA = 2.06155281280883f*fZ*fTmpC + -0.9903379376602873f*fTmpB;
+		out( 74, fTmpA*fC1 );
+		out( 70, fTmpA*fS1 );
+		fC0 = fX*fC1 - fY*fS1;
+		fS0 = fX*fS1 + fY*fC1;
+
+		fTmpA = -0.5900435899266435f;
+		out( 15, fTmpA*fC0 );
+		out( 9, fTmpA*fS0 );
+		fTmpB = -1.770130769779931f*fZ;
+		out( 23, fTmpB*fC0 );
+		out( 17, fTmpB*fS0 );
+		fTmpC = -4.403144694917254f*fZ2 + 0.4892382994352505f;
+		out( 33, fTmpC*fC0 );
+		out( 27, fTmpC*fS0 );
+		fTmpA = fZ*( -10.13325785466416f*fZ2 + 2.763615778544771f );
+		out( 45, fTmpA*fC0 );
+		out( 39, fTmpA*fS0 );
+		fTmpB = 2.207940216581962f*fZ*fTmpA + -0.959403223600247f*fTmpC;
+		out( 59, fTmpB*fC0 );
+		out( 53, fTmpB*fS0 );
+		fTmpC = 2.15322168769582f*fZ*fTmpB + -0.9752173865600178f*fTmpA;
+		out( 75, fTmpC*fC0 );
+		out( 69, fTmpC*fS0 );
+		fC1 = fX*fC0 - fY*fS0;
+		fS1 = fX*fS0 + fY*fC0;
+
+		fTmpA = 0.6258357354491763f;
+		out( 24, fTmpA*fC1 );
+		out( 16, fTmpA*fS1 );
+		fTmpB = 2.075662314881041f*fZ;
+		out( 34, fTmpB*fC1 );
+		out( 26, fTmpB*fS1 );
+		fTmpC = 5.550213908015966f*fZ2 + -0.5045649007287241f;
+		out( 46, fTmpC*fC1 );
+		out( 38, fTmpC*fS1 );
+		fTmpA = fZ*( 13.49180504672677f*fZ2 + -3.113493472321562f );
+		out( 60, fTmpA*fC1 );
+		out( 52, fTmpA*fS1 );
+		fTmpB = 2.304886114323221f*fZ*fTmpA + -0.9481763873554654f*fTmpC;
+		out( 76, fTmpB*fC1 );
+		out( 68, fTmpB*fS1 );
+		fC0 = fX*fC1 - fY*fS1;
+		fS0 = fX*fS1 + fY*fC1;
+
+		fTmpA = -0.6563820568401703f;
+		out( 35, fTmpA*fC0 );
+		out( 25, fTmpA*fS0 );
+		fTmpB = -2.366619162231753f*fZ;
+		out( 47, fTmpB*fC0 );
+		out( 37, fTmpB*fS0 );
+		fTmpC = -6.745902523363385f*fZ2 + 0.5189155787202604f;
+		out( 61, fTmpC*fC0 );
+		out( 51, fTmpC*fS0 );
+		fTmpA = fZ*( -17.24955311049054f*fZ2 + 3.449910622098108f );
+		out( 77, fTmpA*fC0 );
+		out( 67, fTmpA*fS0 );
+		fC1 = fX*fC0 - fY*fS0;
+		fS1 = fX*fS0 + fY*fC0;
+
+		fTmpA = 0.6831841051919144f;
+		out( 48, fTmpA*fC1 );
+		out( 36, fTmpA*fS1 );
+		fTmpB = 2.645960661801901f*fZ;
+		out( 62, fTmpB*fC1 );
+		out( 50, fTmpB*fS1 );
+		fTmpC = 7.984991490893139f*fZ2 + -0.5323327660595426f;
+		out( 78, fTmpC*fC1 );
+		out( 66, fTmpC*fS1 );
+		fC0 = fX*fC1 - fY*fS1;
+		fS0 = fX*fS1 + fY*fC1;
+
+		fTmpA = -0.7071627325245963f;
+		out( 63, fTmpA*fC0 );
+		out( 49, fTmpA*fS0 );
+		fTmpB = -2.91570664069932f*fZ;
+		out( 79, fTmpB*fC0 );
+		out( 65, fTmpB*fS0 );
+		fC1 = fX*fC0 - fY*fS0;
+		fS1 = fX*fS0 + fY*fC0;
+
+		fTmpC = 0.72892666017483f;
+		out( 80, fTmpC*fC1 );
+		out( 64, fTmpC*fS1 );
+	}
+};
+
+// order 10
+template<>
+struct SHKernel<10>
+{
+	template<typename T, typename O>
+	static FORCEINLINE void Eval( const T fX, const T fY, const T fZ, const O &out )
+	{
+		T fC0, fC1, fS0, fS1, fTmpA, fTmpB, fTmpC;
+		T fZ2 = fZ*fZ;
+
+		out( 0, 0.2820947917738781f );
+		out( 2, 0.4886025119029199f*fZ );
+		const T fP6 = 0.9461746957575601f*fZ2 + -0.3153915652525201f;
+		out( 6, fP6 );
+		const T fP12 = fZ*( 1.865881662950577f*fZ2 + -1.119528997770346f );
+		out( 12, fP12 );
+		const T fP20 = 1.984313483298443f*fZ*fP12 + -1.006230589874905f*fP6;
+		out( 20, fP20 );
+		const T fP30 = 1.98997487421324f*fZ*fP20 + -1.002853072844814f*fP12;
+		out( 30, fP30 );
+		const T fP42 = 1.993043457183567f*fZ*fP30 + -1.001542020962219f*fP20;
+		out( 42, fP42 );
+		const T fP56 = 1.994891434824135f*fZ*fP42 + -1.000927213921958f*fP30;
+		out( 56, fP56 );
+		const T fP72 = 1.996089927833914f*fZ*fP56 + -1.000600781069515f*fP42;
+		out( 72, fP72 );
+		out( 90, 1.996911195067937f*fZ*fP72 + -1.000411437993134f*fP56 );
+		fC0 = fX;
+		fS0 = fY;
+
+		fTmpA = -0.48860251190292f;
+		out( 3, fTmpA*fC0 );
+		out( 1, fTmpA*fS0 );
+		fTmpB = -1.092548430592079f*fZ;
+		out( 7, fTmpB*fC0 );
+		out( 5, fTmpB*fS0 );
+		fTmpC = -2.285228997322329f*fZ2 + 0.4570457994644658f;
+		out( 13, fTmpC*fC0 );
+		out( 11, fTmpC*fS0 );
+		fTmpA = fZ*( -4.683325804901025f*fZ2 + 2.007139630671868f );
+		out( 21, fTmpA*fC0 );
+		out( 19, fTmpA*fS0 );
+		fTmpB = 2.03100960115899f*fZ*fTmpA + -0.991031208965115f*fTmpC;
+		out( 31, fTmpB*fC0 );
+		out( 29, fTmpB*fS0 );
+		fTmpC = 2.021314989237028f*fZ*fTmpB + -0.9952267030562385f*fTmpA;
+		out( 43, fTmpC*fC0 );
+		out( 41, fTmpC*fS0 );
+		fTmpA = 2.015564437074638f*fZ*fTmpC + -0.9971550440218319f*fTmpB;
+		out( 57, fTmpA*fC0 );
+		out( 55, fTmpA*fS0 );
+		fTmpB = 2.011869540407391f*fZ*fTmpA + -0.9981668178901745f*fTmpC;
+		out( 73, fTmpB*fC0 );
+		out( 71, fTmpB*fS0 );
+		fTmpC = 2.009353129741012f*fZ*fTmpB + -0.9987492177719088f*fTmpA;
+		out( 91, fTmpC*fC0 );
+		out( 89, fTmpC*fS0 );
+		fC1 = fX*fC0 - fY*fS0;
+		fS1 = fX*fS0 + fY*fC0;
+
+		fTmpA = 0.5462742152960395f;
+		out( 8, fTmpA*fC1 );
+		out( 4, fTmpA*fS1 );
+		fTmpB = 1.445305721320277f*fZ;
+		out( 14, fTmpB*fC1 );
+		out( 10, fTmpB*fS1 );
+		fTmpC = 3.31161143515146f*fZ2 + -0.47308734787878f;
+		out( 22, fTmpC*fC1 );
+		out( 18, fTmpC*fS1 );
+		fTmpA = fZ*( 7.190305177459987f*fZ2 + -2.396768392486662f );
+		out( 32, fTmpA*fC1 );
+		out( 28, fTmpA*fS1 );
+		fTmpB = 2.11394181566097f*fZ*fTmpA + -0.9736101204623268f*fTmpC;
+		out( 44, fTmpB*fC1 );
+		out( 40, fTmpB*fS1 );
+		fTmpC = 2.081665999466133f*fZ*fTmpB + -0.9847319278346618f*fTmpA;
+		out( 58, fTmpC*fC1 );
+		out( 54, fTmpC*fS1 );
+		fTmpA = 2.06155281280883f*fZ*fTmpC + -0.9903379376602873f*fTmpB;
+		out( 74, fTmpA*fC1 );
+		out( 70, fTmpA*fS1 );
+		fTmpB = 2.048122358357819f*fZ*fTmpA + -0.9934852726704042f*fTmpC;
+		out( 92, fTmpB*fC1 );
+		out( 88, fTmpB*fS1 );
+		fC0 = fX*fC1 - fY*fS1;
+		fS0 = fX*fS1 + fY*fC1;
+
+		fTmpA = -0.5900435899266435f;
+		out( 15, fTmpA*fC0 );
+		out( 9, fTmpA*fS0 );
+		fTmpB = -1.770130769779931f*fZ;
+		out( 23, fTmpB*fC0 );
+		out( 17, fTmpB*fS0 );
+		fTmpC = -4.403144694917254f*fZ2 + 0.4892382994352505f;
+		out( 33, fTmpC*fC0 );
+		out( 27, fTmpC*fS0 );
+		fTmpA = fZ*( -10.13325785466416f*fZ2 + 2.763615778544771f );
+		out( 45, fTmpA*fC0 );
+		out( 39, fTmpA*fS0 );
+		fTmpB = 2.207940216581962f*fZ*fTmpA + -0.959403223600247f*fTmpC;
+		out( 59, fTmpB*fC0 );
+		out( 53, fTmpB*fS0 );
+		fTmpC = 2.15322168769582f*fZ*fTmpB + -0.9752173865600178f*fTmpA;
+		out( 75, fTmpC*fC0 );
+		out( 69, fTmpC*fS0 );
+		fTmpA = 2.118044171189805f*fZ*fTmpC + -0.9836628449792094f*fTmpB;
+		out( 93, fTmpA*fC0 );
+		out( 87, fTmpA*fS0 );
+		fC1 = fX*fC0 - fY*fS0;
+		fS1 = fX*fS0 + fY*fC0;
+
+		fTmpA = 0.6258357354491763f;
+		out( 24, fTmpA*fC1 );
+		out( 16, fTmpA*fS1 );
+		fTmpB = 2.075662314881041f*fZ;
+		out( 34, fTmpB*fC1 );
+		out( 26, fTmpB*fS1 );
+		fTmpC = 5.550213908015966f*fZ2 + -0.5045649007287241f;
+		out( 46, fTmpC*fC1 );
+		out( 38, fTmpC*fS1 );
+		fTmpA = fZ*( 13.49180504672677f*fZ2 + -3.113493472321562f );
+		out( 60, fTmpA*fC1 );
+		out( 52, fTmpA*fS1 );
+		fTmpB = 2.304886114323221f*fZ*fTmpA + -0.9481763873554654f*fTmpC;
+		out( 76, fTmpB*fC1 );
+		out( 68, fTmpB*fS1 );
+		fTmpC = 2.229177150706235f*fZ*fTmpB + -0.9671528397231821f*fTmpA;
+		out( 94, fTmpC*fC1 );
+		out( 86, fTmpC*fS1 );
+		fC0 = fX*fC1 - fY*fS1;
+		fS0 = fX*fS1 + fY*fC1;
+
+		fTmpA = -0.6563820568401703f;
+		out( 35, fTmpA*fC0 );
+		out( 25, fTmpA*fS0 );
+		fTmpB = -2.366619162231753f*fZ;
+		out( 47, fTmpB*fC0 );
+		out( 37, fTmpB*fS0 );
+		fTmpC = -6.745902523363385f*fZ2 + 0.5189155787202604f;
+		out( 61, fTmpC*fC0 );
+		out( 51, fTmpC*fS0 );
+		fTmpA = fZ*( -17.24955311049054f*fZ2 + 3.449910622098108f );
+		out( 77, fTmpA*fC0 );
+		out( 67, fTmpA*fS0 );
+		fTmpB = 2.401636346922062f*fZ*fTmpA + -0.9392246042043708f*fTmpC;
+		out( 95, fTmpB*fC0 );
+		out( 85, fTmpB*fS0 );
+		fC1 = fX*fC0 - fY*fS0;
+		fS1 = fX*fS0 + fY*fC0;
+
+		fTmpA = 0.6831841051919144f;
+		out( 48, fTmpA*fC1 );
+		out( 36, fTmpA*fS1 );
+		fTmpB = 2.645960661801901f*fZ;
+		out( 62, fTmpB*fC1 );
+		out( 50, fTmpB*fS1 );
+		fTmpC = 7.984991490893139f*fZ2 + -0.5323327660595426f;
+		out( 78, fTmpC*fC1 );
+		out( 66, fTmpC*fS1 );
+		fTmpA = fZ*( 21.39289019090864f*fZ2 + -3.775215916042701f );
+		out( 96, fTmpA*fC1 );
+		out( 84, fTmpA*fS1 );
+		fC0 = fX*fC1 - fY*fS1;
+		fS0 = fX*fS1 + fY*fC1;
+
+		fTmpA = -0.7071627325245963f;
+		out( 63, fTmpA*fC0 );
+		out( 49, fTmpA*fS0 );
+		fTmpB = -2.91570664069932f*fZ;
+		out( 79, fTmpB*fC0 );
+		out( 65, fTmpB*fS0 );
+		fTmpC = -9.263393182848905f*fZ2 + 0.5449054813440533f;
+		out( 97, fTmpC*fC0 );
+		out( 83, fTmpC*fS0 );
+		fC1 = fX*fC0 - fY*fS0;
+		fS1 = fX*fS0 + fY*fC0;
+
+		fTmpA = 0.72892666017483f;
+		out( 80, fTmpA*fC1 );
+		out( 64, fTmpA*fS1 );
+		fTmpB = 3.177317648954698f*fZ;
+		out( 98, fTmpB*fC1 );
+		out( 82, fTmpB*fS1 );
+		fC0 = fX*fC1 - fY*fS1;
+		fS0 = fX*fS1 + fY*fC1;
+
+		fTmpC = -0.7489009518531884f;
+		out( 99, fTmpC*fC0 );
+		out( 81, fTmpC*fS0 );
+	}
+};
+
+// order 11
+template<>
+struct SHKernel<11>
+{
+	template<typename T, typename O>
+	static FORCEINLINE void Eval( const T fX, const T fY, const T fZ, const O &out )
+	{
+		T fC0, fC1, fS0, fS1, fTmpA, fTmpB, fTmpC;
+		T fZ2 = fZ*fZ;
+
+		out( 0, 0.2820947917738781f );
+		out( 2, 0.4886025119029199f*fZ );
+		const T fP6 = 0.9461746957575601f*fZ2 + -0.3153915652525201f;
+		out( 6, fP6 );
+		const T fP12 = fZ*( 1.865881662950577f*fZ2 + -1.119528997770346f );
+		out( 12, fP12 );
+		const T fP20 = 1.984313483298443f*fZ*fP12 + -1.006230589874905f*fP6;
+		out( 20, fP20 );
+		const T fP30 = 1.98997487421324f*fZ*fP20 + -1.002853072844814f*fP12;
+		out( 30, fP30 );
+		const T fP42 = 1.993043457183567f*fZ*fP30 + -1.001542020962219f*fP20;
+		out( 42, fP42 );
+		const T fP56 = 1.994891434824135f*fZ*fP42 + -1.000927213921958f*fP30;
+		out( 56, fP56 );
+		const T fP72 = 1.996089927833914f*fZ*fP56 + -1.000600781069515f*fP42;
+		out( 72, fP72 );
+		const T fP90 = 1.996911195067937f*fZ*fP72 + -1.000411437993134f*fP56;
+		out( 90, fP90 );
+		out( 110, 1.997498435543818f*fZ*fP90 + -1.00029407440718f*fP72 );
+		fC0 = fX;
+		fS0 = fY;
+
+		fTmpA = -0.48860251190292f;
+		out( 3, fTmpA*fC0 );
+		out( 1, fTmpA*fS0 );
+		fTmpB = -1.092548430592079f*fZ;
+		out( 7, fTmpB*fC0 );
+		out( 5, fTmpB*fS0 );
+		fTmpC = -2.285228997322329f*fZ2 + 0.4570457994644658f;
+		out( 13, fTmpC*fC0 );
+		out( 11, fTmpC*fS0 );
+		fTmpA = fZ*( -4.683325804901025f*fZ2 + 2.007139630671868f );
+		out( 21, fTmpA*fC0 );
+		out( 19, fTmpA*fS0 );
+		fTmpB = 2.03100960115899f*fZ*fTmpA + -0.991031208965115f*fTmpC;
+		out( 31, fTmpB*fC0 );
+		out( 29, fTmpB*fS0 );
+		fTmpC = 2.021314989237028f*fZ*fTmpB + -0.9952267030562385f*fTmpA;
+		out( 43, fTmpC*fC0 );
+		out( 41, fTmpC*fS0 );
+		fTmpA = 2.015564437074638f*fZ*fTmpC + -0.9971550440218319f*fTmpB;
+		out( 57, fTmpA*fC0 );
+		out( 55, fTmpA*fS0 );
+		fTmpB = 2.011869540407391f*fZ*fTmpA + -0.9981668178901745f*fTmpC;
+		out( 73, fTmpB*fC0 );
+		out( 71, fTmpB*fS0 );
+		fTmpC = 2.009353129741012f*fZ*fTmpB + -0.9987492177719088f*fTmpA;
+		out( 91, fTmpC*fC0 );
+		out( 89, fTmpC*fS0 );
+		fTmpA = 2.007561463642653f*fZ*fTmpC + -0.9991083368712843f*fTmpB;
+		out( 111, fTmpA*fC0 );
+		out( 109, fTmpA*fS0 );
+		fC1 = fX*fC0 - fY*fS0;
+		fS1 = fX*fS0 + fY*fC0;
+
+		fTmpA = 0.5462742152960395f;
+		out( 8, fTmpA*fC1 );
+		out( 4, fTmpA*fS1 );
+		fTmpB = 1.445305721320277f*fZ;
+		out( 14, fTmpB*fC1 );
+		out( 10, fTmpB*fS1 );
+		fTmpC = 3.31161143515146f*fZ2 + -0.47308734787878f;
+		out( 22, fTmpC*fC1 );
+		out( 18, fTmpC*fS1 );
+		fTmpA = fZ*( 7.190305177459987f*fZ2 + -2.396768392486662f );
+		out( 32, fTmpA*fC1 );
+		out( 28, fTmpA*fS1 );
+		fTmpB = 2.11394181566097f*fZ*fTmpA + -0.9736101204623268f*fTmpC;
+		out( 44, fTmpB*fC1 );
+		out( 40, fTmpB*fS1 );
+		fTmpC = 2.081665999466133f*fZ*fTmpB + -0.9847319278346618f*fTmpA;
+		out( 58, fTmpC*fC1 );
+		out( 54, fTmpC*fS1 );
+		fTmpA = 2.06155281280883f*fZ*fTmpC + -0.9903379376602873f*fTmpB;
+		out( 74, fTmpA*fC1 );
+		out( 70, fTmpA*fS1 );
+		fTmpB = 2.048122358357819f*fZ*fTmpA + -0.9934852726704042f*fTmpC;
+		out( 92, fTmpB*fC1 );
+		out( 88, fTmpB*fS1 );
+		fTmpC = 2.038688303787511f*fZ*fTmpB + -0.9953938032404119f*fTmpA;
+		out( 112, fTmpC*fC1 );
+		out( 108, fTmpC*fS1 );
+		fC0 = fX*fC1 - fY*fS1;
+		fS0 = fX*fS1 + fY*fC1;
+
+		fTmpA = -0.5900435899266435f;
+		out( 15, fTmpA*fC0 );
+		out( 9, fTmpA*fS0 );
+		fTmpB = -1.770130769779931f*fZ;
+		out( 23, fTmpB*fC0 );
+		out( 17, fTmpB*fS0 );
+		fTmpC = -4.403144694917254f*fZ2 + 0.4892382994352505f;
+		out( 33, fTmpC*fC0 );
+		out( 27, fTmpC*fS0 );
+		fTmpA = fZ*( -10.13325785466416f*fZ2 + 2.763615778544771f );
+		out( 45, fTmpA*fC0 );
+		out( 39, fTmpA*fS0 );
+		fTmpB = 2.207940216581962f*fZ*fTmpA + -0.959403223600247f*fTmpC;
+		out( 59, fTmpB*fC0 );
+		out( 53, fTmpB*fS0 );
+		fTmpC = 2.15322168769582f*fZ*fTmpB + -0.9752173865600178f*fTmpA;
+		out( 75, fTmpC*fC0 );
+		out( 69, fTmpC*fS0 );
+		fTmpA = 2.118044171189805f*fZ*fTmpC + -0.9836628449792094f*fTmpB;
+		out( 93, fTmpA*fC0 );
+		out( 87, fTmpA*fS0 );
+		fTmpB = 2.093947321356338f*fZ*fTmpA + -0.9886230654859614f*fTmpC;
+		out( 113, fTmpB*fC0 );
+		out( 107, fTmpB*fS0 );
+		fC1 = fX*fC0 - fY*fS0;
+		fS1 = fX*fS0 + fY*fC0;
+
+		fTmpA = 0.6258357354491763f;
+		out( 24, fTmpA*fC1 );
+		out( 16, fTmpA*fS1 );
+		fTmpB = 2.075662314881041f*fZ;
+		out( 34, fTmpB*fC1 );
+		out( 26, fTmpB*fS1 );
+		fTmpC = 5.550213908015966f*fZ2 + -0.5045649007287241f;
+		out( 46, fTmpC*fC1 );
+		out( 38, fTmpC*fS1 );
+		fTmpA = fZ*( 13.49180504672677f*fZ2 + -3.113493472321562f );
+		out( 60, fTmpA*fC1 );
+		out( 52, fTmpA*fS1 );
+		fTmpB = 2.304886114323221f*fZ*fTmpA + -0.9481763873554654f*fTmpC;
+		out( 76, fTmpB*fC1 );
+		out( 68, fTmpB*fS1 );
+		fTmpC = 2.229177150706235f*fZ*fTmpB + -0.9671528397231821f*fTmpA;
+		out( 94, fTmpC*fC1 );
+		out( 86, fTmpC*fS1 );
+		fTmpA = 2.179449471770337f*fZ*fTmpC + -0.9776923610938036f*fTmpB;
+		out( 114, fTmpA*fC1 );
+		out( 106, fTmpA*fS1 );
+		fC0 = fX*fC1 - fY*fS1;
+		fS0 = fX*fS1 + fY*fC1;
+
+		fTmpA = -0.6563820568401703f;
+		out( 35, fTmpA*fC0 );
+		out( 25, fTmpA*fS0 );
+		fTmpB = -2.366619162231753f*fZ;
+		out( 47, fTmpB*fC0 );
+		out( 37, fTmpB*fS0 );
+		fTmpC = -6.745902523363385f*fZ2 + 0.5189155787202604f;
+		out( 61, fTmpC*fC0 );
+		out( 51, fTmpC*fS0 );
+		fTmpA = fZ*( -17.24955311049054f*fZ2 + 3.449910622098108f );
+		out( 77, fTmpA*fC0 );
+		out( 67, fTmpA*fS0 );
+		fTmpB = 2.401636346922062f*fZ*fTmpA + -0.9392246042043708f*fTmpC;
+		out( 95, fTmpB*fC0 );
+		out( 85, fTmpB*fS0 );
+		fTmpC = 2.306512518934159f*fZ*fTmpB + -0.9603920767980496f*fTmpA;
+		out( 115, fTmpC*fC0 );
+		out( 105, fTmpC*fS0 );
+		fC1 = fX*fC0 - fY*fS0;
+		fS1 = fX*fS0 + fY*fC0;
+
+		fTmpA = 0.6831841051919144f;
+		out( 48, fTmpA*fC1 );
+		out( 36, fTmpA*fS1 );
+		fTmpB = 2.645960661801901f*fZ;
+		out( 62, fTmpB*fC1 );
+		out( 50, fTmpB*fS1 );
+		fTmpC = 7.984991490893139f*fZ2 + -0.5323327660595426f;
+		out( 78, fTmpC*fC1 );
+		out( 66, fTmpC*fS1 );
+		fTmpA = fZ*( 21.39289019090864f*fZ2 + -3.775215916042701f );
+		out( 96, fTmpA*fC1 );
+		out( 84, fTmpA*fS1 );
+		fTmpB = 2.496873044429773f*fZ*fTmpA + -0.9319689782769534f*fTmpC;
+		out( 116, fTmpB*fC1 );
+		out( 104, fTmpB*fS1 );
+		fC0 = fX*fC1 - fY*fS1;
+		fS0 = fX*fS1 + fY*fC1;
+
+		fTmpA = -0.7071627325245963f;
+		out( 63, fTmpA*fC0 );
+		out( 49, fTmpA*fS0 );
+		fTmpB = -2.91570664069932f*fZ;
+		out( 79, fTmpB*fC0 );
+		out( 65, fTmpB*fS0 );
+		fTmpC = -9.263393182848905f*fZ2 + 0.5449054813440533f;
+		out( 97, fTmpC*fC0 );
+		out( 83, fTmpC*fS0 );
+		fTmpA = fZ*( -25.9102413133663f*fZ2 + 4.091090733689416f );
+		out( 117, fTmpA*fC0 );
+		out( 103, fTmpA*fS0 );
+		fC1 = fX*fC0 - fY*fS0;
+		fS1 = fX*fS0 + fY*fC0;
+
+		fTmpA = 0.72892666017483f;
+		out( 80, fTmpA*fC1 );
+		out( 64, fTmpA*fS1 );
+		fTmpB = 3.177317648954698f*fZ;
+		out( 98, fTmpB*fC1 );
+		out( 82, fTmpB*fS1 );
+		fTmpC = 10.57781172168795f*fZ2 + -0.5567269327204184f;
+		out( 118, fTmpC*fC1 );
+		out( 102, fTmpC*fS1 );
+		fC0 = fX*fC1 - fY*fS1;
+		fS0 = fX*fS1 + fY*fC1;
+
+		fTmpA = -0.7489009518531884f;
+		out( 99, fTmpA*fC0 );
+		out( 81, fTmpA*fS0 );
+		fTmpB = -3.431895299891715f*fZ;
+		out( 119, fTmpB*fC0 );
+		out( 101, fTmpB*fS0 );
+		fC1 = fX*fC0 - fY*fS0;
+		fS1 = fX*fS0 + fY*fC0;
+
+		fTmpC = 0.7673951182219901f;
+		out( 120, fTmpC*fC1 );
+		out( 100, fTmpC*fS1 );
+	}
+};
+
+// order 12
+template<>
+struct SHKernel<12>
+{
+	template<typename T, typename O>
+	static FORCEINLINE void Eval( const T fX, const T fY, const T fZ, const O &out )
+	{
+		T fC0, fC1, fS0, fS1, fTmpA, fTmpB, fTmpC;
+		T fZ2 = fZ*fZ;
+
+		out( 0, 0.2820947917738781f );
+		out( 2, 0.4886025119029199f*fZ );
+		const T fP6 = 0.9461746957575601f*fZ2 + -0.3153915652525201f;
+		out( 6, fP6 );
+		const T fP12 = fZ*( 1.865881662950577f*fZ2 + -1.119528997770346f );
+		out( 12, fP12 );
+		const T fP20 = 1.984313483298443f*fZ*fP12 + -1.006230589874905f*fP6;
+		out( 20, fP20 );
+		const T fP30 = 1.98997487421324f*fZ*fP20 + -1.002853072844814f*fP12;
+		out( 30, fP30 );
+		const T fP42 = 1.993043457183567f*fZ*fP30 + -1.001542020962219f*fP20;
+		out( 42, fP42 );
+		const T fP56 = 1.994891434824135f*fZ*fP42 + -1.000927213921958f*fP30;
+		out( 56, fP56 );
+		const T fP72 = 1.996089927833914f*fZ*fP56 + -1.000600781069515f*fP42;
+		out( 72, fP72 );
+		const T fP90 = 1.996911195067937f*fZ*fP72 + -1.000411437993134f*fP56;
+		out( 90, fP90 );
+		const T fP110 = 1.997498435543818f*fZ*fP90 + -1.00029407440718f*fP72;
+		out( 110, fP110 );
+		out( 132, 1.997932815985082f*fZ*fP110 + -1.000217462218511f*fP90 );
+		fC0 = fX;
+		fS0 = fY;
+
+		fTmpA = -0.48860251190292f;
+		out( 3, fTmpA*fC0 );
+		out( 1, fTmpA*fS0 );
+		fTmpB = -1.092548430592079f*fZ;
+		out( 7, fTmpB*fC0 );
+		out( 5, fTmpB*fS0 );
+		fTmpC = -2.285228997322329f*fZ2 + 0.4570457994644658f;
+		out( 13, fTmpC*fC0 );
+		out( 11, fTmpC*fS0 );
+		fTmpA = fZ*( -4.683325804901025f*fZ2 + 2.007139630671868f );
+		out( 21, fTmpA*fC0 );
+		out( 19, fTmpA*fS0 );
+		fTmpB = 2.03100960115899f*fZ*fTmpA + -0.991031208965115f*fTmpC;
+		out( 31, fTmpB*fC0 );
+		out( 29, fTmpB*fS0 );
+		fTmpC = 2.021314989237028f*fZ*fTmpB + -0.9952267030562385f*fTmpA;
+		out( 43, fTmpC*fC0 );
+		out( 41, fTmpC*fS0 );
+		fTmpA = 2.015564437074638f*fZ*fTmpC + -0.9971550440218319f*fTmpB;
+		out( 57, fTmpA*fC0 );
+		out( 55, fTmpA*fS0 );
+		fTmpB = 2.011869540407391f*fZ*fTmpA + -0.9981668178901745f*fTmpC;
+		out( 73, fTmpB*fC0 );
+		out( 71, fTmpB*fS0 );
+		fTmpC = 2.009353129741012f*fZ*fTmpB + -0.9987492177719088f*fTmpA;
+		out( 91, fTmpC*fC0 );
+		out( 89, fTmpC*fS0 );
+		fTmpA = 2.007561463642653f*fZ*fTmpC + -0.9991083368712843f*fTmpB;
+		out( 111, fTmpA*fC0 );
+		out( 109, fTmpA*fS0 );
+		fTmpB = 2.006240264773888f*fZ*fTmpA + -0.9993418887079215f*fTmpC;
+		out( 133, fTmpB*fC0 );
+		out( 131, fTmpB*fS0 );
+		fC1 = fX*fC0 - fY*fS0;
+		fS1 = fX*fS0 + fY*fC0;
+
+		fTmpA = 0.5462742152960395f;
+		out( 8, fTmpA*fC1 );
+		out( 4, fTmpA*fS1 );
+		fTmpB = 1.445305721320277f*fZ;
+		out( 14, fTmpB*fC1 );
+		out( 10, fTmpB*fS1 );
+		fTmpC = 3.31161143515146f*fZ2 + -0.47308734787878f;
+		out( 22, fTmpC*fC1 );
+		out( 18, fTmpC*fS1 );
+		fTmpA = fZ*( 7.190305177459987f*fZ2 + -2.396768392486662f );
+		out( 32, fTmpA*fC1 );
+		out( 28, fTmpA*fS1 );
+		fTmpB = 2.11394181566097f*fZ*fTmpA + -0.9736101204623268f*fTmpC;
+		out( 44, fTmpB*fC1 );
+		out( 40, fTmpB*fS1 );
+		fTmpC = 2.081665999466133f*fZ*fTmpB + -0.9847319278346618f*fTmpA;
+		out( 58, fTmpC*fC1 );
+		out( 54, fTmpC*fS1 );
+		fTmpA = 2.06155281280883f*fZ*fTmpC + -0.9903379376602873f*fTmpB;
+		out( 74, fTmpA*fC1 );
+		out( 70, fTmpA*fS1 );
+		fTmpB = 2.048122358357819f*fZ*fTmpA + -0.9934852726704042f*fTmpC;
+		out( 92, fTmpB*fC1 );
+		out( 88, fTmpB*fS1 );
+		fTmpC = 2.038688303787511f*fZ*fTmpB + -0.9953938032404119f*fTmpA;
+		out( 112, fTmpC*fC1 );
+		out( 108, fTmpC*fS1 );
+		fTmpA = 2.031798495964875f*fZ*fTmpC + -0.9966204702259603f*fTmpB;
+		out( 134, fTmpA*fC1 );
+		out( 130, fTmpA*fS1 );
+		fC0 = fX*fC1 - fY*fS1;
+		fS0 = fX*fS1 + fY*fC1;
+
+		fTmpA = -0.5900435899266435f;
+		out( 15, fTmpA*fC0 );
+		out( 9, fTmpA*fS0 );
+		fTmpB = -1.770130769779931f*fZ;
+		out( 23, fTmpB*fC0 );
+		out( 17, fTmpB*fS0 );
+		fTmpC = -4.403144694917254f*fZ2 + 0.4892382994352505f;
+		out( 33, fTmpC*fC0 );
+		out( 27, fTmpC*fS0 );
+		fTmpA = fZ*( -10.13325785466416f*fZ2 + 2.763615778544771f );
+		out( 45, fTmpA*fC0 );
+		out( 39, fTmpA*fS0 );
+		fTmpB = 2.207940216581962f*fZ*fTmpA + -0.959403223600247f*fTmpC;
+		out( 59, fTmpB*fC0 );
+		out( 53, fTmpB*fS0 );
+		fTmpC = 2.15322168769582f*fZ*fTmpB + -0.9752173865600178f*fTmpA;
+		out( 75, fTmpC*fC0 );
+		out( 69, fTmpC*fS0 );
+		fTmpA = 2.118044171189805f*fZ*fTmpC + -0.9836628449792094f*fTmpB;
+		out( 93, fTmpA*fC0 );
+		out( 87, fTmpA*fS0 );
+		fTmpB = 2.093947321356338f*fZ*fTmpA + -0.9886230654859614f*fTmpC;
+		out( 113, fTmpB*fC0 );
+		out( 107, fTmpB*fS0 );
+		fTmpC = 2.076655965729519f*fZ*fTmpB + -0.9917422203269092f*fTmpA;
+		out( 135, fTmpC*fC0 );
+		out( 129, fTmpC*fS0 );
+		fC1 = fX*fC0 - fY*fS0;
+		fS1 = fX*fS0 + fY*fC0;
+
+		fTmpA = 0.6258357354491763f;
+		out( 24, fTmpA*fC1 );
+		out( 16, fTmpA*fS1 );
+		fTmpB = 2.075662314881041f*fZ;
+		out( 34, fTmpB*fC1 );
+		out( 26, fTmpB*fS1 );
+		fTmpC = 5.550213908015966f*fZ2 + -0.5045649007287241f;
+		out( 46, fTmpC*fC1 );
+		out( 38, fTmpC*fS1 );
+		fTmpA = fZ*( 13.49180504672677f*fZ2 + -3.113493472321562f );
+		out( 60, fTmpA*fC1 );
+		out( 52, fTmpA*fS1 );
+		fTmpB = 2.304886114323221f*fZ*fTmpA + -0.9481763873554654f*fTmpC;
+		out( 76, fTmpB*fC1 );
+		out( 68, fTmpB*fS1 );
+		fTmpC = 2.229177150706235f*fZ*fTmpB + -0.9671528397231821f*fTmpA;
+		out( 94, fTmpC*fC1 );
+		out( 86, fTmpC*fS1 );
+		fTmpA = 2.179449471770337f*fZ*fTmpC + -0.9776923610938036f*fTmpB;
+		out( 114, fTmpA*fC1 );
+		out( 106, fTmpA*fS1 );
+		fTmpB = 2.144761058952722f*fZ*fTmpA + -0.9840838646332836f*fTmpC;
+		out( 136, fTmpB*fC1 );
+		out( 128, fTmpB*fS1 );
+		fC0 = fX*fC1 - fY*fS1;
+		fS0 = fX*fS1 + fY*fC1;
+
+		fTmpA = -0.6563820568401703f;
+		out( 35, fTmpA*fC0 );
+		out( 25, fTmpA*fS0 );
+		fTmpB = -2.366619162231753f*fZ;
+		out( 47, fTmpB*fC0 );
+		out( 37, fTmpB*fS0 );
+		fTmpC = -6.745902523363385f*fZ2 + 0.5189155787202604f;
+		out( 61, fTmpC*fC0 );
+		out( 51, fTmpC*fS0 );
+		fTmpA = fZ*( -17.24955311049054f*fZ2 + 3.449910622098108f );
+		out( 77, fTmpA*fC0 );
+		out( 67, fTmpA*fS0 );
+		fTmpB = 2.401636346922062f*fZ*fTmpA + -0.9392246042043708f*fTmpC;
+		out( 95, fTmpB*fC0 );
+		out( 85, fTmpB*fS0 );
+		fTmpC = 2.306512518934159f*fZ*fTmpB + -0.9603920767980496f*fTmpA;
+		out( 115, fTmpC*fC0 );
+		out( 105, fTmpC*fS0 );
+		fTmpA = 2.243044805615795f*fZ*fTmpC + -0.9724832565193738f*fTmpB;
+		out( 137, fTmpA*fC0 );
+		out( 127, fTmpA*fS0 );
+		fC1 = fX*fC0 - fY*fS0;
+		fS1 = fX*fS0 + fY*fC0;
+
+		fTmpA = 0.6831841051919144f;
+		out( 48, fTmpA*fC1 );
+		out( 36, fTmpA*fS1 );
+		fTmpB = 2.645960661801901f*fZ;
+		out( 62, fTmpB*fC1 );
+		out( 50, fTmpB*fS1 );
+		fTmpC = 7.984991490893139f*fZ2 + -0.5323327660595426f;
+		out( 78, fTmpC*fC1 );
+		out( 66, fTmpC*fS1 );
+		fTmpA = fZ*( 21.39289019090864f*fZ2 + -3.775215916042701f );
+		out( 96, fTmpA*fC1 );
+		out( 84, fTmpA*fS1 );
+		fTmpB = 2.496873044429773f*fZ*fTmpA + -0.9319689782769534f*fTmpC;
+		out( 116, fTmpB*fC1 );
+		out( 104, fTmpB*fS1 );
+		fTmpC = 2.383768642544085f*fZ*fTmpB + -0.9547015807880142f*fTmpA;
+		out( 138, fTmpC*fC1 );
+		out( 126, fTmpC*fS1 );
+		fC0 = fX*fC1 - fY*fS1;
+		fS0 = fX*fS1 + fY*fC1;
+
+		fTmpA = -0.7071627325245963f;
+		out( 63, fTmpA*fC0 );
+		out( 49, fTmpA*fS0 );
+		fTmpB = -2.91570664069932f*fZ;
+		out( 79, fTmpB*fC0 );
+		out( 65, fTmpB*fS0 );
+		fTmpC = -9.263393182848905f*fZ2 + 0.5449054813440533f;
+		out( 97, fTmpC*fC0 );
+		out( 83, fTmpC*fS0 );
+		fTmpA = fZ*( -25.9102413133663f*fZ2 + 4.091090733689416f );
+		out( 117, fTmpA*fC0 );
+		out( 103, fTmpA*fS0 );
+		fTmpB = 2.590045044653342f*fZ*fTmpA + -0.9259892765852515f*fTmpC;
+		out( 139, fTmpB*fC0 );
+		out( 125, fTmpB*fS0 );
+		fC1 = fX*fC0 - fY*fS0;
+		fS1 = fX*fS0 + fY*fC0;
+
+		fTmpA = 0.72892666017483f;
+		out( 80, fTmpA*fC1 );
+		out( 64, fTmpA*fS1 );
+		fTmpB = 3.177317648954698f*fZ;
+		out( 98, fTmpB*fC1 );
+		out( 82, fTmpB*fS1 );
+		fTmpC = 10.57781172168795f*fZ2 + -0.5567269327204184f;
+		out( 118, fTmpC*fC1 );
+		out( 102, fTmpC*fS1 );
+		fTmpA = fZ*( 30.79157970335749f*fZ2 + -4.398797100479641f );
+		out( 140, fTmpA*fC1 );
+		out( 124, fTmpA*fS1 );
+		fC0 = fX*fC1 - fY*fS1;
+		fS0 = fX*fS1 + fY*fC1;
+
+		fTmpA = -0.7489009518531884f;
+		out( 99, fTmpA*fC0 );
+		out( 81, fTmpA*fS0 );
+		fTmpB = -3.431895299891715f*fZ;
+		out( 119, fTmpB*fC0 );
+		out( 101, fTmpB*fS0 );
+		fTmpC = -11.92552753945219f*fZ2 + 0.5678822637834374f;
+		out( 141, fTmpC*fC0 );
+		out( 123, fTmpC*fS0 );
+		fC1 = fX*fC0 - fY*fS0;
+		fS1 = fX*fS0 + fY*fC0;
+
+		fTmpA = 0.7673951182219901f;
+		out( 120, fTmpA*fC1 );
+		out( 100, fTmpA*fS1 );
+		fTmpB = 3.680297698805312f*fZ;
+		out( 142, fTmpB*fC1 );
+		out( 122, fTmpB*fS1 );
+		fC0 = fX*fC1 - fY*fS1;
+		fS0 = fX*fS1 + fY*fC1;
+
+		fTmpC = -0.7846421057871971f;
+		out( 143, fTmpC*fC0 );
+		out( 121, fTmpC*fS0 );
+	}
+};
+
+// order 13
+template<>
+struct SHKernel<13>
+{
+	template<typename T, typename O>
+	static FORCEINLINE void Eval( const T fX, const T fY, const T fZ, const O &out )
+	{
+		T fC0, fC1, fS0, fS1, fTmpA, fTmpB, fTmpC;
+		T fZ2 = fZ*fZ;
+
+		out( 0, 0.2820947917738781f );
+		out( 2, 0.4886025119029199f*fZ );
+		const T fP6 = 0.9461746957575601f*fZ2 + -0.3153915652525201f;
+		out( 6, fP6 );
+		const T fP12 = fZ*( 1.865881662950577f*fZ2 + -1.119528997770346f );
+		out( 12, fP12 );
+		const T fP20 = 1.984313483298443f*fZ*fP12 + -1.006230589874905f*fP6;
+		out( 20, fP20 );
+		const T fP30 = 1.98997487421324f*fZ*fP20 + -1.002853072844814f*fP12;
+		out( 30, fP30 );
+		const T fP42 = 1.993043457183567f*fZ*fP30 + -1.001542020962219f*fP20;
+		out( 42, fP42 );
+		const T fP56 = 1.994891434824135f*fZ*fP42 + -1.000927213921958f*fP30;
+		out( 56, fP56 );
+		const T fP72 = 1.996089927833914f*fZ*fP56 + -1.000600781069515f*fP42;
+		out( 72, fP72 );
+		const T fP90 = 1.996911195067937f*fZ*fP72 + -1.000411437993134f*fP56;
+		out( 90, fP90 );
+		const T fP110 = 1.997498435543818f*fZ*fP90 + -1.00029407440718f*fP72;
+		out( 110, fP110 );
+		const T fP132 = 1.997932815985082f*fZ*fP110 + -1.000217462218511f*fP90;
+		out( 132, fP132 );
+		out( 156, 1.998263134713633f*fZ*fP132 + -1.000165330248298f*fP110 );
+		fC0 = fX;
+		fS0 = fY;
+
+		fTmpA = -0.48860251190292f;
+		out( 3, fTmpA*fC0 );
+		out( 1, fTmpA*fS0 );
+		fTmpB = -1.092548430592079f*fZ;
+		out( 7, fTmpB*fC0 );
+		out( 5, fTmpB*fS0 );
+		fTmpC = -2.285228997322329f*fZ2 + 0.4570457994644658f;
+		out( 13, fTmpC*fC0 );
+		out( 11, fTmpC*fS0 );
+		fTmpA = fZ*( -4.683325804901025f*fZ2 + 2.007139630671868f );
+		out( 21, fTmpA*fC0 );
+		out( 19, fTmpA*fS0 );
+		fTmpB = 2.03100960115899f*fZ*fTmpA + -0.991031208965115f*fTmpC;
+		out( 31, fTmpB*fC0 );
+		out( 29, fTmpB*fS0 );
+		fTmpC = 2.021314989237028f*fZ*fTmpB + -0.9952267030562385f*fTmpA;
+		out( 43, fTmpC*fC0 );
+		out( 41, fTmpC*fS0 );
+		fTmpA = 2.015564437074638f*fZ*fTmpC + -0.9971550440218319f*fTmpB;
+		out( 57, fTmpA*fC0 );
+		out( 55, fTmpA*fS0 );
+		fTmpB = 2.011869540407391f*fZ*fTmpA + -0.9981668178901745f*fTmpC;
+		out( 73, fTmpB*fC0 );
+		out( 71, fTmpB*fS0 );
+		fTmpC = 2.009353129741012f*fZ*fTmpB + -0.9987492177719088f*fTmpA;
+		out( 91, fTmpC*fC0 );
+		out( 89, fTmpC*fS0 );
+		fTmpA = 2.007561463642653f*fZ*fTmpC + -0.9991083368712843f*fTmpB;
+		out( 111, fTmpA*fC0 );
+		out( 109, fTmpA*fS0 );
+		fTmpB = 2.006240264773888f*fZ*fTmpA + -0.9993418887079215f*fTmpC;
+		out( 133, fTmpB*fC0 );
+		out( 131, fTmpB*fS0 );
+		fTmpC = 2.005237896355199f*fZ*fTmpB + -0.9995003746877732f*fTmpA;
+		out( 157, fTmpC*fC0 );
+		out( 155, fTmpC*fS0 );
+		fC1 = fX*fC0 - fY*fS0;
+		fS1 = fX*fS0 + fY*fC0;
+
+		fTmpA = 0.5462742152960395f;
+		out( 8, fTmpA*fC1 );
+		out( 4, fTmpA*fS1 );
+		fTmpB = 1.445305721320277f*fZ;
+		out( 14, fTmpB*fC1 );
+		out( 10, fTmpB*fS1 );
+		fTmpC = 3.31161143515146f*fZ2 + -0.47308734787878f;
+		out( 22, fTmpC*fC1 );
+		out( 18, fTmpC*fS1 );
+		fTmpA = fZ*( 7.190305177459987f*fZ2 + -2.396768392486662f );
+		out( 32, fTmpA*fC1 );
+		out( 28, fTmpA*fS1 );
+		fTmpB = 2.11394181566097f*fZ*fTmpA + -0.9736101204623268f*fTmpC;
+		out( 44, fTmpB*fC1 );
+		out( 40, fTmpB*fS1 );
+		fTmpC = 2.081665999466133f*fZ*fTmpB + -0.9847319278346618f*fTmpA;
+		out( 58, fTmpC*fC1 );
+		out( 54, fTmpC*fS1 );
+		fTmpA = 2.06155281280883f*fZ*fTmpC + -0.9903379376602873f*fTmpB;
+		out( 74, fTmpA*fC1 );
+		out( 70, fTmpA*fS1 );
+		fTmpB = 2.048122358357819f*fZ*fTmpA + -0.9934852726704042f*fTmpC;
+		out( 92, fTmpB*fC1 );
+		out( 88, fTmpB*fS1 );
+		fTmpC = 2.038688303787511f*fZ*fTmpB + -0.9953938032404119f*fTmpA;
+		out( 112, fTmpC*fC1 );
+		out( 108, fTmpC*fS1 );
+		fTmpA = 2.031798495964875f*fZ*fTmpC + -0.9966204702259603f*fTmpB;
+		out( 134, fTmpA*fC1 );
+		out( 130, fTmpA*fS1 );
+		fTmpB = 2.026608708444444f*fZ*fTmpA + -0.9974457174120671f*fTmpC;
+		out( 158, fTmpB*fC1 );
+		out( 154, fTmpB*fS1 );
+		fC0 = fX*fC1 - fY*fS1;
+		fS0 = fX*fS1 + fY*fC1;
+
+		fTmpA = -0.5900435899266435f;
+		out( 15, fTmpA*fC0 );
+		out( 9, fTmpA*fS0 );
+		fTmpB = -1.770130769779931f*fZ;
+		out( 23, fTmpB*fC0 );
+		out( 17, fTmpB*fS0 );
+		fTmpC = -4.403144694917254f*fZ2 + 0.4892382994352505f;
+		out( 33, fTmpC*fC0 );
+		out( 27, fTmpC*fS0 );
+		fTmpA = fZ*( -10.13325785466416f*fZ2 + 2.763615778544771f );
+		out( 45, fTmpA*fC0 );
+		out( 39, fTmpA*fS0 );
+		fTmpB = 2.207940216581962f*fZ*fTmpA + -0.959403223600247f*fTmpC;
+		out( 59, fTmpB*fC0 );
+		out( 53, fTmpB*fS0 );
+		fTmpC = 2.15322168769582f*fZ*fTmpB + -0.9752173865600178f*fTmpA;
+		out( 75, fTmpC*fC0 );
+		out( 69, fTmpC*fS0 );
+		fTmpA = 2.118044171189805f*fZ*fTmpC + -0.9836628449792094f*fTmpB;
+		out( 93, fTmpA*fC0 );
+		out( 87, fTmpA*fS0 );
+		fTmpB = 2.093947321356338f*fZ*fTmpA + -0.9886230654859614f*fTmpC;
+		out( 113, fTmpB*fC0 );
+		out( 107, fTmpB*fS0 );
+		fTmpC = 2.076655965729519f*fZ*fTmpB + -0.9917422203269092f*fTmpA;
+		out( 135, fTmpC*fC0 );
+		out( 129, fTmpC*fS0 );
+		fTmpA = 2.063797291222968f*fZ*fTmpC + -0.9938079899999066f*fTmpB;
+		out( 159, fTmpA*fC0 );
+		out( 153, fTmpA*fS0 );
+		fC1 = fX*fC0 - fY*fS0;
+		fS1 = fX*fS0 + fY*fC0;
+
+		fTmpA = 0.6258357354491763f;
+		out( 24, fTmpA*fC1 );
+		out( 16, fTmpA*fS1 );
+		fTmpB = 2.075662314881041f*fZ;
+		out( 34, fTmpB*fC1 );
+		out( 26, fTmpB*fS1 );
+		fTmpC = 5.550213908015966f*fZ2 + -0.5045649007287241f;
+		out( 46, fTmpC*fC1 );
+		out( 38, fTmpC*fS1 );
+		fTmpA = fZ*( 13.49180504672677f*fZ2 + -3.113493472321562f );
+		out( 60, fTmpA*fC1 );
+		out( 52, fTmpA*fS1 );
+		fTmpB = 2.304886114323221f*fZ*fTmpA + -0.9481763873554654f*fTmpC;
+		out( 76, fTmpB*fC1 );
+		out( 68, fTmpB*fS1 );
+		fTmpC = 2.229177150706235f*fZ*fTmpB + -0.9671528397231821f*fTmpA;
+		out( 94, fTmpC*fC1 );
+		out( 86, fTmpC*fS1 );
+		fTmpA = 2.179449471770337f*fZ*fTmpC + -0.9776923610938036f*fTmpB;
+		out( 114, fTmpA*fC1 );
+		out( 106, fTmpA*fS1 );
+		fTmpB = 2.144761058952722f*fZ*fTmpA + -0.9840838646332836f*fTmpC;
+		out( 136, fTmpB*fC1 );
+		out( 128, fTmpB*fS1 );
+		fTmpC = 2.119478119726646f*fZ*fTmpB + -0.9882117688026186f*fTmpA;
+		out( 160, fTmpC*fC1 );
+		out( 152, fTmpC*fS1 );
+		fC0 = fX*fC1 - fY*fS1;
+		fS0 = fX*fS1 + fY*fC1;
+
+		fTmpA = -0.6563820568401703f;
+		out( 35, fTmpA*fC0 );
+		out( 25, fTmpA*fS0 );
+		fTmpB = -2.366619162231753f*fZ;
+		out( 47, fTmpB*fC0 );
+		out( 37, fTmpB*fS0 );
+		fTmpC = -6.745902523363385f*fZ2 + 0.5189155787202604f;
+		out( 61, fTmpC*fC0 );
+		out( 51, fTmpC*fS0 );
+		fTmpA = fZ*( -17.24955311049054f*fZ2 + 3.449910622098108f );
+		out( 77, fTmpA*fC0 );
+		out( 67, fTmpA*fS0 );
+		fTmpB = 2.401636346922062f*fZ*fTmpA + -0.9392246042043708f*fTmpC;
+		out( 95, fTmpB*fC0 );
+		out( 85, fTmpB*fS0 );
+		fTmpC = 2.306512518934159f*fZ*fTmpB + -0.9603920767980496f*fTmpA;
+		out( 115, fTmpC*fC0 );
+		out( 105, fTmpC*fS0 );
+		fTmpA = 2.243044805615795f*fZ*fTmpC + -0.9724832565193738f*fTmpB;
+		out( 137, fTmpA*fC0 );
+		out( 127, fTmpA*fS0 );
+		fTmpB = 2.198165774710643f*fZ*fTmpA + -0.9799919151000504f*fTmpC;
+		out( 161, fTmpB*fC0 );
+		out( 151, fTmpB*fS0 );
+		fC1 = fX*fC0 - fY*fS0;
+		fS1 = fX*fS0 + fY*fC0;
+
+		fTmpA = 0.6831841051919144f;
+		out( 48, fTmpA*fC1 );
+		out( 36, fTmpA*fS1 );
+		fTmpB = 2.645960661801901f*fZ;
+		out( 62, fTmpB*fC1 );
+		out( 50, fTmpB*fS1 );
+		fTmpC = 7.984991490893139f*fZ2 + -0.5323327660595426f;
+		out( 78, fTmpC*fC1 );
+		out( 66, fTmpC*fS1 );
+		fTmpA = fZ*( 21.39289019090864f*fZ2 + -3.775215916042701f );
+		out( 96, fTmpA*fC1 );
+		out( 84, fTmpA*fS1 );
+		fTmpB = 2.496873044429773f*fZ*fTmpA + -0.9319689782769534f*fTmpC;
+		out( 116, fTmpB*fC1 );
+		out( 104, fTmpB*fS1 );
+		fTmpC = 2.383768642544085f*fZ*fTmpB + -0.9547015807880142f*fTmpA;
+		out( 138, fTmpC*fC1 );
+		out( 126, fTmpC*fS1 );
+		fTmpA = 2.307395517477243f*fZ*fTmpC + -0.9679611839405133f*fTmpB;
+		out( 162, fTmpA*fC1 );
+		out( 150, fTmpA*fS1 );
+		fC0 = fX*fC1 - fY*fS1;
+		fS0 = fX*fS1 + fY*fC1;
+
+		fTmpA = -0.7071627325245963f;
+		out( 63, fTmpA*fC0 );
+		out( 49, fTmpA*fS0 );
+		fTmpB = -2.91570664069932f*fZ;
+		out( 79, fTmpB*fC0 );
+		out( 65, fTmpB*fS0 );
+		fTmpC = -9.263393182848905f*fZ2 + 0.5449054813440533f;
+		out( 97, fTmpC*fC0 );
+		out( 83, fTmpC*fS0 );
+		fTmpA = fZ*( -25.9102413133663f*fZ2 + 4.091090733689416f );
+		out( 117, fTmpA*fC0 );
+		out( 103, fTmpA*fS0 );
+		fTmpB = 2.590045044653342f*fZ*fTmpA + -0.9259892765852515f*fTmpC;
+		out( 139, fTmpB*fC0 );
+		out( 125, fTmpB*fS0 );
+		fTmpC = 2.460209661583209f*fZ*fTmpB + -0.9498713802919554f*fTmpA;
+		out( 163, fTmpC*fC0 );
+		out( 149, fTmpC*fS0 );
+		fC1 = fX*fC0 - fY*fS0;
+		fS1 = fX*fS0 + fY*fC0;
+
+		fTmpA = 0.72892666017483f;
+		out( 80, fTmpA*fC1 );
+		out( 64, fTmpA*fS1 );
+		fTmpB = 3.177317648954698f*fZ;
+		out( 98, fTmpB*fC1 );
+		out( 82, fTmpB*fS1 );
+		fTmpC = 10.57781172168795f*fZ2 + -0.5567269327204184f;
+		out( 118, fTmpC*fC1 );
+		out( 102, fTmpC*fS1 );
+		fTmpA = fZ*( 30.79157970335749f*fZ2 + -4.398797100479641f );
+		out( 140, fTmpA*fC1 );
+		out( 124, fTmpA*fS1 );
+		fTmpB = 2.680951323690902f*fZ*fTmpA + -0.9209854970162591f*fTmpC;
+		out( 164, fTmpB*fC1 );
+		out( 148, fTmpB*fS1 );
+		fC0 = fX*fC1 - fY*fS1;
+		fS0 = fX*fS1 + fY*fC1;
+
+		fTmpA = -0.7489009518531884f;
+		out( 99, fTmpA*fC0 );
+		out( 81, fTmpA*fS0 );
+		fTmpB = -3.431895299891715f*fZ;
+		out( 119, fTmpB*fC0 );
+		out( 101, fTmpB*fS0 );
+		fTmpC = -11.92552753945219f*fZ2 + 0.5678822637834374f;
+		out( 141, fTmpC*fC0 );
+		out( 123, fTmpC*fS0 );
+		fTmpA = fZ*( -36.02809068931077f*fZ2 + 4.699316176866623f );
+		out( 165, fTmpA*fC0 );
+		out( 147, fTmpA*fS0 );
+		fC1 = fX*fC0 - fY*fS0;
+		fS1 = fX*fS0 + fY*fC0;
+
+		fTmpA = 0.7673951182219901f;
+		out( 120, fTmpA*fC1 );
+		out( 100, fTmpA*fS1 );
+		fTmpB = 3.680297698805312f*fZ;
+		out( 142, fTmpB*fC1 );
+		out( 122, fTmpB*fS1 );
+		fTmpC = 13.30425420025764f*fZ2 + -0.5784458347938103f;
+		out( 166, fTmpC*fC1 );
+		out( 146, fTmpC*fS1 );
+		fC0 = fX*fC1 - fY*fS1;
+		fS0 = fX*fS1 + fY*fC1;
+
+		fTmpA = -0.7846421057871971f;
+		out( 143, fTmpA*fC0 );
+		out( 121, fTmpA*fS0 );
+		fTmpB = -3.923210528935984f*fZ;
+		out( 167, fTmpB*fC0 );
+		out( 145, fTmpB*fS0 );
+		fC1 = fX*fC0 - fY*fS0;
+		fS1 = fX*fS0 + fY*fC0;
+
+		fTmpC = 0.8008219957839717f;
+		out( 168, fTmpC*fC1 );
+		out( 144, fTmpC*fS1 );
+	}
+};
+
+// order 14
+template<>
+struct SHKernel<14>
+{
+	template<typename T, typename O>
+	static FORCEINLINE void Eval( const T fX, const T fY, const T fZ, const O &out )
+	{
+		T fC0, fC1, fS0, fS1, fTmpA, fTmpB, fTmpC;
+		T fZ2 = fZ*fZ;
+
+		out( 0, 0.2820947917738781f );
+		out( 2, 0.4886025119029199f*fZ );
+		const T fP6 = 0.9461746957575601f*fZ2 + -0.3153915652525201f;
+		out( 6, fP6 );
+		const T fP12 = fZ*( 1.865881662950577f*fZ2 + -1.119528997770346f );
+		out( 12, fP12 );
+		const T fP20 = 1.984313483298443f*fZ*fP12 + -1.006230589874905f*fP6;
+		out( 20, fP20 );
+		const T fP30 = 1.98997487421324f*fZ*fP20 + -1.002853072844814f*fP12;
+		out( 30, fP30 );
+		const T fP42 = 1.993043457183567f*fZ*fP30 + -1.001542020962219f*fP20;
+		out( 42, fP42 );
+		const T fP56 = 1.994891434824135f*fZ*fP42 + -1.000927213921958f*fP30;
+		out( 56, fP56 );
+		const T fP72 = 1.996089927833914f*fZ*fP56 + -1.000600781069515f*fP42;
+		out( 72, fP72 );
+		const T fP90 = 1.996911195067937f*fZ*fP72 + -1.000411437993134f*fP56;
+		out( 90, fP90 );
+		const T fP110 = 1.997498435543818f*fZ*fP90 + -1.00029407440718f*fP72;
+		out( 110, fP110 );
+		const T fP132 = 1.997932815985082f*fZ*fP110 + -1.000217462218511f*fP90;
+		out( 132, fP132 );
+		const T fP156 = 1.998263134713633f*fZ*fP132 + -1.000165330248298f*fP110;
+		out( 156, fP156 );
+		out( 182, 1.998520162579474f*fZ*fP156 + -1.000128625635621f*fP132 );
+		fC0 = fX;
+		fS0 = fY;
+
+		fTmpA = -0.48860251190292f;
+		out( 3, fTmpA*fC0 );
+		out( 1, fTmpA*fS0 );
+		fTmpB = -1.092548430592079f*fZ;
+		out( 7, fTmpB*fC0 );
+		out( 5, fTmpB*fS0 );
+		fTmpC = -2.285228997322329f*fZ2 + 0.4570457994644658f;
+		out( 13, fTmpC*fC0 );
+		out( 11, fTmpC*fS0 );
+		fTmpA = fZ*( -4.683325804901025f*fZ2 + 2.007139630671868f );
+		out( 21, fTmpA*fC0 );
+		out( 19, fTmpA*fS0 );
+		fTmpB = 2.03100960115899f*fZ*fTmpA + -0.991031208965115f*fTmpC;
+		out( 31, fTmpB*fC0 );
+		out( 29, fTmpB*fS0 );
+		fTmpC = 2.021314989237028f*fZ*fTmpB + -0.9952267030562385f*fTmpA;
+		out( 43, fTmpC*fC0 );
+		out( 41, fTmpC*fS0 );
+		fTmpA = 2.015564437074638f*fZ*fTmpC + -0.9971550440218319f*fTmpB;
+		out( 57, fTmpA*fC0 );
+		out( 55, fTmpA*fS0 );
+		fTmpB = 2.011869540407391f*fZ*fTmpA + -0.9981668178901745f*fTmpC;
+		out( 73, fTmpB*fC0 );
+		out( 71, fTmpB*fS0 );
+		fTmpC = 2.009353129741012f*fZ*fTmpB + -0.9987492177719088f*fTmpA;
+		out( 91, fTmpC*fC0 );
+		out( 89, fTmpC*fS0 );
+		fTmpA = 2.007561463642653f*fZ*fTmpC + -0.9991083368712843f*fTmpB;
+		out( 111, fTmpA*fC0 );
+		out( 109, fTmpA*fS0 );
+		fTmpB = 2.006240264773888f*fZ*fTmpA + -0.9993418887079215f*fTmpC;
+		out( 133, fTmpB*fC0 );
+		out( 131, fTmpB*fS0 );
+		fTmpC = 2.005237896355199f*fZ*fTmpB + -0.9995003746877732f*fTmpA;
+		out( 157, fTmpC*fC0 );
+		out( 155, fTmpC*fS0 );
+		fTmpA = 2.004459314343183f*fZ*fTmpC + -0.9996117258638336f*fTmpB;
+		out( 183, fTmpA*fC0 );
+		out( 181, fTmpA*fS0 );
+		fC1 = fX*fC0 - fY*fS0;
+		fS1 = fX*fS0 + fY*fC0;
+
+		fTmpA = 0.5462742152960395f;
+		out( 8, fTmpA*fC1 );
+		out( 4, fTmpA*fS1 );
+		fTmpB = 1.445305721320277f*fZ;
+		out( 14, fTmpB*fC1 );
+		out( 10, fTmpB*fS1 );
+		fTmpC = 3.31161143515146f*fZ2 + -0.47308734787878f;
+		out( 22, fTmpC*fC1 );
+		out( 18, fTmpC*fS1 );
+		fTmpA = fZ*( 7.190305177459987f*fZ2 + -2.396768392486662f );
+		out( 32, fTmpA*fC1 );
+		out( 28, fTmpA*fS1 );
+		fTmpB = 2.11394181566097f*fZ*fTmpA + -0.9736101204623268f*fTmpC;
+		out( 44, fTmpB*fC1 );
+		out( 40, fTmpB*fS1 );
+		fTmpC = 2.081665999466133f*fZ*fTmpB + -0.9847319278346618f*fTmpA;
+		out( 58, fTmpC*fC1 );
+		out( 54, fTmpC*fS1 );
+		fTmpA = 2.06155281280883f*fZ*fTmpC + -0.9903379376602873f*fTmpB;
+		out( 74, fTmpA*fC1 );
+		out( 70, fTmpA*fS1 );
+		fTmpB = 2.048122358357819f*fZ*fTmpA + -0.9934852726704042f*fTmpC;
+		out( 92, fTmpB*fC1 );
+		out( 88, fTmpB*fS1 );
+		fTmpC = 2.038688303787511f*fZ*fTmpB + -0.9953938032404119f*fTmpA;
+		out( 112, fTmpC*fC1 );
+		out( 108, fTmpC*fS1 );
+		fTmpA = 2.031798495964875f*fZ*fTmpC + -0.9966204702259603f*fTmpB;
+		out( 134, fTmpA*fC1 );
+		out( 130, fTmpA*fS1 );
+		fTmpB = 2.026608708444444f*fZ*fTmpA + -0.9974457174120671f*fTmpC;
+		out( 158, fTmpB*fC1 );
+		out( 154, fTmpB*fS1 );
+		fTmpC = 2.022599587389726f*fZ*fTmpB + -0.9980217586956907f*fTmpA;
+		out( 184, fTmpC*fC1 );
+		out( 180, fTmpC*fS1 );
+		fC0 = fX*fC1 - fY*fS1;
+		fS0 = fX*fS1 + fY*fC1;
+
+		fTmpA = -0.5900435899266435f;
+		out( 15, fTmpA*fC0 );
+		out( 9, fTmpA*fS0 );
+		fTmpB = -1.770130769779931f*fZ;
+		out( 23, fTmpB*fC0 );
+		out( 17, fTmpB*fS0 );
+		fTmpC = -4.403144694917254f*fZ2 + 0.4892382994352505f;
+		out( 33, fTmpC*fC0 );
+		out( 27, fTmpC*fS0 );
+		fTmpA = fZ*( -10.13325785466416f*fZ2 + 2.763615778544771f );
+		out( 45, fTmpA*fC0 );
+		out( 39, fTmpA*fS0 );
+		fTmpB = 2.207940216581962f*fZ*fTmpA + -0.959403223600247f*fTmpC;
+		out( 59, fTmpB*fC0 );
+		out( 53, fTmpB*fS0 );
+		fTmpC = 2.15322168769582f*fZ*fTmpB + -0.9752173865600178f*fTmpA;
+		out( 75, fTmpC*fC0 );
+		out( 69, fTmpC*fS0 );
+		fTmpA = 2.118044171189805f*fZ*fTmpC + -0.9836628449792094f*fTmpB;
+		out( 93, fTmpA*fC0 );
+		out( 87, fTmpA*fS0 );
+		fTmpB = 2.093947321356338f*fZ*fTmpA + -0.9886230654859614f*fTmpC;
+		out( 113, fTmpB*fC0 );
+		out( 107, fTmpB*fS0 );
+		fTmpC = 2.076655965729519f*fZ*fTmpB + -0.9917422203269092f*fTmpA;
+		out( 135, fTmpC*fC0 );
+		out( 129, fTmpC*fS0 );
+		fTmpA = 2.063797291222968f*fZ*fTmpC + -0.9938079899999066f*fTmpB;
+		out( 159, fTmpA*fC0 );
+		out( 153, fTmpA*fS0 );
+		fTmpB = 2.053959590644373f*fZ*fTmpA + -0.9952332040455557f*fTmpC;
+		out( 185, fTmpB*fC0 );
+		out( 179, fTmpB*fS0 );
+		fC1 = fX*fC0 - fY*fS0;
+		fS1 = fX*fS0 + fY*fC0;
+
+		fTmpA = 0.6258357354491763f;
+		out( 24, fTmpA*fC1 );
+		out( 16, fTmpA*fS1 );
+		fTmpB = 2.075662314881041f*fZ;
+		out( 34, fTmpB*fC1 );
+		out( 26, fTmpB*fS1 );
+		fTmpC = 5.550213908015966f*fZ2 + -0.5045649007287241f;
+		out( 46, fTmpC*fC1 );
+		out( 38, fTmpC*fS1 );
+		fTmpA = fZ*( 13.49180504672677f*fZ2 + -3.113493472321562f );
+		out( 60, fTmpA*fC1 );
+		out( 52, fTmpA*fS1 );
+		fTmpB = 2.304886114323221f*fZ*fTmpA + -0.9481763873554654f*fTmpC;
+		out( 76, fTmpB*fC1 );
+		out( 68, fTmpB*fS1 );
+		fTmpC = 2.229177150706235f*fZ*fTmpB + -0.9671528397231821f*fTmpA;
+		out( 94, fTmpC*fC1 );
+		out( 86, fTmpC*fS1 );
+		fTmpA = 2.179449471770337f*fZ*fTmpC + -0.9776923610938036f*fTmpB;
+		out( 114, fTmpA*fC1 );
+		out( 106, fTmpA*fS1 );
+		fTmpB = 2.144761058952722f*fZ*fTmpA + -0.9840838646332836f*fTmpC;
+		out( 136, fTmpB*fC1 );
+		out( 128, fTmpB*fS1 );
+		fTmpC = 2.119478119726646f*fZ*fTmpB + -0.9882117688026186f*fTmpA;
+		out( 160, fTmpC*fC1 );
+		out( 152, fTmpC*fS1 );
+		fTmpA = 2.100420126042015f*fZ*fTmpC + -0.9910081668184009f*fTmpB;
+		out( 186, fTmpA*fC1 );
+		out( 178, fTmpA*fS1 );
+		fC0 = fX*fC1 - fY*fS1;
+		fS0 = fX*fS1 + fY*fC1;
+
+		fTmpA = -0.6563820568401703f;
+		out( 35, fTmpA*fC0 );
+		out( 25, fTmpA*fS0 );
+		fTmpB = -2.366619162231753f*fZ;
+		out( 47, fTmpB*fC0 );
+		out( 37, fTmpB*fS0 );
+		fTmpC = -6.745902523363385f*fZ2 + 0.5189155787202604f;
+		out( 61, fTmpC*fC0 );
+		out( 51, fTmpC*fS0 );
+		fTmpA = fZ*( -17.24955311049054f*fZ2 + 3.449910622098108f );
+		out( 77, fTmpA*fC0 );
+		out( 67, fTmpA*fS0 );
+		fTmpB = 2.401636346922062f*fZ*fTmpA + -0.9392246042043708f*fTmpC;
+		out( 95, fTmpB*fC0 );
+		out( 85, fTmpB*fS0 );
+		fTmpC = 2.306512518934159f*fZ*fTmpB + -0.9603920767980496f*fTmpA;
+		out( 115, fTmpC*fC0 );
+		out( 105, fTmpC*fS0 );
+		fTmpA = 2.243044805615795f*fZ*fTmpC + -0.9724832565193738f*fTmpB;
+		out( 137, fTmpA*fC0 );
+		out( 127, fTmpA*fS0 );
+		fTmpB = 2.198165774710643f*fZ*fTmpA + -0.9799919151000504f*fTmpC;
+		out( 161, fTmpB*fC0 );
+		out( 151, fTmpB*fS0 );
+		fTmpC = 2.165063509461097f*fZ*fTmpB + -0.9849409604906143f*fTmpA;
+		out( 187, fTmpC*fC0 );
+		out( 177, fTmpC*fS0 );
+		fC1 = fX*fC0 - fY*fS0;
+		fS1 = fX*fS0 + fY*fC0;
+
+		fTmpA = 0.6831841051919144f;
+		out( 48, fTmpA*fC1 );
+		out( 36, fTmpA*fS1 );
+		fTmpB = 2.645960661801901f*fZ;
+		out( 62, fTmpB*fC1 );
+		out( 50, fTmpB*fS1 );
+		fTmpC = 7.984991490893139f*fZ2 + -0.5323327660595426f;
+		out( 78, fTmpC*fC1 );
+		out( 66, fTmpC*fS1 );
+		fTmpA = fZ*( 21.39289019090864f*fZ2 + -3.775215916042701f );
+		out( 96, fTmpA*fC1 );
+		out( 84, fTmpA*fS1 );
+		fTmpB = 2.496873044429773f*fZ*fTmpA + -0.9319689782769534f*fTmpC;
+		out( 116, fTmpB*fC1 );
+		out( 104, fTmpB*fS1 );
+		fTmpC = 2.383768642544085f*fZ*fTmpB + -0.9547015807880142f*fTmpA;
+		out( 138, fTmpC*fC1 );
+		out( 126, fTmpC*fS1 );
+		fTmpA = 2.307395517477243f*fZ*fTmpC + -0.9679611839405133f*fTmpB;
+		out( 162, fTmpA*fC1 );
+		out( 150, fTmpA*fS1 );
+		fTmpB = 2.252817784447915f*fZ*fTmpA + -0.9763466069791972f*fTmpC;
+		out( 188, fTmpB*fC1 );
+		out( 176, fTmpB*fS1 );
+		fC0 = fX*fC1 - fY*fS1;
+		fS0 = fX*fS1 + fY*fC1;
+
+		fTmpA = -0.7071627325245963f;
+		out( 63, fTmpA*fC0 );
+		out( 49, fTmpA*fS0 );
+		fTmpB = -2.91570664069932f*fZ;
+		out( 79, fTmpB*fC0 );
+		out( 65, fTmpB*fS0 );
+		fTmpC = -9.263393182848905f*fZ2 + 0.5449054813440533f;
+		out( 97, fTmpC*fC0 );
+		out( 83, fTmpC*fS0 );
+		fTmpA = fZ*( -25.9102413133663f*fZ2 + 4.091090733689416f );
+		out( 117, fTmpA*fC0 );
+		out( 103, fTmpA*fS0 );
+		fTmpB = 2.590045044653342f*fZ*fTmpA + -0.9259892765852515f*fTmpC;
+		out( 139, fTmpB*fC0 );
+		out( 125, fTmpB*fS0 );
+		fTmpC = 2.460209661583209f*fZ*fTmpB + -0.9498713802919554f*fTmpA;
+		out( 163, fTmpC*fC0 );
+		out( 149, fTmpC*fS0 );
+		fTmpA = 2.371708245126284f*fZ*fTmpC + -0.9640268803757269f*fTmpB;
+		out( 189, fTmpA*fC0 );
+		out( 175, fTmpA*fS0 );
+		fC1 = fX*fC0 - fY*fS0;
+		fS1 = fX*fS0 + fY*fC0;
+
+		fTmpA = 0.72892666017483f;
+		out( 80, fTmpA*fC1 );
+		out( 64, fTmpA*fS1 );
+		fTmpB = 3.177317648954698f*fZ;
+		out( 98, fTmpB*fC1 );
+		out( 82, fTmpB*fS1 );
+		fTmpC = 10.57781172168795f*fZ2 + -0.5567269327204184f;
+		out( 118, fTmpC*fC1 );
+		out( 102, fTmpC*fS1 );
+		fTmpA = fZ*( 30.79157970335749f*fZ2 + -4.398797100479641f );
+		out( 140, fTmpA*fC1 );
+		out( 124, fTmpA*fS1 );
+		fTmpB = 2.680951323690902f*fZ*fTmpA + -0.9209854970162591f*fTmpC;
+		out( 164, fTmpB*fC1 );
+		out( 148, fTmpB*fS1 );
+		fTmpC = 2.53546276418555f*fZ*fTmpB + -0.9457324874869209f*fTmpA;
+		out( 190, fTmpC*fC1 );
+		out( 174, fTmpC*fS1 );
+		fC0 = fX*fC1 - fY*fS1;
+		fS0 = fX*fS1 + fY*fC1;
+
+		fTmpA = -0.7489009518531884f;
+		out( 99, fTmpA*fC0 );
+		out( 81, fTmpA*fS0 );
+		fTmpB = -3.431895299891715f*fZ;
+		out( 119, fTmpB*fC0 );
+		out( 101, fTmpB*fS0 );
+		fTmpC = -11.92552753945219f*fZ2 + 0.5678822637834374f;
+		out( 141, fTmpC*fC0 );
+		out( 123, fTmpC*fS0 );
+		fTmpA = fZ*( -36.02809068931077f*fZ2 + 4.699316176866623f );
+		out( 165, fTmpA*fC0 );
+		out( 147, fTmpA*fS0 );
+		fTmpB = 2.769558547034986f*fZ*fTmpA + -0.9167415228748209f*fTmpC;
+		out( 191, fTmpB*fC0 );
+		out( 173, fTmpB*fS0 );
+		fC1 = fX*fC0 - fY*fS0;
+		fS1 = fX*fS0 + fY*fC0;
+
+		fTmpA = 0.7673951182219901f;
+		out( 120, fTmpA*fC1 );
+		out( 100, fTmpA*fS1 );
+		fTmpB = 3.680297698805312f*fZ;
+		out( 142, fTmpB*fC1 );
+		out( 122, fTmpB*fS1 );
+		fTmpC = 13.30425420025764f*fZ2 + -0.5784458347938103f;
+		out( 166, fTmpC*fC1 );
+		out( 146, fTmpC*fS1 );
+		fTmpA = fZ*( 41.61193153549645f*fZ2 + -4.993431784259574f );
+		out( 192, fTmpA*fC1 );
+		out( 172, fTmpA*fS1 );
+		fC0 = fX*fC1 - fY*fS1;
+		fS0 = fX*fS1 + fY*fC1;
+
+		fTmpA = -0.7846421057871971f;
+		out( 143, fTmpA*fC0 );
+		out( 121, fTmpA*fS0 );
+		fTmpB = -3.923210528935984f*fZ;
+		out( 167, fTmpB*fC0 );
+		out( 145, fTmpB*fS0 );
+		fTmpC = -14.71203948350994f*fZ2 + 0.5884815793403977f;
+		out( 193, fTmpC*fC0 );
+		out( 171, fTmpC*fS0 );
+		fC1 = fX*fC0 - fY*fS0;
+		fS1 = fX*fS0 + fY*fC0;
+
+		fTmpA = 0.8008219957839717f;
+		out( 168, fTmpA*fC1 );
+		out( 144, fTmpA*fS1 );
+		fTmpB = 4.161193153549645f*fZ;
+		out( 194, fTmpB*fC1 );
+		out( 170, fTmpB*fS1 );
+		fC0 = fX*fC1 - fY*fS1;
+		fS0 = fX*fS1 + fY*fC1;
+
+		fTmpC = -0.8160771188376284f;
+		out( 195, fTmpC*fC0 );
+		out( 169, fTmpC*fS0 );
+	}
+};
+
+// order 15
+template<>
+struct SHKernel<15>
+{
+	template<typename T, typename O>
+	static FORCEINLINE void Eval( const T fX, const T fY, const T fZ, const O &out )
+	{
+		T fC0, fC1, fS0, fS1, fTmpA, fTmpB, fTmpC;
+		T fZ2 = fZ*fZ;
+
+		out( 0, 0.2820947917738781f );
+		out( 2, 0.4886025119029199f*fZ );
+		const T fP6 = 0.9461746957575601f*fZ2 + -0.3153915652525201f;
+		out( 6, fP6 );
+		const T fP12 = fZ*( 1.865881662950577f*fZ2 + -1.119528997770346f );
+		out( 12, fP12 );
+		const T fP20 = 1.984313483298443f*fZ*fP12 + -1.006230589874905f*fP6;
+		out( 20, fP20 );
+		const T fP30 = 1.98997487421324f*fZ*fP20 + -1.002853072844814f*fP12;
+		out( 30, fP30 );
+		const T fP42 = 1.993043457183567f*fZ*fP30 + -1.001542020962219f*fP20;
+		out( 42, fP42 );
+		const T fP56 = 1.994891434824135f*fZ*fP42 + -1.000927213921958f*fP30;
+		out( 56, fP56 );
+		const T fP72 = 1.996089927833914f*fZ*fP56 + -1.000600781069515f*fP42;
+		out( 72, fP72 );
+		const T fP90 = 1.996911195067937f*fZ*fP72 + -1.000411437993134f*fP56;
+		out( 90, fP90 );
+		const T fP110 = 1.997498435543818f*fZ*fP90 + -1.00029407440718f*fP72;
+		out( 110, fP110 );
+		const T fP132 = 1.997932815985082f*fZ*fP110 + -1.000217462218511f*fP90;
+		out( 132, fP132 );
+		const T fP156 = 1.998263134713633f*fZ*fP132 + -1.000165330248298f*fP110;
+		out( 156, fP156 );
+		const T fP182 = 1.998520162579474f*fZ*fP156 + -1.000128625635621f*fP132;
+		out( 182, fP182 );
+		out( 210, 1.998724082804747f*fZ*fP182 + -1.000102035610694f*fP156 );
+		fC0 = fX;
+		fS0 = fY;
+
+		fTmpA = -0.48860251190292f;
+		out( 3, fTmpA*fC0 );
+		out( 1, fTmpA*fS0 );
+		fTmpB = -1.092548430592079f*fZ;
+		out( 7, fTmpB*fC0 );
+		out( 5, fTmpB*fS0 );
+		fTmpC = -2.285228997322329f*fZ2 + 0.4570457994644658f;
+		out( 13, fTmpC*fC0 );
+		out( 11, fTmpC*fS0 );
+		fTmpA = fZ*( -4.683325804901025f*fZ2 + 2.007139630671868f );
+		out( 21, fTmpA*fC0 );
+		out( 19, fTmpA*fS0 );
+		fTmpB = 2.03100960115899f*fZ*fTmpA + -0.991031208965115f*fTmpC;
+		out( 31, fTmpB*fC0 );
+		out( 29, fTmpB*fS0 );
+		fTmpC = 2.021314989237028f*fZ*fTmpB + -0.9952267030562385f*fTmpA;
+		out( 43, fTmpC*fC0 );
+		out( 41, fTmpC*fS0 );
+		fTmpA = 2.015564437074638f*fZ*fTmpC + -0.9971550440218319f*fTmpB;
+		out( 57, fTmpA*fC0 );
+		out( 55, fTmpA*fS0 );
+		fTmpB = 2.011869540407391f*fZ*fTmpA + -0.9981668178901745f*fTmpC;
+		out( 73, fTmpB*fC0 );
+		out( 71, fTmpB*fS0 );
+		fTmpC = 2.009353129741012f*fZ*fTmpB + -0.9987492177719088f*fTmpA;
+		out( 91, fTmpC*fC0 );
+		out( 89, fTmpC*fS0 );
+		fTmpA = 2.007561463642653f*fZ*fTmpC + -0.9991083368712843f*fTmpB;
+		out( 111, fTmpA*fC0 );
+		out( 109, fTmpA*fS0 );
+		fTmpB = 2.006240264773888f*fZ*fTmpA + -0.9993418887079215f*fTmpC;
+		out( 133, fTmpB*fC0 );
+		out( 131, fTmpB*fS0 );
+		fTmpC = 2.005237896355199f*fZ*fTmpB + -0.9995003746877732f*fTmpA;
+		out( 157, fTmpC*fC0 );
+		out( 155, fTmpC*fS0 );
+		fTmpA = 2.004459314343183f*fZ*fTmpC + -0.9996117258638336f*fTmpB;
+		out( 183, fTmpA*fC0 );
+		out( 181, fTmpA*fS0 );
+		fTmpB = 2.003842462716222f*fZ*fTmpA + -0.9996922603404586f*fTmpC;
+		out( 211, fTmpB*fC0 );
+		out( 209, fTmpB*fS0 );
+		fC1 = fX*fC0 - fY*fS0;
+		fS1 = fX*fS0 + fY*fC0;
+
+		fTmpA = 0.5462742152960395f;
+		out( 8, fTmpA*fC1 );
+		out( 4, fTmpA*fS1 );
+		fTmpB = 1.445305721320277f*fZ;
+		out( 14, fTmpB*fC1 );
+		out( 10, fTmpB*fS1 );
+		fTmpC = 3.31161143515146f*fZ2 + -0.47308734787878f;
+		out( 22, fTmpC*fC1 );
+		out( 18, fTmpC*fS1 );
+		fTmpA = fZ*( 7.190305177459987f*fZ2 + -2.396768392486662f );
+		out( 32, fTmpA*fC1 );
+		out( 28, fTmpA*fS1 );
+		fTmpB = 2.11394181566097f*fZ*fTmpA + -0.9736101204623268f*fTmpC;
+		out( 44, fTmpB*fC1 );
+		out( 40, fTmpB*fS1 );
+		fTmpC = 2.081665999466133f*fZ*fTmpB + -0.9847319278346618f*fTmpA;
+		out( 58, fTmpC*fC1 );
+		out( 54, fTmpC*fS1 );
+		fTmpA = 2.06155281280883f*fZ*fTmpC + -0.9903379376602873f*fTmpB;
+		out( 74, fTmpA*fC1 );
+		out( 70, fTmpA*fS1 );
+		fTmpB = 2.048122358357819f*fZ*fTmpA + -0.9934852726704042f*fTmpC;
+		out( 92, fTmpB*fC1 );
+		out( 88, fTmpB*fS1 );
+		fTmpC = 2.038688303787511f*fZ*fTmpB + -0.9953938032404119f*fTmpA;
+		out( 112, fTmpC*fC1 );
+		out( 108, fTmpC*fS1 );
+		fTmpA = 2.031798495964875f*fZ*fTmpC + -0.9966204702259603f*fTmpB;
+		out( 134, fTmpA*fC1 );
+		out( 130, fTmpA*fS1 );
+		fTmpB = 2.026608708444444f*fZ*fTmpA + -0.9974457174120671f*fTmpC;
+		out( 158, fTmpB*fC1 );
+		out( 154, fTmpB*fS1 );
+		fTmpC = 2.022599587389726f*fZ*fTmpB + -0.9980217586956907f*fTmpA;
+		out( 184, fTmpC*fC1 );
+		out( 180, fTmpC*fS1 );
+		fTmpA = 2.019436802675439f*fZ*fTmpC + -0.998436277385793f*fTmpB;
+		out( 212, fTmpA*fC1 );
+		out( 208, fTmpA*fS1 );
+		fC0 = fX*fC1 - fY*fS1;
+		fS0 = fX*fS1 + fY*fC1;
+
+		fTmpA = -0.5900435899266435f;
+		out( 15, fTmpA*fC0 );
+		out( 9, fTmpA*fS0 );
+		fTmpB = -1.770130769779931f*fZ;
+		out( 23, fTmpB*fC0 );
+		out( 17, fTmpB*fS0 );
+		fTmpC = -4.403144694917254f*fZ2 + 0.4892382994352505f;
+		out( 33, fTmpC*fC0 );
+		out( 27, fTmpC*fS0 );
+		fTmpA = fZ*( -10.13325785466416f*fZ2 + 2.763615778544771f );
+		out( 45, fTmpA*fC0 );
+		out( 39, fTmpA*fS0 );
+		fTmpB = 2.207940216581962f*fZ*fTmpA + -0.959403223600247f*fTmpC;
+		out( 59, fTmpB*fC0 );
+		out( 53, fTmpB*fS0 );
+		fTmpC = 2.15322168769582f*fZ*fTmpB + -0.9752173865600178f*fTmpA;
+		out( 75, fTmpC*fC0 );
+		out( 69, fTmpC*fS0 );
+		fTmpA = 2.118044171189805f*fZ*fTmpC + -0.9836628449792094f*fTmpB;
+		out( 93, fTmpA*fC0 );
+		out( 87, fTmpA*fS0 );
+		fTmpB = 2.093947321356338f*fZ*fTmpA + -0.9886230654859614f*fTmpC;
+		out( 113, fTmpB*fC0 );
+		out( 107, fTmpB*fS0 );
+		fTmpC = 2.076655965729519f*fZ*fTmpB + -0.9917422203269092f*fTmpA;
+		out( 135, fTmpC*fC0 );
+		out( 129, fTmpC*fS0 );
+		fTmpA = 2.063797291222968f*fZ*fTmpC + -0.9938079899999066f*fTmpB;
+		out( 159, fTmpA*fC0 );
+		out( 153, fTmpA*fS0 );
+		fTmpB = 2.053959590644373f*fZ*fTmpA + -0.9952332040455557f*fTmpC;
+		out( 185, fTmpB*fC0 );
+		out( 179, fTmpB*fS0 );
+		fTmpC = 2.046256527271464f*fZ*fTmpB + -0.9962496519366806f*fTmpA;
+		out( 213, fTmpC*fC0 );
+		out( 207, fTmpC*fS0 );
+		fC1 = fX*fC0 - fY*fS0;
+		fS1 = fX*fS0 + fY*fC0;
+
+		fTmpA = 0.6258357354491763f;
+		out( 24, fTmpA*fC1 );
+		out( 16, fTmpA*fS1 );
+		fTmpB = 2.075662314881041f*fZ;
+		out( 34, fTmpB*fC1 );
+		out( 26, fTmpB*fS1 );
+		fTmpC = 5.550213908015966f*fZ2 + -0.5045649007287241f;
+		out( 46, fTmpC*fC1 );
+		out( 38, fTmpC*fS1 );
+		fTmpA = fZ*( 13.49180504672677f*fZ2 + -3.113493472321562f );
+		out( 60, fTmpA*fC1 );
+		out( 52, fTmpA*fS1 );
+		fTmpB = 2.304886114323221f*fZ*fTmpA + -0.9481763873554654f*fTmpC;
+		out( 76, fTmpB*fC1 );
+		out( 68, fTmpB*fS1 );
+		fTmpC = 2.229177150706235f*fZ*fTmpB + -0.9671528397231821f*fTmpA;
+		out( 94, fTmpC*fC1 );
+		out( 86, fTmpC*fS1 );
+		fTmpA = 2.179449471770337f*fZ*fTmpC + -0.9776923610938036f*fTmpB;
+		out( 114, fTmpA*fC1 );
+		out( 106, fTmpA*fS1 );
+		fTmpB = 2.144761058952722f*fZ*fTmpA + -0.9840838646332836f*fTmpC;
+		out( 136, fTmpB*fC1 );
+		out( 128, fTmpB*fS1 );
+		fTmpC = 2.119478119726646f*fZ*fTmpB + -0.9882117688026186f*fTmpA;
+		out( 160, fTmpC*fC1 );
+		out( 152, fTmpC*fS1 );
+		fTmpA = 2.100420126042015f*fZ*fTmpC + -0.9910081668184009f*fTmpB;
+		out( 186, fTmpA*fC1 );
+		out( 178, fTmpA*fS1 );
+		fTmpB = 2.085665361461421f*fZ*fTmpA + -0.9929753269845127f*fTmpC;
+		out( 214, fTmpB*fC1 );
+		out( 206, fTmpB*fS1 );
+		fC0 = fX*fC1 - fY*fS1;
+		fS0 = fX*fS1 + fY*fC1;
+
+		fTmpA = -0.6563820568401703f;
+		out( 35, fTmpA*fC0 );
+		out( 25, fTmpA*fS0 );
+		fTmpB = -2.366619162231753f*fZ;
+		out( 47, fTmpB*fC0 );
+		out( 37, fTmpB*fS0 );
+		fTmpC = -6.745902523363385f*fZ2 + 0.5189155787202604f;
+		out( 61, fTmpC*fC0 );
+		out( 51, fTmpC*fS0 );
+		fTmpA = fZ*( -17.24955311049054f*fZ2 + 3.449910622098108f );
+		out( 77, fTmpA*fC0 );
+		out( 67, fTmpA*fS0 );
+		fTmpB = 2.401636346922062f*fZ*fTmpA + -0.9392246042043708f*fTmpC;
+		out( 95, fTmpB*fC0 );
+		out( 85, fTmpB*fS0 );
+		fTmpC = 2.306512518934159f*fZ*fTmpB + -0.9603920767980496f*fTmpA;
+		out( 115, fTmpC*fC0 );
+		out( 105, fTmpC*fS0 );
+		fTmpA = 2.243044805615795f*fZ*fTmpC + -0.9724832565193738f*fTmpB;
+		out( 137, fTmpA*fC0 );
+		out( 127, fTmpA*fS0 );
+		fTmpB = 2.198165774710643f*fZ*fTmpA + -0.9799919151000504f*fTmpC;
+		out( 161, fTmpB*fC0 );
+		out( 151, fTmpB*fS0 );
+		fTmpC = 2.165063509461097f*fZ*fTmpB + -0.9849409604906143f*fTmpA;
+		out( 187, fTmpC*fC0 );
+		out( 177, fTmpC*fS0 );
+		fTmpA = 2.139847510553276f*fZ*fTmpC + -0.9883532289941477f*fTmpB;
+		out( 215, fTmpA*fC0 );
+		out( 205, fTmpA*fS0 );
+		fC1 = fX*fC0 - fY*fS0;
+		fS1 = fX*fS0 + fY*fC0;
+
+		fTmpA = 0.6831841051919144f;
+		out( 48, fTmpA*fC1 );
+		out( 36, fTmpA*fS1 );
+		fTmpB = 2.645960661801901f*fZ;
+		out( 62, fTmpB*fC1 );
+		out( 50, fTmpB*fS1 );
+		fTmpC = 7.984991490893139f*fZ2 + -0.5323327660595426f;
+		out( 78, fTmpC*fC1 );
+		out( 66, fTmpC*fS1 );
+		fTmpA = fZ*( 21.39289019090864f*fZ2 + -3.775215916042701f );
+		out( 96, fTmpA*fC1 );
+		out( 84, fTmpA*fS1 );
+		fTmpB = 2.496873044429773f*fZ*fTmpA + -0.9319689782769534f*fTmpC;
+		out( 116, fTmpB*fC1 );
+		out( 104, fTmpB*fS1 );
+		fTmpC = 2.383768642544085f*fZ*fTmpB + -0.9547015807880142f*fTmpA;
+		out( 138, fTmpC*fC1 );
+		out( 126, fTmpC*fS1 );
+		fTmpA = 2.307395517477243f*fZ*fTmpC + -0.9679611839405133f*fTmpB;
+		out( 162, fTmpA*fC1 );
+		out( 150, fTmpA*fS1 );
+		fTmpB = 2.252817784447915f*fZ*fTmpA + -0.9763466069791972f*fTmpC;
+		out( 188, fTmpB*fC1 );
+		out( 176, fTmpB*fS1 );
+		fTmpC = 2.212182180562893f*fZ*fTmpB + -0.9819623210693983f*fTmpA;
+		out( 216, fTmpC*fC1 );
+		out( 204, fTmpC*fS1 );
+		fC0 = fX*fC1 - fY*fS1;
+		fS0 = fX*fS1 + fY*fC1;
+
+		fTmpA = -0.7071627325245963f;
+		out( 63, fTmpA*fC0 );
+		out( 49, fTmpA*fS0 );
+		fTmpB = -2.91570664069932f*fZ;
+		out( 79, fTmpB*fC0 );
+		out( 65, fTmpB*fS0 );
+		fTmpC = -9.263393182848905f*fZ2 + 0.5449054813440533f;
+		out( 97, fTmpC*fC0 );
+		out( 83, fTmpC*fS0 );
+		fTmpA = fZ*( -25.9102413133663f*fZ2 + 4.091090733689416f );
+		out( 117, fTmpA*fC0 );
+		out( 103, fTmpA*fS0 );
+		fTmpB = 2.590045044653342f*fZ*fTmpA + -0.9259892765852515f*fTmpC;
+		out( 139, fTmpB*fC0 );
+		out( 125, fTmpB*fS0 );
+		fTmpC = 2.460209661583209f*fZ*fTmpB + -0.9498713802919554f*fTmpA;
+		out( 163, fTmpC*fC0 );
+		out( 149, fTmpC*fS0 );
+		fTmpA = 2.371708245126284f*fZ*fTmpC + -0.9640268803757269f*fTmpB;
+		out( 189, fTmpA*fC0 );
+		out( 175, fTmpA*fS0 );
+		fTmpB = 2.307927774486216f*fZ*fTmpA + -0.9731077923386515f*fTmpC;
+		out( 217, fTmpB*fC0 );
+		out( 203, fTmpB*fS0 );
+		fC1 = fX*fC0 - fY*fS0;
+		fS1 = fX*fS0 + fY*fC0;
+
+		fTmpA = 0.72892666017483f;
+		out( 80, fTmpA*fC1 );
+		out( 64, fTmpA*fS1 );
+		fTmpB = 3.177317648954698f*fZ;
+		out( 98, fTmpB*fC1 );
+		out( 82, fTmpB*fS1 );
+		fTmpC = 10.57781172168795f*fZ2 + -0.5567269327204184f;
+		out( 118, fTmpC*fC1 );
+		out( 102, fTmpC*fS1 );
+		fTmpA = fZ*( 30.79157970335749f*fZ2 + -4.398797100479641f );
+		out( 140, fTmpA*fC1 );
+		out( 124, fTmpA*fS1 );
+		fTmpB = 2.680951323690902f*fZ*fTmpA + -0.9209854970162591f*fTmpC;
+		out( 164, fTmpB*fC1 );
+		out( 148, fTmpB*fS1 );
+		fTmpC = 2.53546276418555f*fZ*fTmpB + -0.9457324874869209f*fTmpA;
+		out( 190, fTmpC*fC1 );
+		out( 174, fTmpC*fS1 );
+		fTmpA = 2.435532422657966f*fZ*fTmpC + -0.9605869417846947f*fTmpB;
+		out( 218, fTmpA*fC1 );
+		out( 202, fTmpA*fS1 );
+		fC0 = fX*fC1 - fY*fS1;
+		fS0 = fX*fS1 + fY*fC1;
+
+		fTmpA = -0.7489009518531884f;
+		out( 99, fTmpA*fC0 );
+		out( 81, fTmpA*fS0 );
+		fTmpB = -3.431895299891715f*fZ;
+		out( 119, fTmpB*fC0 );
+		out( 101, fTmpB*fS0 );
+		fTmpC = -11.92552753945219f*fZ2 + 0.5678822637834374f;
+		out( 141, fTmpC*fC0 );
+		out( 123, fTmpC*fS0 );
+		fTmpA = fZ*( -36.02809068931077f*fZ2 + 4.699316176866623f );
+		out( 165, fTmpA*fC0 );
+		out( 147, fTmpA*fS0 );
+		fTmpB = 2.769558547034986f*fZ*fTmpA + -0.9167415228748209f*fTmpC;
+		out( 191, fTmpB*fC0 );
+		out( 173, fTmpB*fS0 );
+		fTmpC = 2.609347744585592f*fZ*fTmpB + -0.9421529461361585f*fTmpA;
+		out( 219, fTmpC*fC0 );
+		out( 201, fTmpC*fS0 );
+		fC1 = fX*fC0 - fY*fS0;
+		fS1 = fX*fS0 + fY*fC0;
+
+		fTmpA = 0.7673951182219901f;
+		out( 120, fTmpA*fC1 );
+		out( 100, fTmpA*fS1 );
+		fTmpB = 3.680297698805312f*fZ;
+		out( 142, fTmpB*fC1 );
+		out( 122, fTmpB*fS1 );
+		fTmpC = 13.30425420025764f*fZ2 + -0.5784458347938103f;
+		out( 166, fTmpC*fC1 );
+		out( 146, fTmpC*fS1 );
+		fTmpA = fZ*( 41.61193153549645f*fZ2 + -4.993431784259574f );
+		out( 192, fTmpA*fC1 );
+		out( 172, fTmpA*fS1 );
+		fTmpB = 2.855914914698966f*fZ*fTmpA + -0.9130991183874837f*fTmpC;
+		out( 220, fTmpB*fC1 );
+		out( 200, fTmpB*fS1 );
+		fC0 = fX*fC1 - fY*fS1;
+		fS0 = fX*fS1 + fY*fC1;
+
+		fTmpA = -0.7846421057871971f;
+		out( 143, fTmpA*fC0 );
+		out( 121, fTmpA*fS0 );
+		fTmpB = -3.923210528935984f*fZ;
+		out( 167, fTmpB*fC0 );
+		out( 145, fTmpB*fS0 );
+		fTmpC = -14.71203948350994f*fZ2 + 0.5884815793403977f;
+		out( 193, fTmpC*fC0 );
+		out( 171, fTmpC*fS0 );
+		fTmpA = fZ*( -47.53605436066262f*fZ2 + 5.281783817851402f );
+		out( 221, fTmpA*fC0 );
+		out( 199, fTmpA*fS0 );
+		fC1 = fX*fC0 - fY*fS0;
+		fS1 = fX*fS0 + fY*fC0;
+
+		fTmpA = 0.8008219957839717f;
+		out( 168, fTmpA*fC1 );
+		out( 144, fTmpA*fS1 );
+		fTmpB = 4.161193153549645f*fZ;
+		out( 194, fTmpB*fC1 );
+		out( 170, fTmpB*fS1 );
+		fTmpC = 16.1471947939282f*fZ2 + -0.5980442516269705f;
+		out( 222, fTmpC*fC1 );
+		out( 198, fTmpC*fS1 );
+		fC0 = fX*fC1 - fY*fS1;
+		fS0 = fX*fS1 + fY*fC1;
+
+		fTmpA = -0.8160771188376284f;
+		out( 195, fTmpA*fC0 );
+		out( 169, fTmpA*fS0 );
+		fTmpB = -4.394709780272119f*fZ;
+		out( 223, fTmpB*fC0 );
+		out( 197, fTmpB*fS0 );
+		fC1 = fX*fC0 - fY*fS0;
+		fS1 = fX*fS0 + fY*fC0;
+
+		fTmpC = 0.830522083064524f;
+		out( 224, fTmpC*fC1 );
+		out( 196, fTmpC*fS1 );
+	}
+};
+
+// order 16
+template<>
+struct SHKernel<16>
+{
+	template<typename T, typename O>
+	static FORCEINLINE void Eval( const T fX, const T fY, const T fZ, const O &out )
+	{
+		T fC0, fC1, fS0, fS1, fTmpA, fTmpB, fTmpC;
+		T fZ2 = fZ*fZ;
+
+		out( 0, 0.2820947917738781f );
+		out( 2, 0.4886025119029199f*fZ );
+		const T fP6 = 0.9461746957575601f*fZ2 + -0.3153915652525201f;
+		out( 6, fP6 );
+		const T fP12 = fZ*( 1.865881662950577f*fZ2 + -1.119528997770346f );
+		out( 12, fP12 );
+		const T fP20 = 1.984313483298443f*fZ*fP12 + -1.006230589874905f*fP6;
+		out( 20, fP20 );
+		const T fP30 = 1.98997487421324f*fZ*fP20 + -1.002853072844814f*fP12;
+		out( 30, fP30 );
+		const T fP42 = 1.993043457183567f*fZ*fP30 + -1.001542020962219f*fP20;
+		out( 42, fP42 );
+		const T fP56 = 1.994891434824135f*fZ*fP42 + -1.000927213921958f*fP30;
+		out( 56, fP56 );
+		const T fP72 = 1.996089927833914f*fZ*fP56 + -1.000600781069515f*fP42;
+		out( 72, fP72 );
+		const T fP90 = 1.996911195067937f*fZ*fP72 + -1.000411437993134f*fP56;
+		out( 90, fP90 );
+		const T fP110 = 1.997498435543818f*fZ*fP90 + -1.00029407440718f*fP72;
+		out( 110, fP110 );
+		const T fP132 = 1.997932815985082f*fZ*fP110 + -1.000217462218511f*fP90;
+		out( 132, fP132 );
+		const T fP156 = 1.998263134713633f*fZ*fP132 + -1.000165330248298f*fP110;
+		out( 156, fP156 );
+		const T fP182 = 1.998520162579474f*fZ*fP156 + -1.000128625635621f*fP132;
+		out( 182, fP182 );
+		const T fP210 = 1.998724082804747f*fZ*fP182 + -1.000102035610694f*fP156;
+		out( 210, fP210 );
+		out( 240, 1.998888580075327f*fZ*fP210 + -1.00008230114001f*fP182 );
+		fC0 = fX;
+		fS0 = fY;
+
+		fTmpA = -0.48860251190292f;
+		out( 3, fTmpA*fC0 );
+		out( 1, fTmpA*fS0 );
+		fTmpB = -1.092548430592079f*fZ;
+		out( 7, fTmpB*fC0 );
+		out( 5, fTmpB*fS0 );
+		fTmpC = -2.285228997322329f*fZ2 + 0.4570457994644658f;
+		out( 13, fTmpC*fC0 );
+		out( 11, fTmpC*fS0 );
+		fTmpA = fZ*( -4.683325804901025f*fZ2 + 2.007139630671868f );
+		out( 21, fTmpA*fC0 );
+		out( 19, fTmpA*fS0 );
+		fTmpB = 2.03100960115899f*fZ*fTmpA + -0.991031208965115f*fTmpC;
+		out( 31, fTmpB*fC0 );
+		out( 29, fTmpB*fS0 );
+		fTmpC = 2.021314989237028f*fZ*fTmpB + -0.9952267030562385f*fTmpA;
+		out( 43, fTmpC*fC0 );
+		out( 41, fTmpC*fS0 );
+		fTmpA = 2.015564437074638f*fZ*fTmpC + -0.9971550440218319f*fTmpB;
+		out( 57, fTmpA*fC0 );
+		out( 55, fTmpA*fS0 );
+		fTmpB = 2.011869540407391f*fZ*fTmpA + -0.9981668178901745f*fTmpC;
+		out( 73, fTmpB*fC0 );
+		out( 71, fTmpB*fS0 );
+		fTmpC = 2.009353129741012f*fZ*fTmpB + -0.9987492177719088f*fTmpA;
+		out( 91, fTmpC*fC0 );
+		out( 89, fTmpC*fS0 );
+		fTmpA = 2.007561463642653f*fZ*fTmpC + -0.9991083368712843f*fTmpB;
+		out( 111, fTmpA*fC0 );
+		out( 109, fTmpA*fS0 );
+		fTmpB = 2.006240264773888f*fZ*fTmpA + -0.9993418887079215f*fTmpC;
+		out( 133, fTmpB*fC0 );
+		out( 131, fTmpB*fS0 );
+		fTmpC = 2.005237896355199f*fZ*fTmpB + -0.9995003746877732f*fTmpA;
+		out( 157, fTmpC*fC0 );
+		out( 155, fTmpC*fS0 );
+		fTmpA = 2.004459314343183f*fZ*fTmpC + -0.9996117258638336f*fTmpB;
+		out( 183, fTmpA*fC0 );
+		out( 181, fTmpA*fS0 );
+		fTmpB = 2.003842462716222f*fZ*fTmpA + -0.9996922603404586f*fTmpC;
+		out( 211, fTmpB*fC0 );
+		out( 209, fTmpB*fS0 );
+		fTmpC = 2.003345416333104f*fZ*fTmpB + -0.9997519533634172f*fTmpA;
+		out( 241, fTmpC*fC0 );
+		out( 239, fTmpC*fS0 );
+		fC1 = fX*fC0 - fY*fS0;
+		fS1 = fX*fS0 + fY*fC0;
+
+		fTmpA = 0.5462742152960395f;
+		out( 8, fTmpA*fC1 );
+		out( 4, fTmpA*fS1 );
+		fTmpB = 1.445305721320277f*fZ;
+		out( 14, fTmpB*fC1 );
+		out( 10, fTmpB*fS1 );
+		fTmpC = 3.31161143515146f*fZ2 + -0.47308734787878f;
+		out( 22, fTmpC*fC1 );
+		out( 18, fTmpC*fS1 );
+		fTmpA = fZ*( 7.190305177459987f*fZ2 + -2.396768392486662f );
+		out( 32, fTmpA*fC1 );
+		out( 28, fTmpA*fS1 );
+		fTmpB = 2.11394181566097f*fZ*fTmpA + -0.9736101204623268f*fTmpC;
+		out( 44, fTmpB*fC1 );
+		out( 40, fTmpB*fS1 );
+		fTmpC = 2.081665999466133f*fZ*fTmpB + -0.9847319278346618f*fTmpA;
+		out( 58, fTmpC*fC1 );
+		out( 54, fTmpC*fS1 );
+		fTmpA = 2.06155281280883f*fZ*fTmpC + -0.9903379376602873f*fTmpB;
+		out( 74, fTmpA*fC1 );
+		out( 70, fTmpA*fS1 );
+		fTmpB = 2.048122358357819f*fZ*fTmpA + -0.9934852726704042f*fTmpC;
+		out( 92, fTmpB*fC1 );
+		out( 88, fTmpB*fS1 );
+		fTmpC = 2.038688303787511f*fZ*fTmpB + -0.9953938032404119f*fTmpA;
+		out( 112, fTmpC*fC1 );
+		out( 108, fTmpC*fS1 );
+		fTmpA = 2.031798495964875f*fZ*fTmpC + -0.9966204702259603f*fTmpB;
+		out( 134, fTmpA*fC1 );
+		out( 130, fTmpA*fS1 );
+		fTmpB = 2.026608708444444f*fZ*fTmpA + -0.9974457174120671f*fTmpC;
+		out( 158, fTmpB*fC1 );
+		out( 154, fTmpB*fS1 );
+		fTmpC = 2.022599587389726f*fZ*fTmpB + -0.9980217586956907f*fTmpA;
+		out( 184, fTmpC*fC1 );
+		out( 180, fTmpC*fS1 );
+		fTmpA = 2.019436802675439f*fZ*fTmpC + -0.998436277385793f*fTmpB;
+		out( 212, fTmpA*fC1 );
+		out( 208, fTmpA*fS1 );
+		fTmpB = 2.016896949069888f*fZ*fTmpA + -0.998742296068792f*fTmpC;
+		out( 242, fTmpB*fC1 );
+		out( 238, fTmpB*fS1 );
+		fC0 = fX*fC1 - fY*fS1;
+		fS0 = fX*fS1 + fY*fC1;
+
+		fTmpA = -0.5900435899266435f;
+		out( 15, fTmpA*fC0 );
+		out( 9, fTmpA*fS0 );
+		fTmpB = -1.770130769779931f*fZ;
+		out( 23, fTmpB*fC0 );
+		out( 17, fTmpB*fS0 );
+		fTmpC = -4.403144694917254f*fZ2 + 0.4892382994352505f;
+		out( 33, fTmpC*fC0 );
+		out( 27, fTmpC*fS0 );
+		fTmpA = fZ*( -10.13325785466416f*fZ2 + 2.763615778544771f );
+		out( 45, fTmpA*fC0 );
+		out( 39, fTmpA*fS0 );
+		fTmpB = 2.207940216581962f*fZ*fTmpA + -0.959403223600247f*fTmpC;
+		out( 59, fTmpB*fC0 );
+		out( 53, fTmpB*fS0 );
+		fTmpC = 2.15322168769582f*fZ*fTmpB + -0.9752173865600178f*fTmpA;
+		out( 75, fTmpC*fC0 );
+		out( 69, fTmpC*fS0 );
+		fTmpA = 2.118044171189805f*fZ*fTmpC + -0.9836628449792094f*fTmpB;
+		out( 93, fTmpA*fC0 );
+		out( 87, fTmpA*fS0 );
+		fTmpB = 2.093947321356338f*fZ*fTmpA + -0.9886230654859614f*fTmpC;
+		out( 113, fTmpB*fC0 );
+		out( 107, fTmpB*fS0 );
+		fTmpC = 2.076655965729519f*fZ*fTmpB + -0.9917422203269092f*fTmpA;
+		out( 135, fTmpC*fC0 );
+		out( 129, fTmpC*fS0 );
+		fTmpA = 2.063797291222968f*fZ*fTmpC + -0.9938079899999066f*fTmpB;
+		out( 159, fTmpA*fC0 );
+		out( 153, fTmpA*fS0 );
+		fTmpB = 2.053959590644373f*fZ*fTmpA + -0.9952332040455557f*fTmpC;
+		out( 185, fTmpB*fC0 );
+		out( 179, fTmpB*fS0 );
+		fTmpC = 2.046256527271464f*fZ*fTmpB + -0.9962496519366806f*fTmpA;
+		out( 213, fTmpC*fC0 );
+		out( 207, fTmpC*fS0 );
+		fTmpA = 2.040107114108727f*fZ*fTmpC + -0.9969947985109489f*fTmpB;
+		out( 243, fTmpA*fC0 );
+		out( 237, fTmpA*fS0 );
+		fC1 = fX*fC0 - fY*fS0;
+		fS1 = fX*fS0 + fY*fC0;
+
+		fTmpA = 0.6258357354491763f;
+		out( 24, fTmpA*fC1 );
+		out( 16, fTmpA*fS1 );
+		fTmpB = 2.075662314881041f*fZ;
+		out( 34, fTmpB*fC1 );
+		out( 26, fTmpB*fS1 );
+		fTmpC = 5.550213908015966f*fZ2 + -0.5045649007287241f;
+		out( 46, fTmpC*fC1 );
+		out( 38, fTmpC*fS1 );
+		fTmpA = fZ*( 13.49180504672677f*fZ2 + -3.113493472321562f );
+		out( 60, fTmpA*fC1 );
+		out( 52, fTmpA*fS1 );
+		fTmpB = 2.304886114323221f*fZ*fTmpA + -0.9481763873554654f*fTmpC;
+		out( 76, fTmpB*fC1 );
+		out( 68, fTmpB*fS1 );
+		fTmpC = 2.229177150706235f*fZ*fTmpB + -0.9671528397231821f*fTmpA;
+		out( 94, fTmpC*fC1 );
+		out( 86, fTmpC*fS1 );
+		fTmpA = 2.179449471770337f*fZ*fTmpC + -0.9776923610938036f*fTmpB;
+		out( 114, fTmpA*fC1 );
+		out( 106, fTmpA*fS1 );
+		fTmpB = 2.144761058952722f*fZ*fTmpA + -0.9840838646332836f*fTmpC;
+		out( 136, fTmpB*fC1 );
+		out( 128, fTmpB*fS1 );
+		fTmpC = 2.119478119726646f*fZ*fTmpB + -0.9882117688026186f*fTmpA;
+		out( 160, fTmpC*fC1 );
+		out( 152, fTmpC*fS1 );
+		fTmpA = 2.100420126042015f*fZ*fTmpC + -0.9910081668184009f*fTmpB;
+		out( 186, fTmpA*fC1 );
+		out( 178, fTmpA*fS1 );
+		fTmpB = 2.085665361461421f*fZ*fTmpA + -0.9929753269845127f*fTmpC;
+		out( 214, fTmpB*fC1 );
+		out( 206, fTmpB*fS1 );
+		fTmpC = 2.073990213742235f*fZ*fTmpB + -0.9944021951292297f*fTmpA;
+		out( 244, fTmpC*fC1 );
+		out( 236, fTmpC*fS1 );
+		fC0 = fX*fC1 - fY*fS1;
+		fS0 = fX*fS1 + fY*fC1;
+
+		fTmpA = -0.6563820568401703f;
+		out( 35, fTmpA*fC0 );
+		out( 25, fTmpA*fS0 );
+		fTmpB = -2.366619162231753f*fZ;
+		out( 47, fTmpB*fC0 );
+		out( 37, fTmpB*fS0 );
+		fTmpC = -6.745902523363385f*fZ2 + 0.5189155787202604f;
+		out( 61, fTmpC*fC0 );
+		out( 51, fTmpC*fS0 );
+		fTmpA = fZ*( -17.24955311049054f*fZ2 + 3.449910622098108f );
+		out( 77, fTmpA*fC0 );
+		out( 67, fTmpA*fS0 );
+		fTmpB = 2.401636346922062f*fZ*fTmpA + -0.9392246042043708f*fTmpC;
+		out( 95, fTmpB*fC0 );
+		out( 85, fTmpB*fS0 );
+		fTmpC = 2.306512518934159f*fZ*fTmpB + -0.9603920767980496f*fTmpA;
+		out( 115, fTmpC*fC0 );
+		out( 105, fTmpC*fS0 );
+		fTmpA = 2.243044805615795f*fZ*fTmpC + -0.9724832565193738f*fTmpB;
+		out( 137, fTmpA*fC0 );
+		out( 127, fTmpA*fS0 );
+		fTmpB = 2.198165774710643f*fZ*fTmpA + -0.9799919151000504f*fTmpC;
+		out( 161, fTmpB*fC0 );
+		out( 151, fTmpB*fS0 );
+		fTmpC = 2.165063509461097f*fZ*fTmpB + -0.9849409604906143f*fTmpA;
+		out( 187, fTmpC*fC0 );
+		out( 177, fTmpC*fS0 );
+		fTmpA = 2.139847510553276f*fZ*fTmpC + -0.9883532289941477f*fTmpB;
+		out( 215, fTmpA*fC0 );
+		out( 205, fTmpA*fS0 );
+		fTmpB = 2.120141504711419f*fZ*fTmpA + -0.99079092984679f*fTmpC;
+		out( 245, fTmpB*fC0 );
+		out( 235, fTmpB*fS0 );
+		fC1 = fX*fC0 - fY*fS0;
+		fS1 = fX*fS0 + fY*fC0;
+
+		fTmpA = 0.6831841051919144f;
+		out( 48, fTmpA*fC1 );
+		out( 36, fTmpA*fS1 );
+		fTmpB = 2.645960661801901f*fZ;
+		out( 62, fTmpB*fC1 );
+		out( 50, fTmpB*fS1 );
+		fTmpC = 7.984991490893139f*fZ2 + -0.5323327660595426f;
+		out( 78, fTmpC*fC1 );
+		out( 66, fTmpC*fS1 );
+		fTmpA = fZ*( 21.39289019090864f*fZ2 + -3.775215916042701f );
+		out( 96, fTmpA*fC1 );
+		out( 84, fTmpA*fS1 );
+		fTmpB = 2.496873044429773f*fZ*fTmpA + -0.9319689782769534f*fTmpC;
+		out( 116, fTmpB*fC1 );
+		out( 104, fTmpB*fS1 );
+		fTmpC = 2.383768642544085f*fZ*fTmpB + -0.9547015807880142f*fTmpA;
+		out( 138, fTmpC*fC1 );
+		out( 126, fTmpC*fS1 );
+		fTmpA = 2.307395517477243f*fZ*fTmpC + -0.9679611839405133f*fTmpB;
+		out( 162, fTmpA*fC1 );
+		out( 150, fTmpA*fS1 );
+		fTmpB = 2.252817784447915f*fZ*fTmpA + -0.9763466069791972f*fTmpC;
+		out( 188, fTmpB*fC1 );
+		out( 176, fTmpB*fS1 );
+		fTmpC = 2.212182180562893f*fZ*fTmpB + -0.9819623210693983f*fTmpA;
+		out( 216, fTmpC*fC1 );
+		out( 204, fTmpC*fS1 );
+		fTmpA = 2.180966243804281f*fZ*fTmpC + -0.9858890750350997f*fTmpB;
+		out( 246, fTmpA*fC1 );
+		out( 234, fTmpA*fS1 );
+		fC0 = fX*fC1 - fY*fS1;
+		fS0 = fX*fS1 + fY*fC1;
+
+		fTmpA = -0.7071627325245963f;
+		out( 63, fTmpA*fC0 );
+		out( 49, fTmpA*fS0 );
+		fTmpB = -2.91570664069932f*fZ;
+		out( 79, fTmpB*fC0 );
+		out( 65, fTmpB*fS0 );
+		fTmpC = -9.263393182848905f*fZ2 + 0.5449054813440533f;
+		out( 97, fTmpC*fC0 );
+		out( 83, fTmpC*fS0 );
+		fTmpA = fZ*( -25.9102413133663f*fZ2 + 4.091090733689416f );
+		out( 117, fTmpA*fC0 );
+		out( 103, fTmpA*fS0 );
+		fTmpB = 2.590045044653342f*fZ*fTmpA + -0.9259892765852515f*fTmpC;
+		out( 139, fTmpB*fC0 );
+		out( 125, fTmpB*fS0 );
+		fTmpC = 2.460209661583209f*fZ*fTmpB + -0.9498713802919554f*fTmpA;
+		out( 163, fTmpC*fC0 );
+		out( 149, fTmpC*fS0 );
+		fTmpA = 2.371708245126284f*fZ*fTmpC + -0.9640268803757269f*fTmpB;
+		out( 189, fTmpA*fC0 );
+		out( 175, fTmpA*fS0 );
+		fTmpB = 2.307927774486216f*fZ*fTmpA + -0.9731077923386515f*fTmpC;
+		out( 217, fTmpB*fC0 );
+		out( 203, fTmpB*fS0 );
+		fTmpC = 2.260078437898682f*fZ*fTmpB + -0.9792674029419375f*fTmpA;
+		out( 247, fTmpC*fC0 );
+		out( 233, fTmpC*fS0 );
+		fC1 = fX*fC0 - fY*fS0;
+		fS1 = fX*fS0 + fY*fC0;
+
+		fTmpA = 0.72892666017483f;
+		out( 80, fTmpA*fC1 );
+		out( 64, fTmpA*fS1 );
+		fTmpB = 3.177317648954698f*fZ;
+		out( 98, fTmpB*fC1 );
+		out( 82, fTmpB*fS1 );
+		fTmpC = 10.57781172168795f*fZ2 + -0.5567269327204184f;
+		out( 118, fTmpC*fC1 );
+		out( 102, fTmpC*fS1 );
+		fTmpA = fZ*( 30.79157970335749f*fZ2 + -4.398797100479641f );
+		out( 140, fTmpA*fC1 );
+		out( 124, fTmpA*fS1 );
+		fTmpB = 2.680951323690902f*fZ*fTmpA + -0.9209854970162591f*fTmpC;
+		out( 164, fTmpB*fC1 );
+		out( 148, fTmpB*fS1 );
+		fTmpC = 2.53546276418555f*fZ*fTmpB + -0.9457324874869209f*fTmpA;
+		out( 190, fTmpC*fC1 );
+		out( 174, fTmpC*fS1 );
+		fTmpA = 2.435532422657966f*fZ*fTmpC + -0.9605869417846947f*fTmpB;
+		out( 218, fTmpA*fC1 );
+		out( 202, fTmpA*fS1 );
+		fTmpB = 2.363017336304797f*fZ*fTmpA + -0.9702261872276653f*fTmpC;
+		out( 248, fTmpB*fC1 );
+		out( 232, fTmpB*fS1 );
+		fC0 = fX*fC1 - fY*fS1;
+		fS0 = fX*fS1 + fY*fC1;
+
+		fTmpA = -0.7489009518531884f;
+		out( 99, fTmpA*fC0 );
+		out( 81, fTmpA*fS0 );
+		fTmpB = -3.431895299891715f*fZ;
+		out( 119, fTmpB*fC0 );
+		out( 101, fTmpB*fS0 );
+		fTmpC = -11.92552753945219f*fZ2 + 0.5678822637834374f;
+		out( 141, fTmpC*fC0 );
+		out( 123, fTmpC*fS0 );
+		fTmpA = fZ*( -36.02809068931077f*fZ2 + 4.699316176866623f );
+		out( 165, fTmpA*fC0 );
+		out( 147, fTmpA*fS0 );
+		fTmpB = 2.769558547034986f*fZ*fTmpA + -0.9167415228748209f*fTmpC;
+		out( 191, fTmpB*fC0 );
+		out( 173, fTmpB*fS0 );
+		fTmpC = 2.609347744585592f*fZ*fTmpB + -0.9421529461361585f*fTmpA;
+		out( 219, fTmpC*fC0 );
+		out( 201, fTmpC*fS0 );
+		fTmpA = 2.498610725094158f*fZ*fTmpC + -0.9575614175146977f*fTmpB;
+		out( 249, fTmpA*fC0 );
+		out( 231, fTmpA*fS0 );
+		fC1 = fX*fC0 - fY*fS0;
+		fS1 = fX*fS0 + fY*fC0;
+
+		fTmpA = 0.7673951182219901f;
+		out( 120, fTmpA*fC1 );
+		out( 100, fTmpA*fS1 );
+		fTmpB = 3.680297698805312f*fZ;
+		out( 142, fTmpB*fC1 );
+		out( 122, fTmpB*fS1 );
+		fTmpC = 13.30425420025764f*fZ2 + -0.5784458347938103f;
+		out( 166, fTmpC*fC1 );
+		out( 146, fTmpC*fS1 );
+		fTmpA = fZ*( 41.61193153549645f*fZ2 + -4.993431784259574f );
+		out( 192, fTmpA*fC1 );
+		out( 172, fTmpA*fS1 );
+		fTmpB = 2.855914914698966f*fZ*fTmpA + -0.9130991183874837f*fTmpC;
+		out( 220, fTmpB*fC1 );
+		out( 200, fTmpB*fS1 );
+		fTmpC = 2.681790446697877f*fZ*fTmpB + -0.9390302326218141f*fTmpA;
+		out( 250, fTmpC*fC1 );
+		out( 230, fTmpC*fS1 );
+		fC0 = fX*fC1 - fY*fS1;
+		fS0 = fX*fS1 + fY*fC1;
+
+		fTmpA = -0.7846421057871971f;
+		out( 143, fTmpA*fC0 );
+		out( 121, fTmpA*fS0 );
+		fTmpB = -3.923210528935984f*fZ;
+		out( 167, fTmpB*fC0 );
+		out( 145, fTmpB*fS0 );
+		fTmpC = -14.71203948350994f*fZ2 + 0.5884815793403977f;
+		out( 193, fTmpC*fC0 );
+		out( 171, fTmpC*fS0 );
+		fTmpA = fZ*( -47.53605436066262f*fZ2 + 5.281783817851402f );
+		out( 221, fTmpA*fC0 );
+		out( 199, fTmpA*fS0 );
+		fTmpB = 2.940107271721691f*fZ*fTmpA + -0.9099403568319481f*fTmpC;
+		out( 251, fTmpB*fC0 );
+		out( 229, fTmpB*fS0 );
+		fC1 = fX*fC0 - fY*fS0;
+		fS1 = fX*fS0 + fY*fC0;
+
+		fTmpA = 0.8008219957839717f;
+		out( 168, fTmpA*fC1 );
+		out( 144, fTmpA*fS1 );
+		fTmpB = 4.161193153549645f*fZ;
+		out( 194, fTmpB*fC1 );
+		out( 170, fTmpB*fS1 );
+		fTmpC = 16.1471947939282f*fZ2 + -0.5980442516269705f;
+		out( 222, fTmpC*fC1 );
+		out( 198, fTmpC*fS1 );
+		fTmpA = fZ*( 53.79407212305809f*fZ2 + -5.564904012730148f );
+		out( 252, fTmpA*fC1 );
+		out( 228, fTmpA*fS1 );
+		fC0 = fX*fC1 - fY*fS1;
+		fS0 = fX*fS1 + fY*fC1;
+
+		fTmpA = -0.8160771188376284f;
+		out( 195, fTmpA*fC0 );
+		out( 169, fTmpA*fS0 );
+		fTmpB = -4.394709780272119f*fZ;
+		out( 223, fTmpB*fC0 );
+		out( 197, fTmpB*fS0 );
+		fTmpC = -17.60824338884482f*fZ2 + 0.6071808065118906f;
+		out( 253, fTmpC*fC0 );
+		out( 227, fTmpC*fS0 );
+		fC1 = fX*fC0 - fY*fS0;
+		fS1 = fX*fS0 + fY*fC0;
+
+		fTmpA = 0.830522083064524f;
+		out( 224, fTmpA*fC1 );
+		out( 196, fTmpA*fS1 );
+		fTmpB = 4.624151256630013f*fZ;
+		out( 254, fTmpB*fC1 );
+		out( 226, fTmpB*fS1 );
+		fC0 = fX*fC1 - fY*fS1;
+		fS0 = fX*fS1 + fY*fC1;
+
+		fTmpC = -0.8442506508573726f;
+		out( 255, fTmpC*fC0 );
+		out( 225, fTmpC*fS0 );
+	}
+};
+
+// order 17
+template<>
+struct SHKernel<17>
+{
+	template<typename T, typename O>
+	static FORCEINLINE void Eval( const T fX, const T fY, const T fZ, const O &out )
+	{
+		T fC0, fC1, fS0, fS1, fTmpA, fTmpB, fTmpC;
+		T fZ2 = fZ*fZ;
+
+		out( 0, 0.2820947917738781f );
+		out( 2, 0.4886025119029199f*fZ );
+		const T fP6 = 0.9461746957575601f*fZ2 + -0.3153915652525201f;
+		out( 6, fP6 );
+		const T fP12 = fZ*( 1.865881662950577f*fZ2 + -1.119528997770346f );
+		out( 12, fP12 );
+		const T fP20 = 1.984313483298443f*fZ*fP12 + -1.006230589874905f*fP6;
+		out( 20, fP20 );
+		const T fP30 = 1.98997487421324f*fZ*fP20 + -1.002853072844814f*fP12;
+		out( 30, fP30 );
+		const T fP42 = 1.993043457183567f*fZ*fP30 + -1.001542020962219f*fP20;
+		out( 42, fP42 );
+		const T fP56 = 1.994891434824135f*fZ*fP42 + -1.000927213921958f*fP30;
+		out( 56, fP56 );
+		const T fP72 = 1.996089927833914f*fZ*fP56 + -1.000600781069515f*fP42;
+		out( 72, fP72 );
+		const T fP90 = 1.996911195067937f*fZ*fP72 + -1.000411437993134f*fP56;
+		out( 90, fP90 );
+		const T fP110 = 1.997498435543818f*fZ*fP90 + -1.00029407440718f*fP72;
+		out( 110, fP110 );
+		const T fP132 = 1.997932815985082f*fZ*fP110 + -1.000217462218511f*fP90;
+		out( 132, fP132 );
+		const T fP156 = 1.998263134713633f*fZ*fP132 + -1.000165330248298f*fP110;
+		out( 156, fP156 );
+		const T fP182 = 1.998520162579474f*fZ*fP156 + -1.000128625635621f*fP132;
+		out( 182, fP182 );
+		const T fP210 = 1.998724082804747f*fZ*fP182 + -1.000102035610694f*fP156;
+		out( 210, fP210 );
+		const T fP240 = 1.998888580075327f*fZ*fP210 + -1.00008230114001f*fP182;
+		out( 240, fP240 );
+		out( 272, 1.999023198964935f*fZ*fP240 + -1.00006734687013f*fP210 );
+		fC0 = fX;
+		fS0 = fY;
+
+		fTmpA = -0.48860251190292f;
+		out( 3, fTmpA*fC0 );
+		out( 1, fTmpA*fS0 );
+		fTmpB = -1.092548430592079f*fZ;
+		out( 7, fTmpB*fC0 );
+		out( 5, fTmpB*fS0 );
+		fTmpC = -2.285228997322329f*fZ2 + 0.4570457994644658f;
+		out( 13, fTmpC*fC0 );
+		out( 11, fTmpC*fS0 );
+		fTmpA = fZ*( -4.683325804901025f*fZ2 + 2.007139630671868f );
+		out( 21, fTmpA*fC0 );
+		out( 19, fTmpA*fS0 );
+		fTmpB = 2.03100960115899f*fZ*fTmpA + -0.991031208965115f*fTmpC;
+		out( 31, fTmpB*fC0 );
+		out( 29, fTmpB*fS0 );
+		fTmpC = 2.021314989237028f*fZ*fTmpB + -0.9952267030562385f*fTmpA;
+		out( 43, fTmpC*fC0 );
+		out( 41, fTmpC*fS0 );
+		fTmpA = 2.015564437074638f*fZ*fTmpC + -0.9971550440218319f*fTmpB;
+		out( 57, fTmpA*fC0 );
+		out( 55, fTmpA*fS0 );
+		fTmpB = 2.011869540407391f*fZ*fTmpA + -0.9981668178901745f*fTmpC;
+		out( 73, fTmpB*fC0 );
+		out( 71, fTmpB*fS0 );
+		fTmpC = 2.009353129741012f*fZ*fTmpB + -0.9987492177719088f*fTmpA;
+		out( 91, fTmpC*fC0 );
+		out( 89, fTmpC*fS0 );
+		fTmpA = 2.007561463642653f*fZ*fTmpC + -0.9991083368712843f*fTmpB;
+		out( 111, fTmpA*fC0 );
+		out( 109, fTmpA*fS0 );
+		fTmpB = 2.006240264773888f*fZ*fTmpA + -0.9993418887079215f*fTmpC;
+		out( 133, fTmpB*fC0 );
+		out( 131, fTmpB*fS0 );
+		fTmpC = 2.005237896355199f*fZ*fTmpB + -0.9995003746877732f*fTmpA;
+		out( 157, fTmpC*fC0 );
+		out( 155, fTmpC*fS0 );
+		fTmpA = 2.004459314343183f*fZ*fTmpC + -0.9996117258638336f*fTmpB;
+		out( 183, fTmpA*fC0 );
+		out( 181, fTmpA*fS0 );
+		fTmpB = 2.003842462716222f*fZ*fTmpA + -0.9996922603404586f*fTmpC;
+		out( 211, fTmpB*fC0 );
+		out( 209, fTmpB*fS0 );
+		fTmpC = 2.003345416333104f*fZ*fTmpB + -0.9997519533634172f*fTmpA;
+		out( 241, fTmpC*fC0 );
+		out( 239, fTmpC*fS0 );
+		fTmpA = 2.002939017015334f*fZ*fTmpC + -0.9997971396672504f*fTmpB;
+		out( 273, fTmpA*fC0 );
+		out( 271, fTmpA*fS0 );
+		fC1 = fX*fC0 - fY*fS0;
+		fS1 = fX*fS0 + fY*fC0;
+
+		fTmpA = 0.5462742152960395f;
+		out( 8, fTmpA*fC1 );
+		out( 4, fTmpA*fS1 );
+		fTmpB = 1.445305721320277f*fZ;
+		out( 14, fTmpB*fC1 );
+		out( 10, fTmpB*fS1 );
+		fTmpC = 3.31161143515146f*fZ2 + -0.47308734787878f;
+		out( 22, fTmpC*fC1 );
+		out( 18, fTmpC*fS1 );
+		fTmpA = fZ*( 7.190305177459987f*fZ2 + -2.396768392486662f );
+		out( 32, fTmpA*fC1 );
+		out( 28, fTmpA*fS1 );
+		fTmpB = 2.11394181566097f*fZ*fTmpA + -0.9736101204623268f*fTmpC;
+		out( 44, fTmpB*fC1 );
+		out( 40, fTmpB*fS1 );
+		fTmpC = 2.081665999466133f*fZ*fTmpB + -0.9847319278346618f*fTmpA;
+		out( 58, fTmpC*fC1 );
+		out( 54, fTmpC*fS1 );
+		fTmpA = 2.06155281280883f*fZ*fTmpC + -0.9903379376602873f*fTmpB;
+		out( 74, fTmpA*fC1 );
+		out( 70, fTmpA*fS1 );
+		fTmpB = 2.048122358357819f*fZ*fTmpA + -0.9934852726704042f*fTmpC;
+		out( 92, fTmpB*fC1 );
+		out( 88, fTmpB*fS1 );
+		fTmpC = 2.038688303787511f*fZ*fTmpB + -0.9953938032404119f*fTmpA;
+		out( 112, fTmpC*fC1 );
+		out( 108, fTmpC*fS1 );
+		fTmpA = 2.031798495964875f*fZ*fTmpC + -0.9966204702259603f*fTmpB;
+		out( 134, fTmpA*fC1 );
+		out( 130, fTmpA*fS1 );
+		fTmpB = 2.026608708444444f*fZ*fTmpA + -0.9974457174120671f*fTmpC;
+		out( 158, fTmpB*fC1 );
+		out( 154, fTmpB*fS1 );
+		fTmpC = 2.022599587389726f*fZ*fTmpB + -0.9980217586956907f*fTmpA;
+		out( 184, fTmpC*fC1 );
+		out( 180, fTmpC*fS1 );
+		fTmpA = 2.019436802675439f*fZ*fTmpC + -0.998436277385793f*fTmpB;
+		out( 212, fTmpA*fC1 );
+		out( 208, fTmpA*fS1 );
+		fTmpB = 2.016896949069888f*fZ*fTmpA + -0.998742296068792f*fTmpC;
+		out( 242, fTmpB*fC1 );
+		out( 238, fTmpB*fS1 );
+		fTmpC = 2.014825999813336f*fZ*fTmpB + -0.9989732002631536f*fTmpA;
+		out( 274, fTmpC*fC1 );
+		out( 270, fTmpC*fS1 );
+		fC0 = fX*fC1 - fY*fS1;
+		fS0 = fX*fS1 + fY*fC1;
+
+		fTmpA = -0.5900435899266435f;
+		out( 15, fTmpA*fC0 );
+		out( 9, fTmpA*fS0 );
+		fTmpB = -1.770130769779931f*fZ;
+		out( 23, fTmpB*fC0 );
+		out( 17, fTmpB*fS0 );
+		fTmpC = -4.403144694917254f*fZ2 + 0.4892382994352505f;
+		out( 33, fTmpC*fC0 );
+		out( 27, fTmpC*fS0 );
+		fTmpA = fZ*( -10.13325785466416f*fZ2 + 2.763615778544771f );
+		out( 45, fTmpA*fC0 );
+		out( 39, fTmpA*fS0 );
+		fTmpB = 2.207940216581962f*fZ*fTmpA + -0.959403223600247f*fTmpC;
+		out( 59, fTmpB*fC0 );
+		out( 53, fTmpB*fS0 );
+		fTmpC = 2.15322168769582f*fZ*fTmpB + -0.9752173865600178f*fTmpA;
+		out( 75, fTmpC*fC0 );
+		out( 69, fTmpC*fS0 );
+		fTmpA = 2.118044171189805f*fZ*fTmpC + -0.9836628449792094f*fTmpB;
+		out( 93, fTmpA*fC0 );
+		out( 87, fTmpA*fS0 );
+		fTmpB = 2.093947321356338f*fZ*fTmpA + -0.9886230654859614f*fTmpC;
+		out( 113, fTmpB*fC0 );
+		out( 107, fTmpB*fS0 );
+		fTmpC = 2.076655965729519f*fZ*fTmpB + -0.9917422203269092f*fTmpA;
+		out( 135, fTmpC*fC0 );
+		out( 129, fTmpC*fS0 );
+		fTmpA = 2.063797291222968f*fZ*fTmpC + -0.9938079899999066f*fTmpB;
+		out( 159, fTmpA*fC0 );
+		out( 153, fTmpA*fS0 );
+		fTmpB = 2.053959590644373f*fZ*fTmpA + -0.9952332040455557f*fTmpC;
+		out( 185, fTmpB*fC0 );
+		out( 179, fTmpB*fS0 );
+		fTmpC = 2.046256527271464f*fZ*fTmpB + -0.9962496519366806f*fTmpA;
+		out( 213, fTmpC*fC0 );
+		out( 207, fTmpC*fS0 );
+		fTmpA = 2.040107114108727f*fZ*fTmpC + -0.9969947985109489f*fTmpB;
+		out( 243, fTmpA*fC0 );
+		out( 237, fTmpA*fS0 );
+		fTmpB = 2.035116803738375f*fZ*fTmpA + -0.9975538978635777f*fTmpC;
+		out( 275, fTmpB*fC0 );
+		out( 269, fTmpB*fS0 );
+		fC1 = fX*fC0 - fY*fS0;
+		fS1 = fX*fS0 + fY*fC0;
+
+		fTmpA = 0.6258357354491763f;
+		out( 24, fTmpA*fC1 );
+		out( 16, fTmpA*fS1 );
+		fTmpB = 2.075662314881041f*fZ;
+		out( 34, fTmpB*fC1 );
+		out( 26, fTmpB*fS1 );
+		fTmpC = 5.550213908015966f*fZ2 + -0.5045649007287241f;
+		out( 46, fTmpC*fC1 );
+		out( 38, fTmpC*fS1 );
+		fTmpA = fZ*( 13.49180504672677f*fZ2 + -3.113493472321562f );
+		out( 60, fTmpA*fC1 );
+		out( 52, fTmpA*fS1 );
+		fTmpB = 2.304886114323221f*fZ*fTmpA + -0.9481763873554654f*fTmpC;
+		out( 76, fTmpB*fC1 );
+		out( 68, fTmpB*fS1 );
+		fTmpC = 2.229177150706235f*fZ*fTmpB + -0.9671528397231821f*fTmpA;
+		out( 94, fTmpC*fC1 );
+		out( 86, fTmpC*fS1 );
+		fTmpA = 2.179449471770337f*fZ*fTmpC + -0.9776923610938036f*fTmpB;
+		out( 114, fTmpA*fC1 );
+		out( 106, fTmpA*fS1 );
+		fTmpB = 2.144761058952722f*fZ*fTmpA + -0.9840838646332836f*fTmpC;
+		out( 136, fTmpB*fC1 );
+		out( 128, fTmpB*fS1 );
+		fTmpC = 2.119478119726646f*fZ*fTmpB + -0.9882117688026186f*fTmpA;
+		out( 160, fTmpC*fC1 );
+		out( 152, fTmpC*fS1 );
+		fTmpA = 2.100420126042015f*fZ*fTmpC + -0.9910081668184009f*fTmpB;
+		out( 186, fTmpA*fC1 );
+		out( 178, fTmpA*fS1 );
+		fTmpB = 2.085665361461421f*fZ*fTmpA + -0.9929753269845127f*fTmpC;
+		out( 214, fTmpB*fC1 );
+		out( 206, fTmpB*fS1 );
+		fTmpC = 2.073990213742235f*fZ*fTmpB + -0.9944021951292297f*fTmpA;
+		out( 244, fTmpC*fC1 );
+		out( 236, fTmpC*fS1 );
+		fTmpA = 2.064582282206258f*fZ*fTmpC + -0.9954638496008124f*fTmpB;
+		out( 276, fTmpA*fC1 );
+		out( 268, fTmpA*fS1 );
+		fC0 = fX*fC1 - fY*fS1;
+		fS0 = fX*fS1 + fY*fC1;
+
+		fTmpA = -0.6563820568401703f;
+		out( 35, fTmpA*fC0 );
+		out( 25, fTmpA*fS0 );
+		fTmpB = -2.366619162231753f*fZ;
+		out( 47, fTmpB*fC0 );
+		out( 37, fTmpB*fS0 );
+		fTmpC = -6.745902523363385f*fZ2 + 0.5189155787202604f;
+		out( 61, fTmpC*fC0 );
+		out( 51, fTmpC*fS0 );
+		fTmpA = fZ*( -17.24955311049054f*fZ2 + 3.449910622098108f );
+		out( 77, fTmpA*fC0 );
+		out( 67, fTmpA*fS0 );
+		fTmpB = 2.401636346922062f*fZ*fTmpA + -0.9392246042043708f*fTmpC;
+		out( 95, fTmpB*fC0 );
+		out( 85, fTmpB*fS0 );
+		fTmpC = 2.306512518934159f*fZ*fTmpB + -0.9603920767980496f*fTmpA;
+		out( 115, fTmpC*fC0 );
+		out( 105, fTmpC*fS0 );
+		fTmpA = 2.243044805615795f*fZ*fTmpC + -0.9724832565193738f*fTmpB;
+		out( 137, fTmpA*fC0 );
+		out( 127, fTmpA*fS0 );
+		fTmpB = 2.198165774710643f*fZ*fTmpA + -0.9799919151000504f*fTmpC;
+		out( 161, fTmpB*fC0 );
+		out( 151, fTmpB*fS0 );
+		fTmpC = 2.165063509461097f*fZ*fTmpB + -0.9849409604906143f*fTmpA;
+		out( 187, fTmpC*fC0 );
+		out( 177, fTmpC*fS0 );
+		fTmpA = 2.139847510553276f*fZ*fTmpC + -0.9883532289941477f*fTmpB;
+		out( 215, fTmpA*fC0 );
+		out( 205, fTmpA*fS0 );
+		fTmpB = 2.120141504711419f*fZ*fTmpA + -0.99079092984679f*fTmpC;
+		out( 245, fTmpB*fC0 );
+		out( 235, fTmpB*fS0 );
+		fTmpC = 2.104417123236605f*fZ*fTmpB + -0.9925833339709304f*fTmpA;
+		out( 277, fTmpC*fC0 );
+		out( 267, fTmpC*fS0 );
+		fC1 = fX*fC0 - fY*fS0;
+		fS1 = fX*fS0 + fY*fC0;
+
+		fTmpA = 0.6831841051919144f;
+		out( 48, fTmpA*fC1 );
+		out( 36, fTmpA*fS1 );
+		fTmpB = 2.645960661801901f*fZ;
+		out( 62, fTmpB*fC1 );
+		out( 50, fTmpB*fS1 );
+		fTmpC = 7.984991490893139f*fZ2 + -0.5323327660595426f;
+		out( 78, fTmpC*fC1 );
+		out( 66, fTmpC*fS1 );
+		fTmpA = fZ*( 21.39289019090864f*fZ2 + -3.775215916042701f );
+		out( 96, fTmpA*fC1 );
+		out( 84, fTmpA*fS1 );
+		fTmpB = 2.496873044429773f*fZ*fTmpA + -0.9319689782769534f*fTmpC;
+		out( 116, fTmpB*fC1 );
+		out( 104, fTmpB*fS1 );
+		fTmpC = 2.383768642544085f*fZ*fTmpB + -0.9547015807880142f*fTmpA;
+		out( 138, fTmpC*fC1 );
+		out( 126, fTmpC*fS1 );
+		fTmpA = 2.307395517477243f*fZ*fTmpC + -0.9679611839405133f*fTmpB;
+		out( 162, fTmpA*fC1 );
+		out( 150, fTmpA*fS1 );
+		fTmpB = 2.252817784447915f*fZ*fTmpA + -0.9763466069791972f*fTmpC;
+		out( 188, fTmpB*fC1 );
+		out( 176, fTmpB*fS1 );
+		fTmpC = 2.212182180562893f*fZ*fTmpB + -0.9819623210693983f*fTmpA;
+		out( 216, fTmpC*fC1 );
+		out( 204, fTmpC*fS1 );
+		fTmpA = 2.180966243804281f*fZ*fTmpC + -0.9858890750350997f*fTmpB;
+		out( 246, fTmpA*fC1 );
+		out( 234, fTmpA*fS1 );
+		fTmpB = 2.156385865284782f*fZ*fTmpA + -0.9887295924045926f*fTmpC;
+		out( 278, fTmpB*fC1 );
+		out( 266, fTmpB*fS1 );
+		fC0 = fX*fC1 - fY*fS1;
+		fS0 = fX*fS1 + fY*fC1;
+
+		fTmpA = -0.7071627325245963f;
+		out( 63, fTmpA*fC0 );
+		out( 49, fTmpA*fS0 );
+		fTmpB = -2.91570664069932f*fZ;
+		out( 79, fTmpB*fC0 );
+		out( 65, fTmpB*fS0 );
+		fTmpC = -9.263393182848905f*fZ2 + 0.5449054813440533f;
+		out( 97, fTmpC*fC0 );
+		out( 83, fTmpC*fS0 );
+		fTmpA = fZ*( -25.9102413133663f*fZ2 + 4.091090733689416f );
+		out( 117, fTmpA*fC0 );
+		out( 103, fTmpA*fS0 );
+		fTmpB = 2.590045044653342f*fZ*fTmpA + -0.9259892765852515f*fTmpC;
+		out( 139, fTmpB*fC0 );
+		out( 125, fTmpB*fS0 );
+		fTmpC = 2.460209661583209f*fZ*fTmpB + -0.9498713802919554f*fTmpA;
+		out( 163, fTmpC*fC0 );
+		out( 149, fTmpC*fS0 );
+		fTmpA = 2.371708245126284f*fZ*fTmpC + -0.9640268803757269f*fTmpB;
+		out( 189, fTmpA*fC0 );
+		out( 175, fTmpA*fS0 );
+		fTmpB = 2.307927774486216f*fZ*fTmpA + -0.9731077923386515f*fTmpC;
+		out( 217, fTmpB*fC0 );
+		out( 203, fTmpB*fS0 );
+		fTmpC = 2.260078437898682f*fZ*fTmpB + -0.9792674029419375f*fTmpA;
+		out( 247, fTmpC*fC0 );
+		out( 233, fTmpC*fS0 );
+		fTmpA = 2.223067472099586f*fZ*fTmpC + -0.9836240348217709f*fTmpB;
+		out( 279, fTmpA*fC0 );
+		out( 265, fTmpA*fS0 );
+		fC1 = fX*fC0 - fY*fS0;
+		fS1 = fX*fS0 + fY*fC0;
+
+		fTmpA = 0.72892666017483f;
+		out( 80, fTmpA*fC1 );
+		out( 64, fTmpA*fS1 );
+		fTmpB = 3.177317648954698f*fZ;
+		out( 98, fTmpB*fC1 );
+		out( 82, fTmpB*fS1 );
+		fTmpC = 10.57781172168795f*fZ2 + -0.5567269327204184f;
+		out( 118, fTmpC*fC1 );
+		out( 102, fTmpC*fS1 );
+		fTmpA = fZ*( 30.79157970335749f*fZ2 + -4.398797100479641f );
+		out( 140, fTmpA*fC1 );
+		out( 124, fTmpA*fS1 );
+		fTmpB = 2.680951323690902f*fZ*fTmpA + -0.9209854970162591f*fTmpC;
+		out( 164, fTmpB*fC1 );
+		out( 148, fTmpB*fS1 );
+		fTmpC = 2.53546276418555f*fZ*fTmpB + -0.9457324874869209f*fTmpA;
+		out( 190, fTmpC*fC1 );
+		out( 174, fTmpC*fS1 );
+		fTmpA = 2.435532422657966f*fZ*fTmpC + -0.9605869417846947f*fTmpB;
+		out( 218, fTmpA*fC1 );
+		out( 202, fTmpA*fS1 );
+		fTmpB = 2.363017336304797f*fZ*fTmpA + -0.9702261872276653f*fTmpC;
+		out( 248, fTmpB*fC1 );
+		out( 232, fTmpB*fS1 );
+		fTmpC = 2.308273164077423f*fZ*fTmpB + -0.9768329366922968f*fTmpA;
+		out( 280, fTmpC*fC1 );
+		out( 264, fTmpC*fS1 );
+		fC0 = fX*fC1 - fY*fS1;
+		fS0 = fX*fS1 + fY*fC1;
+
+		fTmpA = -0.7489009518531884f;
+		out( 99, fTmpA*fC0 );
+		out( 81, fTmpA*fS0 );
+		fTmpB = -3.431895299891715f*fZ;
+		out( 119, fTmpB*fC0 );
+		out( 101, fTmpB*fS0 );
+		fTmpC = -11.92552753945219f*fZ2 + 0.5678822637834374f;
+		out( 141, fTmpC*fC0 );
+		out( 123, fTmpC*fS0 );
+		fTmpA = fZ*( -36.02809068931077f*fZ2 + 4.699316176866623f );
+		out( 165, fTmpA*fC0 );
+		out( 147, fTmpA*fS0 );
+		fTmpB = 2.769558547034986f*fZ*fTmpA + -0.9167415228748209f*fTmpC;
+		out( 191, fTmpB*fC0 );
+		out( 173, fTmpB*fS0 );
+		fTmpC = 2.609347744585592f*fZ*fTmpB + -0.9421529461361585f*fTmpA;
+		out( 219, fTmpC*fC0 );
+		out( 201, fTmpC*fS0 );
+		fTmpA = 2.498610725094158f*fZ*fTmpC + -0.9575614175146977f*fTmpB;
+		out( 249, fTmpA*fC0 );
+		out( 231, fTmpA*fS0 );
+		fTmpB = 2.417791199776004f*fZ*fTmpA + -0.9676542149977727f*fTmpC;
+		out( 281, fTmpB*fC0 );
+		out( 263, fTmpB*fS0 );
+		fC1 = fX*fC0 - fY*fS0;
+		fS1 = fX*fS0 + fY*fC0;
+
+		fTmpA = 0.7673951182219901f;
+		out( 120, fTmpA*fC1 );
+		out( 100, fTmpA*fS1 );
+		fTmpB = 3.680297698805312f*fZ;
+		out( 142, fTmpB*fC1 );
+		out( 122, fTmpB*fS1 );
+		fTmpC = 13.30425420025764f*fZ2 + -0.5784458347938103f;
+		out( 166, fTmpC*fC1 );
+		out( 146, fTmpC*fS1 );
+		fTmpA = fZ*( 41.61193153549645f*fZ2 + -4.993431784259574f );
+		out( 192, fTmpA*fC1 );
+		out( 172, fTmpA*fS1 );
+		fTmpB = 2.855914914698966f*fZ*fTmpA + -0.9130991183874837f*fTmpC;
+		out( 220, fTmpB*fC1 );
+		out( 200, fTmpB*fS1 );
+		fTmpC = 2.681790446697877f*fZ*fTmpB + -0.9390302326218141f*fTmpA;
+		out( 250, fTmpC*fC1 );
+		out( 230, fTmpC*fS1 );
+		fTmpA = 2.560799154110355f*fZ*fTmpC + -0.9548841361798045f*fTmpB;
+		out( 282, fTmpA*fC1 );
+		out( 262, fTmpA*fS1 );
+		fC0 = fX*fC1 - fY*fS1;
+		fS0 = fX*fS1 + fY*fC1;
+
+		fTmpA = -0.7846421057871971f;
+		out( 143, fTmpA*fC0 );
+		out( 121, fTmpA*fS0 );
+		fTmpB = -3.923210528935984f*fZ;
+		out( 167, fTmpB*fC0 );
+		out( 145, fTmpB*fS0 );
+		fTmpC = -14.71203948350994f*fZ2 + 0.5884815793403977f;
+		out( 193, fTmpC*fC0 );
+		out( 171, fTmpC*fS0 );
+		fTmpA = fZ*( -47.53605436066262f*fZ2 + 5.281783817851402f );
+		out( 221, fTmpA*fC0 );
+		out( 199, fTmpA*fS0 );
+		fTmpB = 2.940107271721691f*fZ*fTmpA + -0.9099403568319481f*fTmpC;
+		out( 251, fTmpB*fC0 );
+		out( 229, fTmpB*fS0 );
+		fTmpC = 2.752776376275011f*fZ*fTmpB + -0.9362843331437419f*fTmpA;
+		out( 283, fTmpC*fC0 );
+		out( 261, fTmpC*fS0 );
+		fC1 = fX*fC0 - fY*fS0;
+		fS1 = fX*fS0 + fY*fC0;
+
+		fTmpA = 0.8008219957839717f;
+		out( 168, fTmpA*fC1 );
+		out( 144, fTmpA*fS1 );
+		fTmpB = 4.161193153549645f*fZ;
+		out( 194, fTmpB*fC1 );
+		out( 170, fTmpB*fS1 );
+		fTmpC = 16.1471947939282f*fZ2 + -0.5980442516269705f;
+		out( 222, fTmpC*fC1 );
+		out( 198, fTmpC*fS1 );
+		fTmpA = fZ*( 53.79407212305809f*fZ2 + -5.564904012730148f );
+		out( 252, fTmpA*fC1 );
+		out( 228, fTmpA*fS1 );
+		fTmpB = 3.022238999720004f*fZ*fTmpA + -0.9071758265604122f*fTmpC;
+		out( 284, fTmpB*fC1 );
+		out( 260, fTmpB*fS1 );
+		fC0 = fX*fC1 - fY*fS1;
+		fS0 = fX*fS1 + fY*fC1;
+
+		fTmpA = -0.8160771188376284f;
+		out( 195, fTmpA*fC0 );
+		out( 169, fTmpA*fS0 );
+		fTmpB = -4.394709780272119f*fZ;
+		out( 223, fTmpB*fC0 );
+		out( 197, fTmpB*fS0 );
+		fTmpC = -17.60824338884482f*fZ2 + 0.6071808065118906f;
+		out( 253, fTmpC*fC0 );
+		out( 227, fTmpC*fS0 );
+		fTmpA = fZ*( -60.38015494295203f*fZ2 + 5.843240800930841f );
+		out( 285, fTmpA*fC0 );
+		out( 259, fTmpA*fS0 );
+		fC1 = fX*fC0 - fY*fS0;
+		fS1 = fX*fS0 + fY*fC0;
+
+		fTmpA = 0.830522083064524f;
+		out( 224, fTmpA*fC1 );
+		out( 196, fTmpA*fS1 );
+		fTmpB = 4.624151256630013f*fZ;
+		out( 254, fTmpB*fC1 );
+		out( 226, fTmpB*fS1 );
+		fTmpC = 19.09388150936025f*fZ2 + -0.6159316615922662f;
+		out( 286, fTmpC*fC1 );
+		out( 258, fTmpC*fS1 );
+		fC0 = fX*fC1 - fY*fS1;
+		fS0 = fX*fS1 + fY*fC1;
+
+		fTmpA = -0.8442506508573726f;
+		out( 255, fTmpA*fC0 );
+		out( 225, fTmpA*fS0 );
+		fTmpB = -4.849850753230682f*fZ;
+		out( 287, fTmpB*fC0 );
+		out( 257, fTmpB*fS0 );
+		fC1 = fX*fC0 - fY*fS0;
+		fS1 = fX*fS0 + fY*fC0;
+
+		fTmpC = 0.8573405888380252f;
+		out( 288, fTmpC*fC1 );
+		out( 256, fTmpC*fS1 );
+	}
+};
+
+// order 18
+template<>
+struct SHKernel<18>
+{
+	template<typename T, typename O>
+	static FORCEINLINE void Eval( const T fX, const T fY, const T fZ, const O &out )
+	{
+		T fC0, fC1, fS0, fS1, fTmpA, fTmpB, fTmpC;
+		T fZ2 = fZ*fZ;
+
+		out( 0, 0.2820947917738781f );
+		out( 2, 0.4886025119029199f*fZ );
+		const T fP6 = 0.9461746957575601f*fZ2 + -0.3153915652525201f;
+		out( 6, fP6 );
+		const T fP12 = fZ*( 1.865881662950577f*fZ2 + -1.119528997770346f );
+		out( 12, fP12 );
+		const T fP20 = 1.984313483298443f*fZ*fP12 + -1.006230589874905f*fP6;
+		out( 20, fP20 );
+		const T fP30 = 1.98997487421324f*fZ*fP20 + -1.002853072844814f*fP12;
+		out( 30, fP30 );
+		const T fP42 = 1.993043457183567f*fZ*fP30 + -1.001542020962219f*fP20;
+		out( 42, fP42 );
+		const T fP56 = 1.994891434824135f*fZ*fP42 + -1.000927213921958f*fP30;
+		out( 56, fP56 );
+		const T fP72 = 1.996089927833914f*fZ*fP56 + -1.000600781069515f*fP42;
+		out( 72, fP72 );
+		const T fP90 = 1.996911195067937f*fZ*fP72 + -1.000411437993134f*fP56;
+		out( 90, fP90 );
+		const T fP110 = 1.997498435543818f*fZ*fP90 + -1.00029407440718f*fP72;
+		out( 110, fP110 );
+		const T fP132 = 1.997932815985082f*fZ*fP110 + -1.000217462218511f*fP90;
+		out( 132, fP132 );
+		const T fP156 = 1.998263134713633f*fZ*fP132 + -1.000165330248298f*fP110;
+		out( 156, fP156 );
+		const T fP182 = 1.998520162579474f*fZ*fP156 + -1.000128625635621f*fP132;
+		out( 182, fP182 );
+		const T fP210 = 1.998724082804747f*fZ*fP182 + -1.000102035610694f*fP156;
+		out( 210, fP210 );
+		const T fP240 = 1.998888580075327f*fZ*fP210 + -1.00008230114001f*fP182;
+		out( 240, fP240 );
+		const T fP272 = 1.999023198964935f*fZ*fP240 + -1.00006734687013f*fP210;
+		out( 272, fP272 );
+		out( 306, 1.999134760937227f*fZ*fP272 + -1.000055808242921f*fP240 );
+		fC0 = fX;
+		fS0 = fY;
+
+		fTmpA = -0.48860251190292f;
+		out( 3, fTmpA*fC0 );
+		out( 1, fTmpA*fS0 );
+		fTmpB = -1.092548430592079f*fZ;
+		out( 7, fTmpB*fC0 );
+		out( 5, fTmpB*fS0 );
+		fTmpC = -2.285228997322329f*fZ2 + 0.4570457994644658f;
+		out( 13, fTmpC*fC0 );
+		out( 11, fTmpC*fS0 );
+		fTmpA = fZ*( -4.683325804901025f*fZ2 + 2.007139630671868f );
+		out( 21, fTmpA*fC0 );
+		out( 19, fTmpA*fS0 );
+		fTmpB = 2.03100960115899f*fZ*fTmpA + -0.991031208965115f*fTmpC;
+		out( 31, fTmpB*fC0 );
+		out( 29, fTmpB*fS0 );
+		fTmpC = 2.021314989237028f*fZ*fTmpB + -0.9952267030562385f*fTmpA;
+		out( 43, fTmpC*fC0 );
+		out( 41, fTmpC*fS0 );
+		fTmpA = 2.015564437074638f*fZ*fTmpC + -0.9971550440218319f*fTmpB;
+		out( 57, fTmpA*fC0 );
+		out( 55, fTmpA*fS0 );
+		fTmpB = 2.011869540407391f*fZ*fTmpA + -0.9981668178901745f*fTmpC;
+		out( 73, fTmpB*fC0 );
+		out( 71, fTmpB*fS0 );
+		fTmpC = 2.009353129741012f*fZ*fTmpB + -0.9987492177719088f*fTmpA;
+		out( 91, fTmpC*fC0 );
+		out( 89, fTmpC*fS0 );
+		fTmpA = 2.007561463642653f*fZ*fTmpC + -0.9991083368712843f*fTmpB;
+		out( 111, fTmpA*fC0 );
+		out( 109, fTmpA*fS0 );
+		fTmpB = 2.006240264773888f*fZ*fTmpA + -0.9993418887079215f*fTmpC;
+		out( 133, fTmpB*fC0 );
+		out( 131, fTmpB*fS0 );
+		fTmpC = 2.005237896355199f*fZ*fTmpB + -0.9995003746877732f*fTmpA;
+		out( 157, fTmpC*fC0 );
+		out( 155, fTmpC*fS0 );
+		fTmpA = 2.004459314343183f*fZ*fTmpC + -0.9996117258638336f*fTmpB;
+		out( 183, fTmpA*fC0 );
+		out( 181, fTmpA*fS0 );
+		fTmpB = 2.003842462716222f*fZ*fTmpA + -0.9996922603404586f*fTmpC;
+		out( 211, fTmpB*fC0 );
+		out( 209, fTmpB*fS0 );
+		fTmpC = 2.003345416333104f*fZ*fTmpB + -0.9997519533634172f*fTmpA;
+		out( 241, fTmpC*fC0 );
+		out( 239, fTmpC*fS0 );
+		fTmpA = 2.002939017015334f*fZ*fTmpC + -0.9997971396672504f*fTmpB;
+		out( 273, fTmpA*fC0 );
+		out( 271, fTmpA*fS0 );
+		fTmpB = 2.002602473449653f*fZ*fTmpA + -0.9998319751311335f*fTmpC;
+		out( 307, fTmpB*fC0 );
+		out( 305, fTmpB*fS0 );
+		fC1 = fX*fC0 - fY*fS0;
+		fS1 = fX*fS0 + fY*fC0;
+
+		fTmpA = 0.5462742152960395f;
+		out( 8, fTmpA*fC1 );
+		out( 4, fTmpA*fS1 );
+		fTmpB = 1.445305721320277f*fZ;
+		out( 14, fTmpB*fC1 );
+		out( 10, fTmpB*fS1 );
+		fTmpC = 3.31161143515146f*fZ2 + -0.47308734787878f;
+		out( 22, fTmpC*fC1 );
+		out( 18, fTmpC*fS1 );
+		fTmpA = fZ*( 7.190305177459987f*fZ2 + -2.396768392486662f );
+		out( 32, fTmpA*fC1 );
+		out( 28, fTmpA*fS1 );
+		fTmpB = 2.11394181566097f*fZ*fTmpA + -0.9736101204623268f*fTmpC;
+		out( 44, fTmpB*fC1 );
+		out( 40, fTmpB*fS1 );
+		fTmpC = 2.081665999466133f*fZ*fTmpB + -0.9847319278346618f*fTmpA;
+		out( 58, fTmpC*fC1 );
+		out( 54, fTmpC*fS1 );
+		fTmpA = 2.06155281280883f*fZ*fTmpC + -0.9903379376602873f*fTmpB;
+		out( 74, fTmpA*fC1 );
+		out( 70, fTmpA*fS1 );
+		fTmpB = 2.048122358357819f*fZ*fTmpA + -0.9934852726704042f*fTmpC;
+		out( 92, fTmpB*fC1 );
+		out( 88, fTmpB*fS1 );
+		fTmpC = 2.038688303787511f*fZ*fTmpB + -0.9953938032404119f*fTmpA;
+		out( 112, fTmpC*fC1 );
+		out( 108, fTmpC*fS1 );
+		fTmpA = 2.031798495964875f*fZ*fTmpC + -0.9966204702259603f*fTmpB;
+		out( 134, fTmpA*fC1 );
+		out( 130, fTmpA*fS1 );
+		fTmpB = 2.026608708444444f*fZ*fTmpA + -0.9974457174120671f*fTmpC;
+		out( 158, fTmpB*fC1 );
+		out( 154, fTmpB*fS1 );
+		fTmpC = 2.022599587389726f*fZ*fTmpB + -0.9980217586956907f*fTmpA;
+		out( 184, fTmpC*fC1 );
+		out( 180, fTmpC*fS1 );
+		fTmpA = 2.019436802675439f*fZ*fTmpC + -0.998436277385793f*fTmpB;
+		out( 212, fTmpA*fC1 );
+		out( 208, fTmpA*fS1 );
+		fTmpB = 2.016896949069888f*fZ*fTmpA + -0.998742296068792f*fTmpC;
+		out( 242, fTmpB*fC1 );
+		out( 238, fTmpB*fS1 );
+		fTmpC = 2.014825999813336f*fZ*fTmpB + -0.9989732002631536f*fTmpA;
+		out( 274, fTmpC*fC1 );
+		out( 270, fTmpC*fS1 );
+		fTmpA = 2.013114894621608f*fZ*fTmpC + -0.9991507429465936f*fTmpB;
+		out( 308, fTmpA*fC1 );
+		out( 304, fTmpA*fS1 );
+		fC0 = fX*fC1 - fY*fS1;
+		fS0 = fX*fS1 + fY*fC1;
+
+		fTmpA = -0.5900435899266435f;
+		out( 15, fTmpA*fC0 );
+		out( 9, fTmpA*fS0 );
+		fTmpB = -1.770130769779931f*fZ;
+		out( 23, fTmpB*fC0 );
+		out( 17, fTmpB*fS0 );
+		fTmpC = -4.403144694917254f*fZ2 + 0.4892382994352505f;
+		out( 33, fTmpC*fC0 );
+		out( 27, fTmpC*fS0 );
+		fTmpA = fZ*( -10.13325785466416f*fZ2 + 2.763615778544771f );
+		out( 45, fTmpA*fC0 );
+		out( 39, fTmpA*fS0 );
+		fTmpB = 2.207940216581962f*fZ*fTmpA + -0.959403223600247f*fTmpC;
+		out( 59, fTmpB*fC0 );
+		out( 53, fTmpB*fS0 );
+		fTmpC = 2.15322168769582f*fZ*fTmpB + -0.9752173865600178f*fTmpA;
+		out( 75, fTmpC*fC0 );
+		out( 69, fTmpC*fS0 );
+		fTmpA = 2.118044171189805f*fZ*fTmpC + -0.9836628449792094f*fTmpB;
+		out( 93, fTmpA*fC0 );
+		out( 87, fTmpA*fS0 );
+		fTmpB = 2.093947321356338f*fZ*fTmpA + -0.9886230654859614f*fTmpC;
+		out( 113, fTmpB*fC0 );
+		out( 107, fTmpB*fS0 );
+		fTmpC = 2.076655965729519f*fZ*fTmpB + -0.9917422203269092f*fTmpA;
+		out( 135, fTmpC*fC0 );
+		out( 129, fTmpC*fS0 );
+		fTmpA = 2.063797291222968f*fZ*fTmpC + -0.9938079899999066f*fTmpB;
+		out( 159, fTmpA*fC0 );
+		out( 153, fTmpA*fS0 );
+		fTmpB = 2.053959590644373f*fZ*fTmpA + -0.9952332040455557f*fTmpC;
+		out( 185, fTmpB*fC0 );
+		out( 179, fTmpB*fS0 );
+		fTmpC = 2.046256527271464f*fZ*fTmpB + -0.9962496519366806f*fTmpA;
+		out( 213, fTmpC*fC0 );
+		out( 207, fTmpC*fS0 );
+		fTmpA = 2.040107114108727f*fZ*fTmpC + -0.9969947985109489f*fTmpB;
+		out( 243, fTmpA*fC0 );
+		out( 237, fTmpA*fS0 );
+		fTmpB = 2.035116803738375f*fZ*fTmpA + -0.9975538978635777f*fTmpC;
+		out( 275, fTmpB*fC0 );
+		out( 269, fTmpB*fS0 );
+		fTmpC = 2.03100960115899f*fZ*fTmpB + -0.9979818344716921f*fTmpA;
+		out( 309, fTmpC*fC0 );
+		out( 303, fTmpC*fS0 );
+		fC1 = fX*fC0 - fY*fS0;
+		fS1 = fX*fS0 + fY*fC0;
+
+		fTmpA = 0.6258357354491763f;
+		out( 24, fTmpA*fC1 );
+		out( 16, fTmpA*fS1 );
+		fTmpB = 2.075662314881041f*fZ;
+		out( 34, fTmpB*fC1 );
+		out( 26, fTmpB*fS1 );
+		fTmpC = 5.550213908015966f*fZ2 + -0.5045649007287241f;
+		out( 46, fTmpC*fC1 );
+		out( 38, fTmpC*fS1 );
+		fTmpA = fZ*( 13.49180504672677f*fZ2 + -3.113493472321562f );
+		out( 60, fTmpA*fC1 );
+		out( 52, fTmpA*fS1 );
+		fTmpB = 2.304886114323221f*fZ*fTmpA + -0.9481763873554654f*fTmpC;
+		out( 76, fTmpB*fC1 );
+		out( 68, fTmpB*fS1 );
+		fTmpC = 2.229177150706235f*fZ*fTmpB + -0.9671528397231821f*fTmpA;
+		out( 94, fTmpC*fC1 );
+		out( 86, fTmpC*fS1 );
+		fTmpA = 2.179449471770337f*fZ*fTmpC + -0.9776923610938036f*fTmpB;
+		out( 114, fTmpA*fC1 );
+		out( 106, fTmpA*fS1 );
+		fTmpB = 2.144761058952722f*fZ*fTmpA + -0.9840838646332836f*fTmpC;
+		out( 136, fTmpB*fC1 );
+		out( 128, fTmpB*fS1 );
+		fTmpC = 2.119478119726646f*fZ*fTmpB + -0.9882117688026186f*fTmpA;
+		out( 160, fTmpC*fC1 );
+		out( 152, fTmpC*fS1 );
+		fTmpA = 2.100420126042015f*fZ*fTmpC + -0.9910081668184009f*fTmpB;
+		out( 186, fTmpA*fC1 );
+		out( 178, fTmpA*fS1 );
+		fTmpB = 2.085665361461421f*fZ*fTmpA + -0.9929753269845127f*fTmpC;
+		out( 214, fTmpB*fC1 );
+		out( 206, fTmpB*fS1 );
+		fTmpC = 2.073990213742235f*fZ*fTmpB + -0.9944021951292297f*fTmpA;
+		out( 244, fTmpC*fC1 );
+		out( 236, fTmpC*fS1 );
+		fTmpA = 2.064582282206258f*fZ*fTmpC + -0.9954638496008124f*fTmpB;
+		out( 276, fTmpA*fC1 );
+		out( 268, fTmpA*fS1 );
+		fTmpB = 2.056883378018606f*fZ*fTmpA + -0.996270962773436f*fTmpC;
+		out( 310, fTmpB*fC1 );
+		out( 302, fTmpB*fS1 );
+		fC0 = fX*fC1 - fY*fS1;
+		fS0 = fX*fS1 + fY*fC1;
+
+		fTmpA = -0.6563820568401703f;
+		out( 35, fTmpA*fC0 );
+		out( 25, fTmpA*fS0 );
+		fTmpB = -2.366619162231753f*fZ;
+		out( 47, fTmpB*fC0 );
+		out( 37, fTmpB*fS0 );
+		fTmpC = -6.745902523363385f*fZ2 + 0.5189155787202604f;
+		out( 61, fTmpC*fC0 );
+		out( 51, fTmpC*fS0 );
+		fTmpA = fZ*( -17.24955311049054f*fZ2 + 3.449910622098108f );
+		out( 77, fTmpA*fC0 );
+		out( 67, fTmpA*fS0 );
+		fTmpB = 2.401636346922062f*fZ*fTmpA + -0.9392246042043708f*fTmpC;
+		out( 95, fTmpB*fC0 );
+		out( 85, fTmpB*fS0 );
+		fTmpC = 2.306512518934159f*fZ*fTmpB + -0.9603920767980496f*fTmpA;
+		out( 115, fTmpC*fC0 );
+		out( 105, fTmpC*fS0 );
+		fTmpA = 2.243044805615795f*fZ*fTmpC + -0.9724832565193738f*fTmpB;
+		out( 137, fTmpA*fC0 );
+		out( 127, fTmpA*fS0 );
+		fTmpB = 2.198165774710643f*fZ*fTmpA + -0.9799919151000504f*fTmpC;
+		out( 161, fTmpB*fC0 );
+		out( 151, fTmpB*fS0 );
+		fTmpC = 2.165063509461097f*fZ*fTmpB + -0.9849409604906143f*fTmpA;
+		out( 187, fTmpC*fC0 );
+		out( 177, fTmpC*fS0 );
+		fTmpA = 2.139847510553276f*fZ*fTmpC + -0.9883532289941477f*fTmpB;
+		out( 215, fTmpA*fC0 );
+		out( 205, fTmpA*fS0 );
+		fTmpB = 2.120141504711419f*fZ*fTmpA + -0.99079092984679f*fTmpC;
+		out( 245, fTmpB*fC0 );
+		out( 235, fTmpB*fS0 );
+		fTmpC = 2.104417123236605f*fZ*fTmpB + -0.9925833339709304f*fTmpA;
+		out( 277, fTmpC*fC0 );
+		out( 267, fTmpC*fS0 );
+		fTmpA = 2.091650066335189f*fZ*fTmpC + -0.9939332099323633f*fTmpB;
+		out( 311, fTmpA*fC0 );
+		out( 301, fTmpA*fS0 );
+		fC1 = fX*fC0 - fY*fS0;
+		fS1 = fX*fS0 + fY*fC0;
+
+		fTmpA = 0.6831841051919144f;
+		out( 48, fTmpA*fC1 );
+		out( 36, fTmpA*fS1 );
+		fTmpB = 2.645960661801901f*fZ;
+		out( 62, fTmpB*fC1 );
+		out( 50, fTmpB*fS1 );
+		fTmpC = 7.984991490893139f*fZ2 + -0.5323327660595426f;
+		out( 78, fTmpC*fC1 );
+		out( 66, fTmpC*fS1 );
+		fTmpA = fZ*( 21.39289019090864f*fZ2 + -3.775215916042701f );
+		out( 96, fTmpA*fC1 );
+		out( 84, fTmpA*fS1 );
+		fTmpB = 2.496873044429773f*fZ*fTmpA + -0.9319689782769534f*fTmpC;
+		out( 116, fTmpB*fC1 );
+		out( 104, fTmpB*fS1 );
+		fTmpC = 2.383768642544085f*fZ*fTmpB + -0.9547015807880142f*fTmpA;
+		out( 138, fTmpC*fC1 );
+		out( 126, fTmpC*fS1 );
+		fTmpA = 2.307395517477243f*fZ*fTmpC + -0.9679611839405133f*fTmpB;
+		out( 162, fTmpA*fC1 );
+		out( 150, fTmpA*fS1 );
+		fTmpB = 2.252817784447915f*fZ*fTmpA + -0.9763466069791972f*fTmpC;
+		out( 188, fTmpB*fC1 );
+		out( 176, fTmpB*fS1 );
+		fTmpC = 2.212182180562893f*fZ*fTmpB + -0.9819623210693983f*fTmpA;
+		out( 216, fTmpC*fC1 );
+		out( 204, fTmpC*fS1 );
+		fTmpA = 2.180966243804281f*fZ*fTmpC + -0.9858890750350997f*fTmpB;
+		out( 246, fTmpA*fC1 );
+		out( 234, fTmpA*fS1 );
+		fTmpB = 2.156385865284782f*fZ*fTmpA + -0.9887295924045926f*fTmpC;
+		out( 278, fTmpB*fC1 );
+		out( 266, fTmpB*fS1 );
+		fTmpC = 2.13663693483576f*fZ*fTmpB + -0.9908416528011255f*fTmpA;
+		out( 312, fTmpC*fC1 );
+		out( 300, fTmpC*fS1 );
+		fC0 = fX*fC1 - fY*fS1;
+		fS0 = fX*fS1 + fY*fC1;
+
+		fTmpA = -0.7071627325245963f;
+		out( 63, fTmpA*fC0 );
+		out( 49, fTmpA*fS0 );
+		fTmpB = -2.91570664069932f*fZ;
+		out( 79, fTmpB*fC0 );
+		out( 65, fTmpB*fS0 );
+		fTmpC = -9.263393182848905f*fZ2 + 0.5449054813440533f;
+		out( 97, fTmpC*fC0 );
+		out( 83, fTmpC*fS0 );
+		fTmpA = fZ*( -25.9102413133663f*fZ2 + 4.091090733689416f );
+		out( 117, fTmpA*fC0 );
+		out( 103, fTmpA*fS0 );
+		fTmpB = 2.590045044653342f*fZ*fTmpA + -0.9259892765852515f*fTmpC;
+		out( 139, fTmpB*fC0 );
+		out( 125, fTmpB*fS0 );
+		fTmpC = 2.460209661583209f*fZ*fTmpB + -0.9498713802919554f*fTmpA;
+		out( 163, fTmpC*fC0 );
+		out( 149, fTmpC*fS0 );
+		fTmpA = 2.371708245126284f*fZ*fTmpC + -0.9640268803757269f*fTmpB;
+		out( 189, fTmpA*fC0 );
+		out( 175, fTmpA*fS0 );
+		fTmpB = 2.307927774486216f*fZ*fTmpA + -0.9731077923386515f*fTmpC;
+		out( 217, fTmpB*fC0 );
+		out( 203, fTmpB*fS0 );
+		fTmpC = 2.260078437898682f*fZ*fTmpB + -0.9792674029419375f*fTmpA;
+		out( 247, fTmpC*fC0 );
+		out( 233, fTmpC*fS0 );
+		fTmpA = 2.223067472099586f*fZ*fTmpC + -0.9836240348217709f*fTmpB;
+		out( 279, fTmpA*fC0 );
+		out( 265, fTmpA*fS0 );
+		fTmpB = 2.19374109684803f*fZ*fTmpA + -0.9868081488215654f*fTmpC;
+		out( 313, fTmpB*fC0 );
+		out( 299, fTmpB*fS0 );
+		fC1 = fX*fC0 - fY*fS0;
+		fS1 = fX*fS0 + fY*fC0;
+
+		fTmpA = 0.72892666017483f;
+		out( 80, fTmpA*fC1 );
+		out( 64, fTmpA*fS1 );
+		fTmpB = 3.177317648954698f*fZ;
+		out( 98, fTmpB*fC1 );
+		out( 82, fTmpB*fS1 );
+		fTmpC = 10.57781172168795f*fZ2 + -0.5567269327204184f;
+		out( 118, fTmpC*fC1 );
+		out( 102, fTmpC*fS1 );
+		fTmpA = fZ*( 30.79157970335749f*fZ2 + -4.398797100479641f );
+		out( 140, fTmpA*fC1 );
+		out( 124, fTmpA*fS1 );
+		fTmpB = 2.680951323690902f*fZ*fTmpA + -0.9209854970162591f*fTmpC;
+		out( 164, fTmpB*fC1 );
+		out( 148, fTmpB*fS1 );
+		fTmpC = 2.53546276418555f*fZ*fTmpB + -0.9457324874869209f*fTmpA;
+		out( 190, fTmpC*fC1 );
+		out( 174, fTmpC*fS1 );
+		fTmpA = 2.435532422657966f*fZ*fTmpC + -0.9605869417846947f*fTmpB;
+		out( 218, fTmpA*fC1 );
+		out( 202, fTmpA*fS1 );
+		fTmpB = 2.363017336304797f*fZ*fTmpA + -0.9702261872276653f*fTmpC;
+		out( 248, fTmpB*fC1 );
+		out( 232, fTmpB*fS1 );
+		fTmpC = 2.308273164077423f*fZ*fTmpB + -0.9768329366922968f*fTmpA;
+		out( 280, fTmpC*fC1 );
+		out( 264, fTmpC*fS1 );
+		fTmpA = 2.265686062395524f*fZ*fTmpC + -0.9815502331592888f*fTmpB;
+		out( 314, fTmpA*fC1 );
+		out( 298, fTmpA*fS1 );
+		fC0 = fX*fC1 - fY*fS1;
+		fS0 = fX*fS1 + fY*fC1;
+
+		fTmpA = -0.7489009518531884f;
+		out( 99, fTmpA*fC0 );
+		out( 81, fTmpA*fS0 );
+		fTmpB = -3.431895299891715f*fZ;
+		out( 119, fTmpB*fC0 );
+		out( 101, fTmpB*fS0 );
+		fTmpC = -11.92552753945219f*fZ2 + 0.5678822637834374f;
+		out( 141, fTmpC*fC0 );
+		out( 123, fTmpC*fS0 );
+		fTmpA = fZ*( -36.02809068931077f*fZ2 + 4.699316176866623f );
+		out( 165, fTmpA*fC0 );
+		out( 147, fTmpA*fS0 );
+		fTmpB = 2.769558547034986f*fZ*fTmpA + -0.9167415228748209f*fTmpC;
+		out( 191, fTmpB*fC0 );
+		out( 173, fTmpB*fS0 );
+		fTmpC = 2.609347744585592f*fZ*fTmpB + -0.9421529461361585f*fTmpA;
+		out( 219, fTmpC*fC0 );
+		out( 201, fTmpC*fS0 );
+		fTmpA = 2.498610725094158f*fZ*fTmpC + -0.9575614175146977f*fTmpB;
+		out( 249, fTmpA*fC0 );
+		out( 231, fTmpA*fS0 );
+		fTmpB = 2.417791199776004f*fZ*fTmpA + -0.9676542149977727f*fTmpC;
+		out( 281, fTmpB*fC0 );
+		out( 263, fTmpB*fS0 );
+		fTmpC = 2.356455943866682f*fZ*fTmpB + -0.9746316985871221f*fTmpA;
+		out( 315, fTmpC*fC0 );
+		out( 297, fTmpC*fS0 );
+		fC1 = fX*fC0 - fY*fS0;
+		fS1 = fX*fS0 + fY*fC0;
+
+		fTmpA = 0.7673951182219901f;
+		out( 120, fTmpA*fC1 );
+		out( 100, fTmpA*fS1 );
+		fTmpB = 3.680297698805312f*fZ;
+		out( 142, fTmpB*fC1 );
+		out( 122, fTmpB*fS1 );
+		fTmpC = 13.30425420025764f*fZ2 + -0.5784458347938103f;
+		out( 166, fTmpC*fC1 );
+		out( 146, fTmpC*fS1 );
+		fTmpA = fZ*( 41.61193153549645f*fZ2 + -4.993431784259574f );
+		out( 192, fTmpA*fC1 );
+		out( 172, fTmpA*fS1 );
+		fTmpB = 2.855914914698966f*fZ*fTmpA + -0.9130991183874837f*fTmpC;
+		out( 220, fTmpB*fC1 );
+		out( 200, fTmpB*fS1 );
+		fTmpC = 2.681790446697877f*fZ*fTmpB + -0.9390302326218141f*fTmpA;
+		out( 250, fTmpC*fC1 );
+		out( 230, fTmpC*fS1 );
+		fTmpA = 2.560799154110355f*fZ*fTmpC + -0.9548841361798045f*fTmpB;
+		out( 282, fTmpA*fC1 );
+		out( 262, fTmpA*fS1 );
+		fTmpB = 2.472066162365221f*fZ*fTmpA + -0.9653494919339113f*fTmpC;
+		out( 316, fTmpB*fC1 );
+		out( 296, fTmpB*fS1 );
+		fC0 = fX*fC1 - fY*fS1;
+		fS0 = fX*fS1 + fY*fC1;
+
+		fTmpA = -0.7846421057871971f;
+		out( 143, fTmpA*fC0 );
+		out( 121, fTmpA*fS0 );
+		fTmpB = -3.923210528935984f*fZ;
+		out( 167, fTmpB*fC0 );
+		out( 145, fTmpB*fS0 );
+		fTmpC = -14.71203948350994f*fZ2 + 0.5884815793403977f;
+		out( 193, fTmpC*fC0 );
+		out( 171, fTmpC*fS0 );
+		fTmpA = fZ*( -47.53605436066262f*fZ2 + 5.281783817851402f );
+		out( 221, fTmpA*fC0 );
+		out( 199, fTmpA*fS0 );
+		fTmpB = 2.940107271721691f*fZ*fTmpA + -0.9099403568319481f*fTmpC;
+		out( 251, fTmpB*fC0 );
+		out( 229, fTmpB*fS0 );
+		fTmpC = 2.752776376275011f*fZ*fTmpB + -0.9362843331437419f*fTmpA;
+		out( 283, fTmpC*fC0 );
+		out( 261, fTmpC*fS0 );
+		fTmpA = 2.622022120425379f*fZ*fTmpC + -0.9525009525014289f*fTmpB;
+		out( 317, fTmpA*fC0 );
+		out( 295, fTmpA*fS0 );
+		fC1 = fX*fC0 - fY*fS0;
+		fS1 = fX*fS0 + fY*fC0;
+
+		fTmpA = 0.8008219957839717f;
+		out( 168, fTmpA*fC1 );
+		out( 144, fTmpA*fS1 );
+		fTmpB = 4.161193153549645f*fZ;
+		out( 194, fTmpB*fC1 );
+		out( 170, fTmpB*fS1 );
+		fTmpC = 16.1471947939282f*fZ2 + -0.5980442516269705f;
+		out( 222, fTmpC*fC1 );
+		out( 198, fTmpC*fS1 );
+		fTmpA = fZ*( 53.79407212305809f*fZ2 + -5.564904012730148f );
+		out( 252, fTmpA*fC1 );
+		out( 228, fTmpA*fS1 );
+		fTmpB = 3.022238999720004f*fZ*fTmpA + -0.9071758265604122f*fTmpC;
+		out( 284, fTmpB*fC1 );
+		out( 260, fTmpB*fS1 );
+		fTmpC = 2.822324793743503f*fZ*fTmpB + -0.9338522843510981f*fTmpA;
+		out( 318, fTmpC*fC1 );
+		out( 294, fTmpC*fS1 );
+		fC0 = fX*fC1 - fY*fS1;
+		fS0 = fX*fS1 + fY*fC1;
+
+		fTmpA = -0.8160771188376284f;
+		out( 195, fTmpA*fC0 );
+		out( 169, fTmpA*fS0 );
+		fTmpB = -4.394709780272119f*fZ;
+		out( 223, fTmpB*fC0 );
+		out( 197, fTmpB*fS0 );
+		fTmpC = -17.60824338884482f*fZ2 + 0.6071808065118906f;
+		out( 253, fTmpC*fC0 );
+		out( 227, fTmpC*fS0 );
+		fTmpA = fZ*( -60.38015494295203f*fZ2 + 5.843240800930841f );
+		out( 285, fTmpA*fC0 );
+		out( 259, fTmpA*fS0 );
+		fTmpB = 3.102418411497714f*fZ*fTmpA + -0.9047366396343047f*fTmpC;
+		out( 319, fTmpB*fC0 );
+		out( 293, fTmpB*fS0 );
+		fC1 = fX*fC0 - fY*fS0;
+		fS1 = fX*fS0 + fY*fC0;
+
+		fTmpA = 0.830522083064524f;
+		out( 224, fTmpA*fC1 );
+		out( 196, fTmpA*fS1 );
+		fTmpB = 4.624151256630013f*fZ;
+		out( 254, fTmpB*fC1 );
+		out( 226, fTmpB*fS1 );
+		fTmpC = 19.09388150936025f*fZ2 + -0.6159316615922662f;
+		out( 286, fTmpC*fC1 );
+		out( 258, fTmpC*fS1 );
+		fTmpA = fZ*( 67.28894837384407f*fZ2 + -6.117177124894916f );
+		out( 320, fTmpA*fC1 );
+		out( 292, fTmpA*fS1 );
+		fC0 = fX*fC1 - fY*fS1;
+		fS0 = fX*fS1 + fY*fC1;
+
+		fTmpA = -0.8442506508573726f;
+		out( 255, fTmpA*fC0 );
+		out( 225, fTmpA*fS0 );
+		fTmpB = -4.849850753230682f*fZ;
+		out( 287, fTmpB*fC0 );
+		out( 257, fTmpB*fS0 );
+		fTmpC = -20.60294860554973f*fZ2 + 0.6243317759257494f;
+		out( 321, fTmpC*fC0 );
+		out( 291, fTmpC*fS0 );
+		fC1 = fX*fC0 - fY*fS0;
+		fS1 = fX*fS0 + fY*fC0;
+
+		fTmpA = 0.8573405888380252f;
+		out( 288, fTmpA*fC1 );
+		out( 256, fTmpA*fS1 );
+		fTmpB = 5.07209532485536f*fZ;
+		out( 322, fTmpB*fC1 );
+		out( 290, fTmpB*fS1 );
+		fC0 = fX*fC1 - fY*fS1;
+		fS0 = fX*fS1 + fY*fC1;
+
+		fTmpC = -0.8698571719206282f;
+		out( 323, fTmpC*fC0 );
+		out( 289, fTmpC*fS0 );
+	}
+};
+
+// order 19
+template<>
+struct SHKernel<19>
+{
+	template<typename T, typename O>
+	static FORCEINLINE void Eval( const T fX, const T fY, const T fZ, const O &out )
+	{
+		T fC0, fC1, fS0, fS1, fTmpA, fTmpB, fTmpC;
+		T fZ2 = fZ*fZ;
+
+		out( 0, 0.2820947917738781f );
+		out( 2, 0.4886025119029199f*fZ );
+		const T fP6 = 0.9461746957575601f*fZ2 + -0.3153915652525201f;
+		out( 6, fP6 );
+		const T fP12 = fZ*( 1.865881662950577f*fZ2 + -1.119528997770346f );
+		out( 12, fP12 );
+		const T fP20 = 1.984313483298443f*fZ*fP12 + -1.006230589874905f*fP6;
+		out( 20, fP20 );
+		const T fP30 = 1.98997487421324f*fZ*fP20 + -1.002853072844814f*fP12;
+		out( 30, fP30 );
+		const T fP42 = 1.993043457183567f*fZ*fP30 + -1.001542020962219f*fP20;
+		out( 42, fP42 );
+		const T fP56 = 1.994891434824135f*fZ*fP42 + -1.000927213921958f*fP30;
+		out( 56, fP56 );
+		const T fP72 = 1.996089927833914f*fZ*fP56 + -1.000600781069515f*fP42;
+		out( 72, fP72 );
+		const T fP90 = 1.996911195067937f*fZ*fP72 + -1.000411437993134f*fP56;
+		out( 90, fP90 );
+		const T fP110 = 1.997498435543818f*fZ*fP90 + -1.00029407440718f*fP72;
+		out( 110, fP110 );
+		const T fP132 = 1.997932815985082f*fZ*fP110 + -1.000217462218511f*fP90;
+		out( 132, fP132 );
+		const T fP156 = 1.998263134713633f*fZ*fP132 + -1.000165330248298f*fP110;
+		out( 156, fP156 );
+		const T fP182 = 1.998520162579474f*fZ*fP156 + -1.000128625635621f*fP132;
+		out( 182, fP182 );
+		const T fP210 = 1.998724082804747f*fZ*fP182 + -1.000102035610694f*fP156;
+		out( 210, fP210 );
+		const T fP240 = 1.998888580075327f*fZ*fP210 + -1.00008230114001f*fP182;
+		out( 240, fP240 );
+		const T fP272 = 1.999023198964935f*fZ*fP240 + -1.00006734687013f*fP210;
+		out( 272, fP272 );
+		const T fP306 = 1.999134760937227f*fZ*fP272 + -1.000055808242921f*fP240;
+		out( 306, fP306 );
+		out( 342, 1.999228246160731f*fZ*fP306 + -1.000046762842271f*fP272 );
+		fC0 = fX;
+		fS0 = fY;
+
+		fTmpA = -0.48860251190292f;
+		out( 3, fTmpA*fC0 );
+		out( 1, fTmpA*fS0 );
+		fTmpB = -1.092548430592079f*fZ;
+		out( 7, fTmpB*fC0 );
+		out( 5, fTmpB*fS0 );
+		fTmpC = -2.285228997322329f*fZ2 + 0.4570457994644658f;
+		out( 13, fTmpC*fC0 );
+		out( 11, fTmpC*fS0 );
+		fTmpA = fZ*( -4.683325804901025f*fZ2 + 2.007139630671868f );
+		out( 21, fTmpA*fC0 );
+		out( 19, fTmpA*fS0 );
+		fTmpB = 2.03100960115899f*fZ*fTmpA + -0.991031208965115f*fTmpC;
+		out( 31, fTmpB*fC0 );
+		out( 29, fTmpB*fS0 );
+		fTmpC = 2.021314989237028f*fZ*fTmpB + -0.9952267030562385f*fTmpA;
+		out( 43, fTmpC*fC0 );
+		out( 41, fTmpC*fS0 );
+		fTmpA = 2.015564437074638f*fZ*fTmpC + -0.9971550440218319f*fTmpB;
+		out( 57, fTmpA*fC0 );
+		out( 55, fTmpA*fS0 );
+		fTmpB = 2.011869540407391f*fZ*fTmpA + -0.9981668178901745f*fTmpC;
+		out( 73, fTmpB*fC0 );
+		out( 71, fTmpB*fS0 );
+		fTmpC = 2.009353129741012f*fZ*fTmpB + -0.9987492177719088f*fTmpA;
+		out( 91, fTmpC*fC0 );
+		out( 89, fTmpC*fS0 );
+		fTmpA = 2.007561463642653f*fZ*fTmpC + -0.9991083368712843f*fTmpB;
+		out( 111, fTmpA*fC0 );
+		out( 109, fTmpA*fS0 );
+		fTmpB = 2.006240264773888f*fZ*fTmpA + -0.9993418887079215f*fTmpC;
+		out( 133, fTmpB*fC0 );
+		out( 131, fTmpB*fS0 );
+		fTmpC = 2.005237896355199f*fZ*fTmpB + -0.9995003746877732f*fTmpA;
+		out( 157, fTmpC*fC0 );
+		out( 155, fTmpC*fS0 );
+		fTmpA = 2.004459314343183f*fZ*fTmpC + -0.9996117258638336f*fTmpB;
+		out( 183, fTmpA*fC0 );
+		out( 181, fTmpA*fS0 );
+		fTmpB = 2.003842462716222f*fZ*fTmpA + -0.9996922603404586f*fTmpC;
+		out( 211, fTmpB*fC0 );
+		out( 209, fTmpB*fS0 );
+		fTmpC = 2.003345416333104f*fZ*fTmpB + -0.9997519533634172f*fTmpA;
+		out( 241, fTmpC*fC0 );
+		out( 239, fTmpC*fS0 );
+		fTmpA = 2.002939017015334f*fZ*fTmpC + -0.9997971396672504f*fTmpB;
+		out( 273, fTmpA*fC0 );
+		out( 271, fTmpA*fS0 );
+		fTmpB = 2.002602473449653f*fZ*fTmpA + -0.9998319751311335f*fTmpC;
+		out( 307, fTmpB*fC0 );
+		out( 305, fTmpB*fS0 );
+		fTmpC = 2.002320635087347f*fZ*fTmpB + -0.9998592639497642f*fTmpA;
+		out( 343, fTmpC*fC0 );
+		out( 341, fTmpC*fS0 );
+		fC1 = fX*fC0 - fY*fS0;
+		fS1 = fX*fS0 + fY*fC0;
+
+		fTmpA = 0.5462742152960395f;
+		out( 8, fTmpA*fC1 );
+		out( 4, fTmpA*fS1 );
+		fTmpB = 1.445305721320277f*fZ;
+		out( 14, fTmpB*fC1 );
+		out( 10, fTmpB*fS1 );
+		fTmpC = 3.31161143515146f*fZ2 + -0.47308734787878f;
+		out( 22, fTmpC*fC1 );
+		out( 18, fTmpC*fS1 );
+		fTmpA = fZ*( 7.190305177459987f*fZ2 + -2.396768392486662f );
+		out( 32, fTmpA*fC1 );
+		out( 28, fTmpA*fS1 );
+		fTmpB = 2.11394181566097f*fZ*fTmpA + -0.9736101204623268f*fTmpC;
+		out( 44, fTmpB*fC1 );
+		out( 40, fTmpB*fS1 );
+		fTmpC = 2.081665999466133f*fZ*fTmpB + -0.9847319278346618f*fTmpA;
+		out( 58, fTmpC*fC1 );
+		out( 54, fTmpC*fS1 );
+		fTmpA = 2.06155281280883f*fZ*fTmpC + -0.9903379376602873f*fTmpB;
+		out( 74, fTmpA*fC1 );
+		out( 70, fTmpA*fS1 );
+		fTmpB = 2.048122358357819f*fZ*fTmpA + -0.9934852726704042f*fTmpC;
+		out( 92, fTmpB*fC1 );
+		out( 88, fTmpB*fS1 );
+		fTmpC = 2.038688303787511f*fZ*fTmpB + -0.9953938032404119f*fTmpA;
+		out( 112, fTmpC*fC1 );
+		out( 108, fTmpC*fS1 );
+		fTmpA = 2.031798495964875f*fZ*fTmpC + -0.9966204702259603f*fTmpB;
+		out( 134, fTmpA*fC1 );
+		out( 130, fTmpA*fS1 );
+		fTmpB = 2.026608708444444f*fZ*fTmpA + -0.9974457174120671f*fTmpC;
+		out( 158, fTmpB*fC1 );
+		out( 154, fTmpB*fS1 );
+		fTmpC = 2.022599587389726f*fZ*fTmpB + -0.9980217586956907f*fTmpA;
+		out( 184, fTmpC*fC1 );
+		out( 180, fTmpC*fS1 );
+		fTmpA = 2.019436802675439f*fZ*fTmpC + -0.998436277385793f*fTmpB;
+		out( 212, fTmpA*fC1 );
+		out( 208, fTmpA*fS1 );
+		fTmpB = 2.016896949069888f*fZ*fTmpA + -0.998742296068792f*fTmpC;
+		out( 242, fTmpB*fC1 );
+		out( 238, fTmpB*fS1 );
+		fTmpC = 2.014825999813336f*fZ*fTmpB + -0.9989732002631536f*fTmpA;
+		out( 274, fTmpC*fC1 );
+		out( 270, fTmpC*fS1 );
+		fTmpA = 2.013114894621608f*fZ*fTmpC + -0.9991507429465936f*fTmpB;
+		out( 308, fTmpA*fC1 );
+		out( 304, fTmpA*fS1 );
+		fTmpB = 2.011684617428885f*fZ*fTmpA + -0.9992895203365968f*fTmpC;
+		out( 344, fTmpB*fC1 );
+		out( 340, fTmpB*fS1 );
+		fC0 = fX*fC1 - fY*fS1;
+		fS0 = fX*fS1 + fY*fC1;
+
+		fTmpA = -0.5900435899266435f;
+		out( 15, fTmpA*fC0 );
+		out( 9, fTmpA*fS0 );
+		fTmpB = -1.770130769779931f*fZ;
+		out( 23, fTmpB*fC0 );
+		out( 17, fTmpB*fS0 );
+		fTmpC = -4.403144694917254f*fZ2 + 0.4892382994352505f;
+		out( 33, fTmpC*fC0 );
+		out( 27, fTmpC*fS0 );
+		fTmpA = fZ*( -10.13325785466416f*fZ2 + 2.763615778544771f );
+		out( 45, fTmpA*fC0 );
+		out( 39, fTmpA*fS0 );
+		fTmpB = 2.207940216581962f*fZ*fTmpA + -0.959403223600247f*fTmpC;
+		out( 59, fTmpB*fC0 );
+		out( 53, fTmpB*fS0 );
+		fTmpC = 2.15322168769582f*fZ*fTmpB + -0.9752173865600178f*fTmpA;
+		out( 75, fTmpC*fC0 );
+		out( 69, fTmpC*fS0 );
+		fTmpA = 2.118044171189805f*fZ*fTmpC + -0.9836628449792094f*fTmpB;
+		out( 93, fTmpA*fC0 );
+		out( 87, fTmpA*fS0 );
+		fTmpB = 2.093947321356338f*fZ*fTmpA + -0.9886230654859614f*fTmpC;
+		out( 113, fTmpB*fC0 );
+		out( 107, fTmpB*fS0 );
+		fTmpC = 2.076655965729519f*fZ*fTmpB + -0.9917422203269092f*fTmpA;
+		out( 135, fTmpC*fC0 );
+		out( 129, fTmpC*fS0 );
+		fTmpA = 2.063797291222968f*fZ*fTmpC + -0.9938079899999066f*fTmpB;
+		out( 159, fTmpA*fC0 );
+		out( 153, fTmpA*fS0 );
+		fTmpB = 2.053959590644373f*fZ*fTmpA + -0.9952332040455557f*fTmpC;
+		out( 185, fTmpB*fC0 );
+		out( 179, fTmpB*fS0 );
+		fTmpC = 2.046256527271464f*fZ*fTmpB + -0.9962496519366806f*fTmpA;
+		out( 213, fTmpC*fC0 );
+		out( 207, fTmpC*fS0 );
+		fTmpA = 2.040107114108727f*fZ*fTmpC + -0.9969947985109489f*fTmpB;
+		out( 243, fTmpA*fC0 );
+		out( 237, fTmpA*fS0 );
+		fTmpB = 2.035116803738375f*fZ*fTmpA + -0.9975538978635777f*fTmpC;
+		out( 275, fTmpB*fC0 );
+		out( 269, fTmpB*fS0 );
+		fTmpC = 2.03100960115899f*fZ*fTmpB + -0.9979818344716921f*fTmpA;
+		out( 309, fTmpC*fC0 );
+		out( 303, fTmpC*fS0 );
+		fTmpA = 2.027587510099407f*fZ*fTmpC + -0.9983150788368354f*fTmpB;
+		out( 345, fTmpA*fC0 );
+		out( 339, fTmpA*fS0 );
+		fC1 = fX*fC0 - fY*fS0;
+		fS1 = fX*fS0 + fY*fC0;
+
+		fTmpA = 0.6258357354491763f;
+		out( 24, fTmpA*fC1 );
+		out( 16, fTmpA*fS1 );
+		fTmpB = 2.075662314881041f*fZ;
+		out( 34, fTmpB*fC1 );
+		out( 26, fTmpB*fS1 );
+		fTmpC = 5.550213908015966f*fZ2 + -0.5045649007287241f;
+		out( 46, fTmpC*fC1 );
+		out( 38, fTmpC*fS1 );
+		fTmpA = fZ*( 13.49180504672677f*fZ2 + -3.113493472321562f );
+		out( 60, fTmpA*fC1 );
+		out( 52, fTmpA*fS1 );
+		fTmpB = 2.304886114323221f*fZ*fTmpA + -0.9481763873554654f*fTmpC;
+		out( 76, fTmpB*fC1 );
+		out( 68, fTmpB*fS1 );
+		fTmpC = 2.229177150706235f*fZ*fTmpB + -0.9671528397231821f*fTmpA;
+		out( 94, fTmpC*fC1 );
+		out( 86, fTmpC*fS1 );
+		fTmpA = 2.179449471770337f*fZ*fTmpC + -0.9776923610938036f*fTmpB;
+		out( 114, fTmpA*fC1 );
+		out( 106, fTmpA*fS1 );
+		fTmpB = 2.144761058952722f*fZ*fTmpA + -0.9840838646332836f*fTmpC;
+		out( 136, fTmpB*fC1 );
+		out( 128, fTmpB*fS1 );
+		fTmpC = 2.119478119726646f*fZ*fTmpB + -0.9882117688026186f*fTmpA;
+		out( 160, fTmpC*fC1 );
+		out( 152, fTmpC*fS1 );
+		fTmpA = 2.100420126042015f*fZ*fTmpC + -0.9910081668184009f*fTmpB;
+		out( 186, fTmpA*fC1 );
+		out( 178, fTmpA*fS1 );
+		fTmpB = 2.085665361461421f*fZ*fTmpA + -0.9929753269845127f*fTmpC;
+		out( 214, fTmpB*fC1 );
+		out( 206, fTmpB*fS1 );
+		fTmpC = 2.073990213742235f*fZ*fTmpB + -0.9944021951292297f*fTmpA;
+		out( 244, fTmpC*fC1 );
+		out( 236, fTmpC*fS1 );
+		fTmpA = 2.064582282206258f*fZ*fTmpC + -0.9954638496008124f*fTmpB;
+		out( 276, fTmpA*fC1 );
+		out( 268, fTmpA*fS1 );
+		fTmpB = 2.056883378018606f*fZ*fTmpA + -0.996270962773436f*fTmpC;
+		out( 310, fTmpB*fC1 );
+		out( 302, fTmpB*fS1 );
+		fTmpC = 2.050498830661811f*fZ*fTmpB + -0.9968960090664231f*fTmpA;
+		out( 346, fTmpC*fC1 );
+		out( 338, fTmpC*fS1 );
+		fC0 = fX*fC1 - fY*fS1;
+		fS0 = fX*fS1 + fY*fC1;
+
+		fTmpA = -0.6563820568401703f;
+		out( 35, fTmpA*fC0 );
+		out( 25, fTmpA*fS0 );
+		fTmpB = -2.366619162231753f*fZ;
+		out( 47, fTmpB*fC0 );
+		out( 37, fTmpB*fS0 );
+		fTmpC = -6.745902523363385f*fZ2 + 0.5189155787202604f;
+		out( 61, fTmpC*fC0 );
+		out( 51, fTmpC*fS0 );
+		fTmpA = fZ*( -17.24955311049054f*fZ2 + 3.449910622098108f );
+		out( 77, fTmpA*fC0 );
+		out( 67, fTmpA*fS0 );
+		fTmpB = 2.401636346922062f*fZ*fTmpA + -0.9392246042043708f*fTmpC;
+		out( 95, fTmpB*fC0 );
+		out( 85, fTmpB*fS0 );
+		fTmpC = 2.306512518934159f*fZ*fTmpB + -0.9603920767980496f*fTmpA;
+		out( 115, fTmpC*fC0 );
+		out( 105, fTmpC*fS0 );
+		fTmpA = 2.243044805615795f*fZ*fTmpC + -0.9724832565193738f*fTmpB;
+		out( 137, fTmpA*fC0 );
+		out( 127, fTmpA*fS0 );
+		fTmpB = 2.198165774710643f*fZ*fTmpA + -0.9799919151000504f*fTmpC;
+		out( 161, fTmpB*fC0 );
+		out( 151, fTmpB*fS0 );
+		fTmpC = 2.165063509461097f*fZ*fTmpB + -0.9849409604906143f*fTmpA;
+		out( 187, fTmpC*fC0 );
+		out( 177, fTmpC*fS0 );
+		fTmpA = 2.139847510553276f*fZ*fTmpC + -0.9883532289941477f*fTmpB;
+		out( 215, fTmpA*fC0 );
+		out( 205, fTmpA*fS0 );
+		fTmpB = 2.120141504711419f*fZ*fTmpA + -0.99079092984679f*fTmpC;
+		out( 245, fTmpB*fC0 );
+		out( 235, fTmpB*fS0 );
+		fTmpC = 2.104417123236605f*fZ*fTmpB + -0.9925833339709304f*fTmpA;
+		out( 277, fTmpC*fC0 );
+		out( 267, fTmpC*fS0 );
+		fTmpA = 2.091650066335189f*fZ*fTmpC + -0.9939332099323633f*fTmpB;
+		out( 311, fTmpA*fC0 );
+		out( 301, fTmpA*fS0 );
+		fTmpB = 2.081130384894173f*fZ*fTmpA + -0.9949706303122452f*fTmpC;
+		out( 347, fTmpB*fC0 );
+		out( 337, fTmpB*fS0 );
+		fC1 = fX*fC0 - fY*fS0;
+		fS1 = fX*fS0 + fY*fC0;
+
+		fTmpA = 0.6831841051919144f;
+		out( 48, fTmpA*fC1 );
+		out( 36, fTmpA*fS1 );
+		fTmpB = 2.645960661801901f*fZ;
+		out( 62, fTmpB*fC1 );
+		out( 50, fTmpB*fS1 );
+		fTmpC = 7.984991490893139f*fZ2 + -0.5323327660595426f;
+		out( 78, fTmpC*fC1 );
+		out( 66, fTmpC*fS1 );
+		fTmpA = fZ*( 21.39289019090864f*fZ2 + -3.775215916042701f );
+		out( 96, fTmpA*fC1 );
+		out( 84, fTmpA*fS1 );
+		fTmpB = 2.496873044429773f*fZ*fTmpA + -0.9319689782769534f*fTmpC;
+		out( 116, fTmpB*fC1 );
+		out( 104, fTmpB*fS1 );
+		fTmpC = 2.383768642544085f*fZ*fTmpB + -0.9547015807880142f*fTmpA;
+		out( 138, fTmpC*fC1 );
+		out( 126, fTmpC*fS1 );
+		fTmpA = 2.307395517477243f*fZ*fTmpC + -0.9679611839405133f*fTmpB;
+		out( 162, fTmpA*fC1 );
+		out( 150, fTmpA*fS1 );
+		fTmpB = 2.252817784447915f*fZ*fTmpA + -0.9763466069791972f*fTmpC;
+		out( 188, fTmpB*fC1 );
+		out( 176, fTmpB*fS1 );
+		fTmpC = 2.212182180562893f*fZ*fTmpB + -0.9819623210693983f*fTmpA;
+		out( 216, fTmpC*fC1 );
+		out( 204, fTmpC*fS1 );
+		fTmpA = 2.180966243804281f*fZ*fTmpC + -0.9858890750350997f*fTmpB;
+		out( 246, fTmpA*fC1 );
+		out( 234, fTmpA*fS1 );
+		fTmpB = 2.156385865284782f*fZ*fTmpA + -0.9887295924045926f*fTmpC;
+		out( 278, fTmpB*fC1 );
+		out( 266, fTmpB*fS1 );
+		fTmpC = 2.13663693483576f*fZ*fTmpB + -0.9908416528011255f*fTmpA;
+		out( 312, fTmpC*fC1 );
+		out( 300, fTmpC*fS1 );
+		fTmpA = 2.120501774999912f*fZ*fTmpC + -0.9924483380527693f*fTmpB;
+		out( 348, fTmpA*fC1 );
+		out( 336, fTmpA*fS1 );
+		fC0 = fX*fC1 - fY*fS1;
+		fS0 = fX*fS1 + fY*fC1;
+
+		fTmpA = -0.7071627325245963f;
+		out( 63, fTmpA*fC0 );
+		out( 49, fTmpA*fS0 );
+		fTmpB = -2.91570664069932f*fZ;
+		out( 79, fTmpB*fC0 );
+		out( 65, fTmpB*fS0 );
+		fTmpC = -9.263393182848905f*fZ2 + 0.5449054813440533f;
+		out( 97, fTmpC*fC0 );
+		out( 83, fTmpC*fS0 );
+		fTmpA = fZ*( -25.9102413133663f*fZ2 + 4.091090733689416f );
+		out( 117, fTmpA*fC0 );
+		out( 103, fTmpA*fS0 );
+		fTmpB = 2.590045044653342f*fZ*fTmpA + -0.9259892765852515f*fTmpC;
+		out( 139, fTmpB*fC0 );
+		out( 125, fTmpB*fS0 );
+		fTmpC = 2.460209661583209f*fZ*fTmpB + -0.9498713802919554f*fTmpA;
+		out( 163, fTmpC*fC0 );
+		out( 149, fTmpC*fS0 );
+		fTmpA = 2.371708245126284f*fZ*fTmpC + -0.9640268803757269f*fTmpB;
+		out( 189, fTmpA*fC0 );
+		out( 175, fTmpA*fS0 );
+		fTmpB = 2.307927774486216f*fZ*fTmpA + -0.9731077923386515f*fTmpC;
+		out( 217, fTmpB*fC0 );
+		out( 203, fTmpB*fS0 );
+		fTmpC = 2.260078437898682f*fZ*fTmpB + -0.9792674029419375f*fTmpA;
+		out( 247, fTmpC*fC0 );
+		out( 233, fTmpC*fS0 );
+		fTmpA = 2.223067472099586f*fZ*fTmpC + -0.9836240348217709f*fTmpB;
+		out( 279, fTmpA*fC0 );
+		out( 265, fTmpA*fS0 );
+		fTmpB = 2.19374109684803f*fZ*fTmpA + -0.9868081488215654f*fTmpC;
+		out( 313, fTmpB*fC0 );
+		out( 299, fTmpB*fS0 );
+		fTmpC = 2.170043987823959f*fZ*fTmpB + -0.9891978551807596f*fTmpA;
+		out( 349, fTmpC*fC0 );
+		out( 335, fTmpC*fS0 );
+		fC1 = fX*fC0 - fY*fS0;
+		fS1 = fX*fS0 + fY*fC0;
+
+		fTmpA = 0.72892666017483f;
+		out( 80, fTmpA*fC1 );
+		out( 64, fTmpA*fS1 );
+		fTmpB = 3.177317648954698f*fZ;
+		out( 98, fTmpB*fC1 );
+		out( 82, fTmpB*fS1 );
+		fTmpC = 10.57781172168795f*fZ2 + -0.5567269327204184f;
+		out( 118, fTmpC*fC1 );
+		out( 102, fTmpC*fS1 );
+		fTmpA = fZ*( 30.79157970335749f*fZ2 + -4.398797100479641f );
+		out( 140, fTmpA*fC1 );
+		out( 124, fTmpA*fS1 );
+		fTmpB = 2.680951323690902f*fZ*fTmpA + -0.9209854970162591f*fTmpC;
+		out( 164, fTmpB*fC1 );
+		out( 148, fTmpB*fS1 );
+		fTmpC = 2.53546276418555f*fZ*fTmpB + -0.9457324874869209f*fTmpA;
+		out( 190, fTmpC*fC1 );
+		out( 174, fTmpC*fS1 );
+		fTmpA = 2.435532422657966f*fZ*fTmpC + -0.9605869417846947f*fTmpB;
+		out( 218, fTmpA*fC1 );
+		out( 202, fTmpA*fS1 );
+		fTmpB = 2.363017336304797f*fZ*fTmpA + -0.9702261872276653f*fTmpC;
+		out( 248, fTmpB*fC1 );
+		out( 232, fTmpB*fS1 );
+		fTmpC = 2.308273164077423f*fZ*fTmpB + -0.9768329366922968f*fTmpA;
+		out( 280, fTmpC*fC1 );
+		out( 264, fTmpC*fS1 );
+		fTmpA = 2.265686062395524f*fZ*fTmpC + -0.9815502331592888f*fTmpB;
+		out( 314, fTmpA*fC1 );
+		out( 298, fTmpA*fS1 );
+		fTmpB = 2.231763704062155f*fZ*fTmpA + -0.9850277764000974f*fTmpC;
+		out( 350, fTmpB*fC1 );
+		out( 334, fTmpB*fS1 );
+		fC0 = fX*fC1 - fY*fS1;
+		fS0 = fX*fS1 + fY*fC1;
+
+		fTmpA = -0.7489009518531884f;
+		out( 99, fTmpA*fC0 );
+		out( 81, fTmpA*fS0 );
+		fTmpB = -3.431895299891715f*fZ;
+		out( 119, fTmpB*fC0 );
+		out( 101, fTmpB*fS0 );
+		fTmpC = -11.92552753945219f*fZ2 + 0.5678822637834374f;
+		out( 141, fTmpC*fC0 );
+		out( 123, fTmpC*fS0 );
+		fTmpA = fZ*( -36.02809068931077f*fZ2 + 4.699316176866623f );
+		out( 165, fTmpA*fC0 );
+		out( 147, fTmpA*fS0 );
+		fTmpB = 2.769558547034986f*fZ*fTmpA + -0.9167415228748209f*fTmpC;
+		out( 191, fTmpB*fC0 );
+		out( 173, fTmpB*fS0 );
+		fTmpC = 2.609347744585592f*fZ*fTmpB + -0.9421529461361585f*fTmpA;
+		out( 219, fTmpC*fC0 );
+		out( 201, fTmpC*fS0 );
+		fTmpA = 2.498610725094158f*fZ*fTmpC + -0.9575614175146977f*fTmpB;
+		out( 249, fTmpA*fC0 );
+		out( 231, fTmpA*fS0 );
+		fTmpB = 2.417791199776004f*fZ*fTmpA + -0.9676542149977727f*fTmpC;
+		out( 281, fTmpB*fC0 );
+		out( 263, fTmpB*fS0 );
+		fTmpC = 2.356455943866682f*fZ*fTmpB + -0.9746316985871221f*fTmpA;
+		out( 315, fTmpC*fC0 );
+		out( 297, fTmpC*fS0 );
+		fTmpA = 2.308509932184803f*fZ*fTmpC + -0.9796533383929068f*fTmpB;
+		out( 351, fTmpA*fC0 );
+		out( 333, fTmpA*fS0 );
+		fC1 = fX*fC0 - fY*fS0;
+		fS1 = fX*fS0 + fY*fC0;
+
+		fTmpA = 0.7673951182219901f;
+		out( 120, fTmpA*fC1 );
+		out( 100, fTmpA*fS1 );
+		fTmpB = 3.680297698805312f*fZ;
+		out( 142, fTmpB*fC1 );
+		out( 122, fTmpB*fS1 );
+		fTmpC = 13.30425420025764f*fZ2 + -0.5784458347938103f;
+		out( 166, fTmpC*fC1 );
+		out( 146, fTmpC*fS1 );
+		fTmpA = fZ*( 41.61193153549645f*fZ2 + -4.993431784259574f );
+		out( 192, fTmpA*fC1 );
+		out( 172, fTmpA*fS1 );
+		fTmpB = 2.855914914698966f*fZ*fTmpA + -0.9130991183874837f*fTmpC;
+		out( 220, fTmpB*fC1 );
+		out( 200, fTmpB*fS1 );
+		fTmpC = 2.681790446697877f*fZ*fTmpB + -0.9390302326218141f*fTmpA;
+		out( 250, fTmpC*fC1 );
+		out( 230, fTmpC*fS1 );
+		fTmpA = 2.560799154110355f*fZ*fTmpC + -0.9548841361798045f*fTmpB;
+		out( 282, fTmpA*fC1 );
+		out( 262, fTmpA*fS1 );
+		fTmpB = 2.472066162365221f*fZ*fTmpA + -0.9653494919339113f*fTmpC;
+		out( 316, fTmpB*fC1 );
+		out( 296, fTmpB*fS1 );
+		fTmpC = 2.404423007708918f*fZ*fTmpB + -0.9726369966604846f*fTmpA;
+		out( 352, fTmpC*fC1 );
+		out( 332, fTmpC*fS1 );
+		fC0 = fX*fC1 - fY*fS1;
+		fS0 = fX*fS1 + fY*fC1;
+
+		fTmpA = -0.7846421057871971f;
+		out( 143, fTmpA*fC0 );
+		out( 121, fTmpA*fS0 );
+		fTmpB = -3.923210528935984f*fZ;
+		out( 167, fTmpB*fC0 );
+		out( 145, fTmpB*fS0 );
+		fTmpC = -14.71203948350994f*fZ2 + 0.5884815793403977f;
+		out( 193, fTmpC*fC0 );
+		out( 171, fTmpC*fS0 );
+		fTmpA = fZ*( -47.53605436066262f*fZ2 + 5.281783817851402f );
+		out( 221, fTmpA*fC0 );
+		out( 199, fTmpA*fS0 );
+		fTmpB = 2.940107271721691f*fZ*fTmpA + -0.9099403568319481f*fTmpC;
+		out( 251, fTmpB*fC0 );
+		out( 229, fTmpB*fS0 );
+		fTmpC = 2.752776376275011f*fZ*fTmpB + -0.9362843331437419f*fTmpA;
+		out( 283, fTmpC*fC0 );
+		out( 261, fTmpC*fS0 );
+		fTmpA = 2.622022120425379f*fZ*fTmpC + -0.9525009525014289f*fTmpB;
+		out( 317, fTmpA*fC0 );
+		out( 295, fTmpA*fS0 );
+		fTmpB = 2.525729665824827f*fZ*fTmpA + -0.9632754987646973f*fTmpC;
+		out( 353, fTmpB*fC0 );
+		out( 331, fTmpB*fS0 );
+		fC1 = fX*fC0 - fY*fS0;
+		fS1 = fX*fS0 + fY*fC0;
+
+		fTmpA = 0.8008219957839717f;
+		out( 168, fTmpA*fC1 );
+		out( 144, fTmpA*fS1 );
+		fTmpB = 4.161193153549645f*fZ;
+		out( 194, fTmpB*fC1 );
+		out( 170, fTmpB*fS1 );
+		fTmpC = 16.1471947939282f*fZ2 + -0.5980442516269705f;
+		out( 222, fTmpC*fC1 );
+		out( 198, fTmpC*fS1 );
+		fTmpA = fZ*( 53.79407212305809f*fZ2 + -5.564904012730148f );
+		out( 252, fTmpA*fC1 );
+		out( 228, fTmpA*fS1 );
+		fTmpB = 3.022238999720004f*fZ*fTmpA + -0.9071758265604122f*fTmpC;
+		out( 284, fTmpB*fC1 );
+		out( 260, fTmpB*fS1 );
+		fTmpC = 2.822324793743503f*fZ*fTmpB + -0.9338522843510981f*fTmpA;
+		out( 318, fTmpC*fC1 );
+		out( 294, fTmpC*fS1 );
+		fTmpA = 2.682246156571846f*fZ*fTmpC + -0.950367641072997f*fTmpB;
+		out( 354, fTmpA*fC1 );
+		out( 330, fTmpA*fS1 );
+		fC0 = fX*fC1 - fY*fS1;
+		fS0 = fX*fS1 + fY*fC1;
+
+		fTmpA = -0.8160771188376284f;
+		out( 195, fTmpA*fC0 );
+		out( 169, fTmpA*fS0 );
+		fTmpB = -4.394709780272119f*fZ;
+		out( 223, fTmpB*fC0 );
+		out( 197, fTmpB*fS0 );
+		fTmpC = -17.60824338884482f*fZ2 + 0.6071808065118906f;
+		out( 253, fTmpC*fC0 );
+		out( 227, fTmpC*fS0 );
+		fTmpA = fZ*( -60.38015494295203f*fZ2 + 5.843240800930841f );
+		out( 285, fTmpA*fC0 );
+		out( 259, fTmpA*fS0 );
+		fTmpB = 3.102418411497714f*fZ*fTmpA + -0.9047366396343047f*fTmpC;
+		out( 319, fTmpB*fC0 );
+		out( 293, fTmpB*fS0 );
+		fTmpC = 2.890473786367456f*fZ*fTmpB + -0.9316840615873149f*fTmpA;
+		out( 355, fTmpC*fC0 );
+		out( 329, fTmpC*fS0 );
+		fC1 = fX*fC0 - fY*fS0;
+		fS1 = fX*fS0 + fY*fC0;
+
+		fTmpA = 0.830522083064524f;
+		out( 224, fTmpA*fC1 );
+		out( 196, fTmpA*fS1 );
+		fTmpB = 4.624151256630013f*fZ;
+		out( 254, fTmpB*fC1 );
+		out( 226, fTmpB*fS1 );
+		fTmpC = 19.09388150936025f*fZ2 + -0.6159316615922662f;
+		out( 286, fTmpC*fC1 );
+		out( 258, fTmpC*fS1 );
+		fTmpA = fZ*( 67.28894837384407f*fZ2 + -6.117177124894916f );
+		out( 320, fTmpA*fC1 );
+		out( 292, fTmpA*fS1 );
+		fTmpB = 3.180752662499868f*fZ*fTmpA + -0.9025689346627115f*fTmpC;
+		out( 356, fTmpB*fC1 );
+		out( 328, fTmpB*fS1 );
+		fC0 = fX*fC1 - fY*fS1;
+		fS0 = fX*fS1 + fY*fC1;
+
+		fTmpA = -0.8442506508573726f;
+		out( 255, fTmpA*fC0 );
+		out( 225, fTmpA*fS0 );
+		fTmpB = -4.849850753230682f*fZ;
+		out( 287, fTmpB*fC0 );
+		out( 257, fTmpB*fS0 );
+		fTmpC = -20.60294860554973f*fZ2 + 0.6243317759257494f;
+		out( 321, fTmpC*fC0 );
+		out( 291, fTmpC*fS0 );
+		fTmpA = fZ*( -74.51550792153199f*fZ2 + 6.387043536131314f );
+		out( 357, fTmpA*fC0 );
+		out( 327, fTmpA*fS0 );
+		fC1 = fX*fC0 - fY*fS0;
+		fS1 = fX*fS0 + fY*fC0;
+
+		fTmpA = 0.8573405888380252f;
+		out( 288, fTmpA*fC1 );
+		out( 256, fTmpA*fS1 );
+		fTmpB = 5.07209532485536f*fZ;
+		out( 322, fTmpB*fC1 );
+		out( 290, fTmpB*fS1 );
+		fTmpC = 22.13440412464915f*fZ2 + -0.632411546418547f;
+		out( 358, fTmpC*fC1 );
+		out( 326, fTmpC*fS1 );
+		fC0 = fX*fC1 - fY*fS1;
+		fS0 = fX*fS1 + fY*fC1;
+
+		fTmpA = -0.8698571719206282f;
+		out( 323, fTmpA*fC0 );
+		out( 289, fTmpA*fS0 );
+		fTmpB = -5.291134612069974f*fZ;
+		out( 359, fTmpB*fC0 );
+		out( 325, fTmpB*fS0 );
+		fC1 = fX*fC0 - fY*fS0;
+		fS1 = fX*fS0 + fY*fC0;
+
+		fTmpC = 0.8818557686783287f;
+		out( 360, fTmpC*fC1 );
+		out( 324, fTmpC*fS1 );
+	}
+};
+
+// order 20
+template<>
+struct SHKernel<20>
+{
+	template<typename T, typename O>
+	static FORCEINLINE void Eval( const T fX, const T fY, const T fZ, const O &out )
+	{
+		T fC0, fC1, fS0, fS1, fTmpA, fTmpB, fTmpC;
+		T fZ2 = fZ*fZ;
+
+		out( 0, 0.2820947917738781f );
+		out( 2, 0.4886025119029199f*fZ );
+		const T fP6 = 0.9461746957575601f*fZ2 + -0.3153915652525201f;
+		out( 6, fP6 );
+		const T fP12 = fZ*( 1.865881662950577f*fZ2 + -1.119528997770346f );
+		out( 12, fP12 );
+		const T fP20 = 1.984313483298443f*fZ*fP12 + -1.006230589874905f*fP6;
+		out( 20, fP20 );
+		const T fP30 = 1.98997487421324f*fZ*fP20 + -1.002853072844814f*fP12;
+		out( 30, fP30 );
+		const T fP42 = 1.993043457183567f*fZ*fP30 + -1.001542020962219f*fP20;
+		out( 42, fP42 );
+		const T fP56 = 1.994891434824135f*fZ*fP42 + -1.000927213921958f*fP30;
+		out( 56, fP56 );
+		const T fP72 = 1.996089927833914f*fZ*fP56 + -1.000600781069515f*fP42;
+		out( 72, fP72 );
+		const T fP90 = 1.996911195067937f*fZ*fP72 + -1.000411437993134f*fP56;
+		out( 90, fP90 );
+		const T fP110 = 1.997498435543818f*fZ*fP90 + -1.00029407440718f*fP72;
+		out( 110, fP110 );
+		const T fP132 = 1.997932815985082f*fZ*fP110 + -1.000217462218511f*fP90;
+		out( 132, fP132 );
+		const T fP156 = 1.998263134713633f*fZ*fP132 + -1.000165330248298f*fP110;
+		out( 156, fP156 );
+		const T fP182 = 1.998520162579474f*fZ*fP156 + -1.000128625635621f*fP132;
+		out( 182, fP182 );
+		const T fP210 = 1.998724082804747f*fZ*fP182 + -1.000102035610694f*fP156;
+		out( 210, fP210 );
+		const T fP240 = 1.998888580075327f*fZ*fP210 + -1.00008230114001f*fP182;
+		out( 240, fP240 );
+		const T fP272 = 1.999023198964935f*fZ*fP240 + -1.00006734687013f*fP210;
+		out( 272, fP272 );
+		const T fP306 = 1.999134760937227f*fZ*fP272 + -1.000055808242921f*fP240;
+		out( 306, fP306 );
+		const T fP342 = 1.999228246160731f*fZ*fP306 + -1.000046762842271f*fP272;
+		out( 342, fP342 );
+		out( 380, 1.999307359286587f*fZ*fP342 + -1.000039571832785f*fP306 );
+		fC0 = fX;
+		fS0 = fY;
+
+		fTmpA = -0.48860251190292f;
+		out( 3, fTmpA*fC0 );
+		out( 1, fTmpA*fS0 );
+		fTmpB = -1.092548430592079f*fZ;
+		out( 7, fTmpB*fC0 );
+		out( 5, fTmpB*fS0 );
+		fTmpC = -2.285228997322329f*fZ2 + 0.4570457994644658f;
+		out( 13, fTmpC*fC0 );
+		out( 11, fTmpC*fS0 );
+		fTmpA = fZ*( -4.683325804901025f*fZ2 + 2.007139630671868f );
+		out( 21, fTmpA*fC0 );
+		out( 19, fTmpA*fS0 );
+		fTmpB = 2.03100960115899f*fZ*fTmpA + -0.991031208965115f*fTmpC;
+		out( 31, fTmpB*fC0 );
+		out( 29, fTmpB*fS0 );
+		fTmpC = 2.021314989237028f*fZ*fTmpB + -0.9952267030562385f*fTmpA;
+		out( 43, fTmpC*fC0 );
+		out( 41, fTmpC*fS0 );
+		fTmpA = 2.015564437074638f*fZ*fTmpC + -0.9971550440218319f*fTmpB;
+		out( 57, fTmpA*fC0 );
+		out( 55, fTmpA*fS0 );
+		fTmpB = 2.011869540407391f*fZ*fTmpA + -0.9981668178901745f*fTmpC;
+		out( 73, fTmpB*fC0 );
+		out( 71, fTmpB*fS0 );
+		fTmpC = 2.009353129741012f*fZ*fTmpB + -0.9987492177719088f*fTmpA;
+		out( 91, fTmpC*fC0 );
+		out( 89, fTmpC*fS0 );
+		fTmpA = 2.007561463642653f*fZ*fTmpC + -0.9991083368712843f*fTmpB;
+		out( 111, fTmpA*fC0 );
+		out( 109, fTmpA*fS0 );
+		fTmpB = 2.006240264773888f*fZ*fTmpA + -0.9993418887079215f*fTmpC;
+		out( 133, fTmpB*fC0 );
+		out( 131, fTmpB*fS0 );
+		fTmpC = 2.005237896355199f*fZ*fTmpB + -0.9995003746877732f*fTmpA;
+		out( 157, fTmpC*fC0 );
+		out( 155, fTmpC*fS0 );
+		fTmpA = 2.004459314343183f*fZ*fTmpC + -0.9996117258638336f*fTmpB;
+		out( 183, fTmpA*fC0 );
+		out( 181, fTmpA*fS0 );
+		fTmpB = 2.003842462716222f*fZ*fTmpA + -0.9996922603404586f*fTmpC;
+		out( 211, fTmpB*fC0 );
+		out( 209, fTmpB*fS0 );
+		fTmpC = 2.003345416333104f*fZ*fTmpB + -0.9997519533634172f*fTmpA;
+		out( 241, fTmpC*fC0 );
+		out( 239, fTmpC*fS0 );
+		fTmpA = 2.002939017015334f*fZ*fTmpC + -0.9997971396672504f*fTmpB;
+		out( 273, fTmpA*fC0 );
+		out( 271, fTmpA*fS0 );
+		fTmpB = 2.002602473449653f*fZ*fTmpA + -0.9998319751311335f*fTmpC;
+		out( 307, fTmpB*fC0 );
+		out( 305, fTmpB*fS0 );
+		fTmpC = 2.002320635087347f*fZ*fTmpB + -0.9998592639497642f*fTmpA;
+		out( 343, fTmpC*fC0 );
+		out( 341, fTmpC*fS0 );
+		fTmpA = 2.0020822493927f*fZ*fTmpC + -0.9998809452939409f*fTmpB;
+		out( 381, fTmpA*fC0 );
+		out( 379, fTmpA*fS0 );
+		fC1 = fX*fC0 - fY*fS0;
+		fS1 = fX*fS0 + fY*fC0;
+
+		fTmpA = 0.5462742152960395f;
+		out( 8, fTmpA*fC1 );
+		out( 4, fTmpA*fS1 );
+		fTmpB = 1.445305721320277f*fZ;
+		out( 14, fTmpB*fC1 );
+		out( 10, fTmpB*fS1 );
+		fTmpC = 3.31161143515146f*fZ2 + -0.47308734787878f;
+		out( 22, fTmpC*fC1 );
+		out( 18, fTmpC*fS1 );
+		fTmpA = fZ*( 7.190305177459987f*fZ2 + -2.396768392486662f );
+		out( 32, fTmpA*fC1 );
+		out( 28, fTmpA*fS1 );
+		fTmpB = 2.11394181566097f*fZ*fTmpA + -0.9736101204623268f*fTmpC;
+		out( 44, fTmpB*fC1 );
+		out( 40, fTmpB*fS1 );
+		fTmpC = 2.081665999466133f*fZ*fTmpB + -0.9847319278346618f*fTmpA;
+		out( 58, fTmpC*fC1 );
+		out( 54, fTmpC*fS1 );
+		fTmpA = 2.06155281280883f*fZ*fTmpC + -0.9903379376602873f*fTmpB;
+		out( 74, fTmpA*fC1 );
+		out( 70, fTmpA*fS1 );
+		fTmpB = 2.048122358357819f*fZ*fTmpA + -0.9934852726704042f*fTmpC;
+		out( 92, fTmpB*fC1 );
+		out( 88, fTmpB*fS1 );
+		fTmpC = 2.038688303787511f*fZ*fTmpB + -0.9953938032404119f*fTmpA;
+		out( 112, fTmpC*fC1 );
+		out( 108, fTmpC*fS1 );
+		fTmpA = 2.031798495964875f*fZ*fTmpC + -0.9966204702259603f*fTmpB;
+		out( 134, fTmpA*fC1 );
+		out( 130, fTmpA*fS1 );
+		fTmpB = 2.026608708444444f*fZ*fTmpA + -0.9974457174120671f*fTmpC;
+		out( 158, fTmpB*fC1 );
+		out( 154, fTmpB*fS1 );
+		fTmpC = 2.022599587389726f*fZ*fTmpB + -0.9980217586956907f*fTmpA;
+		out( 184, fTmpC*fC1 );
+		out( 180, fTmpC*fS1 );
+		fTmpA = 2.019436802675439f*fZ*fTmpC + -0.998436277385793f*fTmpB;
+		out( 212, fTmpA*fC1 );
+		out( 208, fTmpA*fS1 );
+		fTmpB = 2.016896949069888f*fZ*fTmpA + -0.998742296068792f*fTmpC;
+		out( 242, fTmpB*fC1 );
+		out( 238, fTmpB*fS1 );
+		fTmpC = 2.014825999813336f*fZ*fTmpB + -0.9989732002631536f*fTmpA;
+		out( 274, fTmpC*fC1 );
+		out( 270, fTmpC*fS1 );
+		fTmpA = 2.013114894621608f*fZ*fTmpC + -0.9991507429465936f*fTmpB;
+		out( 308, fTmpA*fC1 );
+		out( 304, fTmpA*fS1 );
+		fTmpB = 2.011684617428885f*fZ*fTmpA + -0.9992895203365968f*fTmpC;
+		out( 344, fTmpB*fC1 );
+		out( 340, fTmpB*fS1 );
+		fTmpC = 2.010476761050147f*fZ*fTmpB + -0.9993995796516643f*fTmpA;
+		out( 382, fTmpC*fC1 );
+		out( 378, fTmpC*fS1 );
+		fC0 = fX*fC1 - fY*fS1;
+		fS0 = fX*fS1 + fY*fC1;
+
+		fTmpA = -0.5900435899266435f;
+		out( 15, fTmpA*fC0 );
+		out( 9, fTmpA*fS0 );
+		fTmpB = -1.770130769779931f*fZ;
+		out( 23, fTmpB*fC0 );
+		out( 17, fTmpB*fS0 );
+		fTmpC = -4.403144694917254f*fZ2 + 0.4892382994352505f;
+		out( 33, fTmpC*fC0 );
+		out( 27, fTmpC*fS0 );
+		fTmpA = fZ*( -10.13325785466416f*fZ2 + 2.763615778544771f );
+		out( 45, fTmpA*fC0 );
+		out( 39, fTmpA*fS0 );
+		fTmpB = 2.207940216581962f*fZ*fTmpA + -0.959403223600247f*fTmpC;
+		out( 59, fTmpB*fC0 );
+		out( 53, fTmpB*fS0 );
+		fTmpC = 2.15322168769582f*fZ*fTmpB + -0.9752173865600178f*fTmpA;
+		out( 75, fTmpC*fC0 );
+		out( 69, fTmpC*fS0 );
+		fTmpA = 2.118044171189805f*fZ*fTmpC + -0.9836628449792094f*fTmpB;
+		out( 93, fTmpA*fC0 );
+		out( 87, fTmpA*fS0 );
+		fTmpB = 2.093947321356338f*fZ*fTmpA + -0.9886230654859614f*fTmpC;
+		out( 113, fTmpB*fC0 );
+		out( 107, fTmpB*fS0 );
+		fTmpC = 2.076655965729519f*fZ*fTmpB + -0.9917422203269092f*fTmpA;
+		out( 135, fTmpC*fC0 );
+		out( 129, fTmpC*fS0 );
+		fTmpA = 2.063797291222968f*fZ*fTmpC + -0.9938079899999066f*fTmpB;
+		out( 159, fTmpA*fC0 );
+		out( 153, fTmpA*fS0 );
+		fTmpB = 2.053959590644373f*fZ*fTmpA + -0.9952332040455557f*fTmpC;
+		out( 185, fTmpB*fC0 );
+		out( 179, fTmpB*fS0 );
+		fTmpC = 2.046256527271464f*fZ*fTmpB + -0.9962496519366806f*fTmpA;
+		out( 213, fTmpC*fC0 );
+		out( 207, fTmpC*fS0 );
+		fTmpA = 2.040107114108727f*fZ*fTmpC + -0.9969947985109489f*fTmpB;
+		out( 243, fTmpA*fC0 );
+		out( 237, fTmpA*fS0 );
+		fTmpB = 2.035116803738375f*fZ*fTmpA + -0.9975538978635777f*fTmpC;
+		out( 275, fTmpB*fC0 );
+		out( 269, fTmpB*fS0 );
+		fTmpC = 2.03100960115899f*fZ*fTmpB + -0.9979818344716921f*fTmpA;
+		out( 309, fTmpC*fC0 );
+		out( 303, fTmpC*fS0 );
+		fTmpA = 2.027587510099407f*fZ*fTmpC + -0.9983150788368354f*fTmpB;
+		out( 345, fTmpA*fC0 );
+		out( 339, fTmpA*fS0 );
+		fTmpB = 2.024705365770985f*fZ*fTmpA + -0.9985785351734189f*fTmpC;
+		out( 383, fTmpB*fC0 );
+		out( 377, fTmpB*fS0 );
+		fC1 = fX*fC0 - fY*fS0;
+		fS1 = fX*fS0 + fY*fC0;
+
+		fTmpA = 0.6258357354491763f;
+		out( 24, fTmpA*fC1 );
+		out( 16, fTmpA*fS1 );
+		fTmpB = 2.075662314881041f*fZ;
+		out( 34, fTmpB*fC1 );
+		out( 26, fTmpB*fS1 );
+		fTmpC = 5.550213908015966f*fZ2 + -0.5045649007287241f;
+		out( 46, fTmpC*fC1 );
+		out( 38, fTmpC*fS1 );
+		fTmpA = fZ*( 13.49180504672677f*fZ2 + -3.113493472321562f );
+		out( 60, fTmpA*fC1 );
+		out( 52, fTmpA*fS1 );
+		fTmpB = 2.304886114323221f*fZ*fTmpA + -0.9481763873554654f*fTmpC;
+		out( 76, fTmpB*fC1 );
+		out( 68, fTmpB*fS1 );
+		fTmpC = 2.229177150706235f*fZ*fTmpB + -0.9671528397231821f*fTmpA;
+		out( 94, fTmpC*fC1 );
+		out( 86, fTmpC*fS1 );
+		fTmpA = 2.179449471770337f*fZ*fTmpC + -0.9776923610938036f*fTmpB;
+		out( 114, fTmpA*fC1 );
+		out( 106, fTmpA*fS1 );
+		fTmpB = 2.144761058952722f*fZ*fTmpA + -0.9840838646332836f*fTmpC;
+		out( 136, fTmpB*fC1 );
+		out( 128, fTmpB*fS1 );
+		fTmpC = 2.119478119726646f*fZ*fTmpB + -0.9882117688026186f*fTmpA;
+		out( 160, fTmpC*fC1 );
+		out( 152, fTmpC*fS1 );
+		fTmpA = 2.100420126042015f*fZ*fTmpC + -0.9910081668184009f*fTmpB;
+		out( 186, fTmpA*fC1 );
+		out( 178, fTmpA*fS1 );
+		fTmpB = 2.085665361461421f*fZ*fTmpA + -0.9929753269845127f*fTmpC;
+		out( 214, fTmpB*fC1 );
+		out( 206, fTmpB*fS1 );
+		fTmpC = 2.073990213742235f*fZ*fTmpB + -0.9944021951292297f*fTmpA;
+		out( 244, fTmpC*fC1 );
+		out( 236, fTmpC*fS1 );
+		fTmpA = 2.064582282206258f*fZ*fTmpC + -0.9954638496008124f*fTmpB;
+		out( 276, fTmpA*fC1 );
+		out( 268, fTmpA*fS1 );
+		fTmpB = 2.056883378018606f*fZ*fTmpA + -0.996270962773436f*fTmpC;
+		out( 310, fTmpB*fC1 );
+		out( 302, fTmpB*fS1 );
+		fTmpC = 2.050498830661811f*fZ*fTmpB + -0.9968960090664231f*fTmpA;
+		out( 346, fTmpC*fC1 );
+		out( 338, fTmpC*fS1 );
+		fTmpA = 2.045142707894041f*fZ*fTmpC + -0.9973878927958029f*fTmpB;
+		out( 384, fTmpA*fC1 );
+		out( 376, fTmpA*fS1 );
+		fC0 = fX*fC1 - fY*fS1;
+		fS0 = fX*fS1 + fY*fC1;
+
+		fTmpA = -0.6563820568401703f;
+		out( 35, fTmpA*fC0 );
+		out( 25, fTmpA*fS0 );
+		fTmpB = -2.366619162231753f*fZ;
+		out( 47, fTmpB*fC0 );
+		out( 37, fTmpB*fS0 );
+		fTmpC = -6.745902523363385f*fZ2 + 0.5189155787202604f;
+		out( 61, fTmpC*fC0 );
+		out( 51, fTmpC*fS0 );
+		fTmpA = fZ*( -17.24955311049054f*fZ2 + 3.449910622098108f );
+		out( 77, fTmpA*fC0 );
+		out( 67, fTmpA*fS0 );
+		fTmpB = 2.401636346922062f*fZ*fTmpA + -0.9392246042043708f*fTmpC;
+		out( 95, fTmpB*fC0 );
+		out( 85, fTmpB*fS0 );
+		fTmpC = 2.306512518934159f*fZ*fTmpB + -0.9603920767980496f*fTmpA;
+		out( 115, fTmpC*fC0 );
+		out( 105, fTmpC*fS0 );
+		fTmpA = 2.243044805615795f*fZ*fTmpC + -0.9724832565193738f*fTmpB;
+		out( 137, fTmpA*fC0 );
+		out( 127, fTmpA*fS0 );
+		fTmpB = 2.198165774710643f*fZ*fTmpA + -0.9799919151000504f*fTmpC;
+		out( 161, fTmpB*fC0 );
+		out( 151, fTmpB*fS0 );
+		fTmpC = 2.165063509461097f*fZ*fTmpB + -0.9849409604906143f*fTmpA;
+		out( 187, fTmpC*fC0 );
+		out( 177, fTmpC*fS0 );
+		fTmpA = 2.139847510553276f*fZ*fTmpC + -0.9883532289941477f*fTmpB;
+		out( 215, fTmpA*fC0 );
+		out( 205, fTmpA*fS0 );
+		fTmpB = 2.120141504711419f*fZ*fTmpA + -0.99079092984679f*fTmpC;
+		out( 245, fTmpB*fC0 );
+		out( 235, fTmpB*fS0 );
+		fTmpC = 2.104417123236605f*fZ*fTmpB + -0.9925833339709304f*fTmpA;
+		out( 277, fTmpC*fC0 );
+		out( 267, fTmpC*fS0 );
+		fTmpA = 2.091650066335189f*fZ*fTmpC + -0.9939332099323633f*fTmpB;
+		out( 311, fTmpA*fC0 );
+		out( 301, fTmpA*fS0 );
+		fTmpB = 2.081130384894173f*fZ*fTmpA + -0.9949706303122452f*fTmpC;
+		out( 347, fTmpB*fC0 );
+		out( 337, fTmpB*fS0 );
+		fTmpC = 2.072352010914858f*fZ*fTmpB + -0.9957819202280493f*fTmpA;
+		out( 385, fTmpC*fC0 );
+		out( 375, fTmpC*fS0 );
+		fC1 = fX*fC0 - fY*fS0;
+		fS1 = fX*fS0 + fY*fC0;
+
+		fTmpA = 0.6831841051919144f;
+		out( 48, fTmpA*fC1 );
+		out( 36, fTmpA*fS1 );
+		fTmpB = 2.645960661801901f*fZ;
+		out( 62, fTmpB*fC1 );
+		out( 50, fTmpB*fS1 );
+		fTmpC = 7.984991490893139f*fZ2 + -0.5323327660595426f;
+		out( 78, fTmpC*fC1 );
+		out( 66, fTmpC*fS1 );
+		fTmpA = fZ*( 21.39289019090864f*fZ2 + -3.775215916042701f );
+		out( 96, fTmpA*fC1 );
+		out( 84, fTmpA*fS1 );
+		fTmpB = 2.496873044429773f*fZ*fTmpA + -0.9319689782769534f*fTmpC;
+		out( 116, fTmpB*fC1 );
+		out( 104, fTmpB*fS1 );
+		fTmpC = 2.383768642544085f*fZ*fTmpB + -0.9547015807880142f*fTmpA;
+		out( 138, fTmpC*fC1 );
+		out( 126, fTmpC*fS1 );
+		fTmpA = 2.307395517477243f*fZ*fTmpC + -0.9679611839405133f*fTmpB;
+		out( 162, fTmpA*fC1 );
+		out( 150, fTmpA*fS1 );
+		fTmpB = 2.252817784447915f*fZ*fTmpA + -0.9763466069791972f*fTmpC;
+		out( 188, fTmpB*fC1 );
+		out( 176, fTmpB*fS1 );
+		fTmpC = 2.212182180562893f*fZ*fTmpB + -0.9819623210693983f*fTmpA;
+		out( 216, fTmpC*fC1 );
+		out( 204, fTmpC*fS1 );
+		fTmpA = 2.180966243804281f*fZ*fTmpC + -0.9858890750350997f*fTmpB;
+		out( 246, fTmpA*fC1 );
+		out( 234, fTmpA*fS1 );
+		fTmpB = 2.156385865284782f*fZ*fTmpA + -0.9887295924045926f*fTmpC;
+		out( 278, fTmpB*fC1 );
+		out( 266, fTmpB*fS1 );
+		fTmpC = 2.13663693483576f*fZ*fTmpB + -0.9908416528011255f*fTmpA;
+		out( 312, fTmpC*fC1 );
+		out( 300, fTmpC*fS1 );
+		fTmpA = 2.120501774999912f*fZ*fTmpC + -0.9924483380527693f*fTmpB;
+		out( 348, fTmpA*fC1 );
+		out( 336, fTmpA*fS1 );
+		fTmpB = 2.107130750570548f*fZ*fTmpA + -0.9936944054529902f*fTmpC;
+		out( 386, fTmpB*fC1 );
+		out( 374, fTmpB*fS1 );
+		fC0 = fX*fC1 - fY*fS1;
+		fS0 = fX*fS1 + fY*fC1;
+
+		fTmpA = -0.7071627325245963f;
+		out( 63, fTmpA*fC0 );
+		out( 49, fTmpA*fS0 );
+		fTmpB = -2.91570664069932f*fZ;
+		out( 79, fTmpB*fC0 );
+		out( 65, fTmpB*fS0 );
+		fTmpC = -9.263393182848905f*fZ2 + 0.5449054813440533f;
+		out( 97, fTmpC*fC0 );
+		out( 83, fTmpC*fS0 );
+		fTmpA = fZ*( -25.9102413133663f*fZ2 + 4.091090733689416f );
+		out( 117, fTmpA*fC0 );
+		out( 103, fTmpA*fS0 );
+		fTmpB = 2.590045044653342f*fZ*fTmpA + -0.9259892765852515f*fTmpC;
+		out( 139, fTmpB*fC0 );
+		out( 125, fTmpB*fS0 );
+		fTmpC = 2.460209661583209f*fZ*fTmpB + -0.9498713802919554f*fTmpA;
+		out( 163, fTmpC*fC0 );
+		out( 149, fTmpC*fS0 );
+		fTmpA = 2.371708245126284f*fZ*fTmpC + -0.9640268803757269f*fTmpB;
+		out( 189, fTmpA*fC0 );
+		out( 175, fTmpA*fS0 );
+		fTmpB = 2.307927774486216f*fZ*fTmpA + -0.9731077923386515f*fTmpC;
+		out( 217, fTmpB*fC0 );
+		out( 203, fTmpB*fS0 );
+		fTmpC = 2.260078437898682f*fZ*fTmpB + -0.9792674029419375f*fTmpA;
+		out( 247, fTmpC*fC0 );
+		out( 233, fTmpC*fS0 );
+		fTmpA = 2.223067472099586f*fZ*fTmpC + -0.9836240348217709f*fTmpB;
+		out( 279, fTmpA*fC0 );
+		out( 265, fTmpA*fS0 );
+		fTmpB = 2.19374109684803f*fZ*fTmpA + -0.9868081488215654f*fTmpC;
+		out( 313, fTmpB*fC0 );
+		out( 299, fTmpB*fS0 );
+		fTmpC = 2.170043987823959f*fZ*fTmpB + -0.9891978551807596f*fTmpA;
+		out( 349, fTmpC*fC0 );
+		out( 335, fTmpC*fS0 );
+		fTmpA = 2.150581316760656f*fZ*fTmpC + -0.9910312089651149f*fTmpB;
+		out( 387, fTmpA*fC0 );
+		out( 373, fTmpA*fS0 );
+		fC1 = fX*fC0 - fY*fS0;
+		fS1 = fX*fS0 + fY*fC0;
+
+		fTmpA = 0.72892666017483f;
+		out( 80, fTmpA*fC1 );
+		out( 64, fTmpA*fS1 );
+		fTmpB = 3.177317648954698f*fZ;
+		out( 98, fTmpB*fC1 );
+		out( 82, fTmpB*fS1 );
+		fTmpC = 10.57781172168795f*fZ2 + -0.5567269327204184f;
+		out( 118, fTmpC*fC1 );
+		out( 102, fTmpC*fS1 );
+		fTmpA = fZ*( 30.79157970335749f*fZ2 + -4.398797100479641f );
+		out( 140, fTmpA*fC1 );
+		out( 124, fTmpA*fS1 );
+		fTmpB = 2.680951323690902f*fZ*fTmpA + -0.9209854970162591f*fTmpC;
+		out( 164, fTmpB*fC1 );
+		out( 148, fTmpB*fS1 );
+		fTmpC = 2.53546276418555f*fZ*fTmpB + -0.9457324874869209f*fTmpA;
+		out( 190, fTmpC*fC1 );
+		out( 174, fTmpC*fS1 );
+		fTmpA = 2.435532422657966f*fZ*fTmpC + -0.9605869417846947f*fTmpB;
+		out( 218, fTmpA*fC1 );
+		out( 202, fTmpA*fS1 );
+		fTmpB = 2.363017336304797f*fZ*fTmpA + -0.9702261872276653f*fTmpC;
+		out( 248, fTmpB*fC1 );
+		out( 232, fTmpB*fS1 );
+		fTmpC = 2.308273164077423f*fZ*fTmpB + -0.9768329366922968f*fTmpA;
+		out( 280, fTmpC*fC1 );
+		out( 264, fTmpC*fS1 );
+		fTmpA = 2.265686062395524f*fZ*fTmpC + -0.9815502331592888f*fTmpB;
+		out( 314, fTmpA*fC1 );
+		out( 298, fTmpA*fS1 );
+		fTmpB = 2.231763704062155f*fZ*fTmpA + -0.9850277764000974f*fTmpC;
+		out( 350, fTmpB*fC1 );
+		out( 334, fTmpB*fS1 );
+		fTmpC = 2.20422001138404f*fZ*fTmpB + -0.9876583293168622f*fTmpA;
+		out( 388, fTmpC*fC1 );
+		out( 372, fTmpC*fS1 );
+		fC0 = fX*fC1 - fY*fS1;
+		fS0 = fX*fS1 + fY*fC1;
+
+		fTmpA = -0.7489009518531884f;
+		out( 99, fTmpA*fC0 );
+		out( 81, fTmpA*fS0 );
+		fTmpB = -3.431895299891715f*fZ;
+		out( 119, fTmpB*fC0 );
+		out( 101, fTmpB*fS0 );
+		fTmpC = -11.92552753945219f*fZ2 + 0.5678822637834374f;
+		out( 141, fTmpC*fC0 );
+		out( 123, fTmpC*fS0 );
+		fTmpA = fZ*( -36.02809068931077f*fZ2 + 4.699316176866623f );
+		out( 165, fTmpA*fC0 );
+		out( 147, fTmpA*fS0 );
+		fTmpB = 2.769558547034986f*fZ*fTmpA + -0.9167415228748209f*fTmpC;
+		out( 191, fTmpB*fC0 );
+		out( 173, fTmpB*fS0 );
+		fTmpC = 2.609347744585592f*fZ*fTmpB + -0.9421529461361585f*fTmpA;
+		out( 219, fTmpC*fC0 );
+		out( 201, fTmpC*fS0 );
+		fTmpA = 2.498610725094158f*fZ*fTmpC + -0.9575614175146977f*fTmpB;
+		out( 249, fTmpA*fC0 );
+		out( 231, fTmpA*fS0 );
+		fTmpB = 2.417791199776004f*fZ*fTmpA + -0.9676542149977727f*fTmpC;
+		out( 281, fTmpB*fC0 );
+		out( 263, fTmpB*fS0 );
+		fTmpC = 2.356455943866682f*fZ*fTmpB + -0.9746316985871221f*fTmpA;
+		out( 315, fTmpC*fC0 );
+		out( 297, fTmpC*fS0 );
+		fTmpA = 2.308509932184803f*fZ*fTmpC + -0.9796533383929068f*fTmpB;
+		out( 351, fTmpA*fC0 );
+		out( 333, fTmpA*fS0 );
+		fTmpB = 2.27014788693852f*fZ*fTmpA + -0.9833823347643229f*fTmpC;
+		out( 389, fTmpB*fC0 );
+		out( 371, fTmpB*fS0 );
+		fC1 = fX*fC0 - fY*fS0;
+		fS1 = fX*fS0 + fY*fC0;
+
+		fTmpA = 0.7673951182219901f;
+		out( 120, fTmpA*fC1 );
+		out( 100, fTmpA*fS1 );
+		fTmpB = 3.680297698805312f*fZ;
+		out( 142, fTmpB*fC1 );
+		out( 122, fTmpB*fS1 );
+		fTmpC = 13.30425420025764f*fZ2 + -0.5784458347938103f;
+		out( 166, fTmpC*fC1 );
+		out( 146, fTmpC*fS1 );
+		fTmpA = fZ*( 41.61193153549645f*fZ2 + -4.993431784259574f );
+		out( 192, fTmpA*fC1 );
+		out( 172, fTmpA*fS1 );
+		fTmpB = 2.855914914698966f*fZ*fTmpA + -0.9130991183874837f*fTmpC;
+		out( 220, fTmpB*fC1 );
+		out( 200, fTmpB*fS1 );
+		fTmpC = 2.681790446697877f*fZ*fTmpB + -0.9390302326218141f*fTmpA;
+		out( 250, fTmpC*fC1 );
+		out( 230, fTmpC*fS1 );
+		fTmpA = 2.560799154110355f*fZ*fTmpC + -0.9548841361798045f*fTmpB;
+		out( 282, fTmpA*fC1 );
+		out( 262, fTmpA*fS1 );
+		fTmpB = 2.472066162365221f*fZ*fTmpA + -0.9653494919339113f*fTmpC;
+		out( 316, fTmpB*fC1 );
+		out( 296, fTmpB*fS1 );
+		fTmpC = 2.404423007708918f*fZ*fTmpB + -0.9726369966604846f*fTmpA;
+		out( 352, fTmpC*fC1 );
+		out( 332, fTmpC*fS1 );
+		fTmpA = 2.351326355949746f*fZ*fTmpC + -0.9779170921302378f*fTmpB;
+		out( 390, fTmpA*fC1 );
+		out( 370, fTmpA*fS1 );
+		fC0 = fX*fC1 - fY*fS1;
+		fS0 = fX*fS1 + fY*fC1;
+
+		fTmpA = -0.7846421057871971f;
+		out( 143, fTmpA*fC0 );
+		out( 121, fTmpA*fS0 );
+		fTmpB = -3.923210528935984f*fZ;
+		out( 167, fTmpB*fC0 );
+		out( 145, fTmpB*fS0 );
+		fTmpC = -14.71203948350994f*fZ2 + 0.5884815793403977f;
+		out( 193, fTmpC*fC0 );
+		out( 171, fTmpC*fS0 );
+		fTmpA = fZ*( -47.53605436066262f*fZ2 + 5.281783817851402f );
+		out( 221, fTmpA*fC0 );
+		out( 199, fTmpA*fS0 );
+		fTmpB = 2.940107271721691f*fZ*fTmpA + -0.9099403568319481f*fTmpC;
+		out( 251, fTmpB*fC0 );
+		out( 229, fTmpB*fS0 );
+		fTmpC = 2.752776376275011f*fZ*fTmpB + -0.9362843331437419f*fTmpA;
+		out( 283, fTmpC*fC0 );
+		out( 261, fTmpC*fS0 );
+		fTmpA = 2.622022120425379f*fZ*fTmpC + -0.9525009525014289f*fTmpB;
+		out( 317, fTmpA*fC0 );
+		out( 295, fTmpA*fS0 );
+		fTmpB = 2.525729665824827f*fZ*fTmpA + -0.9632754987646973f*fTmpC;
+		out( 353, fTmpB*fC0 );
+		out( 331, fTmpB*fS0 );
+		fTmpC = 2.452039967047845f*fZ*fTmpB + -0.9708243919473798f*fTmpA;
+		out( 391, fTmpC*fC0 );
+		out( 369, fTmpC*fS0 );
+		fC1 = fX*fC0 - fY*fS0;
+		fS1 = fX*fS0 + fY*fC0;
+
+		fTmpA = 0.8008219957839717f;
+		out( 168, fTmpA*fC1 );
+		out( 144, fTmpA*fS1 );
+		fTmpB = 4.161193153549645f*fZ;
+		out( 194, fTmpB*fC1 );
+		out( 170, fTmpB*fS1 );
+		fTmpC = 16.1471947939282f*fZ2 + -0.5980442516269705f;
+		out( 222, fTmpC*fC1 );
+		out( 198, fTmpC*fS1 );
+		fTmpA = fZ*( 53.79407212305809f*fZ2 + -5.564904012730148f );
+		out( 252, fTmpA*fC1 );
+		out( 228, fTmpA*fS1 );
+		fTmpB = 3.022238999720004f*fZ*fTmpA + -0.9071758265604122f*fTmpC;
+		out( 284, fTmpB*fC1 );
+		out( 260, fTmpB*fS1 );
+		fTmpC = 2.822324793743503f*fZ*fTmpB + -0.9338522843510981f*fTmpA;
+		out( 318, fTmpC*fC1 );
+		out( 294, fTmpC*fS1 );
+		fTmpA = 2.682246156571846f*fZ*fTmpC + -0.950367641072997f*fTmpB;
+		out( 354, fTmpA*fC1 );
+		out( 330, fTmpA*fS1 );
+		fTmpB = 2.5787147157554f*fZ*fTmpA + -0.9614012157076702f*fTmpC;
+		out( 392, fTmpB*fC1 );
+		out( 368, fTmpB*fS1 );
+		fC0 = fX*fC1 - fY*fS1;
+		fS0 = fX*fS1 + fY*fC1;
+
+		fTmpA = -0.8160771188376284f;
+		out( 195, fTmpA*fC0 );
+		out( 169, fTmpA*fS0 );
+		fTmpB = -4.394709780272119f*fZ;
+		out( 223, fTmpB*fC0 );
+		out( 197, fTmpB*fS0 );
+		fTmpC = -17.60824338884482f*fZ2 + 0.6071808065118906f;
+		out( 253, fTmpC*fC0 );
+		out( 227, fTmpC*fS0 );
+		fTmpA = fZ*( -60.38015494295203f*fZ2 + 5.843240800930841f );
+		out( 285, fTmpA*fC0 );
+		out( 259, fTmpA*fS0 );
+		fTmpB = 3.102418411497714f*fZ*fTmpA + -0.9047366396343047f*fTmpC;
+		out( 319, fTmpB*fC0 );
+		out( 293, fTmpB*fS0 );
+		fTmpC = 2.890473786367456f*fZ*fTmpB + -0.9316840615873149f*fTmpA;
+		out( 355, fTmpC*fC0 );
+		out( 329, fTmpC*fS0 );
+		fTmpA = 2.741464024932663f*fZ*fTmpC + -0.9484479803492502f*fTmpB;
+		out( 393, fTmpA*fC0 );
+		out( 367, fTmpA*fS0 );
+		fC1 = fX*fC0 - fY*fS0;
+		fS1 = fX*fS0 + fY*fC0;
+
+		fTmpA = 0.830522083064524f;
+		out( 224, fTmpA*fC1 );
+		out( 196, fTmpA*fS1 );
+		fTmpB = 4.624151256630013f*fZ;
+		out( 254, fTmpB*fC1 );
+		out( 226, fTmpB*fS1 );
+		fTmpC = 19.09388150936025f*fZ2 + -0.6159316615922662f;
+		out( 286, fTmpC*fC1 );
+		out( 258, fTmpC*fS1 );
+		fTmpA = fZ*( 67.28894837384407f*fZ2 + -6.117177124894916f );
+		out( 320, fTmpA*fC1 );
+		out( 292, fTmpA*fS1 );
+		fTmpB = 3.180752662499868f*fZ*fTmpA + -0.9025689346627115f*fTmpC;
+		out( 356, fTmpB*fC1 );
+		out( 328, fTmpB*fS1 );
+		fTmpC = 2.957271469692044f*fZ*fTmpB + -0.9297395250367622f*fTmpA;
+		out( 394, fTmpC*fC1 );
+		out( 366, fTmpC*fS1 );
+		fC0 = fX*fC1 - fY*fS1;
+		fS0 = fX*fS1 + fY*fC1;
+
+		fTmpA = -0.8442506508573726f;
+		out( 255, fTmpA*fC0 );
+		out( 225, fTmpA*fS0 );
+		fTmpB = -4.849850753230682f*fZ;
+		out( 287, fTmpB*fC0 );
+		out( 257, fTmpB*fS0 );
+		fTmpC = -20.60294860554973f*fZ2 + 0.6243317759257494f;
+		out( 321, fTmpC*fC0 );
+		out( 291, fTmpC*fS0 );
+		fTmpA = fZ*( -74.51550792153199f*fZ2 + 6.387043536131314f );
+		out( 357, fTmpA*fC0 );
+		out( 327, fTmpA*fS0 );
+		fTmpB = 3.257344642135227f*fZ*fTmpA + -0.9006300315787349f*fTmpC;
+		out( 395, fTmpB*fC0 );
+		out( 365, fTmpB*fS0 );
+		fC1 = fX*fC0 - fY*fS0;
+		fS1 = fX*fS0 + fY*fC0;
+
+		fTmpA = 0.8573405888380252f;
+		out( 288, fTmpA*fC1 );
+		out( 256, fTmpA*fS1 );
+		fTmpB = 5.07209532485536f*fZ;
+		out( 322, fTmpB*fC1 );
+		out( 290, fTmpB*fS1 );
+		fTmpC = 22.13440412464915f*fZ2 + -0.632411546418547f;
+		out( 358, fTmpC*fC1 );
+		out( 326, fTmpC*fS1 );
+		fTmpA = fZ*( 82.05524583274547f*fZ2 + -6.653128040492876f );
+		out( 396, fTmpA*fC1 );
+		out( 364, fTmpA*fS1 );
+		fC0 = fX*fC1 - fY*fS1;
+		fS0 = fX*fS1 + fY*fC1;
+
+		fTmpA = -0.8698571719206282f;
+		out( 323, fTmpA*fC0 );
+		out( 289, fTmpA*fS0 );
+		fTmpB = -5.291134612069974f*fZ;
+		out( 359, fTmpB*fC0 );
+		out( 325, fTmpB*fS0 );
+		fTmpC = -23.68730913497825f*fZ2 + 0.6401975441886013f;
+		out( 397, fTmpC*fC0 );
+		out( 363, fTmpC*fS0 );
+		fC1 = fX*fC0 - fY*fS0;
+		fS1 = fX*fS0 + fY*fC0;
+
+		fTmpA = 0.8818557686783287f;
+		out( 360, fTmpA*fC1 );
+		out( 324, fTmpA*fS1 );
+		fTmpB = 5.507187510272244f*fZ;
+		out( 398, fTmpB*fC1 );
+		out( 362, fTmpB*fS1 );
+		fC0 = fX*fC1 - fY*fS1;
+		fS0 = fX*fS1 + fY*fC1;
+
+		fTmpC = -0.8933837843499494f;
+		out( 399, fTmpC*fC0 );
+		out( 361, fTmpC*fS0 );
+	}
+};
+
+// order 21
+template<>
+struct SHKernel<21>
+{
+	template<typename T, typename O>
+	static FORCEINLINE void Eval( const T fX, const T fY, const T fZ, const O &out )
+	{
+		T fC0, fC1, fS0, fS1, fTmpA, fTmpB, fTmpC;
+		T fZ2 = fZ*fZ;
+
+		out( 0, 0.2820947917738781f );
+		out( 2, 0.4886025119029199f*fZ );
+		const T fP6 = 0.9461746957575601f*fZ2 + -0.3153915652525201f;
+		out( 6, fP6 );
+		const T fP12 = fZ*( 1.865881662950577f*fZ2 + -1.119528997770346f );
+		out( 12, fP12 );
+		const T fP20 = 1.984313483298443f*fZ*fP12 + -1.006230589874905f*fP6;
+		out( 20, fP20 );
+		const T fP30 = 1.98997487421324f*fZ*fP20 + -1.002853072844814f*fP12;
+		out( 30, fP30 );
+		const T fP42 = 1.993043457183567f*fZ*fP30 + -1.001542020962219f*fP20;
+		out( 42, fP42 );
+		const T fP56 = 1.994891434824135f*fZ*fP42 + -1.000927213921958f*fP30;
+		out( 56, fP56 );
+		const T fP72 = 1.996089927833914f*fZ*fP56 + -1.000600781069515f*fP42;
+		out( 72, fP72 );
+		const T fP90 = 1.996911195067937f*fZ*fP72 + -1.000411437993134f*fP56;
+		out( 90, fP90 );
+		const T fP110 = 1.997498435543818f*fZ*fP90 + -1.00029407440718f*fP72;
+		out( 110, fP110 );
+		const T fP132 = 1.997932815985082f*fZ*fP110 + -1.000217462218511f*fP90;
+		out( 132, fP132 );
+		const T fP156 = 1.998263134713633f*fZ*fP132 + -1.000165330248298f*fP110;
+		out( 156, fP156 );
+		const T fP182 = 1.998520162579474f*fZ*fP156 + -1.000128625635621f*fP132;
+		out( 182, fP182 );
+		const T fP210 = 1.998724082804747f*fZ*fP182 + -1.000102035610694f*fP156;
+		out( 210, fP210 );
+		const T fP240 = 1.998888580075327f*fZ*fP210 + -1.00008230114001f*fP182;
+		out( 240, fP240 );
+		const T fP272 = 1.999023198964935f*fZ*fP240 + -1.00006734687013f*fP210;
+		out( 272, fP272 );
+		const T fP306 = 1.999134760937227f*fZ*fP272 + -1.000055808242921f*fP240;
+		out( 306, fP306 );
+		const T fP342 = 1.999228246160731f*fZ*fP306 + -1.000046762842271f*fP272;
+		out( 342, fP342 );
+		const T fP380 = 1.999307359286587f*fZ*fP342 + -1.000039571832785f*fP306;
+		out( 380, fP380 );
+		out( 420, 1.999374902313221f*fZ*fP380 + -1.000033783213131f*fP342 );
+		fC0 = fX;
+		fS0 = fY;
+
+		fTmpA = -0.48860251190292f;
+		out( 3, fTmpA*fC0 );
+		out( 1, fTmpA*fS0 );
+		fTmpB = -1.092548430592079f*fZ;
+		out( 7, fTmpB*fC0 );
+		out( 5, fTmpB*fS0 );
+		fTmpC = -2.285228997322329f*fZ2 + 0.4570457994644658f;
+		out( 13, fTmpC*fC0 );
+		out( 11, fTmpC*fS0 );
+		fTmpA = fZ*( -4.683325804901025f*fZ2 + 2.007139630671868f );
+		out( 21, fTmpA*fC0 );
+		out( 19, fTmpA*fS0 );
+		fTmpB = 2.03100960115899f*fZ*fTmpA + -0.991031208965115f*fTmpC;
+		out( 31, fTmpB*fC0 );
+		out( 29, fTmpB*fS0 );
+		fTmpC = 2.021314989237028f*fZ*fTmpB + -0.9952267030562385f*fTmpA;
+		out( 43, fTmpC*fC0 );
+		out( 41, fTmpC*fS0 );
+		fTmpA = 2.015564437074638f*fZ*fTmpC + -0.9971550440218319f*fTmpB;
+		out( 57, fTmpA*fC0 );
+		out( 55, fTmpA*fS0 );
+		fTmpB = 2.011869540407391f*fZ*fTmpA + -0.9981668178901745f*fTmpC;
+		out( 73, fTmpB*fC0 );
+		out( 71, fTmpB*fS0 );
+		fTmpC = 2.009353129741012f*fZ*fTmpB + -0.9987492177719088f*fTmpA;
+		out( 91, fTmpC*fC0 );
+		out( 89, fTmpC*fS0 );
+		fTmpA = 2.007561463642653f*fZ*fTmpC + -0.9991083368712843f*fTmpB;
+		out( 111, fTmpA*fC0 );
+		out( 109, fTmpA*fS0 );
+		fTmpB = 2.006240264773888f*fZ*fTmpA + -0.9993418887079215f*fTmpC;
+		out( 133, fTmpB*fC0 );
+		out( 131, fTmpB*fS0 );
+		fTmpC = 2.005237896355199f*fZ*fTmpB + -0.9995003746877732f*fTmpA;
+		out( 157, fTmpC*fC0 );
+		out( 155, fTmpC*fS0 );
+		fTmpA = 2.004459314343183f*fZ*fTmpC + -0.9996117258638336f*fTmpB;
+		out( 183, fTmpA*fC0 );
+		out( 181, fTmpA*fS0 );
+		fTmpB = 2.003842462716222f*fZ*fTmpA + -0.9996922603404586f*fTmpC;
+		out( 211, fTmpB*fC0 );
+		out( 209, fTmpB*fS0 );
+		fTmpC = 2.003345416333104f*fZ*fTmpB + -0.9997519533634172f*fTmpA;
+		out( 241, fTmpC*fC0 );
+		out( 239, fTmpC*fS0 );
+		fTmpA = 2.002939017015334f*fZ*fTmpC + -0.9997971396672504f*fTmpB;
+		out( 273, fTmpA*fC0 );
+		out( 271, fTmpA*fS0 );
+		fTmpB = 2.002602473449653f*fZ*fTmpA + -0.9998319751311335f*fTmpC;
+		out( 307, fTmpB*fC0 );
+		out( 305, fTmpB*fS0 );
+		fTmpC = 2.002320635087347f*fZ*fTmpB + -0.9998592639497642f*fTmpA;
+		out( 343, fTmpC*fC0 );
+		out( 341, fTmpC*fS0 );
+		fTmpA = 2.0020822493927f*fZ*fTmpC + -0.9998809452939409f*fTmpB;
+		out( 381, fTmpA*fC0 );
+		out( 379, fTmpA*fS0 );
+		fTmpB = 2.001878816760016f*fZ*fTmpA + -0.999898389472887f*fTmpC;
+		out( 421, fTmpB*fC0 );
+		out( 419, fTmpB*fS0 );
+		fC1 = fX*fC0 - fY*fS0;
+		fS1 = fX*fS0 + fY*fC0;
+
+		fTmpA = 0.5462742152960395f;
+		out( 8, fTmpA*fC1 );
+		out( 4, fTmpA*fS1 );
+		fTmpB = 1.445305721320277f*fZ;
+		out( 14, fTmpB*fC1 );
+		out( 10, fTmpB*fS1 );
+		fTmpC = 3.31161143515146f*fZ2 + -0.47308734787878f;
+		out( 22, fTmpC*fC1 );
+		out( 18, fTmpC*fS1 );
+		fTmpA = fZ*( 7.190305177459987f*fZ2 + -2.396768392486662f );
+		out( 32, fTmpA*fC1 );
+		out( 28, fTmpA*fS1 );
+		fTmpB = 2.11394181566097f*fZ*fTmpA + -0.9736101204623268f*fTmpC;
+		out( 44, fTmpB*fC1 );
+		out( 40, fTmpB*fS1 );
+		fTmpC = 2.081665999466133f*fZ*fTmpB + -0.9847319278346618f*fTmpA;
+		out( 58, fTmpC*fC1 );
+		out( 54, fTmpC*fS1 );
+		fTmpA = 2.06155281280883f*fZ*fTmpC + -0.9903379376602873f*fTmpB;
+		out( 74, fTmpA*fC1 );
+		out( 70, fTmpA*fS1 );
+		fTmpB = 2.048122358357819f*fZ*fTmpA + -0.9934852726704042f*fTmpC;
+		out( 92, fTmpB*fC1 );
+		out( 88, fTmpB*fS1 );
+		fTmpC = 2.038688303787511f*fZ*fTmpB + -0.9953938032404119f*fTmpA;
+		out( 112, fTmpC*fC1 );
+		out( 108, fTmpC*fS1 );
+		fTmpA = 2.031798495964875f*fZ*fTmpC + -0.9966204702259603f*fTmpB;
+		out( 134, fTmpA*fC1 );
+		out( 130, fTmpA*fS1 );
+		fTmpB = 2.026608708444444f*fZ*fTmpA + -0.9974457174120671f*fTmpC;
+		out( 158, fTmpB*fC1 );
+		out( 154, fTmpB*fS1 );
+		fTmpC = 2.022599587389726f*fZ*fTmpB + -0.9980217586956907f*fTmpA;
+		out( 184, fTmpC*fC1 );
+		out( 180, fTmpC*fS1 );
+		fTmpA = 2.019436802675439f*fZ*fTmpC + -0.998436277385793f*fTmpB;
+		out( 212, fTmpA*fC1 );
+		out( 208, fTmpA*fS1 );
+		fTmpB = 2.016896949069888f*fZ*fTmpA + -0.998742296068792f*fTmpC;
+		out( 242, fTmpB*fC1 );
+		out( 238, fTmpB*fS1 );
+		fTmpC = 2.014825999813336f*fZ*fTmpB + -0.9989732002631536f*fTmpA;
+		out( 274, fTmpC*fC1 );
+		out( 270, fTmpC*fS1 );
+		fTmpA = 2.013114894621608f*fZ*fTmpC + -0.9991507429465936f*fTmpB;
+		out( 308, fTmpA*fC1 );
+		out( 304, fTmpA*fS1 );
+		fTmpB = 2.011684617428885f*fZ*fTmpA + -0.9992895203365968f*fTmpC;
+		out( 344, fTmpB*fC1 );
+		out( 340, fTmpB*fS1 );
+		fTmpC = 2.010476761050147f*fZ*fTmpB + -0.9993995796516643f*fTmpA;
+		out( 382, fTmpC*fC1 );
+		out( 378, fTmpC*fS1 );
+		fTmpA = 2.00944738370498f*fZ*fTmpC + -0.9994879934127519f*fTmpB;
+		out( 422, fTmpA*fC1 );
+		out( 418, fTmpA*fS1 );
+		fC0 = fX*fC1 - fY*fS1;
+		fS0 = fX*fS1 + fY*fC1;
+
+		fTmpA = -0.5900435899266435f;
+		out( 15, fTmpA*fC0 );
+		out( 9, fTmpA*fS0 );
+		fTmpB = -1.770130769779931f*fZ;
+		out( 23, fTmpB*fC0 );
+		out( 17, fTmpB*fS0 );
+		fTmpC = -4.403144694917254f*fZ2 + 0.4892382994352505f;
+		out( 33, fTmpC*fC0 );
+		out( 27, fTmpC*fS0 );
+		fTmpA = fZ*( -10.13325785466416f*fZ2 + 2.763615778544771f );
+		out( 45, fTmpA*fC0 );
+		out( 39, fTmpA*fS0 );
+		fTmpB = 2.207940216581962f*fZ*fTmpA + -0.959403223600247f*fTmpC;
+		out( 59, fTmpB*fC0 );
+		out( 53, fTmpB*fS0 );
+		fTmpC = 2.15322168769582f*fZ*fTmpB + -0.9752173865600178f*fTmpA;
+		out( 75, fTmpC*fC0 );
+		out( 69, fTmpC*fS0 );
+		fTmpA = 2.118044171189805f*fZ*fTmpC + -0.9836628449792094f*fTmpB;
+		out( 93, fTmpA*fC0 );
+		out( 87, fTmpA*fS0 );
+		fTmpB = 2.093947321356338f*fZ*fTmpA + -0.9886230654859614f*fTmpC;
+		out( 113, fTmpB*fC0 );
+		out( 107, fTmpB*fS0 );
+		fTmpC = 2.076655965729519f*fZ*fTmpB + -0.9917422203269092f*fTmpA;
+		out( 135, fTmpC*fC0 );
+		out( 129, fTmpC*fS0 );
+		fTmpA = 2.063797291222968f*fZ*fTmpC + -0.9938079899999066f*fTmpB;
+		out( 159, fTmpA*fC0 );
+		out( 153, fTmpA*fS0 );
+		fTmpB = 2.053959590644373f*fZ*fTmpA + -0.9952332040455557f*fTmpC;
+		out( 185, fTmpB*fC0 );
+		out( 179, fTmpB*fS0 );
+		fTmpC = 2.046256527271464f*fZ*fTmpB + -0.9962496519366806f*fTmpA;
+		out( 213, fTmpC*fC0 );
+		out( 207, fTmpC*fS0 );
+		fTmpA = 2.040107114108727f*fZ*fTmpC + -0.9969947985109489f*fTmpB;
+		out( 243, fTmpA*fC0 );
+		out( 237, fTmpA*fS0 );
+		fTmpB = 2.035116803738375f*fZ*fTmpA + -0.9975538978635777f*fTmpC;
+		out( 275, fTmpB*fC0 );
+		out( 269, fTmpB*fS0 );
+		fTmpC = 2.03100960115899f*fZ*fTmpB + -0.9979818344716921f*fTmpA;
+		out( 309, fTmpC*fC0 );
+		out( 303, fTmpC*fS0 );
+		fTmpA = 2.027587510099407f*fZ*fTmpC + -0.9983150788368354f*fTmpB;
+		out( 345, fTmpA*fC0 );
+		out( 339, fTmpA*fS0 );
+		fTmpB = 2.024705365770985f*fZ*fTmpA + -0.9985785351734189f*fTmpC;
+		out( 383, fTmpB*fC0 );
+		out( 377, fTmpB*fS0 );
+		fTmpC = 2.022254698720258f*fZ*fTmpB + -0.9987896179403895f*fTmpA;
+		out( 423, fTmpC*fC0 );
+		out( 417, fTmpC*fS0 );
+		fC1 = fX*fC0 - fY*fS0;
+		fS1 = fX*fS0 + fY*fC0;
+
+		fTmpA = 0.6258357354491763f;
+		out( 24, fTmpA*fC1 );
+		out( 16, fTmpA*fS1 );
+		fTmpB = 2.075662314881041f*fZ;
+		out( 34, fTmpB*fC1 );
+		out( 26, fTmpB*fS1 );
+		fTmpC = 5.550213908015966f*fZ2 + -0.5045649007287241f;
+		out( 46, fTmpC*fC1 );
+		out( 38, fTmpC*fS1 );
+		fTmpA = fZ*( 13.49180504672677f*fZ2 + -3.113493472321562f );
+		out( 60, fTmpA*fC1 );
+		out( 52, fTmpA*fS1 );
+		fTmpB = 2.304886114323221f*fZ*fTmpA + -0.9481763873554654f*fTmpC;
+		out( 76, fTmpB*fC1 );
+		out( 68, fTmpB*fS1 );
+		fTmpC = 2.229177150706235f*fZ*fTmpB + -0.9671528397231821f*fTmpA;
+		out( 94, fTmpC*fC1 );
+		out( 86, fTmpC*fS1 );
+		fTmpA = 2.179449471770337f*fZ*fTmpC + -0.9776923610938036f*fTmpB;
+		out( 114, fTmpA*fC1 );
+		out( 106, fTmpA*fS1 );
+		fTmpB = 2.144761058952722f*fZ*fTmpA + -0.9840838646332836f*fTmpC;
+		out( 136, fTmpB*fC1 );
+		out( 128, fTmpB*fS1 );
+		fTmpC = 2.119478119726646f*fZ*fTmpB + -0.9882117688026186f*fTmpA;
+		out( 160, fTmpC*fC1 );
+		out( 152, fTmpC*fS1 );
+		fTmpA = 2.100420126042015f*fZ*fTmpC + -0.9910081668184009f*fTmpB;
+		out( 186, fTmpA*fC1 );
+		out( 178, fTmpA*fS1 );
+		fTmpB = 2.085665361461421f*fZ*fTmpA + -0.9929753269845127f*fTmpC;
+		out( 214, fTmpB*fC1 );
+		out( 206, fTmpB*fS1 );
+		fTmpC = 2.073990213742235f*fZ*fTmpB + -0.9944021951292297f*fTmpA;
+		out( 244, fTmpC*fC1 );
+		out( 236, fTmpC*fS1 );
+		fTmpA = 2.064582282206258f*fZ*fTmpC + -0.9954638496008124f*fTmpB;
+		out( 276, fTmpA*fC1 );
+		out( 268, fTmpA*fS1 );
+		fTmpB = 2.056883378018606f*fZ*fTmpA + -0.996270962773436f*fTmpC;
+		out( 310, fTmpB*fC1 );
+		out( 302, fTmpB*fS1 );
+		fTmpC = 2.050498830661811f*fZ*fTmpB + -0.9968960090664231f*fTmpA;
+		out( 346, fTmpC*fC1 );
+		out( 338, fTmpC*fS1 );
+		fTmpA = 2.045142707894041f*fZ*fTmpC + -0.9973878927958029f*fTmpB;
+		out( 384, fTmpA*fC1 );
+		out( 376, fTmpA*fS1 );
+		fTmpB = 2.040603464664314f*fZ*fTmpA + -0.9977804760458977f*fTmpC;
+		out( 424, fTmpB*fC1 );
+		out( 416, fTmpB*fS1 );
+		fC0 = fX*fC1 - fY*fS1;
+		fS0 = fX*fS1 + fY*fC1;
+
+		fTmpA = -0.6563820568401703f;
+		out( 35, fTmpA*fC0 );
+		out( 25, fTmpA*fS0 );
+		fTmpB = -2.366619162231753f*fZ;
+		out( 47, fTmpB*fC0 );
+		out( 37, fTmpB*fS0 );
+		fTmpC = -6.745902523363385f*fZ2 + 0.5189155787202604f;
+		out( 61, fTmpC*fC0 );
+		out( 51, fTmpC*fS0 );
+		fTmpA = fZ*( -17.24955311049054f*fZ2 + 3.449910622098108f );
+		out( 77, fTmpA*fC0 );
+		out( 67, fTmpA*fS0 );
+		fTmpB = 2.401636346922062f*fZ*fTmpA + -0.9392246042043708f*fTmpC;
+		out( 95, fTmpB*fC0 );
+		out( 85, fTmpB*fS0 );
+		fTmpC = 2.306512518934159f*fZ*fTmpB + -0.9603920767980496f*fTmpA;
+		out( 115, fTmpC*fC0 );
+		out( 105, fTmpC*fS0 );
+		fTmpA = 2.243044805615795f*fZ*fTmpC + -0.9724832565193738f*fTmpB;
+		out( 137, fTmpA*fC0 );
+		out( 127, fTmpA*fS0 );
+		fTmpB = 2.198165774710643f*fZ*fTmpA + -0.9799919151000504f*fTmpC;
+		out( 161, fTmpB*fC0 );
+		out( 151, fTmpB*fS0 );
+		fTmpC = 2.165063509461097f*fZ*fTmpB + -0.9849409604906143f*fTmpA;
+		out( 187, fTmpC*fC0 );
+		out( 177, fTmpC*fS0 );
+		fTmpA = 2.139847510553276f*fZ*fTmpC + -0.9883532289941477f*fTmpB;
+		out( 215, fTmpA*fC0 );
+		out( 205, fTmpA*fS0 );
+		fTmpB = 2.120141504711419f*fZ*fTmpA + -0.99079092984679f*fTmpC;
+		out( 245, fTmpB*fC0 );
+		out( 235, fTmpB*fS0 );
+		fTmpC = 2.104417123236605f*fZ*fTmpB + -0.9925833339709304f*fTmpA;
+		out( 277, fTmpC*fC0 );
+		out( 267, fTmpC*fS0 );
+		fTmpA = 2.091650066335189f*fZ*fTmpC + -0.9939332099323633f*fTmpB;
+		out( 311, fTmpA*fC0 );
+		out( 301, fTmpA*fS0 );
+		fTmpB = 2.081130384894173f*fZ*fTmpA + -0.9949706303122452f*fTmpC;
+		out( 347, fTmpB*fC0 );
+		out( 337, fTmpB*fS0 );
+		fTmpC = 2.072352010914858f*fZ*fTmpB + -0.9957819202280493f*fTmpA;
+		out( 385, fTmpC*fC0 );
+		out( 375, fTmpC*fS0 );
+		fTmpA = 2.064945519862449f*fZ*fTmpC + -0.9964260458583293f*fTmpB;
+		out( 425, fTmpA*fC0 );
+		out( 415, fTmpA*fS0 );
+		fC1 = fX*fC0 - fY*fS0;
+		fS1 = fX*fS0 + fY*fC0;
+
+		fTmpA = 0.6831841051919144f;
+		out( 48, fTmpA*fC1 );
+		out( 36, fTmpA*fS1 );
+		fTmpB = 2.645960661801901f*fZ;
+		out( 62, fTmpB*fC1 );
+		out( 50, fTmpB*fS1 );
+		fTmpC = 7.984991490893139f*fZ2 + -0.5323327660595426f;
+		out( 78, fTmpC*fC1 );
+		out( 66, fTmpC*fS1 );
+		fTmpA = fZ*( 21.39289019090864f*fZ2 + -3.775215916042701f );
+		out( 96, fTmpA*fC1 );
+		out( 84, fTmpA*fS1 );
+		fTmpB = 2.496873044429773f*fZ*fTmpA + -0.9319689782769534f*fTmpC;
+		out( 116, fTmpB*fC1 );
+		out( 104, fTmpB*fS1 );
+		fTmpC = 2.383768642544085f*fZ*fTmpB + -0.9547015807880142f*fTmpA;
+		out( 138, fTmpC*fC1 );
+		out( 126, fTmpC*fS1 );
+		fTmpA = 2.307395517477243f*fZ*fTmpC + -0.9679611839405133f*fTmpB;
+		out( 162, fTmpA*fC1 );
+		out( 150, fTmpA*fS1 );
+		fTmpB = 2.252817784447915f*fZ*fTmpA + -0.9763466069791972f*fTmpC;
+		out( 188, fTmpB*fC1 );
+		out( 176, fTmpB*fS1 );
+		fTmpC = 2.212182180562893f*fZ*fTmpB + -0.9819623210693983f*fTmpA;
+		out( 216, fTmpC*fC1 );
+		out( 204, fTmpC*fS1 );
+		fTmpA = 2.180966243804281f*fZ*fTmpC + -0.9858890750350997f*fTmpB;
+		out( 246, fTmpA*fC1 );
+		out( 234, fTmpA*fS1 );
+		fTmpB = 2.156385865284782f*fZ*fTmpA + -0.9887295924045926f*fTmpC;
+		out( 278, fTmpB*fC1 );
+		out( 266, fTmpB*fS1 );
+		fTmpC = 2.13663693483576f*fZ*fTmpB + -0.9908416528011255f*fTmpA;
+		out( 312, fTmpC*fC1 );
+		out( 300, fTmpC*fS1 );
+		fTmpA = 2.120501774999912f*fZ*fTmpC + -0.9924483380527693f*fTmpB;
+		out( 348, fTmpA*fC1 );
+		out( 336, fTmpA*fS1 );
+		fTmpB = 2.107130750570548f*fZ*fTmpA + -0.9936944054529902f*fTmpC;
+		out( 386, fTmpB*fC1 );
+		out( 374, fTmpB*fS1 );
+		fTmpC = 2.095914393017316f*fZ*fTmpB + -0.9946769522725655f*fTmpA;
+		out( 426, fTmpC*fC1 );
+		out( 414, fTmpC*fS1 );
+		fC0 = fX*fC1 - fY*fS1;
+		fS0 = fX*fS1 + fY*fC1;
+
+		fTmpA = -0.7071627325245963f;
+		out( 63, fTmpA*fC0 );
+		out( 49, fTmpA*fS0 );
+		fTmpB = -2.91570664069932f*fZ;
+		out( 79, fTmpB*fC0 );
+		out( 65, fTmpB*fS0 );
+		fTmpC = -9.263393182848905f*fZ2 + 0.5449054813440533f;
+		out( 97, fTmpC*fC0 );
+		out( 83, fTmpC*fS0 );
+		fTmpA = fZ*( -25.9102413133663f*fZ2 + 4.091090733689416f );
+		out( 117, fTmpA*fC0 );
+		out( 103, fTmpA*fS0 );
+		fTmpB = 2.590045044653342f*fZ*fTmpA + -0.9259892765852515f*fTmpC;
+		out( 139, fTmpB*fC0 );
+		out( 125, fTmpB*fS0 );
+		fTmpC = 2.460209661583209f*fZ*fTmpB + -0.9498713802919554f*fTmpA;
+		out( 163, fTmpC*fC0 );
+		out( 149, fTmpC*fS0 );
+		fTmpA = 2.371708245126284f*fZ*fTmpC + -0.9640268803757269f*fTmpB;
+		out( 189, fTmpA*fC0 );
+		out( 175, fTmpA*fS0 );
+		fTmpB = 2.307927774486216f*fZ*fTmpA + -0.9731077923386515f*fTmpC;
+		out( 217, fTmpB*fC0 );
+		out( 203, fTmpB*fS0 );
+		fTmpC = 2.260078437898682f*fZ*fTmpB + -0.9792674029419375f*fTmpA;
+		out( 247, fTmpC*fC0 );
+		out( 233, fTmpC*fS0 );
+		fTmpA = 2.223067472099586f*fZ*fTmpC + -0.9836240348217709f*fTmpB;
+		out( 279, fTmpA*fC0 );
+		out( 265, fTmpA*fS0 );
+		fTmpB = 2.19374109684803f*fZ*fTmpA + -0.9868081488215654f*fTmpC;
+		out( 313, fTmpB*fC0 );
+		out( 299, fTmpB*fS0 );
+		fTmpC = 2.170043987823959f*fZ*fTmpB + -0.9891978551807596f*fTmpA;
+		out( 349, fTmpC*fC0 );
+		out( 335, fTmpC*fS0 );
+		fTmpA = 2.150581316760656f*fZ*fTmpC + -0.9910312089651149f*fTmpB;
+		out( 387, fTmpA*fC0 );
+		out( 373, fTmpA*fS0 );
+		fTmpB = 2.13437474581095f*fZ*fTmpA + -0.9924640975798494f*fTmpC;
+		out( 427, fTmpB*fC0 );
+		out( 413, fTmpB*fS0 );
+		fC1 = fX*fC0 - fY*fS0;
+		fS1 = fX*fS0 + fY*fC0;
+
+		fTmpA = 0.72892666017483f;
+		out( 80, fTmpA*fC1 );
+		out( 64, fTmpA*fS1 );
+		fTmpB = 3.177317648954698f*fZ;
+		out( 98, fTmpB*fC1 );
+		out( 82, fTmpB*fS1 );
+		fTmpC = 10.57781172168795f*fZ2 + -0.5567269327204184f;
+		out( 118, fTmpC*fC1 );
+		out( 102, fTmpC*fS1 );
+		fTmpA = fZ*( 30.79157970335749f*fZ2 + -4.398797100479641f );
+		out( 140, fTmpA*fC1 );
+		out( 124, fTmpA*fS1 );
+		fTmpB = 2.680951323690902f*fZ*fTmpA + -0.9209854970162591f*fTmpC;
+		out( 164, fTmpB*fC1 );
+		out( 148, fTmpB*fS1 );
+		fTmpC = 2.53546276418555f*fZ*fTmpB + -0.9457324874869209f*fTmpA;
+		out( 190, fTmpC*fC1 );
+		out( 174, fTmpC*fS1 );
+		fTmpA = 2.435532422657966f*fZ*fTmpC + -0.9605869417846947f*fTmpB;
+		out( 218, fTmpA*fC1 );
+		out( 202, fTmpA*fS1 );
+		fTmpB = 2.363017336304797f*fZ*fTmpA + -0.9702261872276653f*fTmpC;
+		out( 248, fTmpB*fC1 );
+		out( 232, fTmpB*fS1 );
+		fTmpC = 2.308273164077423f*fZ*fTmpB + -0.9768329366922968f*fTmpA;
+		out( 280, fTmpC*fC1 );
+		out( 264, fTmpC*fS1 );
+		fTmpA = 2.265686062395524f*fZ*fTmpC + -0.9815502331592888f*fTmpB;
+		out( 314, fTmpA*fC1 );
+		out( 298, fTmpA*fS1 );
+		fTmpB = 2.231763704062155f*fZ*fTmpA + -0.9850277764000974f*fTmpC;
+		out( 350, fTmpB*fC1 );
+		out( 334, fTmpB*fS1 );
+		fTmpC = 2.20422001138404f*fZ*fTmpB + -0.9876583293168622f*fTmpA;
+		out( 388, fTmpC*fC1 );
+		out( 372, fTmpC*fS1 );
+		fTmpA = 2.181496864867922f*fZ*fTmpC + -0.9896910714907037f*fTmpB;
+		out( 428, fTmpA*fC1 );
+		out( 412, fTmpA*fS1 );
+		fC0 = fX*fC1 - fY*fS1;
+		fS0 = fX*fS1 + fY*fC1;
+
+		fTmpA = -0.7489009518531884f;
+		out( 99, fTmpA*fC0 );
+		out( 81, fTmpA*fS0 );
+		fTmpB = -3.431895299891715f*fZ;
+		out( 119, fTmpB*fC0 );
+		out( 101, fTmpB*fS0 );
+		fTmpC = -11.92552753945219f*fZ2 + 0.5678822637834374f;
+		out( 141, fTmpC*fC0 );
+		out( 123, fTmpC*fS0 );
+		fTmpA = fZ*( -36.02809068931077f*fZ2 + 4.699316176866623f );
+		out( 165, fTmpA*fC0 );
+		out( 147, fTmpA*fS0 );
+		fTmpB = 2.769558547034986f*fZ*fTmpA + -0.9167415228748209f*fTmpC;
+		out( 191, fTmpB*fC0 );
+		out( 173, fTmpB*fS0 );
+		fTmpC = 2.609347744585592f*fZ*fTmpB + -0.9421529461361585f*fTmpA;
+		out( 219, fTmpC*fC0 );
+		out( 201, fTmpC*fS0 );
+		fTmpA = 2.498610725094158f*fZ*fTmpC + -0.9575614175146977f*fTmpB;
+		out( 249, fTmpA*fC0 );
+		out( 231, fTmpA*fS0 );
+		fTmpB = 2.417791199776004f*fZ*fTmpA + -0.9676542149977727f*fTmpC;
+		out( 281, fTmpB*fC0 );
+		out( 263, fTmpB*fS0 );
+		fTmpC = 2.356455943866682f*fZ*fTmpB + -0.9746316985871221f*fTmpA;
+		out( 315, fTmpC*fC0 );
+		out( 297, fTmpC*fS0 );
+		fTmpA = 2.308509932184803f*fZ*fTmpC + -0.9796533383929068f*fTmpB;
+		out( 351, fTmpA*fC0 );
+		out( 333, fTmpA*fS0 );
+		fTmpB = 2.27014788693852f*fZ*fTmpA + -0.9833823347643229f*fTmpC;
+		out( 389, fTmpB*fC0 );
+		out( 371, fTmpB*fS0 );
+		fTmpC = 2.23887006879653f*fZ*fTmpB + -0.9862221230951737f*fTmpA;
+		out( 429, fTmpC*fC0 );
+		out( 411, fTmpC*fS0 );
+		fC1 = fX*fC0 - fY*fS0;
+		fS1 = fX*fS0 + fY*fC0;
+
+		fTmpA = 0.7673951182219901f;
+		out( 120, fTmpA*fC1 );
+		out( 100, fTmpA*fS1 );
+		fTmpB = 3.680297698805312f*fZ;
+		out( 142, fTmpB*fC1 );
+		out( 122, fTmpB*fS1 );
+		fTmpC = 13.30425420025764f*fZ2 + -0.5784458347938103f;
+		out( 166, fTmpC*fC1 );
+		out( 146, fTmpC*fS1 );
+		fTmpA = fZ*( 41.61193153549645f*fZ2 + -4.993431784259574f );
+		out( 192, fTmpA*fC1 );
+		out( 172, fTmpA*fS1 );
+		fTmpB = 2.855914914698966f*fZ*fTmpA + -0.9130991183874837f*fTmpC;
+		out( 220, fTmpB*fC1 );
+		out( 200, fTmpB*fS1 );
+		fTmpC = 2.681790446697877f*fZ*fTmpB + -0.9390302326218141f*fTmpA;
+		out( 250, fTmpC*fC1 );
+		out( 230, fTmpC*fS1 );
+		fTmpA = 2.560799154110355f*fZ*fTmpC + -0.9548841361798045f*fTmpB;
+		out( 282, fTmpA*fC1 );
+		out( 262, fTmpA*fS1 );
+		fTmpB = 2.472066162365221f*fZ*fTmpA + -0.9653494919339113f*fTmpC;
+		out( 316, fTmpB*fC1 );
+		out( 296, fTmpB*fS1 );
+		fTmpC = 2.404423007708918f*fZ*fTmpB + -0.9726369966604846f*fTmpA;
+		out( 352, fTmpC*fC1 );
+		out( 332, fTmpC*fS1 );
+		fTmpA = 2.351326355949746f*fZ*fTmpC + -0.9779170921302378f*fTmpB;
+		out( 390, fTmpA*fC1 );
+		out( 370, fTmpA*fS1 );
+		fTmpB = 2.308679276123039f*fZ*fTmpA + -0.9818625433603494f*fTmpC;
+		out( 430, fTmpB*fC1 );
+		out( 410, fTmpB*fS1 );
+		fC0 = fX*fC1 - fY*fS1;
+		fS0 = fX*fS1 + fY*fC1;
+
+		fTmpA = -0.7846421057871971f;
+		out( 143, fTmpA*fC0 );
+		out( 121, fTmpA*fS0 );
+		fTmpB = -3.923210528935984f*fZ;
+		out( 167, fTmpB*fC0 );
+		out( 145, fTmpB*fS0 );
+		fTmpC = -14.71203948350994f*fZ2 + 0.5884815793403977f;
+		out( 193, fTmpC*fC0 );
+		out( 171, fTmpC*fS0 );
+		fTmpA = fZ*( -47.53605436066262f*fZ2 + 5.281783817851402f );
+		out( 221, fTmpA*fC0 );
+		out( 199, fTmpA*fS0 );
+		fTmpB = 2.940107271721691f*fZ*fTmpA + -0.9099403568319481f*fTmpC;
+		out( 251, fTmpB*fC0 );
+		out( 229, fTmpB*fS0 );
+		fTmpC = 2.752776376275011f*fZ*fTmpB + -0.9362843331437419f*fTmpA;
+		out( 283, fTmpC*fC0 );
+		out( 261, fTmpC*fS0 );
+		fTmpA = 2.622022120425379f*fZ*fTmpC + -0.9525009525014289f*fTmpB;
+		out( 317, fTmpA*fC0 );
+		out( 295, fTmpA*fS0 );
+		fTmpB = 2.525729665824827f*fZ*fTmpA + -0.9632754987646973f*fTmpC;
+		out( 353, fTmpB*fC0 );
+		out( 331, fTmpB*fS0 );
+		fTmpC = 2.452039967047845f*fZ*fTmpB + -0.9708243919473798f*fTmpA;
+		out( 391, fTmpC*fC0 );
+		out( 369, fTmpC*fS0 );
+		fTmpA = 2.393988887964797f*fZ*fTmpC + -0.9763253944213071f*fTmpB;
+		out( 431, fTmpA*fC0 );
+		out( 409, fTmpA*fS0 );
+		fC1 = fX*fC0 - fY*fS0;
+		fS1 = fX*fS0 + fY*fC0;
+
+		fTmpA = 0.8008219957839717f;
+		out( 168, fTmpA*fC1 );
+		out( 144, fTmpA*fS1 );
+		fTmpB = 4.161193153549645f*fZ;
+		out( 194, fTmpB*fC1 );
+		out( 170, fTmpB*fS1 );
+		fTmpC = 16.1471947939282f*fZ2 + -0.5980442516269705f;
+		out( 222, fTmpC*fC1 );
+		out( 198, fTmpC*fS1 );
+		fTmpA = fZ*( 53.79407212305809f*fZ2 + -5.564904012730148f );
+		out( 252, fTmpA*fC1 );
+		out( 228, fTmpA*fS1 );
+		fTmpB = 3.022238999720004f*fZ*fTmpA + -0.9071758265604122f*fTmpC;
+		out( 284, fTmpB*fC1 );
+		out( 260, fTmpB*fS1 );
+		fTmpC = 2.822324793743503f*fZ*fTmpB + -0.9338522843510981f*fTmpA;
+		out( 318, fTmpC*fC1 );
+		out( 294, fTmpC*fS1 );
+		fTmpA = 2.682246156571846f*fZ*fTmpC + -0.950367641072997f*fTmpB;
+		out( 354, fTmpA*fC1 );
+		out( 330, fTmpA*fS1 );
+		fTmpB = 2.5787147157554f*fZ*fTmpA + -0.9614012157076702f*fTmpC;
+		out( 392, fTmpB*fC1 );
+		out( 368, fTmpB*fS1 );
+		fTmpC = 2.499218627891526f*fZ*fTmpB + -0.9691722052935243f*fTmpA;
+		out( 432, fTmpC*fC1 );
+		out( 408, fTmpC*fS1 );
+		fC0 = fX*fC1 - fY*fS1;
+		fS0 = fX*fS1 + fY*fC1;
+
+		fTmpA = -0.8160771188376284f;
+		out( 195, fTmpA*fC0 );
+		out( 169, fTmpA*fS0 );
+		fTmpB = -4.394709780272119f*fZ;
+		out( 223, fTmpB*fC0 );
+		out( 197, fTmpB*fS0 );
+		fTmpC = -17.60824338884482f*fZ2 + 0.6071808065118906f;
+		out( 253, fTmpC*fC0 );
+		out( 227, fTmpC*fS0 );
+		fTmpA = fZ*( -60.38015494295203f*fZ2 + 5.843240800930841f );
+		out( 285, fTmpA*fC0 );
+		out( 259, fTmpA*fS0 );
+		fTmpB = 3.102418411497714f*fZ*fTmpA + -0.9047366396343047f*fTmpC;
+		out( 319, fTmpB*fC0 );
+		out( 293, fTmpB*fS0 );
+		fTmpC = 2.890473786367456f*fZ*fTmpB + -0.9316840615873149f*fTmpA;
+		out( 355, fTmpC*fC0 );
+		out( 329, fTmpC*fS0 );
+		fTmpA = 2.741464024932663f*fZ*fTmpC + -0.9484479803492502f*fTmpB;
+		out( 393, fTmpA*fC0 );
+		out( 367, fTmpA*fS0 );
+		fTmpB = 2.630984211674012f*fZ*fTmpA + -0.9597004329606822f*fTmpC;
+		out( 433, fTmpB*fC0 );
+		out( 407, fTmpB*fS0 );
+		fC1 = fX*fC0 - fY*fS0;
+		fS1 = fX*fS0 + fY*fC0;
+
+		fTmpA = 0.830522083064524f;
+		out( 224, fTmpA*fC1 );
+		out( 196, fTmpA*fS1 );
+		fTmpB = 4.624151256630013f*fZ;
+		out( 254, fTmpB*fC1 );
+		out( 226, fTmpB*fS1 );
+		fTmpC = 19.09388150936025f*fZ2 + -0.6159316615922662f;
+		out( 286, fTmpC*fC1 );
+		out( 258, fTmpC*fS1 );
+		fTmpA = fZ*( 67.28894837384407f*fZ2 + -6.117177124894916f );
+		out( 320, fTmpA*fC1 );
+		out( 292, fTmpA*fS1 );
+		fTmpB = 3.180752662499868f*fZ*fTmpA + -0.9025689346627115f*fTmpC;
+		out( 356, fTmpB*fC1 );
+		out( 328, fTmpB*fS1 );
+		fTmpC = 2.957271469692044f*fZ*fTmpB + -0.9297395250367622f*fTmpA;
+		out( 394, fTmpC*fC1 );
+		out( 366, fTmpC*fS1 );
+		fTmpA = 2.799684856214652f*fZ*fTmpC + -0.9467121584567262f*fTmpB;
+		out( 434, fTmpA*fC1 );
+		out( 406, fTmpA*fS1 );
+		fC0 = fX*fC1 - fY*fS1;
+		fS0 = fX*fS1 + fY*fC1;
+
+		fTmpA = -0.8442506508573726f;
+		out( 255, fTmpA*fC0 );
+		out( 225, fTmpA*fS0 );
+		fTmpB = -4.849850753230682f*fZ;
+		out( 287, fTmpB*fC0 );
+		out( 257, fTmpB*fS0 );
+		fTmpC = -20.60294860554973f*fZ2 + 0.6243317759257494f;
+		out( 321, fTmpC*fC0 );
+		out( 291, fTmpC*fS0 );
+		fTmpA = fZ*( -74.51550792153199f*fZ2 + 6.387043536131314f );
+		out( 357, fTmpA*fC0 );
+		out( 327, fTmpA*fS0 );
+		fTmpB = 3.257344642135227f*fZ*fTmpA + -0.9006300315787349f*fTmpC;
+		out( 395, fTmpB*fC0 );
+		out( 365, fTmpB*fS0 );
+		fTmpC = 3.022770725202766f*fZ*fTmpB + -0.9279861535380262f*fTmpA;
+		out( 435, fTmpC*fC0 );
+		out( 405, fTmpC*fS0 );
+		fC1 = fX*fC0 - fY*fS0;
+		fS1 = fX*fS0 + fY*fC0;
+
+		fTmpA = 0.8573405888380252f;
+		out( 288, fTmpA*fC1 );
+		out( 256, fTmpA*fS1 );
+		fTmpB = 5.07209532485536f*fZ;
+		out( 322, fTmpB*fC1 );
+		out( 290, fTmpB*fS1 );
+		fTmpC = 22.13440412464915f*fZ2 + -0.632411546418547f;
+		out( 358, fTmpC*fC1 );
+		out( 326, fTmpC*fS1 );
+		fTmpA = fZ*( 82.05524583274547f*fZ2 + -6.653128040492876f );
+		out( 396, fTmpA*fC1 );
+		out( 364, fTmpA*fS1 );
+		fTmpB = 3.332291503855366f*fZ*fTmpA + -0.8988856965685321f*fTmpC;
+		out( 436, fTmpB*fC1 );
+		out( 404, fTmpB*fS1 );
+		fC0 = fX*fC1 - fY*fS1;
+		fS0 = fX*fS1 + fY*fC1;
+
+		fTmpA = -0.8698571719206282f;
+		out( 323, fTmpA*fC0 );
+		out( 289, fTmpA*fS0 );
+		fTmpB = -5.291134612069974f*fZ;
+		out( 359, fTmpB*fC0 );
+		out( 325, fTmpB*fS0 );
+		fTmpC = -23.68730913497825f*fZ2 + 0.6401975441886013f;
+		out( 397, fTmpC*fC0 );
+		out( 363, fTmpC*fS0 );
+		fTmpA = fZ*( -89.90388731214063f*fZ2 + 6.915683639395432f );
+		out( 437, fTmpA*fC0 );
+		out( 403, fTmpA*fS0 );
+		fC1 = fX*fC0 - fY*fS0;
+		fS1 = fX*fS0 + fY*fC0;
+
+		fTmpA = 0.8818557686783287f;
+		out( 360, fTmpA*fC1 );
+		out( 324, fTmpA*fS1 );
+		fTmpB = 5.507187510272244f*fZ;
+		out( 398, fTmpB*fC1 );
+		out( 362, fTmpB*fS1 );
+		fTmpC = 25.26081157877712f*fZ2 + -0.6477131174045414f;
+		out( 438, fTmpC*fC1 );
+		out( 402, fTmpC*fS1 );
+		fC0 = fX*fC1 - fY*fS1;
+		fS0 = fX*fS1 + fY*fC1;
+
+		fTmpA = -0.8933837843499494f;
+		out( 399, fTmpA*fC0 );
+		out( 361, fTmpA*fS0 );
+		fTmpB = -5.720447362900642f*fZ;
+		out( 439, fTmpB*fC0 );
+		out( 401, fTmpB*fS0 );
+		fC1 = fX*fC0 - fY*fS0;
+		fS1 = fX*fS0 + fY*fC0;
+
+		fTmpC = 0.9044821450934909f;
+		out( 440, fTmpC*fC1 );
+		out( 400, fTmpC*fS1 );
+	}
+};
+
+/// Fused scalar evaluation and projection : accum[c] += weight * Y_c(fX, fY, fZ)
+template<unsigned int N>
+FORCEINLINE void SHEvalAccumulate( const float fX, const float fY, const float fZ, const float weight, float *accum )
+{
+	SHKernel<N>::Eval( fX, fY, fZ, SHAccumulate<float>{ accum, weight } );
+}
+
+/// SIMD variant, accumulating in simdf::Width independent lanes
+template<unsigned int N>
+FORCEINLINE void SHEvalAccumulate( const simdf fX, const simdf fY, const simdf fZ, const simdf weight, simdf *accum )
+{
+	SHKernel<N>::Eval( fX, fY, fZ, SHAccumulate<simdf>{ accum, weight } );
+}
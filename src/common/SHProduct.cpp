@@ -0,0 +1,238 @@
+#include "SHProduct.h"
+#include "SHEval.h"
+#include "parallel.h"
+#include "simd.h"
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <mutex>
+
+/// Gauss-Legendre nodes & weights on [-1, 1], by Newton iterations on P_n
+static void GaussLegendre( int n, std::vector<f64> &nodes, std::vector<f64> &weights )
+{
+	nodes.resize( n );
+	weights.resize( n );
+
+	for ( int i = 0; i < n; ++i )
+	{
+		f64 x = std::cos( M_PI * ( i + 0.75 ) / ( n + 0.5 ) );
+		f64 dp = 0.0;
+
+		for ( int it = 0; it < 100; ++it )
+		{
+			f64 p0 = 1.0, p1 = x;
+			for ( int k = 2; k <= n; ++k )
+			{
+				const f64 p2 = ( ( 2 * k - 1 ) * x * p1 - ( k - 1 ) * p0 ) / k;
+				p0 = p1;
+				p1 = p2;
+			}
+
+			dp = n * ( x * p1 - p0 ) / ( x * x - 1.0 );
+			const f64 dx = p1 / dp;
+			x -= dx;
+			if ( std::abs( dx ) < 1e-15 )
+				break;
+		}
+
+		nodes[i] = x;
+		weights[i] = 2.0 / ( ( 1.0 - x * x ) * dp * dp );
+	}
+}
+
+/// SH basis of a direction in double precision, as accurate as available
+static void EvalBasis( int nBand, f64 x, f64 y, f64 z, f64 *sh )
+{
+	if ( nBand <= 11 )
+		SHEval11D( x, y, z, sh );
+	else if ( nBand <= 15 )
+		SHEval15D( x, y, z, sh );
+	else
+	{
+		f32 shf[21 * 21];
+		SHEval21( (f32) x, (f32) y, (f32) z, shf );
+		std::copy( shf, shf + 21 * 21, sh );
+	}
+}
+
+void SHProductTable::Init( int nBand )
+{
+	Assert( nBand >= 1 && nBand <= SHProductMaxBand );
+
+	this->nBand = nBand;
+	const int nCoeff = nBand * nBand;
+	const int evalCoeff = nBand <= 11 ? 121 : ( nBand <= 15 ? 225 : 441 );
+
+	// Exact quadrature for the polynomial of degree 3 * (nBand - 1) in z, and of trigonometric degree
+	// 3 * (nBand - 1) in phi
+	const int maxDegree = 3 * ( nBand - 1 );
+	const int nTheta = maxDegree / 2 + 1;
+	const int nPhi = maxDegree + 1;
+
+	std::vector<f64> nodes, weights;
+	GaussLegendre( nTheta, nodes, weights );
+
+	const int nDir = nTheta * nPhi;
+	std::vector<f64> basis( (size_t) nDir * nCoeff ), quadWeights( nDir ), eval( evalCoeff );
+	for ( int t = 0; t < nTheta; ++t )
+	{
+		const f64 z = nodes[t];
+		const f64 r = std::sqrt( std::max( 0.0, 1.0 - z * z ) );
+		for ( int p = 0; p < nPhi; ++p )
+		{
+			const f64 phi = 2.0 * M_PI * ( p + 0.5 ) / nPhi;
+			const int d = t * nPhi + p;
+
+			EvalBasis( nBand, r * std::cos( phi ), r * std::sin( phi ), z, &eval[0] );
+			std::copy( eval.begin(), eval.begin() + nCoeff, basis.begin() + (size_t) d * nCoeff );
+			quadWeights[d] = weights[t] * 2.0 * M_PI / nPhi;
+		}
+	}
+
+	// band l & order m of each coefficient
+	std::vector<int> band( nCoeff ), order( nCoeff );
+	for ( int l = 0; l < nBand; ++l )
+		for ( int m = -l; m <= l; ++m )
+			band[l * ( l + 1 ) + m] = l, order[l * ( l + 1 ) + m] = m;
+
+	std::vector<std::vector<u32>> kIndices( nCoeff );
+	std::vector<std::vector<f32>> kValues( nCoeff );
+
+	Parallel::For( nCoeff, [&]( u32 k, u32 )
+	{
+		const int lk = band[k], mk = order[k];
+
+		for ( int i = 0; i < nCoeff; ++i )
+		{
+			const int li = band[i], mi = order[i];
+
+			for ( int j = i; j < nCoeff; ++j )
+			{
+				const int lj = band[j], mj = order[j];
+
+				// triangle & parity rules on the bands
+				if ( lk < std::abs( li - lj ) || lk > li + lj || ( ( li + lj + lk ) & 1 ) )
+					continue;
+
+				// real SH : |mk| = |mi| +- |mj|, with an even number of sine (m < 0) terms
+				const int ami = std::abs( mi ), amj = std::abs( mj ), amk = std::abs( mk );
+				if ( ( amk != ami + amj && amk != std::abs( ami - amj ) ) || ( ( ( mi < 0 ) + ( mj < 0 ) + ( mk < 0 ) ) & 1 ) )
+					continue;
+
+				f64 g = 0.0;
+				for ( int d = 0; d < nDir; ++d )
+				{
+					const f64 *Y = &basis[(size_t) d * nCoeff];
+					g += quadWeights[d] * Y[i] * Y[j] * Y[k];
+				}
+
+				if ( std::abs( g ) > 1e-6 )
+				{
+					kIndices[k].push_back( (u32) i | ( (u32) j << 16 ) );
+					kValues[k].push_back( (f32) ( i == j ? 0.5 * g : g ) );
+				}
+			}
+		}
+	} );
+
+	offsets.assign( nCoeff + 1, 0 );
+	indices.clear();
+	values.clear();
+	for ( int k = 0; k < nCoeff; ++k )
+	{
+		indices.insert( indices.end(), kIndices[k].begin(), kIndices[k].end() );
+		values.insert( values.end(), kValues[k].begin(), kValues[k].end() );
+		offsets[k + 1] = (u32) values.size();
+	}
+}
+
+const SHProductTable& SHProductTable::Get( int nBand )
+{
+	Assert( nBand >= 1 && nBand <= SHProductMaxBand );
+
+	static std::mutex mutex;
+	static std::unique_ptr<SHProductTable> tables[SHProductMaxBand + 1];
+
+	std::lock_guard<std::mutex> lock( mutex );
+	if ( !tables[nBand] )
+	{
+		tables[nBand].reset( new SHProductTable() );
+		tables[nBand]->Init( nBand );
+	}
+
+	return *tables[nBand];
+}
+
+void SHProductTable::Multiply( const f32 *a, const f32 *b, f32 *out ) const
+{
+	const u32 nCoeff = nBand * nBand;
+
+	for ( u32 k = 0; k < nCoeff; ++k )
+	{
+		f32 sum = 0.f;
+		for ( u32 t = offsets[k]; t < offsets[k + 1]; ++t )
+		{
+			const u32 i = indices[t] & 0xFFFF, j = indices[t] >> 16;
+			sum += values[t] * ( a[i] * b[j] + a[j] * b[i] );
+		}
+		out[k] = sum;
+	}
+}
+
+void SHProductTable::MultiplyBatch( u32 count, const f32 *a, const f32 *b, f32 *out ) const
+{
+	const u32 W = simdf::Width;
+	const u32 nCoeff = nBand * nBand;
+
+	// Width pairs are transposed to coefficient-major, so that each lane computes its own product
+	std::vector<f32> soa( 3 * nCoeff * W + W );
+	f32 *sa = &soa[0], *sb = sa + nCoeff * W, *sc = sb + nCoeff * W;
+
+	u32 v = 0;
+	for ( ; v + W <= count; v += W )
+	{
+		for ( u32 l = 0; l < W; ++l )
+			for ( u32 c = 0; c < nCoeff; ++c )
+			{
+				sa[c * W + l] = a[( v + l ) * nCoeff + c];
+				sb[c * W + l] = b[( v + l ) * nCoeff + c];
+			}
+
+		for ( u32 k = 0; k < nCoeff; ++k )
+		{
+			simdf sum = simdf::Zero();
+			for ( u32 t = offsets[k]; t < offsets[k + 1]; ++t )
+			{
+				const u32 i = ( indices[t] & 0xFFFF ) * W, j = ( indices[t] >> 16 ) * W;
+				const simdf cross = MulAdd( simdf::Load( sa + i ), simdf::Load( sb + j ), simdf::Load( sa + j ) * simdf::Load( sb + i ) );
+				sum = MulAdd( simdf( values[t] ), cross, sum );
+			}
+			sum.Store( sc + k * W );
+		}
+
+		for ( u32 l = 0; l < W; ++l )
+			for ( u32 c = 0; c < nCoeff; ++c )
+				out[( v + l ) * nCoeff + c] = sc[c * W + l];
+	}
+
+	for ( ; v < count; ++v )
+		Multiply( a + v * nCoeff, b + v * nCoeff, out + v * nCoeff );
+}
+
+void SHProductTable::ProductMatrix( const f32 *a, f32 *M ) const
+{
+	const u32 nCoeff = nBand * nBand;
+	std::fill( M, M + nCoeff * nCoeff, 0.f );
+
+	for ( u32 k = 0; k < nCoeff; ++k )
+	{
+		f32 *row = M + k * nCoeff;
+		for ( u32 t = offsets[k]; t < offsets[k + 1]; ++t )
+		{
+			const u32 i = indices[t] & 0xFFFF, j = indices[t] >> 16;
+			row[j] += values[t] * a[i];
+			row[i] += values[t] * a[j];
+		}
+	}
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "common.h"
+
+/// Highest band count handled by SHProductTable
+static const int SHProductMaxBand = 21;
+
+/// General SH x SH products in SHEval's coefficient layout. The product of two nBand functions a & b, projected
+/// back on nBand bands, is c_k = sum_ij G_ijk a_i b_j with the Gaunt coefficients G_ijk = integral( Y_i Y_j Y_k ).
+/// G is very sparse (band and order selection rules) : the table only keeps its non-zero i <= j terms, grouped by k.
+struct SHProductTable
+{
+	SHProductTable() : nBand( 0 ) {}
+
+	/// Builds the table by quadrature of the triple products allowed by the selection rules, k in parallel
+	/// (see Parallel::For). nBand in [1, SHProductMaxBand]. About 30 ms for 11 bands, prefer Get.
+	void Init( int nBand );
+
+	/// Shared table for nBand, built on first use. Thread-safe.
+	static const SHProductTable& Get( int nBand );
+
+	/// out = a * b. out may not alias a or b.
+	void Multiply( const f32 *a, const f32 *b, f32 *out ) const;
+
+	/// count products of contiguous coefficient vectors, simdf::Width pairs at a time (see simd.h) :
+	/// out[v] = a[v] * b[v]. out may not alias a or b.
+	void MultiplyBatch( u32 count, const f32 *a, const f32 *b, f32 *out ) const;
+
+	/// Row-major (nBand^2)^2 matrix M of the product by a : a * b = M b. Cheaper than Multiply when a multiplies
+	/// many vectors (visibility, BRDF), since the matrix product is dense.
+	void ProductMatrix( const f32 *a, f32 *M ) const;
+
+	/// Number of stored terms
+	u32 TermCount() const { return (u32) values.size(); }
+
+	int nBand;
+	std::vector<u32> offsets;	//!< Terms of output coefficient k are [offsets[k], offsets[k+1])
+	std::vector<u32> indices;	//!< i | j << 16, i <= j
+	std::vector<f32> values;	//!< G_ijk, halved when i == j : every term adds value * ( a_i b_j + a_j b_i )
+};
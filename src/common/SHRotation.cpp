@@ -0,0 +1,188 @@
+#include "SHRotation.h"
+#include "simd.h"
+
+#include <algorithm>
+#include <cmath>
+
+/// Offset of band l's matrix in SHRotation::blocks : sum of (2k+1)^2 for k < l
+static u32 BlockOffset( int l )
+{
+	return (u32) ( l * ( 2 * l - 1 ) * ( 2 * l + 1 ) / 3 );
+}
+
+/// Band matrix accessed with signed orders m, n in [-l, l]
+struct BandMatrix
+{
+	int l;
+	f64 *data;
+
+	f64& operator()( int m, int n ) { return data[( m + l ) * ( 2 * l + 1 ) + n + l]; }
+	f64 operator()( int m, int n ) const { return data[( m + l ) * ( 2 * l + 1 ) + n + l]; }
+};
+
+/// P term of the recurrence, from band 1 (R1) and band l - 1 (prev)
+static f64 P( int i, int a, int b, int l, const BandMatrix &R1, const BandMatrix &prev )
+{
+	if ( b == l )
+		return R1( i, 1 ) * prev( a, l - 1 ) - R1( i, -1 ) * prev( a, -l + 1 );
+	if ( b == -l )
+		return R1( i, 1 ) * prev( a, -l + 1 ) + R1( i, -1 ) * prev( a, l - 1 );
+	return R1( i, 0 ) * prev( a, b );
+}
+
+/// Ivanic & Ruedenberg recurrence, with the corrections of their 1998 erratum.
+/// Matrices are for the real SH without the Condon-Shortley phase.
+static void ComputeBand( int l, const BandMatrix &R1, const BandMatrix &prev, BandMatrix &M )
+{
+	for ( int m = -l; m <= l; ++m )
+	{
+		const int am = std::abs( m );
+
+		for ( int n = -l; n <= l; ++n )
+		{
+			const f64 d = std::abs( n ) == l ? ( 2.0 * l ) * ( 2.0 * l - 1 ) : (f64) ( l + n ) * ( l - n );
+			const f64 u = std::sqrt( ( l + m ) * ( l - m ) / d );
+			const f64 v = 0.5 * std::sqrt( ( m == 0 ? 2.0 : 1.0 ) * ( l + am - 1 ) * ( l + am ) / d ) * ( m == 0 ? -1.0 : 1.0 );
+			const f64 w = m == 0 ? 0.0 : -0.5 * std::sqrt( ( l - am - 1 ) * ( l - am ) / d );
+
+			f64 value = 0.0;
+
+			if ( u != 0.0 )
+				value += u * P( 0, m, n, l, R1, prev );
+
+			if ( v != 0.0 )
+			{
+				f64 V;
+				if ( m == 0 )
+					V = P( 1, 1, n, l, R1, prev ) + P( -1, -1, n, l, R1, prev );
+				else if ( m > 0 )
+					V = P( 1, m - 1, n, l, R1, prev ) * ( m == 1 ? std::sqrt( 2.0 ) : 1.0 ) - ( m == 1 ? 0.0 : P( -1, -m + 1, n, l, R1, prev ) );
+				else
+					V = ( m == -1 ? 0.0 : P( 1, m + 1, n, l, R1, prev ) ) + P( -1, -m - 1, n, l, R1, prev ) * ( m == -1 ? std::sqrt( 2.0 ) : 1.0 );
+				value += v * V;
+			}
+
+			if ( w != 0.0 )
+			{
+				const f64 W = m > 0 ? P( 1, m + 1, n, l, R1, prev ) + P( -1, -m - 1, n, l, R1, prev )
+									: P( 1, m - 1, n, l, R1, prev ) - P( -1, -m + 1, n, l, R1, prev );
+				value += w * W;
+			}
+
+			M( m, n ) = value;
+		}
+	}
+}
+
+void SHRotation::Init( const mat3f &R, int nBand )
+{
+	Assert( nBand >= 1 && nBand <= SHRotationMaxBand );
+
+	this->nBand = nBand;
+	blocks.resize( BlockOffset( nBand ) );
+	blocks[0] = 1.f;
+
+	if ( nBand == 1 )
+		return;
+
+	// SH frame rotation : swap y & z on both sides. mat3 is column-major, R[col][row]
+	const int swz[3] = { 0, 2, 1 };
+	f64 Rs[3][3];
+	for ( int row = 0; row < 3; ++row )
+		for ( int col = 0; col < 3; ++col )
+			Rs[row][col] = R.M[swz[col]][swz[row]];
+
+	// band 1 basis is ordered (y, z, x) in the SH frame
+	const int axis[3] = { 1, 2, 0 };
+	std::vector<f64> scratch( 2 * ( 2 * nBand - 1 ) * ( 2 * nBand - 1 ) );
+
+	f64 r1[9];
+	BandMatrix R1 = { 1, r1 };
+	for ( int m = -1; m <= 1; ++m )
+		for ( int n = -1; n <= 1; ++n )
+			R1( m, n ) = Rs[axis[m + 1]][axis[n + 1]];
+
+	BandMatrix prev = R1;
+	for ( int l = 1; l < nBand; ++l )
+	{
+		BandMatrix M = { l, &scratch[( l & 1 ) * ( 2 * nBand - 1 ) * ( 2 * nBand - 1 )] };
+		if ( l == 1 )
+			std::copy( r1, r1 + 9, M.data );
+		else
+			ComputeBand( l, R1, prev, M );
+
+		// back to SHEval's Condon-Shortley phase : (-1)^m on each basis function
+		f32 *block = &blocks[BlockOffset( l )];
+		for ( int m = -l; m <= l; ++m )
+			for ( int n = -l; n <= l; ++n )
+				*block++ = (f32) ( ( ( m + n ) & 1 ) ? -M( m, n ) : M( m, n ) );
+
+		prev = M;
+	}
+}
+
+void SHRotation::Apply( const f32 *in, f32 *out ) const
+{
+	f32 band[2 * SHRotationMaxBand - 1];
+
+	out[0] = in[0];
+	for ( int l = 1; l < nBand; ++l )
+	{
+		const int size = 2 * l + 1;
+		const f32 *M = &blocks[BlockOffset( l )];
+
+		std::copy( in + l * l, in + l * l + size, band );
+		for ( int r = 0; r < size; ++r, M += size )
+		{
+			f32 sum = 0.f;
+			for ( int c = 0; c < size; ++c )
+				sum += M[c] * band[c];
+			out[l * l + r] = sum;
+		}
+	}
+}
+
+void SHRotation::ApplyBatch( u32 count, const f32 *in, f32 *out ) const
+{
+	const u32 W = simdf::Width;
+	const u32 nCoeff = nBand * nBand;
+
+	// Width vectors are transposed to coefficient-major, so that each lane rotates its own vector
+	alignas( 32 ) f32 soa[SHRotationMaxBand * SHRotationMaxBand * simdf::Width];
+	simdf band[2 * SHRotationMaxBand - 1];
+
+	u32 v = 0;
+	for ( ; v + W <= count; v += W )
+	{
+		const f32 *src = in + v * nCoeff;
+		for ( u32 i = 0; i < W; ++i )
+			for ( u32 c = 0; c < nCoeff; ++c )
+				soa[c * W + i] = src[i * nCoeff + c];
+
+		for ( int l = 1; l < nBand; ++l )
+		{
+			const int size = 2 * l + 1;
+			const f32 *M = &blocks[BlockOffset( l )];
+			f32 *coeffs = &soa[l * l * W];
+
+			for ( int c = 0; c < size; ++c )
+				band[c] = simdf::Load( coeffs + c * W );
+
+			for ( int r = 0; r < size; ++r, M += size )
+			{
+				simdf sum = simdf::Zero();
+				for ( int c = 0; c < size; ++c )
+					sum = MulAdd( simdf( M[c] ), band[c], sum );
+				sum.Store( coeffs + r * W );
+			}
+		}
+
+		f32 *dst = out + v * nCoeff;
+		for ( u32 i = 0; i < W; ++i )
+			for ( u32 c = 0; c < nCoeff; ++c )
+				dst[i * nCoeff + c] = soa[c * W + i];
+	}
+
+	for ( ; v < count; ++v )
+		Apply( in + v * nCoeff, out + v * nCoeff );
+}
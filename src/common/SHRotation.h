@@ -0,0 +1,30 @@
+#pragma once
+
+#include "common.h"
+
+/// Highest band count handled by SHRotation
+static const int SHRotationMaxBand = 21;
+
+/// Rotation of SH coefficient vectors laid out like SHEval's output (coefficient l * (l + 1) + m, Condon-Shortley phase).
+/// The rotation is block-diagonal, one (2l+1)^2 matrix per band, built once by the Ivanic/Ruedenberg recurrence [Ivanic96]
+/// and reused for every vector. Applying it costs sum( (2l+1)^2 ) multiply-adds : about 1.5k for 11 bands, which replaces
+/// a full re-integration of the rotated function.
+struct SHRotation
+{
+	SHRotation() : nBand( 0 ) {}
+
+	/// R is a world space rotation (y up), like the directions given to the integrators : it is swizzled to the
+	/// SH z-up convention here. nBand in [1, SHRotationMaxBand].
+	/// If f has coefficients in, f( R^-1 * d ) has coefficients out (see Apply).
+	void Init( const mat3f &R, int nBand );
+
+	/// Rotates one vector of nBand * nBand coefficients. in and out may be the same array.
+	void Apply( const f32 *in, f32 *out ) const;
+
+	/// Rotates count contiguous vectors of nBand * nBand coefficients, simdf::Width vectors at a time (see simd.h).
+	/// in and out may be the same array.
+	void ApplyBatch( u32 count, const f32 *in, f32 *out ) const;
+
+	int nBand;
+	std::vector<f32> blocks;	//!< Row-major band matrices, band l starts at l * (2l-1) * (2l+1) / 3
+};
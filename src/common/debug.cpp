@@ -1,8 +1,12 @@
 #include "common.h"
 
 #include <stdlib.h>
+#ifdef RADAR_HEADLESS
+#include <chrono>
+#else
 #include <GL/glew.h>
 #include <GLFW/glfw3.h>
+#endif
 #include <time.h>
 
 bool Log::log_opened = false;
@@ -65,5 +69,11 @@ void Log::Close()
 
 double Log::get_engine_time()
 {
+#ifdef RADAR_HEADLESS
+	// no GLFW window in headless builds (tools, benchmarks) : time since first log
+	static const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	return std::chrono::duration<double>( std::chrono::steady_clock::now() - start ).count();
+#else
 	return glfwGetTime();
+#endif
 }
@@ -552,29 +552,32 @@ typedef vec4<f32> vec4f;
 typedef vec4<int> vec4i;
 
 
+/// Bilinear filtering of a texSize texture, with GL conventions : texel centers at (i + 0.5) / size, clamp to edge.
+/// Any size from 1x1 up.
 template<typename T>
 inline T BilinearLookup( const f32 *f32Texture, const vec2f &coord, const vec2i &texSize )
 {
-	const vec2i coordI( (int) std::floor( texSize.y * coord.x ), (int) std::floor( texSize.y * coord.y ) );
-	const vec2f offset( coord.x - coordI.x, coord.y - coordI.y );
+	const vec2f texel( coord.x * texSize.x - 0.5f, coord.y * texSize.y - 0.5f );
+	const vec2i coordI( std::max( 0, std::min( texSize.x - 2, (int) std::floor( texel.x ) ) ),
+						std::max( 0, std::min( texSize.y - 2, (int) std::floor( texel.y ) ) ) );
+	const vec2f offset( std::max( 0.f, std::min( 1.f, texel.x - coordI.x ) ),
+						std::max( 0.f, std::min( 1.f, texel.y - coordI.y ) ) );
+
+	// second texel of each axis, the same as the first one on a size 1 axis
+	const int x1 = std::min( coordI.x + 1, texSize.x - 1 );
+	const int y1 = std::min( coordI.y + 1, texSize.y - 1 );
 
 	const T *texture = (T*) f32Texture;
 
 	T res = texture[coordI.y * texSize.x + coordI.x];
-	if ( coordI.x < ( texSize.x - 1 ) && coordI.y < ( texSize.y - 1 ) )
-	{
-		T res_tr = texture[coordI.y * texSize.x + coordI.x + 1];
-		T res_bl = texture[( coordI.y + 1 ) * texSize.x + coordI.x];
-		T res_br = texture[( coordI.y + 1 ) * texSize.x + coordI.x + 1];
+	T res_tr = texture[coordI.y * texSize.x + x1];
+	T res_bl = texture[y1 * texSize.x + coordI.x];
+	T res_br = texture[y1 * texSize.x + x1];
+
+	res = res * ( 1.f - offset.x ) + res_tr * offset.x;
+	res_bl = res_bl * ( 1.f - offset.x ) + res_br * offset.x;
+	res = res * ( 1.f - offset.y ) + res_bl * offset.y;
 
-		res = res * ( 1.f - offset.x ) + res_tr * offset.x;
-		res_bl = res_bl * ( 1.f - offset.x ) + res_br * offset.x;
-		res = res * ( 1.f - offset.y ) + res_bl * offset.y;
-	}
-	else
-	{
-		LogErr( "Out of texture." );
-	}
 	return res;
 }
 
@@ -760,6 +763,8 @@ public:
 		R[0][2] = +( M[0][1] * M[1][2] - M[1][1] * M[0][2] ) * oneOverDet;
 		R[1][2] = -( M[0][0] * M[1][2] - M[1][0] * M[0][2] ) * oneOverDet;
 		R[2][2] = +( M[0][0] * M[1][1] - M[1][0] * M[0][1] ) * oneOverDet;
+
+		return R;
 	}
 
 	vec3<T> M[3];
@@ -0,0 +1,141 @@
+#include "parallel.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace Parallel
+{
+	/// Persistent worker threads, woken up for each For() call.
+	/// The calling thread works as thread 0, the workers as 1..N-1.
+	struct Pool
+	{
+		std::vector<std::thread> workers;
+		std::mutex mutex;
+		std::condition_variable wakeCond;
+		std::condition_variable doneCond;
+
+		const std::function<void( u32, u32 )> *job = nullptr;
+		u32 jobCount = 0;
+		std::atomic<u32> nextTask;
+		u32 busyWorkers = 0;
+		u64 generation = 0;
+		bool quit = false;
+
+		Pool() : nextTask( 0 ) {}
+		~Pool() { Stop(); }
+
+		void Start( u32 threadCount );
+		void Stop();
+		void Run( u32 threadIdx );
+		void WorkerLoop( u32 threadIdx, u64 seenGeneration );
+	};
+
+	static Pool pool;
+	static u32 threadCount = 0;
+	static thread_local bool insideFor = false;
+
+	void Pool::Start( u32 count )
+	{
+		// workers start from the current generation, or they would run a stale job after a restart
+		std::lock_guard<std::mutex> lock( mutex );
+		quit = false;
+		for ( u32 i = 1; i < count; ++i )
+			workers.push_back( std::thread( &Pool::WorkerLoop, this, i, generation ) );
+	}
+
+	void Pool::Stop()
+	{
+		{
+			std::lock_guard<std::mutex> lock( mutex );
+			quit = true;
+		}
+		wakeCond.notify_all();
+
+		for ( std::thread &t : workers )
+			t.join();
+		workers.clear();
+	}
+
+	void Pool::Run( u32 threadIdx )
+	{
+		insideFor = true;
+		for ( u32 task = nextTask++; task < jobCount; task = nextTask++ )
+			( *job )( task, threadIdx );
+		insideFor = false;
+	}
+
+	void Pool::WorkerLoop( u32 threadIdx, u64 seenGeneration )
+	{
+		for ( ;; )
+		{
+			{
+				std::unique_lock<std::mutex> lock( mutex );
+				wakeCond.wait( lock, [&] { return quit || generation != seenGeneration; } );
+				if ( quit )
+					return;
+				seenGeneration = generation;
+			}
+
+			Run( threadIdx );
+
+			std::lock_guard<std::mutex> lock( mutex );
+			if ( --busyWorkers == 0 )
+				doneCond.notify_one();
+		}
+	}
+
+	void SetThreadCount( u32 count )
+	{
+		Assert( !insideFor );
+
+		if ( count == 0 )
+			count = std::max( 1u, std::thread::hardware_concurrency() );
+
+		if ( count != threadCount )
+		{
+			pool.Stop();
+			pool.Start( count );
+			threadCount = count;
+		}
+	}
+
+	u32 ThreadCount()
+	{
+		if ( threadCount == 0 )
+			SetThreadCount( 0 );
+		return threadCount;
+	}
+
+	void For( u32 taskCount, const std::function<void( u32, u32 )> &func )
+	{
+		if ( taskCount == 0 )
+			return;
+
+		// Serial path : nested call, single task or single thread
+		if ( insideFor || taskCount == 1 || ThreadCount() == 1 )
+		{
+			for ( u32 task = 0; task < taskCount; ++task )
+				func( task, 0 );
+			return;
+		}
+
+		{
+			std::lock_guard<std::mutex> lock( pool.mutex );
+			pool.job = &func;
+			pool.jobCount = taskCount;
+			pool.nextTask = 0;
+			pool.busyWorkers = (u32) pool.workers.size();
+			++pool.generation;
+		}
+		pool.wakeCond.notify_all();
+
+		pool.Run( 0 );
+
+		std::unique_lock<std::mutex> lock( pool.mutex );
+		pool.doneCond.wait( lock, [] { return pool.busyWorkers == 0; } );
+		pool.job = nullptr;
+	}
+}
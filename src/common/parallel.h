@@ -0,0 +1,21 @@
+#pragma once
+
+#include "common.h"
+#include <functional>
+
+namespace Parallel
+{
+	/// Sets the number of threads used by Parallel::For, calling thread included.
+	/// 0 means std::thread::hardware_concurrency(). Must not be called from inside a For.
+	void SetThreadCount( u32 count );
+
+	/// Number of threads used by Parallel::For, calling thread included
+	u32 ThreadCount();
+
+	/// Runs func( taskIdx, threadIdx ) for every taskIdx in [0, taskCount) on the worker pool.
+	/// Tasks are handed out dynamically, so the task->thread mapping is not deterministic : any
+	/// reproducible result should only depend on taskIdx. threadIdx is in [0, ThreadCount()).
+	/// Blocks until every task is done. Nested calls run serially on the calling thread.
+	/// There is a single pool : For should only be called from one application thread at a time.
+	void For( u32 taskCount, const std::function<void( u32 taskIdx, u32 threadIdx )> &func );
+}
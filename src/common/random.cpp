@@ -1,36 +1,166 @@
 #include "random.h"
+#include "simd.h"
 #include <random>
 #include <array>
 #include <algorithm>
+#include <atomic>
 #include <functional>
 
 namespace Random
 {
-	// TODO : Have this per-thread when multithreading stuff
-	std::mt19937 twister;
-	std::uniform_real_distribution<float> rd( 0, 1 );
+	static u64 globalSeed = 0;
+	static std::atomic<u64> threadStreamCount( 0 );
 
 
-	Random::Pool<f32> GlobalPool;
+	Philox &ThreadGenerator()
+	{
+		static thread_local Philox generator( globalSeed, threadStreamCount++ );
+		return generator;
+	}
 
+	void SeedThread( u64 seed, u64 stream )
+	{
+		ThreadGenerator() = Philox( seed, stream );
+	}
 
-	// Feed the twister with enough entropy (state size of 19968 bits == 624 ints)
+	// Seed the generators from the system entropy source
 	void InitRandom()
 	{
 		std::random_device r;
-		std::array<int, 624> seed_data;
-		std::generate( seed_data.begin(), seed_data.end(), std::ref( r ) );
+		globalSeed = ( (u64) r() << 32 ) | r();
+
+		// the calling thread may have drawn values before
+		SeedThread( globalSeed, threadStreamCount++ );
+	}
 
-		std::seed_seq seed( std::begin( seed_data ), std::end( seed_data ) );
-		twister = std::mt19937( seed );
+#if !defined(RADAR_SIMD_SCALAR)
+	/// 4 Philox blocks in parallel, one per SSE2 lane, converted to floats in block order
+	static void PhiloxBlocks4( const u32 key[2], u64 stream, u64 firstBlock, f32 *out )
+	{
+		__m128i c0 = _mm_setr_epi32( (int) ( firstBlock ), (int) ( firstBlock + 1 ), (int) ( firstBlock + 2 ), (int) ( firstBlock + 3 ) );
+		__m128i c1 = _mm_setr_epi32( (int) ( firstBlock >> 32 ), (int) ( ( firstBlock + 1 ) >> 32 ), (int) ( ( firstBlock + 2 ) >> 32 ), (int) ( ( firstBlock + 3 ) >> 32 ) );
+		__m128i c2 = _mm_set1_epi32( (int) stream );
+		__m128i c3 = _mm_set1_epi32( (int) ( stream >> 32 ) );
+		u32 k0 = key[0], k1 = key[1];
+
+		const __m128i m0 = _mm_set1_epi32( (int) Philox::PhiloxM0 );
+		const __m128i m1 = _mm_set1_epi32( (int) Philox::PhiloxM1 );
+
+		for ( int round = 0; round < 10; ++round )
+		{
+			// 32x32 -> 64 products, even and odd lanes separately
+			const __m128i p0even = _mm_mul_epu32( c0, m0 );
+			const __m128i p0odd = _mm_mul_epu32( _mm_srli_epi64( c0, 32 ), m0 );
+			const __m128i p1even = _mm_mul_epu32( c2, m1 );
+			const __m128i p1odd = _mm_mul_epu32( _mm_srli_epi64( c2, 32 ), m1 );
+
+			const __m128i lo0 = _mm_unpacklo_epi32( _mm_shuffle_epi32( p0even, _MM_SHUFFLE( 0, 0, 2, 0 ) ), _mm_shuffle_epi32( p0odd, _MM_SHUFFLE( 0, 0, 2, 0 ) ) );
+			const __m128i hi0 = _mm_unpacklo_epi32( _mm_shuffle_epi32( p0even, _MM_SHUFFLE( 0, 0, 3, 1 ) ), _mm_shuffle_epi32( p0odd, _MM_SHUFFLE( 0, 0, 3, 1 ) ) );
+			const __m128i lo1 = _mm_unpacklo_epi32( _mm_shuffle_epi32( p1even, _MM_SHUFFLE( 0, 0, 2, 0 ) ), _mm_shuffle_epi32( p1odd, _MM_SHUFFLE( 0, 0, 2, 0 ) ) );
+			const __m128i hi1 = _mm_unpacklo_epi32( _mm_shuffle_epi32( p1even, _MM_SHUFFLE( 0, 0, 3, 1 ) ), _mm_shuffle_epi32( p1odd, _MM_SHUFFLE( 0, 0, 3, 1 ) ) );
+
+			c0 = _mm_xor_si128( _mm_xor_si128( hi1, c1 ), _mm_set1_epi32( (int) k0 ) );
+			c1 = lo1;
+			c2 = _mm_xor_si128( _mm_xor_si128( hi0, c3 ), _mm_set1_epi32( (int) k1 ) );
+			c3 = lo0;
+
+			k0 += Philox::PhiloxW0;
+			k1 += Philox::PhiloxW1;
+		}
+
+		// u32 -> [0, 1) float, then transpose from word-major to block-major
+		const __m128 scale = _mm_set1_ps( 1.f / 16777216.f );
+		__m128 w0 = _mm_mul_ps( _mm_cvtepi32_ps( _mm_srli_epi32( c0, 8 ) ), scale );
+		__m128 w1 = _mm_mul_ps( _mm_cvtepi32_ps( _mm_srli_epi32( c1, 8 ) ), scale );
+		__m128 w2 = _mm_mul_ps( _mm_cvtepi32_ps( _mm_srli_epi32( c2, 8 ) ), scale );
+		__m128 w3 = _mm_mul_ps( _mm_cvtepi32_ps( _mm_srli_epi32( c3, 8 ) ), scale );
+		_MM_TRANSPOSE4_PS( w0, w1, w2, w3 );
+
+		_mm_storeu_ps( out + 0, w0 );
+		_mm_storeu_ps( out + 4, w1 );
+		_mm_storeu_ps( out + 8, w2 );
+		_mm_storeu_ps( out + 12, w3 );
+	}
+
+	/// 2 Philox blocks in parallel. The multiplied words c0 & c2 of both blocks share a register,
+	/// [b0.c0, b0.c2, b1.c0, b1.c2], so that a single _mm_mul_epu32 pair does all 4 products.
+	/// The other words are kept in the same order : [b0.c1, b0.c3, b1.c1, b1.c3]
+	static void PhiloxBlocks2( const u32 key[2], u64 stream, u64 firstBlock, f32 *out )
+	{
+		__m128i x = _mm_setr_epi32( (int) firstBlock, (int) stream, (int) ( firstBlock + 1 ), (int) stream );
+		__m128i y = _mm_setr_epi32( (int) ( firstBlock >> 32 ), (int) ( stream >> 32 ), (int) ( ( firstBlock + 1 ) >> 32 ), (int) ( stream >> 32 ) );
+		u32 k0 = key[0], k1 = key[1];
+
+		const __m128i m0 = _mm_set1_epi32( (int) Philox::PhiloxM0 );
+		const __m128i m1 = _mm_set1_epi32( (int) Philox::PhiloxM1 );
+
+		for ( int round = 0; round < 10; ++round )
+		{
+			// 64 bits products : [lo, hi] of c0 * M0 for both blocks, then c2 * M1
+			const __m128i p0 = _mm_mul_epu32( x, m0 );
+			const __m128i p1 = _mm_mul_epu32( _mm_srli_epi64( x, 32 ), m1 );
+
+			// hi words to [b0.hi1, b0.hi0, b1.hi1, b1.hi0], lo words likewise
+			const __m128i hi = _mm_unpacklo_epi32( _mm_shuffle_epi32( p1, _MM_SHUFFLE( 0, 0, 3, 1 ) ), _mm_shuffle_epi32( p0, _MM_SHUFFLE( 0, 0, 3, 1 ) ) );
+			const __m128i lo = _mm_unpacklo_epi32( _mm_shuffle_epi32( p1, _MM_SHUFFLE( 0, 0, 2, 0 ) ), _mm_shuffle_epi32( p0, _MM_SHUFFLE( 0, 0, 2, 0 ) ) );
+
+			// c0 = hi1 ^ c1 ^ k0, c2 = hi0 ^ c3 ^ k1, c1 = lo1, c3 = lo0
+			x = _mm_xor_si128( _mm_xor_si128( hi, y ), _mm_setr_epi32( (int) k0, (int) k1, (int) k0, (int) k1 ) );
+			y = lo;
+
+			k0 += Philox::PhiloxW0;
+			k1 += Philox::PhiloxW1;
+		}
+
+		// back to [c0, c1, c2, c3] per block, then u32 -> [0, 1) float
+		const __m128 scale = _mm_set1_ps( 1.f / 16777216.f );
+		const __m128i b0 = _mm_unpacklo_epi32( x, y );
+		const __m128i b1 = _mm_unpackhi_epi32( x, y );
+
+		_mm_storeu_ps( out + 0, _mm_mul_ps( _mm_cvtepi32_ps( _mm_srli_epi32( b0, 8 ) ), scale ) );
+		_mm_storeu_ps( out + 4, _mm_mul_ps( _mm_cvtepi32_ps( _mm_srli_epi32( b1, 8 ) ), scale ) );
+	}
+#endif
 
-		// Initialize the Global Random pool
-		GlobalPool.Init( 65536 );
+	void Philox::Fill( f32 *out, u32 count )
+	{
+		// leftovers of the current block first
+		while ( bufferIdx < 4 && count )
+		{
+			*out++ = Next();
+			--count;
+		}
+
+#if !defined(RADAR_SIMD_SCALAR)
+		for ( ; count >= 16; count -= 16, out += 16, block += 4 )
+		{
+			PhiloxBlocks4( key, stream, block, out );
+		}
+
+		if ( count >= 8 )
+		{
+			PhiloxBlocks2( key, stream, block, out );
+			count -= 8;
+			out += 8;
+			block += 2;
+		}
+#endif
+
+		for ( ; count >= 4; count -= 4, out += 4 )
+		{
+			u32 b[4];
+			Block( block++, b );
+			for ( int i = 0; i < 4; ++i )
+				out[i] = ( b[i] >> 8 ) * ( 1.f / 16777216.f );
+		}
+
+		while ( count-- )
+			*out++ = Next();
 	}
 
 	float Float()
 	{
-		return rd( twister );
+		return ThreadGenerator().Next();
 	}
 
 	vec2f Vec2f()
@@ -48,22 +178,56 @@ namespace Random
 		return vec4f( Float(), Float(), Float(), Float() );
 	}
 
-	int Int( int a, int b )
+	/// Uniform value in [0, range) from a 32 bits random value, with Lemire's multiply-shift
+	static u32 Bounded( u32 range )
 	{
-		std::uniform_int_distribution<int> di( a, b );
+		return (u32) ( ( (u64) ThreadGenerator().UInt() * range ) >> 32 );
+	}
 
-		return di( twister );
+	int Int( int a, int b )
+	{
+		const u32 range = (u32) b - (u32) a + 1;
+		return (int) ( (u32) a + ( range ? Bounded( range ) : ThreadGenerator().UInt() ) );
 	}
 
 	unsigned int UInt( unsigned int a, unsigned int b )
 	{
-		std::uniform_int_distribution<unsigned int> di( a, b );
-
-		return di( twister );
+		const u32 range = b - a + 1;
+		return a + ( range ? Bounded( range ) : ThreadGenerator().UInt() );
 	}
 
 	vec2i Vec2i( int a, int b )
 	{
 		return vec2i( Int( a, b ), Int( a, b ) );
 	}
+
+	template<typename Sampler>
+	static void Generate2D( u64 seed, u64 first, u32 count, vec2f *samples )
+	{
+		Sampler sampler( seed, first );
+		for ( u32 i = 0; i < count; ++i )
+			samples[i] = sampler.Next2D();
+	}
+
+	void Generate2D( Sequence seq, u64 seed, u64 first, u32 count, vec2f *samples )
+	{
+		switch ( seq )
+		{
+		case SEQ_PCG:		Generate2D<Stream>( seed, first, count, samples ); break;
+		case SEQ_PHILOX:
+		{
+			// bulk SIMD path, vec2f being 2 packed floats
+			Philox philox( seed, 0 );
+			philox.Seek( first * 2 );
+			philox.Fill( &samples[0].x, count * 2 );
+			break;
+		}
+		case SEQ_SOBOL:		Generate2D<Sobol>( seed, first, count, samples ); break;
+		case SEQ_HALTON:	Generate2D<Halton>( seed, first, count, samples ); break;
+		case SEQ_R2:		Generate2D<R2>( seed, first, count, samples ); break;
+		case SEQ_THREAD:	ThreadGenerator().Fill( &samples[0].x, count * 2 ); break;
+		default:
+			Assert( false );
+		}
+	}
 }
\ No newline at end of file
@@ -40,10 +40,10 @@ namespace Random
 		return Vec4f();
 	}
 
-	/// Random int between [a, b)
+	/// Random int between [a, b]
 	int Int( int a, int b );
 
-	/// Random uint between [a, b)
+	/// Random uint between [a, b]
 	unsigned int UInt( unsigned int a, unsigned int b );
 
 	template<typename T>
@@ -90,7 +90,283 @@ namespace Random
 		u32 sampleIdx;
 	};
 
-	/// Global Random floating point value pool, queriable from anywhere
-	/// For faster query than the individual functions
-	extern Random::Pool<f32> GlobalPool;
+	/// Small PCG32 generator (O'Neill 2014). Each (seed, sequence) pair is an independent stream,
+	/// so parallel tasks can each own a reproducible stream indexed by their task id.
+	class Stream
+	{
+	public:
+		Stream( u64 seed, u64 sequence ) : state( 0 ), inc( ( sequence << 1u ) | 1u )
+		{
+			UInt();
+			state += seed;
+			UInt();
+		}
+
+		u32 UInt()
+		{
+			const u64 old = state;
+			state = old * 6364136223846793005ULL + inc;
+			const u32 xorshifted = (u32) ( ( ( old >> 18u ) ^ old ) >> 27u );
+			const u32 rot = (u32) ( old >> 59u );
+			return ( xorshifted >> rot ) | ( xorshifted << ( ( 32 - rot ) & 31 ) );
+		}
+
+		/// Uniform float in [0, 1)
+		f32 Next()
+		{
+			return ( UInt() >> 8 ) * ( 1.f / 16777216.f );
+		}
+
+		vec2f Next2D()
+		{
+			const f32 u = Next();
+			return vec2f( u, Next() );
+		}
+
+	private:
+		u64 state;
+		u64 inc;
+	};
+
+	/// Philox4x32-10 counter-based generator [Salmon11]. Each output is a pure function of (seed, stream, index) :
+	/// streams are independent, any index is reachable in O(1) (Seek) and there is no shared state between threads.
+	/// Every 4 outputs are the encryption of the counter ( index / 4, stream ) with the seed as key.
+	class Philox
+	{
+	public:
+		Philox( u64 seed, u64 stream ) : stream( stream ), block( 0 ), bufferIdx( 4 )
+		{
+			key[0] = (u32) seed;
+			key[1] = (u32) ( seed >> 32 );
+		}
+
+		/// Moves to the index-th output of the stream
+		void Seek( u64 index )
+		{
+			block = index >> 2;
+			bufferIdx = 4;
+			if ( index & 3 )
+			{
+				Block( block++, buffer );
+				bufferIdx = (u32) ( index & 3 );
+			}
+		}
+
+		u32 UInt()
+		{
+			if ( bufferIdx == 4 )
+			{
+				Block( block++, buffer );
+				bufferIdx = 0;
+			}
+			return buffer[bufferIdx++];
+		}
+
+		/// Uniform float in [0, 1)
+		f32 Next()
+		{
+			return ( UInt() >> 8 ) * ( 1.f / 16777216.f );
+		}
+
+		vec2f Next2D()
+		{
+			const f32 u = Next();
+			return vec2f( u, Next() );
+		}
+
+		/// Bulk version of Next, same sequence. Generates 4 blocks (16 floats) per SIMD pass, then 2 blocks for
+		/// a remaining 8.
+		void Fill( f32 *out, u32 count );
+
+		/// 8 floats at a time, for SIMD consumers. Generates 2 blocks per SIMD pass when the stream is at a
+		/// block boundary (after Seek( 4k ) or a multiple of 4 outputs)
+		void Next8( f32 *out )
+		{
+			Fill( out, 8 );
+		}
+
+		/// The 4 outputs of the given counter block
+		void Block( u64 blockIdx, u32 out[4] ) const
+		{
+			u32 c[4] = { (u32) blockIdx, (u32) ( blockIdx >> 32 ), (u32) stream, (u32) ( stream >> 32 ) };
+			u32 k[2] = { key[0], key[1] };
+
+			for ( int round = 0; round < 10; ++round )
+			{
+				const u64 p0 = (u64) PhiloxM0 * c[0];
+				const u64 p1 = (u64) PhiloxM1 * c[2];
+
+				const u32 c0 = (u32) ( p1 >> 32 ) ^ c[1] ^ k[0];
+				const u32 c2 = (u32) ( p0 >> 32 ) ^ c[3] ^ k[1];
+				c[0] = c0;
+				c[1] = (u32) p1;
+				c[2] = c2;
+				c[3] = (u32) p0;
+
+				k[0] += PhiloxW0;
+				k[1] += PhiloxW1;
+			}
+
+			out[0] = c[0]; out[1] = c[1]; out[2] = c[2]; out[3] = c[3];
+		}
+
+		static const u32 PhiloxM0 = 0xD2511F53;
+		static const u32 PhiloxM1 = 0xCD9E8D57;
+		static const u32 PhiloxW0 = 0x9E3779B9;
+		static const u32 PhiloxW1 = 0xBB67AE85;
+
+	private:
+		u32 key[2];
+		u64 stream;
+		u64 block;		// next block to generate
+		u32 buffer[4];
+		u32 bufferIdx;
+	};
+
+	/// Generator of the calling thread, used by Float(), Int(), ... Created on first use, on its own stream
+	/// of the InitRandom seed.
+	Philox &ThreadGenerator();
+
+	/// Reseeds the calling thread's generator, e.g. at the start of a parallel task for reproducible results
+	void SeedThread( u64 seed, u64 stream );
+
+	/// Maps the 24 high bits of x to a float in [0, 1)
+	FORCEINLINE f32 ToFloat( u32 x )
+	{
+		return ( x >> 8 ) * ( 1.f / 16777216.f );
+	}
+
+	FORCEINLINE u32 ReverseBits( u32 x )
+	{
+		x = ( x << 16 ) | ( x >> 16 );
+		x = ( ( x & 0x00ff00ff ) << 8 ) | ( ( x & 0xff00ff00 ) >> 8 );
+		x = ( ( x & 0x0f0f0f0f ) << 4 ) | ( ( x & 0xf0f0f0f0 ) >> 4 );
+		x = ( ( x & 0x33333333 ) << 2 ) | ( ( x & 0xcccccccc ) >> 2 );
+		x = ( ( x & 0x55555555 ) << 1 ) | ( ( x & 0xaaaaaaaa ) >> 1 );
+		return x;
+	}
+
+	/// 64 to 32 bits seed hash (SplitMix64 finalizer), with a salt to derive several keys from one seed
+	FORCEINLINE u32 HashSeed( u64 seed, u64 salt )
+	{
+		u64 z = seed + ( salt + 1 ) * 0x9e3779b97f4a7c15ULL;
+		z = ( z ^ ( z >> 30 ) ) * 0xbf58476d1ce4e5b9ULL;
+		z = ( z ^ ( z >> 27 ) ) * 0x94d049bb133111ebULL;
+		return (u32) ( ( z ^ ( z >> 31 ) ) >> 32 );
+	}
+
+	// 2D sample sequences.
+	// They all share the same interface, so that sampling code can be templated on them :
+	//   Sampler( u64 seed, u64 first ) : draws samples first, first + 1, ... of the sequence seeded by seed.
+	//                                    Disjoint index ranges can be handed to parallel tasks.
+	//   vec2f Next2D()                 : next sample in [0, 1)^2
+	// Stream (above) also fits it, with first selecting an independent stream.
+	// Quasi-random indices wrap every 2^32 samples, each 2^32 block being randomized with different keys.
+
+	/// Owen-scrambled Sobol (0,2)-sequence, with the hash-based nested uniform scrambling of [Burley20].
+	/// Any 2^k aligned index range is a stratified (0,k,2)-net : use power of two sample counts.
+	class Sobol
+	{
+	public:
+		Sobol( u64 seed, u64 first ) : index( (u32) first ), shuffleKey( HashSeed( seed, 3 * ( first >> 32 ) ) ),
+			xKey( HashSeed( seed, 3 * ( first >> 32 ) + 1 ) ), yKey( HashSeed( seed, 3 * ( first >> 32 ) + 2 ) )
+		{}
+
+		vec2f Next2D()
+		{
+			const u32 i = NestedUniformScramble( index++, shuffleKey );
+
+			// first dimension is the Van der Corput sequence, the second one is generated by the Pascal matrix
+			u32 y = 0;
+			for ( u32 v = 1u << 31, bits = i; bits; bits >>= 1, v ^= v >> 1 )
+				if ( bits & 1 )
+					y ^= v;
+
+			return vec2f( ToFloat( NestedUniformScramble( ReverseBits( i ), xKey ) ),
+						  ToFloat( NestedUniformScramble( y, yKey ) ) );
+		}
+
+	private:
+		/// [Laine & Karras 11] hash, an approximation of an Owen scramble on bit-reversed values
+		static FORCEINLINE u32 LaineKarras( u32 x, u32 key )
+		{
+			x += key;
+			x ^= x * 0x6c50b47cu;
+			x ^= x * 0xb82f1e52u;
+			x ^= x * 0xc7afe638u;
+			x ^= x * 0x8d22f6e6u;
+			return x;
+		}
+
+		static FORCEINLINE u32 NestedUniformScramble( u32 x, u32 key )
+		{
+			return ReverseBits( LaineKarras( ReverseBits( x ), key ) );
+		}
+
+		u32 index;
+		u32 shuffleKey, xKey, yKey;
+	};
+
+	/// Halton sequence in bases 2 and 3, randomized by a seeded toroidal shift (Cranley-Patterson rotation).
+	class Halton
+	{
+	public:
+		Halton( u64 seed, u64 first ) : index( (u32) first ),
+			offset( ToFloat( HashSeed( seed, 2 * ( first >> 32 ) ) ), ToFloat( HashSeed( seed, 2 * ( first >> 32 ) + 1 ) ) )
+		{}
+
+		vec2f Next2D()
+		{
+			const u32 i = index++;
+
+			f64 y = 0.0, digit = 1.0 / 3.0;
+			for ( u32 b = i; b; b /= 3, digit *= 1.0 / 3.0 )
+				y += ( b % 3 ) * digit;
+
+			return vec2f( Wrap( ReverseBits( i ) * ( 1.0 / 4294967296.0 ) + offset.x ), Wrap( y + offset.y ) );
+		}
+
+	private:
+		static FORCEINLINE f32 Wrap( f64 v )
+		{
+			return std::min( (f32) ( v < 1.0 ? v : v - 1.0 ), 0.99999994f );
+		}
+
+		u32 index;
+		vec2f offset;
+	};
+
+	/// Roberts' R2 additive recurrence, x_n = frac( offset + n * (1/g, 1/g^2) ) with g the plastic number.
+	/// Computed in 0.32 fixed point so that it stays exact at any index.
+	class R2
+	{
+	public:
+		R2( u64 seed, u64 first ) : index( (u32) first ),
+			xOffset( HashSeed( seed, 2 * ( first >> 32 ) ) ), yOffset( HashSeed( seed, 2 * ( first >> 32 ) + 1 ) )
+		{}
+
+		vec2f Next2D()
+		{
+			const u32 i = index++;
+			return vec2f( ToFloat( xOffset + i * 3242174889u ), ToFloat( yOffset + i * 2447445413u ) );
+		}
+
+	private:
+		u32 index;
+		u32 xOffset, yOffset;
+	};
+
+	/// Runtime selection of the 2D sequence used by the integrators
+	enum Sequence
+	{
+		SEQ_PCG,	// pseudo-random, Random::Stream
+		SEQ_PHILOX,	// pseudo-random, Random::Philox. Index ranges are exact, like the quasi-random ones
+		SEQ_SOBOL,
+		SEQ_HALTON,
+		SEQ_R2,
+		SEQ_THREAD	// pseudo-random, the calling thread's generator (see ThreadGenerator). seed and first are ignored
+	};
+
+	/// Writes count samples of the given sequence, starting at index first, to samples
+	void Generate2D( Sequence seq, u64 seed, u64 first, u32 count, vec2f *samples );
 }
\ No newline at end of file
@@ -1,5 +1,7 @@
 #include "sampling.h"
+#include "simd.h"
 #include <algorithm>
+#include <fstream>
 
 void Sampling::SampleSphereRandom( std::vector<vec3f>& dirs, u32 count )
 {
@@ -63,6 +65,128 @@ f32 Sampling::SampleHemisphereRandomPDF()
 	return pdf;
 }
 
+/// Fills x, y, z from the spherical coordinates given by cell( i, cosTheta, phi ) for each direction i.
+/// sin/cos(phi) are evaluated in SIMD, the partial last batch goes through padded temporaries.
+template<typename CellFunc>
+static void GenerateSoA( f32 *x, f32 *y, f32 *z, u32 count, const CellFunc &cell )
+{
+	const u32 W = simdf::Width;
+	alignas( 32 ) f32 cosThetas[W], phis[W];
+	alignas( 32 ) f32 tx[W], tz[W];
+
+	for ( u32 i = 0; i < count; i += W )
+	{
+		const u32 n = std::min( W, count - i );
+		for ( u32 l = 0; l < W; ++l )
+		{
+			if ( l < n )
+				cell( i + l, cosThetas[l], phis[l] );
+			else
+				cosThetas[l] = phis[l] = 0.f;
+		}
+
+		const simdf cosTheta = simdf::Load( cosThetas );
+		const simdf sinTheta = Sqrt( Max( simdf::Zero(), 1.f - cosTheta * cosTheta ) );
+		simdf sinPhi, cosPhi;
+		SinCos( simdf::Load( phis ), sinPhi, cosPhi );
+
+		if ( n == W )
+		{
+			( sinTheta * cosPhi ).Store( x + i );
+			( sinTheta * sinPhi ).Store( z + i );
+		}
+		else
+		{
+			( sinTheta * cosPhi ).Store( tx );
+			( sinTheta * sinPhi ).Store( tz );
+			std::copy( tx, tx + n, x + i );
+			std::copy( tz, tz + n, z + i );
+		}
+		std::copy( cosThetas, cosThetas + n, y + i );
+	}
+}
+
+void Sampling::SampleSphereFibonacci( f32 *x, f32 *y, f32 *z, u32 count )
+{
+	const f32 invCount = 1.f / count;
+
+	GenerateSoA( x, y, z, count, [invCount]( u32 i, f32 &cosTheta, f32 &phi )
+	{
+		// frac( i / golden ratio ) in 0.32 fixed point, exact for any i
+		const u32 frac = i * 2654435769u;
+
+		cosTheta = 1.f - ( 2 * i + 1 ) * invCount;
+		phi = 2.f * M_PI * ( ( frac >> 8 ) * ( 1.f / 16777216.f ) );
+	} );
+}
+
+f32 Sampling::SampleSphereFibonacciPDF()
+{
+	return SampleSphereRandomPDF();
+}
+
+/// Equal-area strata of the unit square : about sqrt(count) rows, row r holding the cells
+/// [ r*count/rows, (r+1)*count/rows ). Each cell has an area of 1/count.
+/// Calls sample( i, u, v ) with a jittered point of each cell i.
+template<typename SampleFunc>
+static void Stratify( u32 count, u64 seed, u32 i, const SampleFunc &sample )
+{
+	const u32 rows = std::max( 1u, (u32) ( std::sqrt( (f32) count ) + 0.5f ) );
+
+	// row r spans cells [rowStart(r), rowStart(r+1)), rowStart(r) = ceil(r * count / rows)
+	u32 r = (u32) ( ( (u64) i * rows ) / count );
+	while ( r + 1 < rows && ( (u64) ( r + 1 ) * count + rows - 1 ) / rows <= i )
+		++r;
+	while ( r > 0 && ( (u64) r * count + rows - 1 ) / rows > i )
+		--r;
+
+	const u32 rowStart = (u32) ( ( (u64) r * count + rows - 1 ) / rows );
+	const u32 rowEnd = (u32) ( ( (u64) ( r + 1 ) * count + rows - 1 ) / rows );
+
+	// per-cell stream, so that any i can be generated independently
+	Random::Philox rng( seed, i );
+	const vec2f j = rng.Next2D();
+
+	const f32 v = ( rowStart + j.y * ( rowEnd - rowStart ) ) / (f32) count;
+	const f32 u = ( ( i - rowStart ) + j.x ) / (f32) ( rowEnd - rowStart );
+	sample( u, v );
+}
+
+void Sampling::SampleSphereStratified( f32 *x, f32 *y, f32 *z, u32 count, u64 seed )
+{
+	GenerateSoA( x, y, z, count, [count, seed]( u32 i, f32 &cosTheta, f32 &phi )
+	{
+		Stratify( count, seed, i, [&]( f32 u, f32 v )
+		{
+			cosTheta = 1.f - 2.f * v;
+			phi = 2.f * M_PI * u;
+		} );
+	} );
+}
+
+f32 Sampling::SampleSphereStratifiedPDF()
+{
+	return SampleSphereRandomPDF();
+}
+
+void Sampling::SampleHemisphereCosine( f32 *x, f32 *y, f32 *z, u32 count, u64 seed )
+{
+	GenerateSoA( x, y, z, count, [count, seed]( u32 i, f32 &cosTheta, f32 &phi )
+	{
+		Stratify( count, seed, i, [&]( f32 u, f32 v )
+		{
+			// uniform disk area v = sin^2 theta, projected up
+			cosTheta = std::sqrt( std::max( 0.f, 1.f - v ) );
+			phi = 2.f * M_PI * u;
+		} );
+	} );
+}
+
+f32 Sampling::SampleHemisphereCosinePDF( f32 cosTheta )
+{
+	return std::max( 0.f, cosTheta ) / M_PI;
+}
+
 f32 MinDotDistance( const std::vector<vec3f>& dirs, const vec3f& w )
 {
 
@@ -130,3 +254,165 @@ void Sampling::SampleSphereBluenoise( std::vector<vec3f>& dirs, u32 count )
 		}
 	}
 }
+
+/// Spatial hash of points on the unit sphere, on a 3D grid of cellSize wide cells.
+/// Cells are hashed to a power of two bucket table, each bucket being a linked list of point indices.
+/// Colliding cells share a bucket, which only costs extra distance tests.
+struct SphereHashGrid
+{
+	enum : u32 { Empty = 0xFFFFFFFF };	// enum, so that passing it by reference (head.assign) needs no definition
+
+	f32 invCellSize;
+	u32 mask;
+	std::vector<u32> head;	// first point of each bucket
+	std::vector<u32> next;	// next point in the same bucket
+	const std::vector<vec3f> *points;
+
+	SphereHashGrid( f32 cellSize, u32 maxCount, const std::vector<vec3f> *pts ) : invCellSize( 1.f / cellSize ), points( pts )
+	{
+		u32 bucketCount = 1;
+		while ( bucketCount < 2 * maxCount )
+			bucketCount <<= 1;
+
+		mask = bucketCount - 1;
+		head.assign( bucketCount, Empty );
+		next.reserve( maxCount );
+	}
+
+	vec3i Cell( const vec3f &p ) const
+	{
+		return vec3i( (int) std::floor( ( p.x + 1.f ) * invCellSize ),
+					  (int) std::floor( ( p.y + 1.f ) * invCellSize ),
+					  (int) std::floor( ( p.z + 1.f ) * invCellSize ) );
+	}
+
+	u32 Bucket( int x, int y, int z ) const
+	{
+		return ( ( (u32) x * 73856093u ) ^ ( (u32) y * 19349663u ) ^ ( (u32) z * 83492791u ) ) & mask;
+	}
+
+	/// Adds (*points)[idx], which must be the next point
+	void Insert( u32 idx )
+	{
+		const vec3i c = Cell( ( *points )[idx] );
+		const u32 b = Bucket( c.x, c.y, c.z );
+		next.push_back( head[b] );
+		head[b] = idx;
+	}
+
+	/// Returns true if a point is closer than sqrt(distSq) to w. Only valid for distances up to cellSize.
+	bool HasNeighbour( const vec3f &w, f32 distSq ) const
+	{
+		const vec3i c = Cell( w );
+
+		for ( int z = c.z - 1; z <= c.z + 1; ++z )
+			for ( int y = c.y - 1; y <= c.y + 1; ++y )
+				for ( int x = c.x - 1; x <= c.x + 1; ++x )
+				{
+					for ( u32 i = head[Bucket( x, y, z )]; i != Empty; i = next[i] )
+					{
+						const vec3f d = ( *points )[i] - w;
+						if ( Dot( d, d ) < distSq )
+							return true;
+					}
+				}
+
+		return false;
+	}
+};
+
+void Sampling::SampleSphereBluenoiseGrid( std::vector<vec3f>& dirs, u32 count, u64 seed )
+{
+	if ( count == 0 )
+		return;
+
+	const u32 maxTry = 1000;
+	const f32 relaxation = 0.95f;
+
+	// Chord distance between neighbours of an hexagonal packing of count points, never reached by dart
+	// throwing, the minimal distance relaxes from there. The grid cells are as wide : the minimal distance
+	// only decreases, so testing the 27 cells around a candidate is always enough.
+	const f32 packingDist = std::sqrt( 8.f * M_PI / ( std::sqrt( 3.f ) * count ) );
+	f32 minDist = std::min( 2.f, packingDist );
+
+	std::vector<vec3f> points;
+	points.reserve( count );
+
+	SphereHashGrid grid( minDist, count, &points );
+	Random::Philox rng( seed, 0 );
+
+	u32 nbTry = 0;
+	while ( points.size() < count )
+	{
+		const vec2f uv = rng.Next2D();
+
+		// same mapping as SampleSphereRandom
+		vec3f w;
+		w.y = 2.f * uv.y - 1.f;
+		const f32 sinTheta = std::sqrt( std::max( 0.f, 1.f - w.y * w.y ) );
+		const f32 phi = 2.f * M_PI * uv.x;
+		w.x = sinTheta * std::cos( phi );
+		w.z = sinTheta * std::sin( phi );
+
+		if ( grid.HasNeighbour( w, minDist * minDist ) )
+		{
+			if ( ++nbTry == maxTry )
+			{
+				minDist *= relaxation;
+				nbTry = 0;
+			}
+			continue;
+		}
+
+		points.push_back( w );
+		grid.Insert( (u32) points.size() - 1 );
+		nbTry = 0;
+	}
+
+	dirs.insert( dirs.end(), points.begin(), points.end() );
+}
+
+static const u32 BluenoiseCacheMagic = 0x43534E42; // 'BNSC'
+
+void Sampling::SampleSphereBluenoiseCached( std::vector<vec3f>& dirs, u32 count, u64 seed, const std::string &cacheDir )
+{
+	const std::string filePath = cacheDir + "/bluenoise_" + std::to_string( count ) + "_" + std::to_string( seed ) + ".bin";
+
+	std::ifstream in( filePath, std::ios::in | std::ios::binary );
+	if ( in )
+	{
+		u32 magic = 0, fileCount = 0;
+		u64 fileSeed = 0;
+		in.read( (char*) &magic, sizeof( u32 ) );
+		in.read( (char*) &fileCount, sizeof( u32 ) );
+		in.read( (char*) &fileSeed, sizeof( u64 ) );
+
+		if ( in && magic == BluenoiseCacheMagic && fileCount == count && fileSeed == seed )
+		{
+			const size_t first = dirs.size();
+			dirs.resize( first + count );
+			if ( count == 0 || in.read( (char*) &dirs[first], count * sizeof( vec3f ) ) )
+				return;
+
+			dirs.resize( first );
+		}
+
+		LogErr( "Invalid bluenoise cache file ", filePath, ", regenerating it." );
+	}
+
+	const size_t first = dirs.size();
+	SampleSphereBluenoiseGrid( dirs, count, seed );
+
+	std::ofstream out( filePath, std::ios::out | std::ios::binary );
+	if ( out )
+	{
+		out.write( (const char*) &BluenoiseCacheMagic, sizeof( u32 ) );
+		out.write( (const char*) &count, sizeof( u32 ) );
+		out.write( (const char*) &seed, sizeof( u64 ) );
+		if ( count )
+			out.write( (const char*) &dirs[first], count * sizeof( vec3f ) );
+	}
+
+	if ( !out )
+		LogErr( "Error writing bluenoise cache file ", filePath );
+}
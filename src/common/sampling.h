@@ -15,6 +15,31 @@ namespace Sampling
 	void SampleHemisphereRandom( std::vector<vec3f> &dirs, u32 count );
 	f32 SampleHemisphereRandomPDF();
 
+	/// Bulk generators writing count directions to the SoA arrays x, y, z (dirs.y is UP as well).
+	/// The spherical to cartesian conversion runs simdf::Width directions at a time (see simd.h).
+
+	/// Spherical Fibonacci point set [Marques13] : deterministic, evenly spread, works for any count
+	void SampleSphereFibonacci( f32 *x, f32 *y, f32 *z, u32 count );
+	f32 SampleSphereFibonacciPDF();
+
+	/// Jittered equal-area stratification : count cells in about sqrt(count) bands of constant y,
+	/// with one uniform sample per cell
+	void SampleSphereStratified( f32 *x, f32 *y, f32 *z, u32 count, u64 seed = 0 );
+	f32 SampleSphereStratifiedPDF();
+
+	/// Cosine-weighted hemisphere around +y, same stratification mapped with Malley's method
+	void SampleHemisphereCosine( f32 *x, f32 *y, f32 *z, u32 count, u64 seed = 0 );
+	f32 SampleHemisphereCosinePDF( f32 cosTheta );
+
 	/// BlueNoise
 	void SampleSphereBluenoise( std::vector<vec3f> &dirs, u32 count );
-}
\ No newline at end of file
+
+	/// Dart throwing blue noise with a decreasing minimal distance [McCool92]. Candidates are only tested
+	/// against the accepted directions of the neighbouring cells of a spatial hash grid, which makes it
+	/// about linear in count. Deterministic for a given (count, seed).
+	void SampleSphereBluenoiseGrid( std::vector<vec3f> &dirs, u32 count, u64 seed = 0 );
+
+	/// Same, read from the binary cache file cacheDir/bluenoise_<count>_<seed>.bin when it exists.
+	/// Otherwise the set is generated and written there for the next runs.
+	void SampleSphereBluenoiseCached( std::vector<vec3f> &dirs, u32 count, u64 seed, const std::string &cacheDir );
+}
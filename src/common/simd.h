@@ -0,0 +1,308 @@
+#pragma once
+
+#include "common.h"
+
+// Thin float lane wrapper used by the batched math kernels.
+// The width is chosen at compile time from the enabled instruction set :
+//   AVX  (-mavx / -mavx2, /arch:AVX2) : 8 lanes
+//   SSE2 (any x64 target)             : 4 lanes
+//   otherwise                         : 1 lane (plain float)
+// Build with OPTFLAGS="-mavx2 -mfma" to get the 8-wide path with the Makefile.
+
+#if defined(__AVX__)
+#   define RADAR_SIMD_AVX
+#   include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || ( defined(_M_IX86_FP) && _M_IX86_FP >= 2 )
+#   define RADAR_SIMD_SSE
+#   include <emmintrin.h>
+#else
+#   define RADAR_SIMD_SCALAR
+#endif
+
+#if defined(RADAR_SIMD_AVX)
+#   define RADAR_SIMD_WIDTH 8
+#elif defined(RADAR_SIMD_SSE)
+#   define RADAR_SIMD_WIDTH 4
+#else
+#   define RADAR_SIMD_WIDTH 1
+#endif
+
+struct simdf
+{
+#if defined(RADAR_SIMD_AVX)
+	typedef __m256 type;
+#elif defined(RADAR_SIMD_SSE)
+	typedef __m128 type;
+#else
+	typedef float type;
+#endif
+
+	enum { Width = RADAR_SIMD_WIDTH };
+
+	type v;
+
+	FORCEINLINE simdf() {}
+	FORCEINLINE simdf( type iv ) : v( iv ) {}
+#if defined(RADAR_SIMD_AVX)
+	FORCEINLINE simdf( f32 s ) : v( _mm256_set1_ps( s ) ) {}
+#elif defined(RADAR_SIMD_SSE)
+	FORCEINLINE simdf( f32 s ) : v( _mm_set1_ps( s ) ) {}
+#endif
+
+	/// Unaligned load/store of Width floats
+	static FORCEINLINE simdf Load( const f32 *p )
+	{
+#if defined(RADAR_SIMD_AVX)
+		return simdf( _mm256_loadu_ps( p ) );
+#elif defined(RADAR_SIMD_SSE)
+		return simdf( _mm_loadu_ps( p ) );
+#else
+		return simdf( *p );
+#endif
+	}
+
+	FORCEINLINE void Store( f32 *p ) const
+	{
+#if defined(RADAR_SIMD_AVX)
+		_mm256_storeu_ps( p, v );
+#elif defined(RADAR_SIMD_SSE)
+		_mm_storeu_ps( p, v );
+#else
+		*p = v;
+#endif
+	}
+
+	static FORCEINLINE simdf Zero()
+	{
+		return simdf( 0.f );
+	}
+
+	FORCEINLINE simdf& operator+=( const simdf &b ) { *this = *this + b; return *this; }
+	FORCEINLINE simdf& operator-=( const simdf &b ) { *this = *this - b; return *this; }
+	FORCEINLINE simdf& operator*=( const simdf &b ) { *this = *this * b; return *this; }
+
+	// Arithmetic operators are non-member friends so that f32 operands on either side
+	// get broadcasted through the converting constructor.
+#if defined(RADAR_SIMD_AVX)
+	friend FORCEINLINE simdf operator+( const simdf &a, const simdf &b ) { return _mm256_add_ps( a.v, b.v ); }
+	friend FORCEINLINE simdf operator-( const simdf &a, const simdf &b ) { return _mm256_sub_ps( a.v, b.v ); }
+	friend FORCEINLINE simdf operator*( const simdf &a, const simdf &b ) { return _mm256_mul_ps( a.v, b.v ); }
+	friend FORCEINLINE simdf operator/( const simdf &a, const simdf &b ) { return _mm256_div_ps( a.v, b.v ); }
+	friend FORCEINLINE simdf operator-( const simdf &a ) { return _mm256_xor_ps( a.v, _mm256_set1_ps( -0.f ) ); }
+#elif defined(RADAR_SIMD_SSE)
+	friend FORCEINLINE simdf operator+( const simdf &a, const simdf &b ) { return _mm_add_ps( a.v, b.v ); }
+	friend FORCEINLINE simdf operator-( const simdf &a, const simdf &b ) { return _mm_sub_ps( a.v, b.v ); }
+	friend FORCEINLINE simdf operator*( const simdf &a, const simdf &b ) { return _mm_mul_ps( a.v, b.v ); }
+	friend FORCEINLINE simdf operator/( const simdf &a, const simdf &b ) { return _mm_div_ps( a.v, b.v ); }
+	friend FORCEINLINE simdf operator-( const simdf &a ) { return _mm_xor_ps( a.v, _mm_set1_ps( -0.f ) ); }
+#else
+	friend FORCEINLINE simdf operator+( const simdf &a, const simdf &b ) { return a.v + b.v; }
+	friend FORCEINLINE simdf operator-( const simdf &a, const simdf &b ) { return a.v - b.v; }
+	friend FORCEINLINE simdf operator*( const simdf &a, const simdf &b ) { return a.v * b.v; }
+	friend FORCEINLINE simdf operator/( const simdf &a, const simdf &b ) { return a.v / b.v; }
+	friend FORCEINLINE simdf operator-( const simdf &a ) { return -a.v; }
+#endif
+};
+
+/// a * b + c, fused when the target has FMA
+FORCEINLINE simdf MulAdd( const simdf &a, const simdf &b, const simdf &c )
+{
+#if defined(RADAR_SIMD_AVX) && defined(__FMA__)
+	return _mm256_fmadd_ps( a.v, b.v, c.v );
+#else
+	return a * b + c;
+#endif
+}
+
+FORCEINLINE simdf Min( const simdf &a, const simdf &b )
+{
+#if defined(RADAR_SIMD_AVX)
+	return _mm256_min_ps( a.v, b.v );
+#elif defined(RADAR_SIMD_SSE)
+	return _mm_min_ps( a.v, b.v );
+#else
+	return a.v < b.v ? a.v : b.v;
+#endif
+}
+
+FORCEINLINE simdf Max( const simdf &a, const simdf &b )
+{
+#if defined(RADAR_SIMD_AVX)
+	return _mm256_max_ps( a.v, b.v );
+#elif defined(RADAR_SIMD_SSE)
+	return _mm_max_ps( a.v, b.v );
+#else
+	return a.v > b.v ? a.v : b.v;
+#endif
+}
+
+FORCEINLINE simdf Sqrt( const simdf &a )
+{
+#if defined(RADAR_SIMD_AVX)
+	return _mm256_sqrt_ps( a.v );
+#elif defined(RADAR_SIMD_SSE)
+	return _mm_sqrt_ps( a.v );
+#else
+	return std::sqrt( a.v );
+#endif
+}
+
+FORCEINLINE simdf Abs( const simdf &a )
+{
+#if defined(RADAR_SIMD_AVX)
+	return _mm256_andnot_ps( _mm256_set1_ps( -0.f ), a.v );
+#elif defined(RADAR_SIMD_SSE)
+	return _mm_andnot_ps( _mm_set1_ps( -0.f ), a.v );
+#else
+	return std::fabs( a.v );
+#endif
+}
+
+FORCEINLINE simdf Floor( const simdf &a )
+{
+#if defined(RADAR_SIMD_AVX)
+	return _mm256_floor_ps( a.v );
+#elif defined(RADAR_SIMD_SSE)
+	// truncation, minus one where it rounded up. |a| < 2^31
+	const __m128 t = _mm_cvtepi32_ps( _mm_cvttps_epi32( a.v ) );
+	return _mm_sub_ps( t, _mm_and_ps( _mm_cmpgt_ps( t, a.v ), _mm_set1_ps( 1.f ) ) );
+#else
+	return std::floor( a.v );
+#endif
+}
+
+// Lane masks, as returned by the comparisons, have all bits set where true (1.f in scalar mode).
+// They should only be combined with And and consumed by Select.
+
+FORCEINLINE simdf CmpLt( const simdf &a, const simdf &b )
+{
+#if defined(RADAR_SIMD_AVX)
+	return _mm256_cmp_ps( a.v, b.v, _CMP_LT_OQ );
+#elif defined(RADAR_SIMD_SSE)
+	return _mm_cmplt_ps( a.v, b.v );
+#else
+	return a.v < b.v ? 1.f : 0.f;
+#endif
+}
+
+FORCEINLINE simdf And( const simdf &maskA, const simdf &maskB )
+{
+#if defined(RADAR_SIMD_AVX)
+	return _mm256_and_ps( maskA.v, maskB.v );
+#elif defined(RADAR_SIMD_SSE)
+	return _mm_and_ps( maskA.v, maskB.v );
+#else
+	return ( maskA.v != 0.f && maskB.v != 0.f ) ? 1.f : 0.f;
+#endif
+}
+
+/// Per lane mask ? a : b
+FORCEINLINE simdf Select( const simdf &mask, const simdf &a, const simdf &b )
+{
+#if defined(RADAR_SIMD_AVX)
+	return _mm256_blendv_ps( b.v, a.v, mask.v );
+#elif defined(RADAR_SIMD_SSE)
+	return _mm_or_ps( _mm_and_ps( mask.v, a.v ), _mm_andnot_ps( mask.v, b.v ) );
+#else
+	return mask.v != 0.f ? a.v : b.v;
+#endif
+}
+
+/// Sum of all the lanes
+FORCEINLINE f32 ReduceAdd( const simdf &a )
+{
+	alignas( 32 ) f32 lanes[simdf::Width];
+	a.Store( lanes );
+
+	f32 sum = 0.f;
+	for ( int i = 0; i < simdf::Width; ++i )
+		sum += lanes[i];
+	return sum;
+}
+
+/// Smallest & largest lane
+FORCEINLINE f32 ReduceMin( const simdf &a )
+{
+	alignas( 32 ) f32 lanes[simdf::Width];
+	a.Store( lanes );
+
+	f32 m = lanes[0];
+	for ( int i = 1; i < simdf::Width; ++i )
+		m = lanes[i] < m ? lanes[i] : m;
+	return m;
+}
+
+FORCEINLINE f32 ReduceMax( const simdf &a )
+{
+	alignas( 32 ) f32 lanes[simdf::Width];
+	a.Store( lanes );
+
+	f32 m = lanes[0];
+	for ( int i = 1; i < simdf::Width; ++i )
+		m = lanes[i] > m ? lanes[i] : m;
+	return m;
+}
+
+/// True if any lane of the mask is set
+FORCEINLINE bool Any( const simdf &mask )
+{
+#if defined(RADAR_SIMD_AVX)
+	return _mm256_movemask_ps( mask.v ) != 0;
+#elif defined(RADAR_SIMD_SSE)
+	return _mm_movemask_ps( mask.v ) != 0;
+#else
+	return mask.v != 0.f;
+#endif
+}
+
+/// Sine and cosine of a, in one range reduction. Cody-Waite reduction to [-pi/4, pi/4] and
+/// minimax polynomials from Cephes' sinf/cosf, ~2 ulp for |a| < 8192.
+FORCEINLINE void SinCos( const simdf &a, simdf &sinA, simdf &cosA )
+{
+	// a = q * pi/2 + r
+	const simdf q = Floor( MulAdd( a, simdf( 0.63661977236f ), simdf( 0.5f ) ) );
+	simdf r = MulAdd( q, simdf( -1.5703125f ), a );
+	r = MulAdd( q, simdf( -4.837512969970703125e-4f ), r );
+	r = MulAdd( q, simdf( -7.54978995489188216e-8f ), r );
+
+	const simdf r2 = r * r;
+	simdf s = MulAdd( r2, simdf( -1.9515295891e-4f ), simdf( 8.3321608736e-3f ) );
+	s = MulAdd( s, r2, simdf( -1.6666654611e-1f ) );
+	s = MulAdd( s * r2, r, r );
+
+	simdf c = MulAdd( r2, simdf( 2.443315711809948e-5f ), simdf( -1.388731625493765e-3f ) );
+	c = MulAdd( c, r2, simdf( 4.166664568298827e-2f ) );
+	c = MulAdd( c * r2, r2, MulAdd( r2, simdf( -0.5f ), simdf( 1.f ) ) );
+
+	// quadrant k = q mod 4 : sin = { s, c, -s, -c }, cos = { c, -s, -c, s }
+	const simdf k = q - 4.f * Floor( q * 0.25f );
+	const simdf odd = CmpLt( simdf( 0.5f ), k - 2.f * Floor( k * 0.5f ) );
+	const simdf sinNeg = CmpLt( simdf( 1.5f ), k );
+	const simdf cosNeg = And( CmpLt( simdf( 0.5f ), k ), CmpLt( k, simdf( 2.5f ) ) );
+
+	const simdf sb = Select( odd, c, s );
+	const simdf cb = Select( odd, s, c );
+	sinA = Select( sinNeg, -sb, sb );
+	cosA = Select( cosNeg, -cb, cb );
+}
+
+/// Arc cosine of a in [-1, 1], from Cephes' asinf : ~2 ulp
+FORCEINLINE simdf Acos( const simdf &a )
+{
+	// acos(x) = pi/2 - asin(x) for |x| <= 0.5, 2 asin( sqrt( (1-|x|)/2 ) ) above, mirrored for x < 0
+	const simdf x = Abs( a );
+	const simdf big = CmpLt( simdf( 0.5f ), x );
+	const simdf zBig = ( 1.f - x ) * 0.5f;
+	const simdf z = Select( big, zBig, x * x );
+	const simdf s = Select( big, Sqrt( zBig ), x );
+
+	simdf p = MulAdd( z, simdf( 4.2163199048e-2f ), simdf( 2.4181311049e-2f ) );
+	p = MulAdd( p, z, simdf( 4.5470025998e-2f ) );
+	p = MulAdd( p, z, simdf( 7.4953002686e-2f ) );
+	p = MulAdd( p, z, simdf( 1.6666752422e-1f ) );
+	const simdf asinS = MulAdd( p * z, s, s );
+
+	// acos(|x|), then acos(-x) = pi - acos(x)
+	const simdf r = Select( big, 2.f * asinS, simdf( 1.57079632679f ) - asinS );
+	return Select( CmpLt( a, simdf::Zero() ), simdf( 3.14159265359f ) - r, r );
+}
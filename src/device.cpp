@@ -339,6 +339,8 @@ static bool LoadConfig( Config &config )
 	config.cameraRotationSpeed = Json::ReadFloat( conf_file.root, "fCameraRotationSpeed", 1.f );
 	config.cameraPosition = Json::ReadVec3( conf_file.root, "vCameraPosition", vec3f( 10, 8, 10 ) );
 	config.cameraTarget = Json::ReadVec3( conf_file.root, "vCameraTarget", vec3f( 0, 0.5, 0 ) );
+	config.optimizeMeshes = Json::ReadInt( conf_file.root, "bOptimizeMeshes", 1 ) != 0;
+	config.compactVertices = Json::ReadInt( conf_file.root, "bCompactVertices", 0 ) != 0;
 
 	conf_file.Close();
 	return true;
@@ -23,6 +23,9 @@ struct Config
 
 	vec3f 	cameraPosition;
 	vec3f	cameraTarget;
+
+	bool	optimizeMeshes;		//!< Vertex cache & fetch reordering of the imported meshes
+	bool	compactVertices;	//!< Interleaved & compressed vertex layout for the imported meshes. Lossy (half float UVs), off by default
 };
 
 typedef void ( *LoopFunction )( float dt );
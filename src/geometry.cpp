@@ -1,8 +1,12 @@
 #include "geometry.h"
 #include "common/SHEval.h"
+#include "common/simd.h"
+#include "common/SHEval.inl"
+#include "common/parallel.h"
+#include "zhlobes.h"
 
 #include <algorithm>
-#include <complex>
+#include <array>
 #include <cstring>
 
 //#pragma optimize("", off)
@@ -17,6 +21,208 @@ static int sign( f32 b )
 	return ( b >= 0 ) - ( b < 0 );
 }
 
+/// Gathers weighted sample directions in simdf::Width packets and projects them with the
+/// fused SH kernels into per-lane accumulators. Lanes are reduced once, in Finish().
+template<unsigned int N>
+struct SHProjector
+{
+	static const u32 W = simdf::Width;
+
+	simdf acc[N * N];
+	alignas( 32 ) f32 x[W], y[W], z[W], w[W];
+	u32 count;
+
+	SHProjector() : count( 0 )
+	{
+		for ( u32 c = 0; c < N * N; ++c )
+			acc[c] = simdf::Zero();
+	}
+
+	/// dir is in world space (y up), and swizzled to the SH z-up convention
+	FORCEINLINE void Add( const vec3f &dir, f32 weight )
+	{
+		x[count] = dir.x;
+		y[count] = dir.z;
+		z[count] = dir.y;
+		w[count] = weight;
+
+		if ( ++count == W )
+		{
+			SHEvalAccumulate<N>( simdf::Load( x ), simdf::Load( y ), simdf::Load( z ), simdf::Load( w ), acc );
+			count = 0;
+		}
+	}
+
+	/// Projects the remaining partial packet (zero-weighted padding) and adds the result to shvals
+	void Finish( f32 *shvals )
+	{
+		if ( count > 0 )
+		{
+			for ( u32 l = count; l < W; ++l )
+			{
+				x[l] = y[l] = 0.f;
+				z[l] = 1.f;
+				w[l] = 0.f;
+			}
+			SHEvalAccumulate<N>( simdf::Load( x ), simdf::Load( y ), simdf::Load( z ), simdf::Load( w ), acc );
+			count = 0;
+		}
+
+		for ( u32 c = 0; c < N * N; ++c )
+			shvals[c] += ReduceAdd( acc[c] );
+	}
+};
+
+/// Sample source of the serial integrators : samples 0, 1, ... of the seq sequence, generated BlockSize at a time
+/// by Random::Generate2D. Random::SEQ_THREAD draws them from the calling thread's generator.
+struct SequenceSampler
+{
+	static const u32 BlockSize = 64;
+
+	Random::Sequence seq;
+	u64 seed;
+	u64 next;		// index of the first sample of the next block
+	u32 idx;
+	vec2f block[BlockSize];
+
+	SequenceSampler( u64 seed, Random::Sequence seq ) : seq( seq ), seed( seed ), next( 0 ), idx( BlockSize ) {}
+
+	FORCEINLINE vec2f Next2D()
+	{
+		if ( idx == BlockSize )
+		{
+			Random::Generate2D( seq, seed, next, BlockSize, block );
+			next += BlockSize;
+			idx = 0;
+		}
+		return block[idx++];
+	}
+};
+
+/// Sample source of the parallel integrators : a chunk of pregenerated samples (see Random::Generate2D)
+struct BufferSampler
+{
+	const vec2f *samples;
+
+	FORCEINLINE vec2f Next2D()
+	{
+		return *samples++;
+	}
+};
+
+/// Number of samples integrated by each task of the parallel integrators. This is fixed
+/// (not derived from the thread count) so that the results do not depend on it.
+static const u32 SHChunkSize = 8192;
+
+/// Parallel integration engine. The sampleCount samples are cut in SHChunkSize chunks, integrated
+/// by Parallel::For tasks. Chunk i draws samples [i * SHChunkSize, (i+1) * SHChunkSize) of the seq sequence,
+/// into its own SH vector. The chunk vectors are then summed into shvals in chunk order, which makes the
+/// result bit-reproducible whatever the number of threads.
+/// sampleChunk( count, rng, proj ) projects count samples drawn from rng into proj.
+template<unsigned int N, typename F>
+static void IntegrateChunks( u32 sampleCount, u64 seed, Random::Sequence seq, f32 *shvals, const F &sampleChunk )
+{
+	const u32 nCoeff = N * N;
+	const u32 chunkCount = ( sampleCount + SHChunkSize - 1 ) / SHChunkSize;
+	std::vector<f32> chunkSH( chunkCount * nCoeff, 0.f );
+	std::vector<std::vector<vec2f>> threadSamples( Parallel::ThreadCount() );
+
+	Parallel::For( chunkCount, [&]( u32 chunk, u32 threadIdx )
+	{
+		const u32 count = std::min( SHChunkSize, sampleCount - chunk * SHChunkSize );
+
+		std::vector<vec2f> &samples = threadSamples[threadIdx];
+		samples.resize( SHChunkSize );
+		Random::Generate2D( seq, seed, (u64) chunk * SHChunkSize, count, samples.data() );
+
+		BufferSampler rng{ samples.data() };
+		SHProjector<N> proj;
+		sampleChunk( count, rng, proj );
+		proj.Finish( &chunkSH[chunk * nCoeff] );
+	} );
+
+	for ( u32 chunk = 0; chunk < chunkCount; ++chunk )
+	{
+		for ( u32 c = 0; c < nCoeff; ++c )
+			shvals[c] += chunkSH[chunk * nCoeff + c];
+	}
+}
+
+/// Sample source of the adaptive integrators : one Philox stream per batch
+struct PhiloxSampler
+{
+	Random::Philox rng;
+
+	PhiloxSampler( u64 seed, u64 stream ) : rng( seed, stream ) {}
+
+	FORCEINLINE vec2f Next2D()
+	{
+		return rng.Next2D();
+	}
+};
+
+/// Adaptive integration engine. Batch k projects batchSize samples drawn from stream k of adaptive.seed with
+/// sampleBatch( count, rng, proj ), each batch sum times normPerSample / batchSize being an independent estimate
+/// of the SH vector. Batches are added until their mean converges (see AdaptiveSampling). Their sum goes to
+/// shvals, and the returned factor normalizes it.
+template<unsigned int N, typename F>
+static f32 IntegrateAdaptive( AdaptiveSampling &adaptive, u32 batchSize, f32 normPerSample, f32 *shvals, const F &sampleBatch )
+{
+	Assert( batchSize > 0 );
+
+	const u32 nCoeff = N * N;
+	const f64 batchNorm = (f64) normPerSample / batchSize;
+	std::array<f32, N * N> batchSH;
+	std::array<f64, N * N> mean, m2;	// Welford running moments of the batch estimates
+	mean.fill( 0.0 );
+	m2.fill( 0.0 );
+
+	const u32 minBatches = std::max( 2u, ( adaptive.minSamples + batchSize - 1 ) / batchSize );
+	const u32 maxBatches = std::max( minBatches, adaptive.maxSamples / batchSize );
+
+	u32 k = 0;
+	adaptive.relativeError = 0.f;
+
+	while ( k < maxBatches )
+	{
+		PhiloxSampler rng( adaptive.seed, k );
+		SHProjector<N> proj;
+		sampleBatch( batchSize, rng, proj );
+
+		batchSH.fill( 0.f );
+		proj.Finish( batchSH.data() );
+		++k;
+
+		for ( u32 c = 0; c < nCoeff; ++c )
+		{
+			const f64 x = batchSH[c] * batchNorm;
+			const f64 delta = x - mean[c];
+			mean[c] += delta / k;
+			m2[c] += delta * ( x - mean[c] );
+
+			shvals[c] += batchSH[c];
+		}
+
+		if ( k < minBatches )
+			continue;
+
+		// variance of the mean, summed over the coefficients, against the squared norm
+		f64 varMean = 0.0, norm2 = 0.0;
+		for ( u32 c = 0; c < nCoeff; ++c )
+		{
+			varMean += m2[c] / ( (f64) ( k - 1 ) * k );
+			norm2 += mean[c] * mean[c];
+		}
+
+		adaptive.relativeError = norm2 > 0.0 ? (f32) std::sqrt( varMean / norm2 ) : 0.f;
+		if ( adaptive.relativeError <= adaptive.targetError )
+			break;
+	}
+
+	adaptive.samplesUsed = k * batchSize;
+	return normPerSample / (f32) adaptive.samplesUsed;
+}
+
 //////////////////////////////////////////////////////////////////////////////////////////
 //////////////////////////////////////////////////////////////////////////////////////////
 
@@ -50,51 +256,300 @@ Polygon::Polygon( const std::vector<vec3f> &pts )
 	edges.push_back( Edge{ pts[nv - 1], pts[0] } );
 }
 
-f32 Polygon::SolidAngle() const
+/// Allocation-free implementation of the Polygon moments, shared by Polygon and FixedPolygon.
+/// Arrays are caller-provided, see the FixedPolygon doc for the sizes.
+namespace Moments
 {
-
-	if ( edges.size() == 3 )
+	/// Signed solid angle of the spherical triangle ABC, by Oosterom & Strackee 83 :
+	/// tan(phi/2) = [A B C] / ( r1 r2 r3 + (A.B) r3 + (A.C) r2 + (B.C) r1 ). Negative for triangles wound
+	/// clockwise as seen from the origin. In ]-2pi, 2pi[, without any wrapping.
+	static f32 TriangleSolidAngle( const vec3f &A, const vec3f &B, const vec3f &C )
 	{
-		const vec3f &A = edges[0].A;
-		const vec3f &B = edges[1].A;
-		const vec3f &C = edges[2].A;
-
-		// Arvo solid angle : alpha + beta + gamma - pi
-		// Oosterom & Strackee 83 method
-		const vec3f tmp = Cross( A, B );
-		const f32 num = std::fabs( Dot( tmp, A ) );
+		const f32 num = Dot( Cross( A, B ), C );
 		const f32 r1 = std::sqrt( Dot( A, A ) );
 		const f32 r2 = std::sqrt( Dot( B, B ) );
 		const f32 r3 = std::sqrt( Dot( C, C ) );
 
 		const f32 denom = r1 * r2 * r3 + Dot( A, B ) * r3 + Dot( A, C ) * r2 + Dot( B, C ) * r1;
 
-		// tan(phi/2) = num/denom
-		f32 halPhi = std::atan2( num, denom );
-		if ( halPhi < 0.f ) halPhi += M_PI;
+		return -2.f * std::atan2( num, denom );
+	}
+
+	/// Signed solid angle of the convex polygon, as a fan of triangles around its first vertex.
+	/// All fan terms share the polygon winding, so the sum is not wrapped to ]-pi, pi] like an arg() of
+	/// the edge products would be, and stays exact for polygons covering more than pi sr.
+	static f32 SolidAngle( const Edge *edges, u32 edgeCount )
+	{
+		const vec3f &A = edges[0].A;
+
+		f32 sA = 0.f;
+		for ( u32 k = 1; k < edgeCount - 1; ++k )
+			sA += TriangleSolidAngle( A, edges[k].A, edges[k].B );
 
-		return 2.f * halPhi;
+		return sA;
 	}
-	else
+
+	/// R[1..n+1] are filled, R[0] is left untouched
+	static void CosSumIntegral( f32 x, f32 y, f32 c, int n, f32 *R )
 	{
-		// Algorithm of polyhedral cones by Mazonka http://arxiv.org/pdf/1205.1396v2.pdf
-		std::complex<float> z( 1, 0 );
-		for ( unsigned int k = 0; k < edges.size(); ++k )
+		const f32 sinx = std::sin( x );
+		const f32 siny = std::sin( y );
+		const f32 cosx = std::cos( x );
+		const f32 cosy = std::cos( y );
+		const f32 cosxsq = cosx * cosx;
+		const f32 cosysq = cosy * cosy;
+
+		static const vec2f i1( 1, 1 );
+		static const vec2f i2( 2, 2 );
+		vec2i i( 0, 1 );
+		vec2f F( y - x, siny - sinx );
+		vec2f S( 0.f, 0.f );
+
+		vec2f pow_c( 1.f, c );
+		vec2f pow_cosx( cosx, cosxsq );
+		vec2f pow_cosy( cosy, cosysq );
+
+		while ( i[1] <= n )
 		{
-			const vec3f& A = edges[( k > 0 ) ? k - 1 : edges.size() - 1].A;
-			const vec3f& B = edges[k].A;
-			const vec3f& C = edges[k].B;
-
-			const float ak = Dot( A, C );
-			const float bk = Dot( A, B );
-			const float ck = Dot( B, C );
-			const float dk = Dot( A, Cross( B, C ) );
-			const std::complex<float> zk( bk*ck - ak, dk );
-			z *= zk;
+			S += pow_c * F;
+
+			R[i[1] + 0] = S[0];
+			R[i[1] + 1] = S[1];
+
+			vec2f T = pow_cosy * siny - pow_cosx * sinx;
+			F = ( T + vec2f( i + i1 ) * F ) / vec2f( i + i2 );
+
+			i += i2;
+			pow_c *= c*c;
+			pow_cosx *= cosxsq;
+			pow_cosy *= cosysq;
 		}
-		const float arg = std::arg( z );
-		return arg;
 	}
+
+	/// Returns false, leaving R untouched, if the edge is orthogonal to w (null integral)
+	static bool LineIntegral( const vec3f &A, const vec3f &B, const vec3f &w, int n, f32 *R )
+	{
+		const f32 eps = 1e-7f;
+		if ( ( n < 0 ) || ( ( fabs( Dot( w, A ) ) < eps ) && ( fabs( Dot( w, B ) ) < eps ) ) )
+		{
+			return false;
+		}
+
+		vec3f s = Normalize( A );
+
+		const f32 sDotB = Dot( s, B );
+
+		vec3f t = Normalize( B - s * sDotB );
+
+		const f32 a = Dot( w, s );
+		const f32 b = Dot( w, t );
+		const f32 c = std::sqrt( a*a + b*b );
+
+		const f32 cos_l = sDotB / Dot( B, B );
+		const f32 l = std::acos( std::max( -1.f, std::min( 1.f, cos_l ) ) );
+		const f32 phi = sign( b ) * std::acos( a / c );
+
+		CosSumIntegral( -phi, l - phi, c, n, R );
+		return true;
+	}
+
+	/// Accumulates into R[0..n+1]. b is a n+2 workspace
+	static void BoundaryIntegral( const Edge *edges, u32 edgeCount, const vec3f &w, const vec3f &v, int n, f32 *R, f32 *b )
+	{
+		b[0] = 0.f;
+
+		for ( u32 e = 0; e < edgeCount; ++e )
+		{
+			const Edge &edge = edges[e];
+
+			if ( !LineIntegral( edge.A, edge.B, w, n, b ) )
+				continue;
+
+			vec3f nrm = Normalize( Cross( edge.A, edge.B ) );
+			f32 nDotv = Dot( nrm, v );
+
+			for ( int i = 0; i < n + 2; ++i )
+				R[i] += b[i] * nDotv;
+		}
+	}
+
+	/// Writes the order+1 moments in R. b is a order+2 workspace, sA the polygon solid angle
+	static void AxialMoment( const Edge *edges, u32 edgeCount, f32 sA, const vec3f &w, int order, f32 *R, f32 *b )
+	{
+		// Compute the Boundary Integral of the polygon, only keeping the first order+1 terms
+		std::fill( R, R + order + 1, 0.f );
+		b[0] = 0.f;
+
+		for ( u32 e = 0; e < edgeCount; ++e )
+		{
+			const Edge &edge = edges[e];
+
+			if ( !LineIntegral( edge.A, edge.B, w, order, b ) )
+				continue;
+
+			const f32 nDotw = Dot( Normalize( Cross( edge.A, edge.B ) ), w );
+
+			for ( int i = 0; i <= order; ++i )
+				R[i] += b[i] * nDotw;
+		}
+
+		// - boundary + solidangle for even orders
+		for ( int i = 0; i <= order; ++i )
+		{
+			R[i] *= -1.f; // - boundary
+
+			// add the solid angle for even orders
+			if ( even( i ) )
+			{
+				R[i] += sA;
+			}
+
+			// normalize by order+1
+			R[i] *= -1.f / (f32) ( i + 1 );
+		}
+	}
+
+	/// Batched AxialMoment of dirCount SoA directions, simdf::Width at a time.
+	/// Edges are the outer loop so that their invariants are computed once. The per-direction line integral
+	/// is then trig-free : with phi the angle of w in the edge frame, cos(phi) = a/c and sin(phi) = b/c, and
+	/// y - x = l. Moments are accumulated coefficient-major in ws.acc, then written direction-major in R.
+	static void AxialMomentsBatch( const Edge *edges, u32 edgeCount, f32 sA, const f32 *pX, const f32 *pY, const f32 *pZ,
+								   u32 dirCount, int order, f32 *R, MomentWorkspace &ws )
+	{
+		const u32 W = simdf::Width;
+		const u32 stride = ( dirCount + W - 1 ) / W * W;
+		const u32 nMoments = order + 1;
+
+		ws.acc.assign( nMoments * stride, 0.f );
+
+		const simdf eps( 1e-7f );
+		const simdf zero = simdf::Zero();
+
+		for ( u32 e = 0; e < edgeCount; ++e )
+		{
+			const vec3f &A = edges[e].A;
+			const vec3f &B = edges[e].B;
+
+			// Edge invariants, see LineIntegral
+			const vec3f s = Normalize( A );
+			const f32 sDotB = Dot( s, B );
+			const vec3f t = Normalize( B - s * sDotB );
+			const f32 cos_l = sDotB / Dot( B, B );
+			const f32 l = std::acos( std::max( -1.f, std::min( 1.f, cos_l ) ) );
+			const f32 cosl = std::cos( l );
+			const f32 sinl = std::sin( l );
+			const vec3f nrm = Normalize( Cross( A, B ) );
+
+			for ( u32 d = 0; d < stride; d += W )
+			{
+				// last packet is padded with +Z directions, discarded at the end
+				alignas( 32 ) f32 tail[3][W];
+				const f32 *px = pX + d, *py = pY + d, *pz = pZ + d;
+				if ( d + W > dirCount )
+				{
+					for ( u32 i = 0; i < W; ++i )
+					{
+						const bool in = d + i < dirCount;
+						tail[0][i] = in ? pX[d + i] : 0.f;
+						tail[1][i] = in ? pY[d + i] : 0.f;
+						tail[2][i] = in ? pZ[d + i] : 1.f;
+					}
+					px = tail[0]; py = tail[1]; pz = tail[2];
+				}
+
+				const simdf wx = simdf::Load( px );
+				const simdf wy = simdf::Load( py );
+				const simdf wz = simdf::Load( pz );
+
+				// edges orthogonal to w have a null integral
+				const simdf wA = MulAdd( wx, A.x, MulAdd( wy, A.y, wz * A.z ) );
+				const simdf wB = MulAdd( wx, B.x, MulAdd( wy, B.y, wz * B.z ) );
+				const simdf orthogonal = And( CmpLt( Abs( wA ), eps ), CmpLt( Abs( wB ), eps ) );
+
+				const simdf a = MulAdd( wx, s.x, MulAdd( wy, s.y, wz * s.z ) );
+				const simdf b = MulAdd( wx, t.x, MulAdd( wy, t.y, wz * t.z ) );
+				const simdf c = Sqrt( MulAdd( a, a, b * b ) );
+				const simdf invC = simdf( 1.f ) / Max( c, simdf( 1e-30f ) );
+				const simdf nDotw = Select( orthogonal, zero, MulAdd( wx, nrm.x, MulAdd( wy, nrm.y, wz * nrm.z ) ) );
+
+				// x = -phi, y = l - phi
+				const simdf cosPhi = a * invC;
+				const simdf sinPhi = b * invC;
+				const simdf cosx = cosPhi;
+				const simdf sinx = -sinPhi;
+				const simdf cosy = MulAdd( cosPhi, cosl, sinPhi * sinl );
+				const simdf siny = MulAdd( cosPhi, sinl, -( sinPhi * cosl ) );
+
+				// CosSumIntegral( x, y, c, order ), even (0) and odd (1) terms
+				const simdf csq = c * c;
+				const simdf cosxsq = cosx * cosx;
+				const simdf cosysq = cosy * cosy;
+
+				simdf F0( l ), F1 = siny - sinx;
+				simdf S0 = zero, S1 = zero;
+				simdf pow_c0( 1.f ), pow_c1 = c;
+				simdf pow_cosx0 = cosx, pow_cosx1 = cosxsq;
+				simdf pow_cosy0 = cosy, pow_cosy1 = cosysq;
+
+				f32 *acc = &ws.acc[d];
+				for ( int i = 1; i <= order; i += 2 )
+				{
+					S0 = MulAdd( pow_c0, F0, S0 );
+					S1 = MulAdd( pow_c1, F1, S1 );
+
+					f32 *acc0 = acc + i * stride;
+					MulAdd( S0, nDotw, simdf::Load( acc0 ) ).Store( acc0 );
+					if ( i + 1 <= order )
+					{
+						f32 *acc1 = acc0 + stride;
+						MulAdd( S1, nDotw, simdf::Load( acc1 ) ).Store( acc1 );
+					}
+
+					const simdf T0 = pow_cosy0 * siny - pow_cosx0 * sinx;
+					const simdf T1 = pow_cosy1 * siny - pow_cosx1 * sinx;
+					F0 = MulAdd( (f32) i, F0, T0 ) / (f32) ( i + 1 );
+					F1 = MulAdd( (f32) ( i + 1 ), F1, T1 ) / (f32) ( i + 2 );
+
+					pow_c0 *= csq; pow_c1 *= csq;
+					pow_cosx0 *= cosxsq; pow_cosx1 *= cosxsq;
+					pow_cosy0 *= cosysq; pow_cosy1 *= cosysq;
+				}
+			}
+		}
+
+		// - boundary + solidangle for even orders, normalized by order+1
+		for ( u32 k = 0; k < nMoments; ++k )
+		{
+			const f32 sAk = even( k ) ? sA : 0.f;
+			const f32 norm = -1.f / (f32) ( k + 1 );
+			const f32 *acc = &ws.acc[k * stride];
+
+			for ( u32 d = 0; d < dirCount; ++d )
+				R[d * nMoments + k] = ( sAk - acc[d] ) * norm;
+		}
+	}
+
+	/// AoS to SoA conversion of the directions into the workspace, then AxialMomentsBatch
+	static void AxialMoments( const Edge *edges, u32 edgeCount, f32 sA, const vec3f *directions, u32 dirCount,
+							  int order, f32 *R, MomentWorkspace &ws )
+	{
+		ws.x.resize( dirCount );
+		ws.y.resize( dirCount );
+		ws.z.resize( dirCount );
+		for ( u32 i = 0; i < dirCount; ++i )
+		{
+			ws.x[i] = directions[i].x;
+			ws.y[i] = directions[i].y;
+			ws.z[i] = directions[i].z;
+		}
+
+		AxialMomentsBatch( edges, edgeCount, sA, ws.x.data(), ws.y.data(), ws.z.data(), dirCount, order, R, ws );
+	}
+}
+
+f32 Polygon::SolidAngle() const
+{
+	return Moments::SolidAngle( edges.data(), (u32) edges.size() );
 }
 
 f32 Polygon::CosSumIntegralArvo( f32 x, f32 y, f32 c, int nMin, int nMax ) const
@@ -183,102 +638,26 @@ f32 Polygon::DoubleAxisMomentArvo( const vec3f & w, const vec3f & v, int order )
 
 void Polygon::CosSumIntegral( f32 x, f32 y, f32 c, int n, std::vector<f32> &R ) const
 {
-	const f32 sinx = std::sin( x );
-	const f32 siny = std::sin( y );
-	const f32 cosx = std::cos( x );
-	const f32 cosy = std::cos( y );
-	const f32 cosxsq = cosx * cosx;
-	const f32 cosysq = cosy * cosy;
-
-	static const vec2f i1( 1, 1 );
-	static const vec2f i2( 2, 2 );
-	vec2i i( 0, 1 );
-	vec2f F( y - x, siny - sinx );
-	vec2f S( 0.f, 0.f );
-
-	vec2f pow_c( 1.f, c );
-	vec2f pow_cosx( cosx, cosxsq );
-	vec2f pow_cosy( cosy, cosysq );
-
-	while ( i[1] <= n )
-	{
-		S += pow_c * F;
-
-		R[i[1] + 0] = S[0];
-		R[i[1] + 1] = S[1];
-
-		vec2f T = pow_cosy * siny - pow_cosx * sinx;
-		F = ( T + ( i + i1 ) * F ) / ( i + i2 );
-
-		i += i2;
-		pow_c *= c*c;
-		pow_cosx *= cosxsq;
-		pow_cosy *= cosysq;
-	}
+	Moments::CosSumIntegral( x, y, c, n, R.data() );
 }
 
 void Polygon::LineIntegral( const vec3f &A, const vec3f &B, const vec3f &w, int n, std::vector<f32> &R ) const
 {
-	const f32 eps = 1e-7f;
-	if ( ( n < 0 ) || ( ( fabs( Dot( w, A ) ) < eps ) && ( fabs( Dot( w, B ) ) < eps ) ) )
-	{
-		return;
-	}
-
-	vec3f s = Normalize( A );
-
-	const f32 sDotB = Dot( s, B );
-
-	vec3f t = Normalize( B - s * sDotB );
-
-	const f32 a = Dot( w, s );
-	const f32 b = Dot( w, t );
-	const f32 c = std::sqrt( a*a + b*b );
-
-	const f32 cos_l = sDotB / Dot( B, B );
-	const f32 l = std::acos( std::max( -1.f, std::min( 1.f, cos_l ) ) );
-	const f32 phi = sign( b ) * std::acos( a / c );
-
-	CosSumIntegral( -phi, l - phi, c, n, R );
+	Moments::LineIntegral( A, B, w, n, R.data() );
 }
 
 void Polygon::BoundaryIntegral( const vec3f &w, const vec3f &v, int n, std::vector<f32> &R ) const
 {
 	std::vector<f32> b( n + 2, 0.f );
-
-	for ( const Edge &e : edges )
-	{
-		vec3f nrm = Normalize( Cross( e.A, e.B ) );
-		f32 nDotv = Dot( nrm, v );
-
-		LineIntegral( e.A, e.B, w, n, b );
-
-		for ( int i = 0; i < n + 2; ++i )
-			R[i] += b[i] * nDotv;
-	}
+	Moments::BoundaryIntegral( edges.data(), (u32) edges.size(), w, v, n, R.data(), b.data() );
 }
 
 void Polygon::AxialMoment( const vec3f &w, int order, std::vector<f32> &R ) const
 {
-	// Compute the Boundary Integral of the polygon
-	BoundaryIntegral( w, w, order, R );
-
-	// - boundary + solidangle for even orders
-	f32 sA = SolidAngle();
-
-	for ( u32 i = 0; i < R.size(); ++i )
-	{
-		R[i] *= -1.f; // - boundary
+	Assert( R.size() >= (size_t) ( order + 1 ) );
 
-		// add the solid angle for even orders
-		if ( even( i ) )
-		{
-			R[i] += sA;
-		}
-
-		// normalize by order+1
-		R[i] *= -1.f / (f32) ( i + 1 );
-	}
+	std::vector<f32> b( order + 2, 0.f );
+	Moments::AxialMoment( edges.data(), (u32) edges.size(), SolidAngle(), w, order, R.data(), b.data() );
 }
 
 std::vector<f32> Polygon::AxialMoments( const std::vector<vec3f> &directions ) const
@@ -288,20 +667,53 @@ std::vector<f32> Polygon::AxialMoments( const std::vector<vec3f> &directions ) c
 
 	std::vector<f32> result( dsize * order, 0.f );
 
-	for ( u32 i = 0; i < dsize; ++i )
-	{
-		std::vector<f32> dirResult( order, 0.f );
-		const vec3f &d = directions[i];
-		AxialMoment( d, order - 1, dirResult );
+	MomentWorkspace ws;
+	Moments::AxialMoments( edges.data(), (u32) edges.size(), SolidAngle(), directions.data(), dsize, order - 1, result.data(), ws );
 
-		for ( u32 j = 0; j < order; ++j )
-		{
-			result[i*order + j] = dirResult[j];
-		}
+	return result;
+}
+
+FixedPolygon::FixedPolygon( const vec3f *pts, u32 count )
+{
+	Assert( count >= 3 && count <= MaxEdges );
+
+	edgeCount = count;
+	for ( u32 i = 0; i < count - 1; ++i )
+	{
+		edges[i] = Edge{ pts[i], pts[i + 1] };
 	}
+	edges[count - 1] = Edge{ pts[count - 1], pts[0] };
+}
 
-	return result;
+FixedPolygon::FixedPolygon( const Polygon &P )
+{
+	Assert( P.edges.size() <= MaxEdges );
+
+	edgeCount = (u32) P.edges.size();
+	std::copy( P.edges.begin(), P.edges.end(), edges );
 }
+
+f32 FixedPolygon::SolidAngle() const
+{
+	return Moments::SolidAngle( edges, edgeCount );
+}
+
+void FixedPolygon::AxialMoment( const vec3f &w, int order, f32 *R, MomentWorkspace &ws ) const
+{
+	ws.Reserve( order );
+	Moments::AxialMoment( edges, edgeCount, SolidAngle(), w, order, R, ws.b.data() );
+}
+
+void FixedPolygon::AxialMoments( const vec3f *directions, u32 dirCount, int order, f32 *R, MomentWorkspace &ws ) const
+{
+	Moments::AxialMoments( edges, edgeCount, SolidAngle(), directions, dirCount, order, R, ws );
+}
+
+void FixedPolygon::AxialMomentsBatch( const f32 *pX, const f32 *pY, const f32 *pZ, u32 dirCount, int order, f32 *R, MomentWorkspace &ws ) const
+{
+	Moments::AxialMomentsBatch( edges, edgeCount, SolidAngle(), pX, pY, pZ, dirCount, order, R, ws );
+}
+
 //////////////////////////////////////////////////////////////////////////////////////////
 //////////////////////////////////////////////////////////////////////////////////////////
 
@@ -536,8 +948,15 @@ f32 Rectangle::IntegrateMRP( const vec3f & integrationPos, const vec3f & integra
 	return solidAngle * std::max( 0.f, Dot( integrationNrm, rayDir ) );
 }
 
-f32 Rectangle::IntegrateAngularStratification( const vec3f & integrationPos, const vec3f & integrationNrm, u32 sampleCount, std::vector<f32> &shvals, int nBand ) const
+template<unsigned int N, typename Rng>
+static void RectangleStratifiedSamples( const Rectangle &rect, const vec3f &integrationPos, u32 sampleCount, Rng &rng, SHProjector<N> &proj )
 {
+	const vec3f &position = rect.position;
+	const vec3f &ex = rect.ex;
+	const vec3f &ey = rect.ey;
+	const f32 hx = rect.hx;
+	const f32 hy = rect.hy;
+
 	const u32 sampleCountX = (u32) std::sqrt( (f32) sampleCount );
 	const u32 sampleCountY = sampleCountX;
 
@@ -580,9 +999,6 @@ f32 Rectangle::IntegrateAngularStratification( const vec3f & integrationPos, con
 	const f32 tanW = std::tan( theta_n );
 	const f32 tanH = std::tan( gamma_n );
 
-	const int nCoeff = nBand * nBand;
-	std::vector<f32> shtmp( nCoeff );
-
 	// Marching over the equi angular rectangles
 	f32 x1 = 0.f;
 	f32 tanx1 = 0.f;
@@ -600,22 +1016,18 @@ f32 Rectangle::IntegrateAngularStratification( const vec3f & integrationPos, con
 			const f32 y2 = lh1 * tany2 / ( siny + tany2 * cosy );
 			const f32 ly = y2 - y1;
 
-			const f32 u1 = ( x1 + Random::GlobalPool.Next() * lx ) / rwidth;
-			const f32 u2 = ( y1 + Random::GlobalPool.Next() * ly ) / rheight;
+			const vec2f randV = rng.Next2D();
+			const f32 u1 = ( x1 + randV.x * lx ) / rwidth;
+			const f32 u2 = ( y1 + randV.y * ly ) / rheight;
 			//const f32 u1 = (x1 + Random::Float() * lx) / rwidth;
 			//const f32 u2 = (y1 + Random::Float() * ly) / rheight;
 
 			vec3f rayDir;
-			const f32 invPdf = SampleDir( rayDir, integrationPos, u1, u2 ) * lx * ly * sampleCount;
+			const f32 invPdf = rect.SampleDir( rayDir, integrationPos, u1, u2 ) * lx * ly * sampleCount;
 
 			if ( invPdf > 0.f )
 			{
-				SHEval( nBand, rayDir.x, rayDir.z, rayDir.y, &shtmp[0] );
-
-				for ( int i = 0; i < nCoeff; ++i )
-				{
-					shvals[i] += shtmp[i] * invPdf; // constant luminance of 1 for now
-				}
+				proj.Add( rayDir, invPdf ); // constant luminance of 1 for now
 			}
 
 			y1 = y2;
@@ -626,41 +1038,185 @@ f32 Rectangle::IntegrateAngularStratification( const vec3f & integrationPos, con
 		tanx1 = tanx2;
 	}
 
+}
+
+template<unsigned int N>
+f32 Rectangle::IntegrateAngularStratification( const vec3f & integrationPos, const vec3f & integrationNrm, u32 sampleCount, f32 *shvals, u64 seed, Random::Sequence seq ) const
+{
+	SequenceSampler rng( seed, seq );
+	SHProjector<N> proj;
+	RectangleStratifiedSamples<N>( *this, integrationPos, sampleCount, rng, proj );
+	proj.Finish( shvals );
+
 	return 1.f / (f32) sampleCount;
 }
 
-f32 Rectangle::IntegrateRandom( const vec3f & integrationPos, const vec3f & integrationNrm, u32 sampleCount, std::vector<f32>& shvals, int nBand ) const
+f32 Rectangle::IntegrateAngularStratification( const vec3f & integrationPos, const vec3f & integrationNrm, u32 sampleCount, std::vector<f32> &shvals, int nBand, u64 seed, Random::Sequence seq ) const
 {
-	// Rectangle area
-	const f32 area = 4.f * hx * hy;
+	Assert( shvals.size() >= (size_t) ( nBand * nBand ) );
 
-	const int nCoeff = nBand * nBand;
+	switch ( nBand )
+	{
+#define BAND_CASE( N ) case N: return IntegrateAngularStratification<N>( integrationPos, integrationNrm, sampleCount, &shvals[0], seed, seq );
+	SH_FOR_EACH_BAND( BAND_CASE )
+#undef BAND_CASE
+	default:
+		Assert( false );
+		return 0.f;
+	}
+}
 
-	std::vector<f32> shtmp( nCoeff, 0.f );
+#define SH_INSTANTIATE( N ) template f32 Rectangle::IntegrateAngularStratification<N>( const vec3f &, const vec3f &, u32, f32 *, u64, Random::Sequence ) const;
+SH_FOR_EACH_BAND( SH_INSTANTIATE )
+#undef SH_INSTANTIATE
 
+template<unsigned int N, typename Rng>
+static void RectangleRandomSamples( const Rectangle &rect, const vec3f &integrationPos, u32 sampleCount, Rng &rng, SHProjector<N> &proj )
+{
 	// costheta * A / r^3
 	for ( u32 i = 0; i < sampleCount; ++i )
 	{
-		const vec2f randV( Random::GlobalPool.Next(), Random::GlobalPool.Next() );
-		//const vec2f randV = Random::Vec2f();
+		const vec2f randV = rng.Next2D();
 
 		vec3f rayDir;
-		const f32 invPdf = SampleDir( rayDir, integrationPos, randV.x, randV.y );
+		const f32 invPdf = rect.SampleDir( rayDir, integrationPos, randV.x, randV.y );
 
 		if ( invPdf > 0.f )
 		{
-			SHEval( nBand, rayDir.x, rayDir.z, rayDir.y, &shtmp[0] );
-
-			for ( int j = 0; j < nCoeff; ++j )
-			{
-				shvals[j] += shtmp[j] * invPdf; // constant luminance of 1 for now
-			}
+			proj.Add( rayDir, invPdf ); // constant luminance of 1 for now
 		}
 	}
+}
+
+template<unsigned int N>
+f32 Rectangle::IntegrateRandom( const vec3f & integrationPos, const vec3f & integrationNrm, u32 sampleCount, f32 *shvals, u64 seed, Random::Sequence seq ) const
+{
+	// Rectangle area
+	const f32 area = 4.f * hx * hy;
+
+	SequenceSampler rng( seed, seq );
+	SHProjector<N> proj;
+	RectangleRandomSamples<N>( *this, integrationPos, sampleCount, rng, proj );
+	proj.Finish( shvals );
 
 	return area / (f32) sampleCount;
 }
 
+f32 Rectangle::IntegrateRandom( const vec3f & integrationPos, const vec3f & integrationNrm, u32 sampleCount, std::vector<f32> &shvals, int nBand, u64 seed, Random::Sequence seq ) const
+{
+	Assert( shvals.size() >= (size_t) ( nBand * nBand ) );
+
+	switch ( nBand )
+	{
+#define BAND_CASE( N ) case N: return IntegrateRandom<N>( integrationPos, integrationNrm, sampleCount, &shvals[0], seed, seq );
+	SH_FOR_EACH_BAND( BAND_CASE )
+#undef BAND_CASE
+	default:
+		Assert( false );
+		return 0.f;
+	}
+}
+
+#define SH_INSTANTIATE( N ) template f32 Rectangle::IntegrateRandom<N>( const vec3f &, const vec3f &, u32, f32 *, u64, Random::Sequence ) const;
+SH_FOR_EACH_BAND( SH_INSTANTIATE )
+#undef SH_INSTANTIATE
+
+f32 Rectangle::IntegrateRandomAdaptive( const vec3f & integrationPos, const vec3f & integrationNrm, AdaptiveSampling &adaptive, std::vector<f32>& shvals, int nBand ) const
+{
+	Assert( shvals.size() >= (size_t) ( nBand * nBand ) );
+
+	switch ( nBand )
+	{
+#define BAND_CASE( N ) case N: return IntegrateAdaptive<N>( adaptive, adaptive.batchSize, 4.f * hx * hy, &shvals[0], [&]( u32 count, PhiloxSampler &rng, SHProjector<N> &proj ) { RectangleRandomSamples<N>( *this, integrationPos, count, rng, proj ); } );
+	SH_FOR_EACH_BAND( BAND_CASE )
+#undef BAND_CASE
+	default:
+		Assert( false );
+		return 0.f;
+	}
+}
+
+f32 Rectangle::IntegrateAngularStratificationAdaptive( const vec3f & integrationPos, const vec3f & integrationNrm, AdaptiveSampling &adaptive, std::vector<f32>& shvals, int nBand ) const
+{
+	Assert( shvals.size() >= (size_t) ( nBand * nBand ) );
+
+	// each batch is a full stratification, of a square sample count
+	const u32 side = std::max( 1u, (u32) std::sqrt( (f32) adaptive.batchSize ) );
+	const u32 batchSize = side * side;
+
+	switch ( nBand )
+	{
+#define BAND_CASE( N ) case N: return IntegrateAdaptive<N>( adaptive, batchSize, 1.f, &shvals[0], [&]( u32 count, PhiloxSampler &rng, SHProjector<N> &proj ) { RectangleStratifiedSamples<N>( *this, integrationPos, count, rng, proj ); } );
+	SH_FOR_EACH_BAND( BAND_CASE )
+#undef BAND_CASE
+	default:
+		Assert( false );
+		return 0.f;
+	}
+}
+
+f32 Rectangle::IntegrateRandomParallel( const vec3f & integrationPos, const vec3f & integrationNrm, u32 sampleCount, std::vector<f32>& shvals, int nBand, u64 seed, Random::Sequence seq ) const
+{
+	Assert( shvals.size() >= (size_t) ( nBand * nBand ) );
+
+	switch ( nBand )
+	{
+#define BAND_CASE( N ) case N: IntegrateChunks<N>( sampleCount, seed, seq, &shvals[0], [&]( u32 count, BufferSampler &rng, SHProjector<N> &proj ) { RectangleRandomSamples<N>( *this, integrationPos, count, rng, proj ); } ); break;
+	SH_FOR_EACH_BAND( BAND_CASE )
+#undef BAND_CASE
+	default:
+		Assert( false );
+		return 0.f;
+	}
+
+	return 4.f * hx * hy / (f32) sampleCount;
+}
+
+f32 Rectangle::IntegrateAnalytic( const vec3f & integrationPos, const vec3f & integrationNrm, std::vector<f32>& shvals, int nBand ) const
+{
+	const u32 nCoeff = nBand * nBand;
+	Assert( shvals.size() >= nCoeff );
+
+	// per-thread scratch : allocation-free after the first call of each thread
+	static thread_local MomentWorkspace ws;
+	static thread_local std::vector<f32> sh;
+	sh.resize( nCoeff );
+
+	ZHLobes::Get( nBand ).ProjectRectangle( *this, integrationPos, &sh[0], ws );
+
+	for ( u32 c = 0; c < nCoeff; ++c )
+		shvals[c] += sh[c];
+
+	return 1.f;
+}
+
+f32 Rectangle::ValidateAnalytic( const vec3f & integrationPos, const vec3f & integrationNrm, u32 sampleCount, int nBand, u64 seed, Random::Sequence seq ) const
+{
+	// IntegrateAnalytic is one-sided (see ZHLobes::ProjectRectangle) while SphericalRectangle sees the light from
+	// both sides : there is nothing to compare behind it
+	if ( Dot( integrationPos - position, ez ) < 1e-5f )
+		return 0.f;
+
+	const u32 nCoeff = nBand * nBand;
+	std::vector<f32> analytic( nCoeff ), sampled( nCoeff, 0.f );
+
+	IntegrateAnalytic( integrationPos, integrationNrm, analytic, nBand );
+
+	// solid angle sampling : the area sampling of IntegrateRandomParallel is too noisy for close & large lights
+	SphericalRectangle srect;
+	srect.Init( *this, integrationPos );
+	const f32 norm = srect.IntegrateParallel( integrationNrm, sampleCount, sampled, nBand, seed, seq );
+
+	f64 diff = 0.0, ref = 0.0;
+	for ( u32 c = 0; c < nCoeff; ++c )
+	{
+		const f64 d = sampled[c] * norm - analytic[c];
+		diff += d * d;
+		ref += analytic[c] * analytic[c];
+	}
+
+	return ref > 0.0 ? (f32) std::sqrt( diff / ref ) : (f32) std::sqrt( diff );
+}
 
 void SphericalRectangle::Init( const Rectangle &rect, const vec3f &org )
 {
@@ -743,35 +1299,83 @@ vec3f SphericalRectangle::Sample( f32 u1, f32 u2 ) const
 	return o + x * xu + y * yv + z * z0;
 }
 
-f32 SphericalRectangle::Integrate( const vec3f & integrationNrm, u32 sampleCount, std::vector<f32>& shvals, int nBand ) const
+template<unsigned int N, typename Rng>
+static void SphericalRectangleSamples( const SphericalRectangle &srect, u32 sampleCount, Rng &rng, SHProjector<N> &proj )
 {
-	// Construct a Spherical Rectangle from the point integrationPos
+	// Sample the spherical rectangle
+	for ( u32 i = 0; i < sampleCount; ++i )
+	{
+		const vec2f randV = rng.Next2D();
+
+		vec3f rayDir = srect.Sample( randV.x, randV.y ) - srect.o;
+		rayDir = Normalize( rayDir );
 
+		proj.Add( rayDir, 1.f );
+	}
+}
+
+template<unsigned int N>
+f32 SphericalRectangle::Integrate( const vec3f & integrationNrm, u32 sampleCount, f32 *shvals, u64 seed, Random::Sequence seq ) const
+{
 	const f32 area = S; // spherical rectangle area/solidangle
 
+	SequenceSampler rng( seed, seq );
+	SHProjector<N> proj;
+	SphericalRectangleSamples<N>( *this, sampleCount, rng, proj );
+	proj.Finish( shvals );
+
+	return area / (f32) sampleCount;
+}
 
-	const int nCoeff = nBand * nBand;
-	std::vector<f32> shtmp( nCoeff );
+f32 SphericalRectangle::Integrate( const vec3f & integrationNrm, u32 sampleCount, std::vector<f32> &shvals, int nBand, u64 seed, Random::Sequence seq ) const
+{
+	Assert( shvals.size() >= (size_t) ( nBand * nBand ) );
 
-	// Sample the spherical rectangle
-	for ( u32 i = 0; i < sampleCount; ++i )
+	switch ( nBand )
 	{
-		const vec2f randV( Random::GlobalPool.Next(), Random::GlobalPool.Next() );
-		//const vec2f randV = Random::Vec2f();
+#define BAND_CASE( N ) case N: return Integrate<N>( integrationNrm, sampleCount, &shvals[0], seed, seq );
+	SH_FOR_EACH_BAND( BAND_CASE )
+#undef BAND_CASE
+	default:
+		Assert( false );
+		return 0.f;
+	}
+}
 
-		vec3f rayDir = Sample( randV.x, randV.y ) - o;
-		const f32 rayLenSq = Dot( rayDir, rayDir );
-		rayDir = Normalize( rayDir );
+#define SH_INSTANTIATE( N ) template f32 SphericalRectangle::Integrate<N>( const vec3f &, u32, f32 *, u64, Random::Sequence ) const;
+SH_FOR_EACH_BAND( SH_INSTANTIATE )
+#undef SH_INSTANTIATE
 
-		SHEval( nBand, rayDir.x, rayDir.z, rayDir.y, &shtmp[0] );
+f32 SphericalRectangle::IntegrateParallel( const vec3f & integrationNrm, u32 sampleCount, std::vector<f32>& shvals, int nBand, u64 seed, Random::Sequence seq ) const
+{
+	Assert( shvals.size() >= (size_t) ( nBand * nBand ) );
 
-		for ( int j = 0; j < nCoeff; ++j )
-		{
-			shvals[j] += shtmp[j];
-		}
+	switch ( nBand )
+	{
+#define BAND_CASE( N ) case N: IntegrateChunks<N>( sampleCount, seed, seq, &shvals[0], [&]( u32 count, BufferSampler &rng, SHProjector<N> &proj ) { SphericalRectangleSamples<N>( *this, count, rng, proj ); } ); break;
+	SH_FOR_EACH_BAND( BAND_CASE )
+#undef BAND_CASE
+	default:
+		Assert( false );
+		return 0.f;
 	}
 
-	return area / (f32) sampleCount;
+	return S / (f32) sampleCount;
+}
+
+f32 SphericalRectangle::IntegrateAdaptive( const vec3f & integrationNrm, AdaptiveSampling &adaptive, std::vector<f32>& shvals, int nBand ) const
+{
+	Assert( shvals.size() >= (size_t) ( nBand * nBand ) );
+
+	switch ( nBand )
+	{
+#define BAND_CASE( N ) case N: return ::IntegrateAdaptive<N>( adaptive, adaptive.batchSize, S, &shvals[0], [&]( u32 count, PhiloxSampler &rng, SHProjector<N> &proj ) { SphericalRectangleSamples<N>( *this, count, rng, proj ); } );
+	SH_FOR_EACH_BAND( BAND_CASE )
+#undef BAND_CASE
+	default:
+		Assert( false );
+		return 0.f;
+	}
 }
 
 void PlanarRectangle::InitBary( const Rectangle & rect, const vec3f & integrationPoint )
@@ -882,31 +1486,67 @@ f32 PlanarRectangle::SampleDir( vec3f & rayDir, const f32 u1, const f32 u2 ) con
 	return costheta / rayLenSq;
 }
 
-f32 PlanarRectangle::IntegrateRandom( u32 sampleCount, std::vector<f32> &shvals, int nBand ) const
+template<unsigned int N, typename Rng>
+static void PlanarRectangleRandomSamples( const PlanarRectangle &prect, u32 sampleCount, Rng &rng, SHProjector<N> &proj )
 {
-	const int nCoeff = nBand * nBand;
-
-	std::vector<f32> shtmp( nCoeff, 0.f );
-
 	// costheta * A / r^2
 	for ( u32 i = 0; i < sampleCount; ++i )
 	{
-		const vec2f randV( Random::GlobalPool.Next(), Random::GlobalPool.Next() );
-		//const vec2f randV = Random::Vec2f();
+		const vec2f randV = rng.Next2D();
 
 		vec3f rayDir;
-		const f32 invPdf = SampleDir( rayDir, randV.x, randV.y );
+		const f32 invPdf = prect.SampleDir( rayDir, randV.x, randV.y );
 
 		if ( invPdf > 0.f )
 		{
-			SHEval( nBand, rayDir.x, rayDir.z, rayDir.y, &shtmp[0] );
-
-			for ( int j = 0; j < nCoeff; ++j )
-			{
-				shvals[j] += shtmp[j] * invPdf; // constant luminance of 1 for now
-			}
+			proj.Add( rayDir, invPdf ); // constant luminance of 1 for now
 		}
 	}
+}
+
+template<unsigned int N>
+f32 PlanarRectangle::IntegrateRandom( u32 sampleCount, f32 *shvals, u64 seed, Random::Sequence seq ) const
+{
+	SequenceSampler rng( seed, seq );
+	SHProjector<N> proj;
+	PlanarRectangleRandomSamples<N>( *this, sampleCount, rng, proj );
+	proj.Finish( shvals );
 
 	return area / (f32) sampleCount;
-}
\ No newline at end of file
+}
+
+f32 PlanarRectangle::IntegrateRandom( u32 sampleCount, std::vector<f32> &shvals, int nBand, u64 seed, Random::Sequence seq ) const
+{
+	Assert( shvals.size() >= (size_t) ( nBand * nBand ) );
+
+	switch ( nBand )
+	{
+#define BAND_CASE( N ) case N: return IntegrateRandom<N>( sampleCount, &shvals[0], seed, seq );
+	SH_FOR_EACH_BAND( BAND_CASE )
+#undef BAND_CASE
+	default:
+		Assert( false );
+		return 0.f;
+	}
+}
+
+#define SH_INSTANTIATE( N ) template f32 PlanarRectangle::IntegrateRandom<N>( u32, f32 *, u64, Random::Sequence ) const;
+SH_FOR_EACH_BAND( SH_INSTANTIATE )
+#undef SH_INSTANTIATE
+
+f32 PlanarRectangle::IntegrateRandomParallel( u32 sampleCount, std::vector<f32> &shvals, int nBand, u64 seed, Random::Sequence seq ) const
+{
+	Assert( shvals.size() >= (size_t) ( nBand * nBand ) );
+
+	switch ( nBand )
+	{
+#define BAND_CASE( N ) case N: IntegrateChunks<N>( sampleCount, seed, seq, &shvals[0], [&]( u32 count, BufferSampler &rng, SHProjector<N> &proj ) { PlanarRectangleRandomSamples<N>( *this, count, rng, proj ); } ); break;
+	SH_FOR_EACH_BAND( BAND_CASE )
+#undef BAND_CASE
+	default:
+		Assert( false );
+		return 0.f;
+	}
+
+	return area / (f32) sampleCount;
+}
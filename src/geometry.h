@@ -13,8 +13,8 @@ struct Polygon
 	Polygon() {}
 	Polygon( const std::vector<vec3f> &pts );
 
-	/// Oosterom & Strackee 83' triangle solidangle
-	/// A, B & C in unit space (spherical triangle)
+	/// Signed solid angle of the convex polygon, as a fan of Oosterom & Strackee 83' triangle solid angles
+	/// Vertices in unit space (spherical polygon)
 	f32 SolidAngle() const;
 
 	f32 CosSumIntegralArvo( f32 x, f32 y, f32 c, int nMin, int nMax ) const;
@@ -27,12 +27,78 @@ struct Polygon
 	void CosSumIntegral( f32 x, f32 y, f32 c, int n, std::vector<f32> &R ) const;
 	void LineIntegral( const vec3f &A, const vec3f &B, const vec3f &w, int n, std::vector<f32> &R ) const;
 	void BoundaryIntegral( const vec3f &w, const vec3f &v, int n, std::vector<f32> &R ) const;
+
+	// R (at least order+1) is filled with the axial moments 0 to order around w
 	void AxialMoment( const vec3f &w, int order, std::vector<f32> &R ) const;
 	std::vector<f32> AxialMoments( const std::vector<vec3f> &directions ) const;
 };
 
 
 
+/// Reusable scratch memory for the FixedPolygon moments. It only grows : keeping one around
+/// between calls makes them allocation-free.
+struct MomentWorkspace
+{
+	std::vector<f32> b;
+	std::vector<f32> acc;		// batched moments, coefficient-major
+	std::vector<f32> x, y, z;	// SoA directions
+	std::vector<f32> moments;	// ZHLobes::ProjectPolygon
+
+	void Reserve( int order )
+	{
+		if ( b.size() < (size_t) ( order + 2 ) )
+			b.resize( order + 2 );
+	}
+};
+
+/// Polygon with inline storage for up to MaxEdges edges. Computes the same moments as Polygon,
+/// without any heap allocation, for the per-pixel / per-direction hot loops.
+struct FixedPolygon
+{
+	static const u32 MaxEdges = 8;
+
+	Edge edges[MaxEdges];
+	u32 edgeCount;
+
+	FixedPolygon() : edgeCount( 0 ) {}
+
+	/// Closed polygon from count (3 to MaxEdges) points
+	FixedPolygon( const vec3f *pts, u32 count );
+	explicit FixedPolygon( const Polygon &P );
+
+	f32 SolidAngle() const;
+
+	/// Writes the axial moments of order 0 to order around w in R[0..order]
+	void AxialMoment( const vec3f &w, int order, f32 *R, MomentWorkspace &ws ) const;
+
+	/// Same for dirCount directions. R is dirCount * (order+1), moments of direction i starting at R[i * (order+1)].
+	/// Runs AxialMomentsBatch on a SoA copy of the directions.
+	void AxialMoments( const vec3f *directions, u32 dirCount, int order, f32 *R, MomentWorkspace &ws ) const;
+
+	/// Same with SoA directions (pX, pY, pZ), evaluated simdf::Width at a time (see simd.h).
+	/// The edge frames, lengths, normals and the solid angle are only computed once for all directions.
+	void AxialMomentsBatch( const f32 *pX, const f32 *pY, const f32 *pZ, u32 dirCount, int order, f32 *R, MomentWorkspace &ws ) const;
+};
+
+
+/// Settings & result of the adaptive SH integrators. Samples are integrated in batches of batchSize,
+/// each batch giving an independent estimate of the SH vector. Integration stops once the standard error
+/// of their mean, relative to its norm, is below targetError (or at maxSamples).
+struct AdaptiveSampling
+{
+	AdaptiveSampling() : targetError( 0.01f ), batchSize( 256 ), minSamples( 1024 ), maxSamples( 65536 ), seed( 0 ), samplesUsed( 0 ), relativeError( 0.f ) {}
+
+	f32 targetError;	//!< Relative standard error of the SH vector, e.g. 0.01 for 1%
+	u32 batchSize;		//!< Samples between two error checks. Rounded down to a square for the stratified integrators
+	u32 minSamples;		//!< Below two batches, the error estimate is meaningless
+	u32 maxSamples;
+	u64 seed;			//!< Batch k uses the Random::Philox stream ( seed, k )
+
+	u32 samplesUsed;	//!< [out] number of samples integrated
+	f32 relativeError;	//!< [out] estimated relative standard error at the end
+};
+
+
 /// Represents a spherical or WS triangle of three coordinates q0, q1, q2.
 /// depending on the Init function used
 /// solid angle is approximated. For a real triangle solid angle, use Polygon::SolidAngle
@@ -124,10 +190,40 @@ struct Rectangle
 
 	/// Numerical Integration with the technique from Pixar [Pekelis & Hery 2014]
 	/// This is the preferred method between good results and speed.
-	f32 IntegrateAngularStratification( const vec3f &integrationPos, const vec3f &integrationNrm, u32 sampleCount, std::vector<f32> &shvals, int nBand ) const;
+	f32 IntegrateAngularStratification( const vec3f &integrationPos, const vec3f &integrationNrm, u32 sampleCount, std::vector<f32> &shvals, int nBand, u64 seed = 0, Random::Sequence seq = Random::SEQ_THREAD ) const;
 
 	/// Numerical integration for Ground Truth, True random world space rectangle sampling
-	f32 IntegrateRandom( const vec3f &integrationPos, const vec3f &integrationNrm, u32 sampleCount, std::vector<f32> &shvals, int nBand ) const;
+	/// The serial integrators draw their samples from the seq sequence seeded by seed (see Random::Sequence),
+	/// by default from the calling thread's generator.
+	f32 IntegrateRandom( const vec3f &integrationPos, const vec3f &integrationNrm, u32 sampleCount, std::vector<f32> &shvals, int nBand, u64 seed = 0, Random::Sequence seq = Random::SEQ_THREAD ) const;
+
+	/// Compile-time band versions of the above (N in [3, 21]), accumulating into the N * N coefficients of shvals.
+	/// The runtime nBand versions check the size of their vector and dispatch to these.
+	template<unsigned int N>
+	f32 IntegrateAngularStratification( const vec3f &integrationPos, const vec3f &integrationNrm, u32 sampleCount, f32 *shvals, u64 seed = 0, Random::Sequence seq = Random::SEQ_THREAD ) const;
+
+	template<unsigned int N>
+	f32 IntegrateRandom( const vec3f &integrationPos, const vec3f &integrationNrm, u32 sampleCount, f32 *shvals, u64 seed = 0, Random::Sequence seq = Random::SEQ_THREAD ) const;
+
+	/// Multithreaded IntegrateRandom (see Parallel::For). Samples of the seq sequence are drawn in fixed-size chunks of
+	/// consecutive indices, and chunk results are summed in order : the result is the same for any thread count.
+	/// The quasi-random sequences (Random::SEQ_SOBOL, ...) converge faster than SEQ_PCG, Sobol works best with power of two counts.
+	f32 IntegrateRandomParallel( const vec3f &integrationPos, const vec3f &integrationNrm, u32 sampleCount, std::vector<f32> &shvals, int nBand, u64 seed = 0, Random::Sequence seq = Random::SEQ_PCG ) const;
+
+	/// Adaptive versions of IntegrateRandom & IntegrateAngularStratification : the sample count is decided by
+	/// the convergence of the SH vector (see AdaptiveSampling). Same shvals & return value conventions.
+	f32 IntegrateRandomAdaptive( const vec3f &integrationPos, const vec3f &integrationNrm, AdaptiveSampling &adaptive, std::vector<f32> &shvals, int nBand ) const;
+	f32 IntegrateAngularStratificationAdaptive( const vec3f &integrationPos, const vec3f &integrationNrm, AdaptiveSampling &adaptive, std::vector<f32> &shvals, int nBand ) const;
+
+	/// Exact, noise-free projection from the axial moments of the rectangle (see ZHLobes::ProjectRectangle), at a fixed
+	/// cost per point. Accumulated into shvals like the sampled integrators, and already normalized : returns 1,
+	/// so that it can replace them as is.
+	f32 IntegrateAnalytic( const vec3f &integrationPos, const vec3f &integrationNrm, std::vector<f32> &shvals, int nBand ) const;
+
+	/// Validation of IntegrateAnalytic against SphericalRectangle::IntegrateParallel with sampleCount samples : returns the L2 norm of
+	/// their difference, relative to the analytic one. Should go down like the Monte Carlo error as sampleCount grows.
+	/// Returns 0 behind the light, where the one-sided analytic projection is zero and there is nothing to validate.
+	f32 ValidateAnalytic( const vec3f &integrationPos, const vec3f &integrationNrm, u32 sampleCount, int nBand, u64 seed = 0, Random::Sequence seq = Random::SEQ_SOBOL ) const;
 };
 
 /// Rectangle projected to a plane
@@ -147,7 +243,13 @@ struct PlanarRectangle
 	vec3f SamplePoint( f32 u1, f32 u2 ) const;
 	f32 SampleDir( vec3f & rayDir, const f32 u1, const f32 u2 ) const;
 
-	f32 IntegrateRandom( u32 sampleCount, std::vector<f32> &shvals, int nBand ) const;
+	f32 IntegrateRandom( u32 sampleCount, std::vector<f32> &shvals, int nBand, u64 seed = 0, Random::Sequence seq = Random::SEQ_THREAD ) const;
+
+	template<unsigned int N>
+	f32 IntegrateRandom( u32 sampleCount, f32 *shvals, u64 seed = 0, Random::Sequence seq = Random::SEQ_THREAD ) const;
+
+	/// Multithreaded, reproducible IntegrateRandom. See Rectangle::IntegrateRandomParallel
+	f32 IntegrateRandomParallel( u32 sampleCount, std::vector<f32> &shvals, int nBand, u64 seed = 0, Random::Sequence seq = Random::SEQ_PCG ) const;
 };
 
 // For use with SphericalRectangle sampling [Urena13]
@@ -165,7 +267,16 @@ struct SphericalRectangle
 
 	/// Numerical Integration using the technique from Urena et al., 2013
 	/// This is more robust at grazing angles, but a bit slower than AS.
-	f32 Integrate( const vec3f &integrationNrm, u32 sampleCount, std::vector<f32> &shvals, int nBand ) const;
+	f32 Integrate( const vec3f &integrationNrm, u32 sampleCount, std::vector<f32> &shvals, int nBand, u64 seed = 0, Random::Sequence seq = Random::SEQ_THREAD ) const;
+
+	template<unsigned int N>
+	f32 Integrate( const vec3f &integrationNrm, u32 sampleCount, f32 *shvals, u64 seed = 0, Random::Sequence seq = Random::SEQ_THREAD ) const;
+
+	/// Multithreaded, reproducible Integrate. See Rectangle::IntegrateRandomParallel
+	f32 IntegrateParallel( const vec3f &integrationNrm, u32 sampleCount, std::vector<f32> &shvals, int nBand, u64 seed = 0, Random::Sequence seq = Random::SEQ_PCG ) const;
+
+	/// Adaptive Integrate, see AdaptiveSampling
+	f32 IntegrateAdaptive( const vec3f &integrationNrm, AdaptiveSampling &adaptive, std::vector<f32> &shvals, int nBand ) const;
 
 };
 
@@ -0,0 +1,329 @@
+#include "groundtruth.h"
+#include "zhlobes.h"
+
+#include "common/parallel.h"
+#include "common/SHEval.h"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <sstream>
+
+namespace GroundTruth
+{
+	static const u32 DumpMagic = 0x44424752; // 'RGBD'
+
+	bool GBufferDump::Save( const std::string &filePath ) const
+	{
+		Assert( normal.size() == width * height && position.size() == width * height );
+
+		std::ofstream file( filePath, std::ios::out | std::ios::binary );
+		if ( !file )
+		{
+			LogErr( "Error opening file ", filePath, " for writing." );
+			return false;
+		}
+
+		file.write( (const char*) &DumpMagic, sizeof( u32 ) );
+		file.write( (const char*) &width, sizeof( u32 ) );
+		file.write( (const char*) &height, sizeof( u32 ) );
+		file.write( (const char*) &normal[0], normal.size() * sizeof( vec3f ) );
+		file.write( (const char*) &position[0], position.size() * sizeof( vec3f ) );
+
+		return file.good();
+	}
+
+	bool GBufferDump::Load( const std::string &filePath )
+	{
+		std::ifstream file( filePath, std::ios::in | std::ios::binary );
+		if ( !file )
+		{
+			LogErr( "Error opening file ", filePath, " for reading." );
+			return false;
+		}
+
+		u32 magic = 0;
+		file.read( (char*) &magic, sizeof( u32 ) );
+		file.read( (char*) &width, sizeof( u32 ) );
+		file.read( (char*) &height, sizeof( u32 ) );
+		if ( !file || magic != DumpMagic )
+		{
+			LogErr( filePath, " is not a GBuffer dump." );
+			return false;
+		}
+
+		normal.resize( width * height );
+		position.resize( width * height );
+		file.read( (char*) &normal[0], normal.size() * sizeof( vec3f ) );
+		file.read( (char*) &position[0], position.size() * sizeof( vec3f ) );
+
+		if ( !file )
+		{
+			LogErr( "Truncated GBuffer dump ", filePath );
+			return false;
+		}
+
+		return true;
+	}
+
+	bool SaveLights( const std::string &filePath, const std::vector<Light> &lights )
+	{
+		std::ofstream file( filePath, std::ios::out );
+		if ( !file )
+		{
+			LogErr( "Error opening file ", filePath, " for writing." );
+			return false;
+		}
+
+		file.precision( 9 );
+		for ( const Light &light : lights )
+		{
+			const vec3f values[6] = { light.rect.p0, light.rect.p1, light.rect.p2, light.rect.p3, light.rect.ez, light.Ld };
+			for ( const vec3f &v : values )
+				file << v.x << " " << v.y << " " << v.z << " ";
+			file << "\n";
+		}
+
+		return file.good();
+	}
+
+	bool LoadLights( const std::string &filePath, std::vector<Light> &lights )
+	{
+		std::ifstream file( filePath, std::ios::in );
+		if ( !file )
+		{
+			LogErr( "Error opening file ", filePath, " for reading." );
+			return false;
+		}
+
+		lights.clear();
+
+		std::string line;
+		while ( std::getline( file, line ) )
+		{
+			if ( line.find_first_not_of( " \t\r" ) == std::string::npos )
+				continue;
+
+			std::istringstream ss( line );
+			std::vector<vec3f> corners( 4 );
+			vec3f ez;
+			Light light;
+			for ( vec3f &v : corners )
+				ss >> v.x >> v.y >> v.z;
+			ss >> ez.x >> ez.y >> ez.z;
+			ss >> light.Ld.x >> light.Ld.y >> light.Ld.z;
+
+			if ( !ss )
+			{
+				LogErr( "Invalid light in ", filePath, " : ", line );
+				return false;
+			}
+
+			// the emitting side is kept as is, it does not always follow the corners winding (see AreaLight::GetRectangle)
+			light.rect = Rectangle( corners );
+			light.rect.ez = Normalize( ez );
+			lights.push_back( light );
+		}
+
+		return true;
+	}
+
+	/// Per-thread sample buffers for the SH projection, reused between pixels
+	struct ShadeScratch
+	{
+		std::vector<vec2f> samples;
+		std::vector<f32> x, y, z, w;
+		std::vector<f32> sh;
+		std::vector<f32> analytic;
+		std::vector<vec3f> sampledSum;	// SH_VALIDATE
+		MomentWorkspace moments;
+	};
+
+	static void ShadePixel( const vec3f &P, const vec3f &N, u32 px, const std::vector<Light> &lights, const Desc &desc,
+							ShadeScratch &scratch, vec3f &irradiance, vec3f *sh, f32 *shError )
+	{
+		const u32 nCoeff = desc.nBand * desc.nBand;
+		const bool sampledSH = nCoeff && desc.shMethod != SH_ANALYTIC;
+		const bool analyticSH = nCoeff && desc.shMethod != SH_SAMPLED;
+
+		if ( shError )
+			std::fill( scratch.sampledSum.begin(), scratch.sampledSum.end(), vec3f( 0.f ) );
+
+		for ( u32 l = 0; l < lights.size(); ++l )
+		{
+			const Light &light = lights[l];
+			const Rectangle &rect = light.rect;
+
+			// one-sided lights, also rejects points lying in the light plane
+			if ( Dot( P - rect.position, rect.ez ) < 1e-5f )
+				continue;
+
+			SphericalRectangle srect;
+			srect.Init( rect, P );
+			if ( !( srect.S > 0.f ) )
+				continue;
+
+			const u64 first = ( (u64) px * lights.size() + l ) * desc.sampleCount;
+			Random::Generate2D( desc.sequence, desc.seed, first, desc.sampleCount, scratch.samples.data() );
+
+			f32 E = 0.f;
+			for ( u32 i = 0; i < desc.sampleCount; ++i )
+			{
+				const vec2f &u = scratch.samples[i];
+				const vec3f dir = Normalize( srect.Sample( u.x, u.y ) - P );
+
+				E += std::max( 0.f, Dot( dir, N ) );
+
+				if ( sampledSH )
+				{
+					// SH basis is z-up
+					scratch.x[i] = dir.x;
+					scratch.y[i] = dir.z;
+					scratch.z[i] = dir.y;
+				}
+			}
+
+			const f32 invPdf = srect.S / (f32) desc.sampleCount;
+			irradiance += light.Ld * ( E * invPdf );
+
+			if ( sampledSH )
+			{
+				std::fill( scratch.w.begin(), scratch.w.end(), invPdf );
+				std::fill( scratch.sh.begin(), scratch.sh.end(), 0.f );
+				SHEvalAccumulateBatch( desc.nBand, desc.sampleCount, &scratch.x[0], &scratch.y[0], &scratch.z[0], &scratch.w[0], &scratch.sh[0] );
+
+				vec3f *dst = shError ? &scratch.sampledSum[0] : sh;
+				for ( u32 c = 0; c < nCoeff; ++c )
+					dst[c] += light.Ld * scratch.sh[c];
+			}
+
+			if ( analyticSH )
+			{
+				ZHLobes::Get( desc.nBand ).ProjectRectangle( rect, P, &scratch.analytic[0], scratch.moments );
+
+				for ( u32 c = 0; c < nCoeff; ++c )
+					sh[c] += light.Ld * scratch.analytic[c];
+			}
+		}
+
+		if ( shError )
+		{
+			f32 diff = 0.f, ref = 0.f;
+			for ( u32 c = 0; c < nCoeff; ++c )
+			{
+				const vec3f d = scratch.sampledSum[c] - sh[c];
+				diff += Dot( d, d );
+				ref += Dot( sh[c], sh[c] );
+			}
+
+			*shError = ref > 0.f ? std::sqrt( diff / ref ) : 0.f;
+		}
+	}
+
+	void Render( const GBufferDump &gbuffer, const std::vector<Light> &lights, const Desc &desc, Image &out )
+	{
+		Assert( desc.nBand == 0 || ( desc.nBand >= 3 && desc.nBand <= 21 ) );
+		Assert( desc.tileSize > 0 );
+
+		const u32 width = gbuffer.width;
+		const u32 height = gbuffer.height;
+		const u32 nCoeff = desc.nBand * desc.nBand;
+
+		out.width = width;
+		out.height = height;
+		out.nBand = desc.nBand;
+		out.irradiance.assign( width * height, vec3f( 0.f ) );
+		out.sh.assign( width * height * nCoeff, vec3f( 0.f ) );
+		out.shError.assign( nCoeff && desc.shMethod == SH_VALIDATE ? width * height : 0, 0.f );
+
+		// built once here rather than by the first tiles
+		if ( nCoeff && desc.shMethod != SH_SAMPLED )
+			ZHLobes::Get( desc.nBand );
+
+		const u32 tileCountX = ( width + desc.tileSize - 1 ) / desc.tileSize;
+		const u32 tileCountY = ( height + desc.tileSize - 1 ) / desc.tileSize;
+
+		std::vector<ShadeScratch> scratches( Parallel::ThreadCount() );
+		for ( ShadeScratch &s : scratches )
+		{
+			s.samples.resize( desc.sampleCount );
+			if ( nCoeff )
+			{
+				s.x.resize( desc.sampleCount );
+				s.y.resize( desc.sampleCount );
+				s.z.resize( desc.sampleCount );
+				s.w.resize( desc.sampleCount );
+				s.sh.resize( nCoeff );
+				s.analytic.resize( nCoeff );
+				s.sampledSum.resize( nCoeff );
+			}
+		}
+
+		Parallel::For( tileCountX * tileCountY, [&]( u32 tile, u32 threadIdx )
+		{
+			const u32 x0 = ( tile % tileCountX ) * desc.tileSize;
+			const u32 y0 = ( tile / tileCountX ) * desc.tileSize;
+			const u32 x1 = std::min( width, x0 + desc.tileSize );
+			const u32 y1 = std::min( height, y0 + desc.tileSize );
+
+			for ( u32 y = y0; y < y1; ++y )
+			{
+				for ( u32 x = x0; x < x1; ++x )
+				{
+					const u32 px = y * width + x;
+					const vec3f &N = gbuffer.normal[px];
+
+					if ( Dot( N, N ) < 1e-6f )
+						continue;
+
+					ShadePixel( gbuffer.position[px], Normalize( N ), px, lights, desc, scratches[threadIdx],
+								out.irradiance[px], nCoeff ? &out.sh[px * nCoeff] : nullptr, out.shError.empty() ? nullptr : &out.shError[px] );
+				}
+			}
+		} );
+	}
+
+	/// Ward's shared exponent encoding
+	static void FloatToRGBE( const vec3f &rgb, u8 rgbe[4] )
+	{
+		const f32 v = std::max( rgb.x, std::max( rgb.y, rgb.z ) );
+
+		if ( v < 1e-32f )
+		{
+			rgbe[0] = rgbe[1] = rgbe[2] = rgbe[3] = 0;
+			return;
+		}
+
+		int e;
+		const f32 scale = std::frexp( v, &e ) * 256.f / v;
+
+		rgbe[0] = (u8) ( std::max( 0.f, rgb.x ) * scale );
+		rgbe[1] = (u8) ( std::max( 0.f, rgb.y ) * scale );
+		rgbe[2] = (u8) ( std::max( 0.f, rgb.z ) * scale );
+		rgbe[3] = (u8) ( e + 128 );
+	}
+
+	bool WriteHDR( const std::string &filePath, u32 width, u32 height, const vec3f *pixels )
+	{
+		std::ofstream file( filePath, std::ios::out | std::ios::binary );
+		if ( !file )
+		{
+			LogErr( "Error opening file ", filePath, " for writing." );
+			return false;
+		}
+
+		file << "#?RADIANCE\nFORMAT=32-bit_rle_rgbe\n\n-Y " << height << " +X " << width << "\n";
+
+		// flat scanlines, readers accept them as well as RLE ones
+		std::vector<u8> scanline( width * 4 );
+		for ( u32 y = 0; y < height; ++y )
+		{
+			for ( u32 x = 0; x < width; ++x )
+				FloatToRGBE( pixels[y * width + x], &scanline[x * 4] );
+
+			file.write( (const char*) &scanline[0], scanline.size() );
+		}
+
+		return file.good();
+	}
+}
@@ -0,0 +1,82 @@
+#pragma once
+
+#include "common/common.h"
+#include "geometry.h"
+
+/// CPU ground truth renderer for area lighting.
+/// Shades a dump of the GBuffer (world positions & normals) against a set of rectangular area lights,
+/// without any GL dependency, so that it can run on headless machines. Used to validate the LTC and
+/// SH shader approximations at full resolution.
+/// The app writes its inputs with Render::FBO::DumpGBuffer and SaveLights, bin/radar_groundtruth
+/// (tools/groundtruth.cpp) renders them offline.
+namespace GroundTruth
+{
+	/// Rectangular light with a constant emitted radiance Ld, emitting towards rect.ez.
+	/// From a scene light : { AreaLight::GetRectangle( ubo ), ubo.Ld }
+	struct Light
+	{
+		Rectangle rect;
+		vec3f Ld;
+	};
+
+	/// CPU copy of the GBuffer Normal & World Position attachments (see Render::FBO::ReadGBuffer).
+	/// Row-major, top row first, width * height texels each.
+	/// Texels with a null normal (background) are not shaded.
+	struct GBufferDump
+	{
+		u32 width, height;
+		std::vector<vec3f> normal;
+		std::vector<vec3f> position;
+
+		GBufferDump() : width( 0 ), height( 0 ) {}
+
+		/// Raw binary dump file I/O
+		bool Save( const std::string &filePath ) const;
+		bool Load( const std::string &filePath );
+	};
+
+	/// Light list file I/O. Text, one light per line : the corners p0 p1 p2 p3 of its rectangle (see Rectangle),
+	/// its emitting normal ez, then Ld, as 18 floats.
+	bool SaveLights( const std::string &filePath, const std::vector<Light> &lights );
+	bool LoadLights( const std::string &filePath, std::vector<Light> &lights );
+
+	/// How Image::sh is computed
+	enum SHMethod
+	{
+		SH_SAMPLED,		//!< Projection of the irradiance samples
+		SH_ANALYTIC,	//!< Exact projection from the lights' axial moments (see ZHLobes), noise-free
+		SH_VALIDATE		//!< Analytic, plus the relative error of the sampled projection in Image::shError
+	};
+
+	struct Desc
+	{
+		Desc() : sampleCount( 256 ), nBand( 0 ), shMethod( SH_SAMPLED ), tileSize( 16 ), seed( 0 ), sequence( Random::SEQ_SOBOL ) {}
+
+		u32 sampleCount;	//!< Samples per pixel and per light. Keep it a power of two with SEQ_SOBOL
+		int nBand;			//!< SH projection band count of the incoming radiance, [3, 21]. 0 to only compute irradiance
+		SHMethod shMethod;
+		u32 tileSize;		//!< Side of the square pixel tiles dispatched to the worker threads
+		u64 seed;
+		Random::Sequence sequence;	//!< Sample sequence. Each (pixel, light) pair uses its own range of indices
+	};
+
+	struct Image
+	{
+		u32 width, height;
+		int nBand;
+		std::vector<vec3f> irradiance;	//!< Per pixel cosine-weighted irradiance
+		std::vector<vec3f> sh;			//!< Per pixel RGB SH coefficients : sh[pixel * nBand * nBand + c]. Empty if nBand is 0
+		std::vector<f32> shError;		//!< SH_VALIDATE only : per pixel L2 norm of the sampled - analytic SH, relative to the analytic one
+
+		Image() : width( 0 ), height( 0 ), nBand( 0 ) {}
+	};
+
+	/// Renders every pixel of the GBuffer dump. Tiles are handed out to the Parallel::For pool on demand, so
+	/// that fast (background) tiles don't keep threads idle. Samples only depend on the pixel and desc.seed,
+	/// not on the thread count.
+	/// Irradiance is estimated by uniformly sampling the lights' solid angle [Urena13].
+	void Render( const GBufferDump &gbuffer, const std::vector<Light> &lights, const Desc &desc, Image &out );
+
+	/// Writes an RGB float image to a Radiance RGBE (.hdr) file, top row first.
+	bool WriteHDR( const std::string &filePath, u32 width, u32 height, const vec3f *pixels );
+}
@@ -0,0 +1,420 @@
+#include "ltcfit.h"
+
+#include "brdf.h"
+#include "common/parallel.h"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+
+namespace LTCFit
+{
+	static const f32 MinAlpha = 1e-3f;
+
+	/// BRDF * cosine in the local frame (N = z), with its importance sampling
+	struct FitBRDF
+	{
+		BRDFType type;
+		f32 roughness;
+		f32 alpha;
+
+		FitBRDF( BRDFType type, f32 roughness ) : type( type ), roughness( roughness ), alpha( std::max( MinAlpha, roughness * roughness ) ) {}
+
+		f32 Eval( const vec3f &V, const vec3f &L, f32 &pdf ) const
+		{
+			pdf = 0.f;
+			if ( V.z <= 0.f || L.z <= 0.f )
+				return 0.f;
+
+			const vec3f H = Normalize( V + L );
+			const f32 NdotH = H.z;
+			const f32 LdotH = Dot( L, H );
+
+			if ( type == BRDF_BURLEY )
+			{
+				pdf = L.z / M_PI;
+				return Render::BRDF::DiffuseBurley( L.z, V.z, LdotH, roughness ) * L.z;
+			}
+
+			const f32 alpha2 = alpha * alpha;
+			const f32 denom = NdotH * NdotH * ( alpha2 - 1.f ) + 1.f;
+			const f32 D = alpha2 / ( M_PI * denom * denom );
+			pdf = D * NdotH / ( 4.f * LdotH );
+
+			return Render::BRDF::GGX( L.z, V.z, NdotH, LdotH, alpha, vec3f( 1.f ) ).x * L.z;
+		}
+
+		vec3f Sample( const vec3f &V, f32 u1, f32 u2 ) const
+		{
+			const f32 phi = 2.f * M_PI * u1;
+
+			if ( type == BRDF_BURLEY )
+			{
+				const f32 r = std::sqrt( u2 );
+				return vec3f( r * std::cos( phi ), r * std::sin( phi ), std::sqrt( std::max( 0.f, 1.f - u2 ) ) );
+			}
+
+			// GGX distribution of normals, reflected
+			const f32 tanTheta2 = alpha * alpha * u2 / ( 1.f - u2 );
+			const f32 cosTheta = 1.f / std::sqrt( 1.f + tanTheta2 );
+			const f32 sinTheta = std::sqrt( std::max( 0.f, 1.f - cosTheta * cosTheta ) );
+			const vec3f H( sinTheta * std::cos( phi ), sinTheta * std::sin( phi ), cosTheta );
+
+			return H * ( 2.f * Dot( V, H ) ) - V;
+		}
+	};
+
+	/// Clamped cosine distribution transformed by M = [X Y Z] * ( m11 0 m13 | 0 m22 0 | 0 0 1 )
+	struct LTC
+	{
+		f32 m11, m22, m13;
+		vec3f X, Y, Z;
+		f32 amplitude;
+
+		mat3f M, invM;
+		f32 detM;
+
+		LTC() : m11( 1.f ), m22( 1.f ), m13( 0.f ), X( 1, 0, 0 ), Y( 0, 1, 0 ), Z( 0, 0, 1 ), amplitude( 1.f ) { Update(); }
+
+		void Update()
+		{
+			const mat3f frame( X, Y, Z );
+			const mat3f params( vec3f( m11, 0, 0 ), vec3f( 0, m22, 0 ), vec3f( m13, 0, 1 ) );
+
+			M = frame * params;
+			invM = M.Inverse();
+			detM = Dot( M.M[0], Cross( M.M[1], M.M[2] ) );
+		}
+
+		f32 Eval( const vec3f &L ) const
+		{
+			const vec3f Lorig = Normalize( invM * L );
+			const f32 len = Len( M * Lorig );
+
+			// D(Lorig) / Jacobian of Lorig -> L
+			const f32 D = std::max( 0.f, Lorig.z ) / M_PI;
+			const f32 jacobian = detM / ( len * len * len );
+
+			return amplitude * D / jacobian;
+		}
+
+		vec3f Sample( f32 u1, f32 u2 ) const
+		{
+			const f32 r = std::sqrt( u1 );
+			const f32 phi = 2.f * M_PI * u2;
+			const vec3f L( r * std::cos( phi ), r * std::sin( phi ), std::sqrt( std::max( 0.f, 1.f - u1 ) ) );
+
+			return Normalize( M * L );
+		}
+	};
+
+	/// Fitting error of a cell : integral of |brdf - ltc|^3, multiple importance sampled from both
+	struct FitCell
+	{
+		const FitBRDF &brdf;
+		const vec3f V;
+		const u32 sampleCount;
+		LTC &ltc;
+		bool isotropic;
+
+		FitCell( const FitBRDF &brdf, const vec3f &V, u32 sampleCount, LTC &ltc, bool isotropic ) :
+			brdf( brdf ), V( V ), sampleCount( sampleCount ), ltc( ltc ), isotropic( isotropic )
+		{}
+
+		void Set( const f32 *params )
+		{
+			ltc.m11 = std::max( params[0], 1e-7f );
+			ltc.m22 = isotropic ? ltc.m11 : std::max( params[1], 1e-7f );
+			ltc.m13 = isotropic ? 0.f : params[2];
+			ltc.Update();
+		}
+
+		f32 Error( const vec3f &L ) const
+		{
+			f32 pdfBRDF;
+			const f32 evalBRDF = brdf.Eval( V, L, pdfBRDF );
+			const f32 evalLTC = ltc.Eval( L );
+			const f32 pdfLTC = evalLTC / ltc.amplitude;
+
+			const f32 e = std::fabs( evalBRDF - evalLTC );
+			return ( pdfLTC + pdfBRDF > 0.f ) ? e * e * e / ( pdfLTC + pdfBRDF ) : 0.f;
+		}
+
+		f32 operator()( const f32 *params )
+		{
+			Set( params );
+
+			f64 error = 0.0;
+			for ( u32 j = 0; j < sampleCount; ++j )
+			{
+				for ( u32 i = 0; i < sampleCount; ++i )
+				{
+					const f32 u1 = ( i + 0.5f ) / sampleCount;
+					const f32 u2 = ( j + 0.5f ) / sampleCount;
+
+					error += Error( ltc.Sample( u1, u2 ) );
+					error += Error( brdf.Sample( V, u1, u2 ) );
+				}
+			}
+
+			return (f32) ( error / ( sampleCount * sampleCount ) );
+		}
+	};
+
+	/// Downhill simplex minimization of f in 3 dimensions, starting with a simplex of size delta around x.
+	/// x receives the minimum.
+	template<typename Func>
+	static f32 NelderMead( f32 x[3], f32 delta, f32 tolerance, u32 maxIterations, Func &f )
+	{
+		const int D = 3;
+		f32 s[D + 1][D];
+		f32 fs[D + 1];
+
+		for ( int i = 0; i <= D; ++i )
+		{
+			for ( int k = 0; k < D; ++k )
+				s[i][k] = x[k] + ( i == k + 1 ? delta : 0.f );
+			fs[i] = f( s[i] );
+		}
+
+		for ( u32 it = 0; it < maxIterations; ++it )
+		{
+			// sort the vertices, best first
+			for ( int i = 1; i <= D; ++i )
+				for ( int j = i; j > 0 && fs[j] < fs[j - 1]; --j )
+				{
+					std::swap( fs[j], fs[j - 1] );
+					for ( int k = 0; k < D; ++k )
+						std::swap( s[j][k], s[j - 1][k] );
+				}
+
+			if ( fs[D] - fs[0] < tolerance )
+				break;
+
+			f32 centroid[D] = { 0.f, 0.f, 0.f };
+			for ( int i = 0; i < D; ++i )
+				for ( int k = 0; k < D; ++k )
+					centroid[k] += s[i][k] / D;
+
+			// reflection
+			f32 xr[D], xe[D], xc[D];
+			for ( int k = 0; k < D; ++k )
+				xr[k] = centroid[k] + ( centroid[k] - s[D][k] );
+			const f32 fr = f( xr );
+
+			if ( fr < fs[0] )
+			{
+				// expansion
+				for ( int k = 0; k < D; ++k )
+					xe[k] = centroid[k] + 2.f * ( centroid[k] - s[D][k] );
+				const f32 fe = f( xe );
+
+				const bool expand = fe < fr;
+				for ( int k = 0; k < D; ++k )
+					s[D][k] = expand ? xe[k] : xr[k];
+				fs[D] = expand ? fe : fr;
+				continue;
+			}
+
+			if ( fr < fs[D - 1] )
+			{
+				for ( int k = 0; k < D; ++k )
+					s[D][k] = xr[k];
+				fs[D] = fr;
+				continue;
+			}
+
+			// contraction, towards the best of the reflected and the worst vertex
+			const bool outside = fr < fs[D];
+			for ( int k = 0; k < D; ++k )
+				xc[k] = centroid[k] + 0.5f * ( ( outside ? xr[k] : s[D][k] ) - centroid[k] );
+			const f32 fc = f( xc );
+
+			if ( fc < std::min( fr, fs[D] ) )
+			{
+				for ( int k = 0; k < D; ++k )
+					s[D][k] = xc[k];
+				fs[D] = fc;
+				continue;
+			}
+
+			// shrink towards the best vertex
+			for ( int i = 1; i <= D; ++i )
+			{
+				for ( int k = 0; k < D; ++k )
+					s[i][k] = s[0][k] + 0.5f * ( s[i][k] - s[0][k] );
+				fs[i] = f( s[i] );
+			}
+		}
+
+		int best = 0;
+		for ( int i = 1; i <= D; ++i )
+			if ( fs[i] < fs[best] )
+				best = i;
+
+		for ( int k = 0; k < D; ++k )
+			x[k] = s[best][k];
+		return fs[best];
+	}
+
+	/// BRDF albedo, its Fresnel part and average direction, projected to the V plane
+	static void ComputeMoments( const FitBRDF &brdf, const vec3f &V, u32 sampleCount, f32 &norm, f32 &fresnel, vec3f &averageDir )
+	{
+		f64 n = 0.0, f = 0.0;
+		vec3f dir( 0.f );
+
+		for ( u32 j = 0; j < sampleCount; ++j )
+		{
+			for ( u32 i = 0; i < sampleCount; ++i )
+			{
+				const vec3f L = brdf.Sample( V, ( i + 0.5f ) / sampleCount, ( j + 0.5f ) / sampleCount );
+
+				f32 pdf;
+				const f32 eval = brdf.Eval( V, L, pdf );
+				if ( pdf <= 0.f )
+					continue;
+
+				const f32 w = eval / pdf;
+				const vec3f H = Normalize( V + L );
+
+				n += w;
+				f += w * std::pow( 1.f - std::max( 0.f, Dot( V, H ) ), 5.f );
+				dir += L * w;
+			}
+		}
+
+		const u32 count = sampleCount * sampleCount;
+		norm = (f32) ( n / count );
+		fresnel = (f32) ( f / count );
+
+		dir.y = 0.f;
+		averageDir = Dot( dir, dir ) > 0.f ? Normalize( dir ) : vec3f( 0, 0, 1 );
+	}
+
+	/// Fits cell ( roughness column a, theta row t ), starting from the current ltc parameters
+	static void FitCellLTC( const Desc &desc, u32 a, u32 t, LTC &ltc, vec2f &amplitude )
+	{
+		const u32 N = desc.lutSize;
+		const f32 roughness = a / (f32) ( N - 1 );
+		const f32 theta = std::min( 1.57f, t / (f32) ( N - 1 ) * 1.57079f );
+		const vec3f V( std::sin( theta ), 0.f, std::cos( theta ) );
+
+		const FitBRDF brdf( desc.brdf, roughness );
+
+		f32 norm, fresnel;
+		vec3f averageDir;
+		ComputeMoments( brdf, V, desc.sampleCount, norm, fresnel, averageDir );
+
+		ltc.amplitude = norm;
+		amplitude = vec2f( norm, fresnel );
+
+		// normal incidence : the lobe is isotropic around N
+		const bool isotropic = t == 0;
+		if ( isotropic )
+		{
+			ltc.X = vec3f( 1, 0, 0 );
+			ltc.Y = vec3f( 0, 1, 0 );
+			ltc.Z = vec3f( 0, 0, 1 );
+			ltc.m13 = 0.f;
+		}
+		else
+		{
+			ltc.X = vec3f( averageDir.z, 0.f, -averageDir.x );
+			ltc.Y = vec3f( 0, 1, 0 );
+			ltc.Z = averageDir;
+		}
+		ltc.Update();
+
+		FitCell fit( brdf, V, desc.sampleCount, ltc, isotropic );
+		f32 params[3] = { ltc.m11, ltc.m22, ltc.m13 };
+		NelderMead( params, 0.05f, 1e-5f, desc.maxIterations, fit );
+		fit.Set( params );
+	}
+
+	/// Inverse of M, scaled to the ( 1 0 y | 0 z 0 | w 0 x ) form of LTC_Matrix
+	static vec4f PackInverse( const LTC &ltc )
+	{
+		mat3f inv = ltc.invM;
+		inv = inv / inv[0][0];
+
+		return vec4f( inv[2][2], inv[0][2], inv[1][1], inv[2][0] );
+	}
+
+	void Fit( const Desc &desc, Table &out )
+	{
+		Assert( desc.lutSize >= 2 && desc.sampleCount > 0 );
+
+		const u32 N = desc.lutSize;
+		out.size = N;
+		out.matrix.assign( N * N, vec4f( 0.f ) );
+		out.amplitude.assign( N * N, vec2f( 0.f ) );
+
+		// theta = 0 row, from rough to smooth : the isotropic fits are chained, starting from the unit cosine
+		std::vector<LTC> normalIncidence( N );
+		LTC ltc;
+		for ( int a = N - 1; a >= 0; --a )
+		{
+			FitCellLTC( desc, a, 0, ltc, out.amplitude[a] );
+			normalIncidence[a] = ltc;
+			out.matrix[a] = PackInverse( ltc );
+		}
+
+		// each column walks up to grazing angles from its theta = 0 cell
+		Parallel::For( N, [&]( u32 a, u32 )
+		{
+			LTC columnLTC = normalIncidence[a];
+			for ( u32 t = 1; t < N; ++t )
+			{
+				FitCellLTC( desc, a, t, columnLTC, out.amplitude[t * N + a] );
+				out.matrix[t * N + a] = PackInverse( columnLTC );
+			}
+		} );
+	}
+
+	// DDS header constants, see render_internal/texture.inl
+	static const u32 DDSFlags = 0x1 | 0x2 | 0x4 | 0x8 | 0x1000;	// caps, height, width, pitch, pixelformat
+	static const u32 DDSFourCC = 0x4;
+	static const u32 DDSDX10 = 0x30315844;							// 'DX10'
+	static const u32 DDSTextureCaps = 0x1000;
+	static const u32 DXGIFloatFormats[4] = { 41, 16, 6, 2 };		// R32, RG32, RGB32, RGBA32 _FLOAT
+
+	bool WriteDDS( const std::string &filePath, u32 width, u32 height, u32 channelCount, const f32 *texels )
+	{
+		Assert( channelCount >= 1 && channelCount <= 4 );
+
+		std::ofstream file( filePath, std::ios::out | std::ios::binary );
+		if ( !file )
+		{
+			LogErr( "Error opening file ", filePath, " for writing." );
+			return false;
+		}
+
+		u32 header[31] = { 0 };
+		header[0] = sizeof( header );
+		header[1] = DDSFlags;
+		header[2] = height;
+		header[3] = width;
+		header[4] = width * channelCount * sizeof( f32 );	// pitch
+		header[5] = 1;										// depth
+		header[6] = 1;										// mipmap count
+		header[18] = 32;									// pixel format size
+		header[19] = DDSFourCC;
+		header[20] = DDSDX10;
+		header[26] = DDSTextureCaps;
+
+		const u32 dx10[5] = { DXGIFloatFormats[channelCount - 1], 3 /* 2D */, 0, 1 /* array size */, 0 };
+
+		file.write( "DDS ", 4 );
+		file.write( (const char*) header, sizeof( header ) );
+		file.write( (const char*) dx10, sizeof( dx10 ) );
+		file.write( (const char*) texels, width * height * channelCount * sizeof( f32 ) );
+
+		return file.good();
+	}
+
+	bool WriteTables( const Table &table, const std::string &matrixPath, const std::string &amplitudePath )
+	{
+		return WriteDDS( matrixPath, table.size, table.size, 4, &table.matrix[0].x ) &&
+			   WriteDDS( amplitudePath, table.size, table.size, 2, &table.amplitude[0].x );
+	}
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+#include "common/common.h"
+
+/// Offline fitting of the Linearly Transformed Cosines tables [Heitz16] used by the area light shaders
+/// (data/ltc_mat.dds & data/ltc_amp.dds). The tables are parameterized like LTC_Coords : columns go
+/// from roughness 0 to 1, rows from theta_v = 0 to pi/2.
+namespace LTCFit
+{
+	enum BRDFType
+	{
+		BRDF_GGX,		//!< BRDF::GGX, with alpha = roughness^2
+		BRDF_BURLEY		//!< BRDF::DiffuseBurley
+	};
+
+	struct Desc
+	{
+		Desc() : lutSize( 32 ), brdf( BRDF_GGX ), sampleCount( 32 ), maxIterations( 100 ) {}
+
+		u32 lutSize;		//!< Side of the tables
+		BRDFType brdf;
+		u32 sampleCount;	//!< The fitting error is integrated with 2 * sampleCount^2 samples
+		u32 maxIterations;	//!< Nelder-Mead iterations per table cell
+	};
+
+	struct Table
+	{
+		u32 size;
+		std::vector<vec4f> matrix;		//!< Inverse LTC matrix terms, as read by BRDF::LTC_Matrix. size * size, row-major
+		std::vector<vec2f> amplitude;	//!< BRDF albedo and its Schlick Fresnel part (x * F0 + y * (1 - F0))
+
+		Table() : size( 0 ) {}
+	};
+
+	/// Fits every cell of the tables. Each cell starts from the fit of its neighbour : the theta = 0 row
+	/// from rough to smooth first, where lobes are isotropic, then every roughness column from that
+	/// row up to grazing angles. Columns are fitted in parallel (see Parallel::For).
+	void Fit( const Desc &desc, Table &out );
+
+	/// Writes a width * height image of 1 to 4 float channels as a DX10 DDS, as loaded by Render::Texture.
+	bool WriteDDS( const std::string &filePath, u32 width, u32 height, u32 channelCount, const f32 *texels );
+
+	/// Writes out.matrix & out.amplitude to matrixPath & amplitudePath
+	bool WriteTables( const Table &table, const std::string &matrixPath, const std::string &amplitudePath );
+}
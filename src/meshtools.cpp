@@ -0,0 +1,733 @@
+#include "meshtools.h"
+#include "common/parallel.h"
+#include "common/simd.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace MeshTools
+{
+	/// Vertices per task of the per-vertex passes
+	static const u32 VertexBlock = 4096;
+
+	void VertexStreams::Resize( u32 count )
+	{
+		std::vector<f32> *streams[] = { &px, &py, &pz, &nx, &ny, &nz, &u, &v, &tx, &ty, &tz, &bx, &by, &bz };
+		for ( std::vector<f32> *s : streams )
+			s->resize( count );
+	}
+
+	void VertexStreams::FromArrays( u32 count, const vec3f *pos, const vec3f *nrm, const vec2f *uv )
+	{
+		Resize( count );
+		for ( u32 i = 0; i < count; ++i )
+		{
+			if ( pos ) px[i] = pos[i].x, py[i] = pos[i].y, pz[i] = pos[i].z;
+			if ( nrm ) nx[i] = nrm[i].x, ny[i] = nrm[i].y, nz[i] = nrm[i].z;
+			if ( uv ) u[i] = uv[i].x, v[i] = uv[i].y;
+		}
+	}
+
+	void VertexStreams::ToArrays( vec3f *pos, vec3f *nrm, vec2f *uv, vec3f *tan, vec3f *bit ) const
+	{
+		const u32 count = Count();
+		for ( u32 i = 0; i < count; ++i )
+		{
+			if ( pos ) pos[i] = vec3f( px[i], py[i], pz[i] );
+			if ( nrm ) nrm[i] = vec3f( nx[i], ny[i], nz[i] );
+			if ( uv ) uv[i] = vec2f( u[i], v[i] );
+			if ( tan ) tan[i] = vec3f( tx[i], ty[i], tz[i] );
+			if ( bit ) bit[i] = vec3f( bx[i], by[i], bz[i] );
+		}
+	}
+
+	/// Bits of f, with -0 folded on +0 so that equal floats hash the same
+	static u32 FloatBits( f32 f )
+	{
+		f += 0.f;
+		u32 bits;
+		std::memcpy( &bits, &f, sizeof( bits ) );
+		return bits;
+	}
+
+	static u64 VertexHash( const VertexStreams &vs, u32 i )
+	{
+		const f32 attribs[8] = { vs.px[i], vs.py[i], vs.pz[i], vs.nx[i], vs.ny[i], vs.nz[i], vs.u[i], vs.v[i] };
+
+		// FNV-1a over the 8 words
+		u64 h = 14695981039346656037ull;
+		for ( u32 k = 0; k < 8; ++k )
+			h = ( h ^ FloatBits( attribs[k] ) ) * 1099511628211ull;
+		return h ^ ( h >> 29 );
+	}
+
+	static bool SameVertex( const VertexStreams &vs, u32 a, u32 b )
+	{
+		return vs.px[a] == vs.px[b] && vs.py[a] == vs.py[b] && vs.pz[a] == vs.pz[b] &&
+			   vs.nx[a] == vs.nx[b] && vs.ny[a] == vs.ny[b] && vs.nz[a] == vs.nz[b] &&
+			   vs.u[a] == vs.u[b] && vs.v[a] == vs.v[b];
+	}
+
+	/// Keeps the elements src[i] of every full-size stream, in that order
+	static void GatherStreams( VertexStreams &vs, u32 oldCount, const std::vector<u32> &src )
+	{
+		std::vector<f32> *streams[] = { &vs.px, &vs.py, &vs.pz, &vs.nx, &vs.ny, &vs.nz, &vs.u, &vs.v,
+										&vs.tx, &vs.ty, &vs.tz, &vs.bx, &vs.by, &vs.bz };
+		std::vector<f32> tmp( src.size() );
+
+		for ( std::vector<f32> *s : streams )
+		{
+			if ( s->size() != oldCount )
+				continue;
+
+			for ( size_t i = 0; i < src.size(); ++i )
+				tmp[i] = ( *s )[src[i]];
+			s->assign( tmp.begin(), tmp.end() );
+		}
+	}
+
+	static void RemapIndices( std::vector<u32> &indices, const std::vector<u32> &remap )
+	{
+		const u32 count = (u32) indices.size();
+		Parallel::For( ( count + VertexBlock - 1 ) / VertexBlock, [&]( u32 block, u32 )
+		{
+			const u32 end = std::min( ( block + 1 ) * VertexBlock, count );
+			for ( u32 i = block * VertexBlock; i < end; ++i )
+				indices[i] = remap[indices[i]];
+		} );
+	}
+
+	u32 WeldVertices( VertexStreams &vs, std::vector<u32> &indices )
+	{
+		const u32 count = vs.Count();
+		if ( !count )
+			return 0;
+
+		std::vector<u64> hashes( count );
+		Parallel::For( ( count + VertexBlock - 1 ) / VertexBlock, [&]( u32 block, u32 )
+		{
+			const u32 end = std::min( ( block + 1 ) * VertexBlock, count );
+			for ( u32 i = block * VertexBlock; i < end; ++i )
+				hashes[i] = VertexHash( vs, i );
+		} );
+
+		// Open addressing, linear probing, at most half full
+		u32 tableSize = 1;
+		while ( tableSize < 2 * count )
+			tableSize <<= 1;
+
+		std::vector<u32> table( tableSize, ~0u );
+		std::vector<u32> remap( count ), kept;
+		kept.reserve( count );
+
+		for ( u32 i = 0; i < count; ++i )
+		{
+			u32 slot = (u32) hashes[i] & ( tableSize - 1 );
+			for ( ;; )
+			{
+				const u32 w = table[slot];
+				if ( w == ~0u )
+				{
+					table[slot] = remap[i] = (u32) kept.size();
+					kept.push_back( i );
+					break;
+				}
+
+				const u32 other = kept[w];
+				if ( hashes[other] == hashes[i] && SameVertex( vs, other, i ) )
+				{
+					remap[i] = w;
+					break;
+				}
+
+				slot = ( slot + 1 ) & ( tableSize - 1 );
+			}
+		}
+
+		if ( kept.size() < count )
+		{
+			GatherStreams( vs, count, kept );
+			RemapIndices( indices, remap );
+		}
+
+		return (u32) kept.size();
+	}
+
+	/// UV gradient dP/du of triangle t, scaled by the inverse UV determinant [Lengyel01]. Returns the sign of the
+	/// determinant, 0 for degenerate UVs
+	static FORCEINLINE f32 TriangleTangent( const VertexStreams &vs, const u32 *tri, f32 &tx, f32 &ty, f32 &tz )
+	{
+		const u32 i1 = tri[0], i2 = tri[1], i3 = tri[2];
+
+		const f32 e1x = vs.px[i2] - vs.px[i1], e1y = vs.py[i2] - vs.py[i1], e1z = vs.pz[i2] - vs.pz[i1];
+		const f32 e2x = vs.px[i3] - vs.px[i1], e2y = vs.py[i3] - vs.py[i1], e2z = vs.pz[i3] - vs.pz[i1];
+		const f32 s1 = vs.u[i2] - vs.u[i1], t1 = vs.v[i2] - vs.v[i1];
+		const f32 s2 = vs.u[i3] - vs.u[i1], t2 = vs.v[i3] - vs.v[i1];
+
+		const f32 det = s1 * t2 - s2 * t1;
+		if ( std::fabs( det ) < 1e-20f || !std::isfinite( det ) )
+		{
+			tx = ty = tz = 0.f;
+			return 0.f;
+		}
+
+		const f32 r = 1.f / det;
+		tx = ( e1x * t2 - e2x * t1 ) * r;
+		ty = ( e1y * t2 - e2y * t1 ) * r;
+		tz = ( e1z * t2 - e2z * t1 ) * r;
+		return det > 0.f ? 1.f : -1.f;
+	}
+
+	/// Gives the triangles of negative handedness their own copy of the vertices they share with positive ones
+	static void SplitMirroredVertices( VertexStreams &vs, std::vector<u32> &indices )
+	{
+		const u32 count = vs.Count();
+		const u32 triCount = (u32) indices.size() / 3;
+
+		std::vector<f32> signs( triCount );
+		Parallel::For( ( triCount + VertexBlock - 1 ) / VertexBlock, [&]( u32 block, u32 )
+		{
+			const u32 end = std::min( ( block + 1 ) * VertexBlock, triCount );
+			f32 tx, ty, tz;
+			for ( u32 t = block * VertexBlock; t < end; ++t )
+				signs[t] = TriangleTangent( vs, &indices[t * 3], tx, ty, tz );
+		} );
+
+		// bit 0 : used by a positive triangle, bit 1 : by a negative one
+		std::vector<u8> usage( count, 0 );
+		for ( u32 t = 0; t < triCount; ++t )
+		{
+			const u8 bit = signs[t] < 0.f ? 2 : ( signs[t] > 0.f ? 1 : 0 );
+			for ( u32 k = 0; k < 3; ++k )
+				usage[indices[t * 3 + k]] |= bit;
+		}
+
+		std::vector<u32> src( count ), duplicate( count, ~0u );
+		for ( u32 i = 0; i < count; ++i )
+		{
+			src[i] = i;
+			if ( usage[i] == 3 )
+			{
+				duplicate[i] = (u32) src.size();
+				src.push_back( i );
+			}
+		}
+
+		if ( src.size() == count )
+			return;
+
+		for ( u32 t = 0; t < triCount; ++t )
+		{
+			if ( signs[t] >= 0.f )
+				continue;
+
+			for ( u32 k = 0; k < 3; ++k )
+			{
+				u32 &idx = indices[t * 3 + k];
+				if ( duplicate[idx] != ~0u )
+					idx = duplicate[idx];
+			}
+		}
+
+		GatherStreams( vs, count, src );
+	}
+
+	/// Orthonormal frame of Width vertices starting at i : tangent & handedness accumulated in vs.t* & hand
+	static FORCEINLINE void OrthonormalizeLanes( VertexStreams &vs, const f32 *hand, u32 i )
+	{
+		const simdf zero = simdf::Zero(), one( 1.f );
+
+		simdf nx = simdf::Load( &vs.nx[i] ), ny = simdf::Load( &vs.ny[i] ), nz = simdf::Load( &vs.nz[i] );
+		const simdf nLen2 = MulAdd( nx, nx, MulAdd( ny, ny, nz * nz ) );
+		const simdf nInv = Select( CmpLt( zero, nLen2 ), one / Sqrt( nLen2 ), zero );
+		nx *= nInv; ny *= nInv; nz *= nInv;
+
+		// Gram-Schmidt
+		simdf tx = simdf::Load( &vs.tx[i] ), ty = simdf::Load( &vs.ty[i] ), tz = simdf::Load( &vs.tz[i] );
+		simdf d = MulAdd( nx, tx, MulAdd( ny, ty, nz * tz ) );
+		tx = tx - nx * d; ty = ty - ny * d; tz = tz - nz * d;
+		const simdf tLen2 = MulAdd( tx, tx, MulAdd( ty, ty, tz * tz ) );
+
+		// No usable UV gradient : any unit vector orthogonal to n, from x or y
+		const simdf useX = CmpLt( Abs( nx ), simdf( 0.9f ) );
+		const simdf ax = Select( useX, one, zero ), ay = Select( useX, zero, one );
+		d = MulAdd( nx, ax, ny * ay );
+		const simdf fx = ax - nx * d, fy = ay - ny * d, fz = -( nz * d );
+		const simdf fInv = one / Sqrt( MulAdd( fx, fx, MulAdd( fy, fy, fz * fz ) ) );
+
+		const simdf valid = CmpLt( simdf( 1e-30f ), tLen2 );
+		const simdf tInv = one / Sqrt( Max( tLen2, simdf( 1e-30f ) ) );
+		tx = Select( valid, tx * tInv, fx * fInv );
+		ty = Select( valid, ty * tInv, fy * fInv );
+		tz = Select( valid, tz * tInv, fz * fInv );
+
+		const simdf h = Select( CmpLt( simdf::Load( hand + i ), zero ), -one, one );
+		( ( ny * tz - nz * ty ) * h ).Store( &vs.bx[i] );
+		( ( nz * tx - nx * tz ) * h ).Store( &vs.by[i] );
+		( ( nx * ty - ny * tx ) * h ).Store( &vs.bz[i] );
+
+		( -tx ).Store( &vs.tx[i] );
+		( -ty ).Store( &vs.ty[i] );
+		( -tz ).Store( &vs.tz[i] );
+	}
+
+	bool GenerateTangents( VertexStreams &vs, std::vector<u32> &indices, const TangentOptions &opts )
+	{
+		const u32 inCount = vs.Count();
+		if ( indices.size() % 3 || vs.nx.size() != inCount || vs.u.size() != inCount || vs.v.size() != inCount )
+		{
+			LogErr( "Tangent generation needs positions, normals, texcoords and a triangle list." );
+			return false;
+		}
+
+		if ( opts.weld )
+			WeldVertices( vs, indices );
+		if ( opts.splitMirrored )
+			SplitMirroredVertices( vs, indices );
+
+		const u32 count = vs.Count();
+		const u32 triCount = (u32) indices.size() / 3;
+		vs.Resize( count );
+
+		// One triangle range per thread, scattering into a buffer spanning [lo, hi] of the vertices it references
+		// 4 floats per vertex : tangent & handedness
+		const u32 rangeCount = std::max( 1u, std::min( Parallel::ThreadCount(), triCount ) );
+		std::vector<std::vector<f32>> scatter( rangeCount );
+		std::vector<u32> lo( rangeCount, 0 ), hi( rangeCount, 0 );
+
+		Parallel::For( rangeCount, [&]( u32 r, u32 )
+		{
+			const u32 begin = (u32) ( (u64) triCount * r / rangeCount );
+			const u32 end = (u32) ( (u64) triCount * ( r + 1 ) / rangeCount );
+			if ( begin == end )
+				return;
+
+			const u32 *first = &indices[begin * 3], *last = &indices[0] + end * 3;
+			lo[r] = *std::min_element( first, last );
+			hi[r] = *std::max_element( first, last );
+
+			std::vector<f32> &buf = scatter[r];
+			buf.assign( 4 * (size_t) ( hi[r] - lo[r] + 1 ), 0.f );
+
+			for ( u32 t = begin; t < end; ++t )
+			{
+				const u32 *tri = &indices[t * 3];
+				f32 tx, ty, tz;
+				const f32 sign = TriangleTangent( vs, tri, tx, ty, tz );
+
+				for ( u32 k = 0; k < 3; ++k )
+				{
+					f32 *acc = &buf[4 * (size_t) ( tri[k] - lo[r] )];
+					acc[0] += tx;
+					acc[1] += ty;
+					acc[2] += tz;
+					acc[3] += sign;
+				}
+			}
+		} );
+
+		// Gather the ranges & orthonormalize, vertex blocks in parallel
+		std::vector<f32> hand( count );
+		const u32 W = simdf::Width;
+
+		Parallel::For( ( count + VertexBlock - 1 ) / VertexBlock, [&]( u32 block, u32 )
+		{
+			const u32 begin = block * VertexBlock;
+			const u32 end = std::min( begin + VertexBlock, count );
+
+			std::fill( &vs.tx[0] + begin, &vs.tx[0] + end, 0.f );
+			std::fill( &vs.ty[0] + begin, &vs.ty[0] + end, 0.f );
+			std::fill( &vs.tz[0] + begin, &vs.tz[0] + end, 0.f );
+			std::fill( &hand[0] + begin, &hand[0] + end, 0.f );
+
+			for ( u32 r = 0; r < rangeCount; ++r )
+			{
+				if ( scatter[r].empty() )
+					continue;
+
+				const u32 b = std::max( begin, lo[r] ), e = std::min( end, hi[r] + 1 );
+				for ( u32 i = b; i < e; ++i )
+				{
+					const f32 *acc = &scatter[r][4 * (size_t) ( i - lo[r] )];
+					vs.tx[i] += acc[0];
+					vs.ty[i] += acc[1];
+					vs.tz[i] += acc[2];
+					hand[i] += acc[3];
+				}
+			}
+
+			u32 i = begin;
+			for ( ; i + W <= end; i += W )
+				OrthonormalizeLanes( vs, &hand[0], i );
+
+			// Tail, through a padded copy
+			if ( i < end )
+			{
+				VertexStreams tail;
+				tail.Resize( W );
+				f32 tailHand[RADAR_SIMD_WIDTH] = {};
+				for ( u32 k = 0; k < W; ++k )
+				{
+					const u32 j = std::min( i + k, end - 1 );
+					tail.nx[k] = vs.nx[j]; tail.ny[k] = vs.ny[j]; tail.nz[k] = vs.nz[j];
+					tail.tx[k] = vs.tx[j]; tail.ty[k] = vs.ty[j]; tail.tz[k] = vs.tz[j];
+					tailHand[k] = hand[j];
+				}
+
+				OrthonormalizeLanes( tail, tailHand, 0 );
+
+				for ( u32 k = 0; i + k < end; ++k )
+				{
+					vs.tx[i + k] = tail.tx[k]; vs.ty[i + k] = tail.ty[k]; vs.tz[i + k] = tail.tz[k];
+					vs.bx[i + k] = tail.bx[k]; vs.by[i + k] = tail.by[k]; vs.bz[i + k] = tail.bz[k];
+				}
+			}
+		} );
+
+		return true;
+	}
+
+	/// Grows the sphere ( c, r ) to contain p, keeping the far side of the sphere fixed
+	static FORCEINLINE void GrowSphere( vec3f &c, f32 &r, const vec3f &p )
+	{
+		const vec3f d = p - c;
+		const f32 d2 = Dot( d, d );
+		if ( d2 <= r * r )
+			return;
+
+		const f32 len = std::sqrt( d2 );
+		const f32 newR = 0.5f * ( r + len );
+		c += d * ( ( newR - r ) / len );
+		r = newR;
+	}
+
+	/// Ritter sweep over the SoA points, block after block from block start. Lanes are only handled one by one
+	/// when one of them is outside the current sphere
+	static void RitterSweep( const std::vector<f32> &x, const std::vector<f32> &y, const std::vector<f32> &z,
+		u32 start, vec3f &c, f32 &r )
+	{
+		const u32 W = simdf::Width;
+		const u32 count = (u32) x.size();
+		const u32 groupCount = count / W;
+
+		simdf cx( c.x ), cy( c.y ), cz( c.z ), r2( r * r );
+		for ( u32 g = 0; g < groupCount; ++g )
+		{
+			const u32 i = ( ( g + start ) % groupCount ) * W;
+
+			const simdf dx = simdf::Load( &x[i] ) - cx, dy = simdf::Load( &y[i] ) - cy, dz = simdf::Load( &z[i] ) - cz;
+			const simdf d2 = MulAdd( dx, dx, MulAdd( dy, dy, dz * dz ) );
+			if ( !Any( CmpLt( r2, d2 ) ) )
+				continue;
+
+			for ( u32 k = 0; k < W; ++k )
+				GrowSphere( c, r, vec3f( x[i + k], y[i + k], z[i + k] ) );
+
+			cx = simdf( c.x ); cy = simdf( c.y ); cz = simdf( c.z ); r2 = simdf( r * r );
+		}
+	}
+
+	void ComputeBounds( const f32 *positions, u32 count, Bounds &bounds )
+	{
+		bounds = Bounds();
+		if ( !count )
+			return;
+
+		// SoA copy, padded to whole blocks with the last point
+		const u32 blockCount = ( count + VertexBlock - 1 ) / VertexBlock;
+		const u32 padded = blockCount * VertexBlock;
+		std::vector<f32> x( padded ), y( padded ), z( padded );
+		std::vector<vec3f> blockMin( blockCount ), blockMax( blockCount );
+
+		Parallel::For( blockCount, [&]( u32 block, u32 )
+		{
+			const u32 begin = block * VertexBlock, end = begin + VertexBlock;
+			for ( u32 i = begin; i < end; ++i )
+			{
+				const f32 *p = positions + 3 * std::min( i, count - 1 );
+				x[i] = p[0];
+				y[i] = p[1];
+				z[i] = p[2];
+			}
+
+			simdf minX = simdf::Load( &x[begin] ), minY = simdf::Load( &y[begin] ), minZ = simdf::Load( &z[begin] );
+			simdf maxX = minX, maxY = minY, maxZ = minZ;
+			for ( u32 i = begin + simdf::Width; i < end; i += simdf::Width )
+			{
+				const simdf px = simdf::Load( &x[i] ), py = simdf::Load( &y[i] ), pz = simdf::Load( &z[i] );
+				minX = Min( minX, px ); minY = Min( minY, py ); minZ = Min( minZ, pz );
+				maxX = Max( maxX, px ); maxY = Max( maxY, py ); maxZ = Max( maxZ, pz );
+			}
+
+			blockMin[block] = vec3f( ReduceMin( minX ), ReduceMin( minY ), ReduceMin( minZ ) );
+			blockMax[block] = vec3f( ReduceMax( maxX ), ReduceMax( maxY ), ReduceMax( maxZ ) );
+		} );
+
+		bounds.boxMin = blockMin[0];
+		bounds.boxMax = blockMax[0];
+		for ( u32 b = 1; b < blockCount; ++b )
+			for ( int a = 0; a < 3; ++a )
+			{
+				bounds.boxMin[a] = std::min( bounds.boxMin[a], blockMin[b][a] );
+				bounds.boxMax[a] = std::max( bounds.boxMax[a], blockMax[b][a] );
+			}
+
+		// The 6 box-extremal points, only scanning the first block holding each extremum
+		const std::vector<f32> *axes[3] = { &x, &y, &z };
+		vec3f extremes[6];
+		for ( int a = 0; a < 3; ++a )
+			for ( int side = 0; side < 2; ++side )
+			{
+				const f32 target = side ? bounds.boxMax[a] : bounds.boxMin[a];
+				const std::vector<vec3f> &blockExt = side ? blockMax : blockMin;
+
+				u32 b = 0;
+				while ( blockExt[b][a] != target )
+					++b;
+
+				u32 i = b * VertexBlock;
+				while ( ( *axes[a] )[i] != target )
+					++i;
+
+				extremes[a * 2 + side] = vec3f( x[i], y[i], z[i] );
+			}
+
+		// Ritter : start from the most distant pair, grow over every point
+		int pair = 0;
+		f32 pairDist = -1.f;
+		for ( int a = 0; a < 3; ++a )
+		{
+			const f32 d = Len( extremes[a * 2 + 1] - extremes[a * 2] );
+			if ( d > pairDist )
+				pairDist = d, pair = a;
+		}
+
+		vec3f c = ( extremes[pair * 2] + extremes[pair * 2 + 1] ) * 0.5f;
+		f32 r = 0.5f * pairDist;
+		RitterSweep( x, y, z, 0, c, r );
+
+		// Refinement : shrink and regrow from other starting blocks, keep the smallest
+		const u32 groupCount = padded / simdf::Width;
+		vec3f c2 = c;
+		f32 r2 = r;
+		for ( u32 k = 1; k <= 4; ++k )
+		{
+			r2 *= 0.95f;
+			RitterSweep( x, y, z, k * groupCount / 5, c2, r2 );
+			if ( r2 < r )
+				c = c2, r = r2;
+		}
+
+		// float safety, every point must be inside
+		bounds.center = c;
+		bounds.radius = r * ( 1.f + 1e-5f );
+	}
+
+	f32 ComputeACMR( const std::vector<u32> &indices, u32 vertexCount, u32 cacheSize )
+	{
+		const u32 triCount = (u32) indices.size() / 3;
+		if ( !triCount )
+			return 0.f;
+
+		// FIFO : a vertex is in the cache while less than cacheSize misses happened since it entered
+		std::vector<u32> entered( vertexCount, ~0u );
+		u32 misses = 0;
+
+		for ( u32 v : indices )
+		{
+			if ( entered[v] == ~0u || misses - entered[v] >= cacheSize )
+				entered[v] = misses++;
+		}
+
+		return misses / (f32) triCount;
+	}
+
+	void OptimizeVertexCache( std::vector<u32> &indices, u32 vertexCount, u32 cacheSize )
+	{
+		const u32 triCount = (u32) indices.size() / 3;
+		if ( !triCount )
+			return;
+
+		// Triangles around each vertex
+		std::vector<u32> offsets( vertexCount + 1, 0 ), adjacency( triCount * 3 );
+		for ( u32 v : indices )
+			++offsets[v + 1];
+		for ( u32 v = 0; v < vertexCount; ++v )
+			offsets[v + 1] += offsets[v];
+
+		std::vector<u32> fill( offsets.begin(), offsets.end() - 1 );
+		for ( u32 i = 0; i < triCount * 3; ++i )
+			adjacency[fill[indices[i]]++] = i / 3;
+
+		std::vector<u32> live( vertexCount );
+		for ( u32 v = 0; v < vertexCount; ++v )
+			live[v] = offsets[v + 1] - offsets[v];
+
+		std::vector<u32> cacheTime( vertexCount, 0 );
+		std::vector<u32> deadEnds, candidates;
+		std::vector<bool> emitted( triCount, false );
+		std::vector<u32> output;
+		output.reserve( triCount * 3 );
+
+		u32 time = cacheSize + 1;
+		u32 cursor = 0;
+
+		// Next fanning vertex when the current one has no triangle left
+		auto skipDeadEnd = [&]() -> int
+		{
+			while ( !deadEnds.empty() )
+			{
+				const u32 d = deadEnds.back();
+				deadEnds.pop_back();
+				if ( live[d] > 0 )
+					return (int) d;
+			}
+
+			for ( ; cursor < vertexCount; ++cursor )
+			{
+				if ( live[cursor] > 0 )
+					return (int) cursor;
+			}
+
+			return -1;
+		};
+
+		int fan = live[0] > 0 ? 0 : skipDeadEnd();
+		while ( fan >= 0 )
+		{
+			candidates.clear();
+
+			for ( u32 a = offsets[fan]; a < offsets[fan + 1]; ++a )
+			{
+				const u32 t = adjacency[a];
+				if ( emitted[t] )
+					continue;
+
+				for ( u32 k = 0; k < 3; ++k )
+				{
+					const u32 v = indices[t * 3 + k];
+					output.push_back( v );
+					deadEnds.push_back( v );
+					candidates.push_back( v );
+					--live[v];
+
+					if ( time - cacheTime[v] > cacheSize )
+						cacheTime[v] = time++;
+				}
+				emitted[t] = true;
+			}
+
+			// Candidate still in the cache after its remaining triangles are emitted, the oldest one first
+			int best = -1, bestPriority = -1;
+			for ( u32 v : candidates )
+			{
+				if ( !live[v] )
+					continue;
+
+				int priority = 0;
+				if ( time - cacheTime[v] + 2 * live[v] <= cacheSize )
+					priority = (int) ( time - cacheTime[v] );
+
+				if ( priority > bestPriority )
+				{
+					bestPriority = priority;
+					best = (int) v;
+				}
+			}
+
+			fan = best >= 0 ? best : skipDeadEnd();
+		}
+
+		indices.swap( output );
+	}
+
+	u32 OptimizeVertexFetch( VertexStreams &vs, std::vector<u32> &indices )
+	{
+		const u32 count = vs.Count();
+
+		std::vector<u32> remap( count, ~0u ), src;
+		src.reserve( count );
+
+		for ( u32 &v : indices )
+		{
+			if ( remap[v] == ~0u )
+			{
+				remap[v] = (u32) src.size();
+				src.push_back( v );
+			}
+			v = remap[v];
+		}
+
+		GatherStreams( vs, count, src );
+		return (u32) src.size();
+	}
+
+	u16 FloatToHalf( f32 f )
+	{
+		u32 bits;
+		std::memcpy( &bits, &f, sizeof( bits ) );
+
+		const u16 sign = (u16) ( ( bits >> 16 ) & 0x8000 );
+		const u32 absBits = bits & 0x7FFFFFFF;
+
+		if ( absBits >= 0x7F800000 )	// inf & NaN
+			return sign | 0x7C00 | ( absBits > 0x7F800000 ? 0x200 : 0 );
+		if ( absBits >= 0x477FF000 )	// rounds above 65504
+			return sign | 0x7C00;
+
+		if ( absBits < 0x38800000 )
+		{
+			// denormal half : the float's value in units of 2^-24
+			if ( absBits < 0x33000000 )
+				return sign;
+
+			const u32 mantissa = ( absBits & 0x007FFFFF ) | 0x00800000;
+			const u32 shift = 126 - ( absBits >> 23 );
+			const u32 shifted = mantissa >> shift;
+			const u32 rest = mantissa & ( ( 1u << shift ) - 1 );
+			const u32 half = 1u << ( shift - 1 );
+			return sign | (u16) ( shifted + ( rest > half || ( rest == half && ( shifted & 1 ) ) ) );
+		}
+
+		// normal : rebias the exponent, round the 13 dropped mantissa bits to nearest even
+		const u32 rebased = absBits - 0x38000000;
+		const u32 rounded = rebased + 0xFFF + ( ( rebased >> 13 ) & 1 );
+		return sign | (u16) ( rounded >> 13 );
+	}
+
+	f32 HalfToFloat( u16 h )
+	{
+		const u32 sign = (u32) ( h & 0x8000 ) << 16;
+		const u32 exponent = ( h >> 10 ) & 0x1F;
+		const u32 mantissa = h & 0x3FF;
+
+		u32 bits;
+		if ( exponent == 0x1F )
+			bits = sign | 0x7F800000 | ( mantissa << 13 );
+		else if ( exponent )
+			bits = sign | ( ( exponent + 112 ) << 23 ) | ( mantissa << 13 );
+		else
+		{
+			const f32 denormal = mantissa * 5.9604644775390625e-8f;	// 2^-24
+			std::memcpy( &bits, &denormal, sizeof( bits ) );
+			bits |= sign;
+		}
+
+		f32 f;
+		std::memcpy( &f, &bits, sizeof( f ) );
+		return f;
+	}
+
+	u32 PackSnorm1010102( const vec3f &v )
+	{
+		u32 packed = 0;
+		for ( int c = 0; c < 3; ++c )
+		{
+			const f32 x = std::min( std::max( v[c], -1.f ), 1.f );
+			const int q = (int) std::floor( x * 511.f + 0.5f );
+			packed |= ( (u32) q & 0x3FF ) << ( 10 * c );
+		}
+		return packed;
+	}
+}
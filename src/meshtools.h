@@ -0,0 +1,88 @@
+#pragma once
+
+#include "common/common.h"
+
+/// CPU side mesh processing, run at import time before the GL upload (Render::Mesh::Build).
+namespace MeshTools
+{
+	/// Vertex attributes in SoA form, one array per component. Positions, normals & texcoords are inputs,
+	/// tangents & bitangents are written by GenerateTangents.
+	struct VertexStreams
+	{
+		u32 Count() const { return (u32) px.size(); }
+
+		/// Resizes every stream
+		void Resize( u32 count );
+
+		/// AoS copies. Any pointer may be null
+		void FromArrays( u32 count, const vec3f *pos, const vec3f *nrm, const vec2f *uv );
+		void ToArrays( vec3f *pos, vec3f *nrm, vec2f *uv, vec3f *tan, vec3f *bit ) const;
+
+		std::vector<f32> px, py, pz;
+		std::vector<f32> nx, ny, nz;
+		std::vector<f32> u, v;
+		std::vector<f32> tx, ty, tz;
+		std::vector<f32> bx, by, bz;
+	};
+
+	/// Axis-aligned box & bounding sphere of a point set
+	struct Bounds
+	{
+		Bounds() : boxMin( 0.f ), boxMax( 0.f ), center( 0.f ), radius( 0.f ) {}
+
+		vec3f boxMin, boxMax;
+		vec3f center;
+		f32 radius;
+	};
+
+	/// Bounds of count points given as xyz triplets (AoS, as Render::Mesh::Desc::positions). The box comes from SIMD
+	/// min/max passes over vertex blocks, in parallel. The sphere is Ritter's, grown from the most distant pair of
+	/// box-extremal points, then refined by a few shrink & regrow sweeps [Ericson05, 4.3.4] : usually within a few
+	/// percent of the minimal sphere, where centroid + max distance can be far off on asymmetric meshes.
+	void ComputeBounds( const f32 *positions, u32 count, Bounds &bounds );
+
+	/// Default post-transform cache size of the vertex cache functions, FIFO entries
+	static const u32 VertexCacheSize = 16;
+
+	/// Average cache miss ratio : vertices transformed per triangle by a FIFO post-transform cache of cacheSize
+	/// entries. 3 is the worst case, 0.5 the ideal of a large regular grid.
+	f32 ComputeACMR( const std::vector<u32> &indices, u32 vertexCount, u32 cacheSize = VertexCacheSize );
+
+	/// Reorders the triangles for the post-transform vertex cache with Tipsify [Sander07] : fans around the
+	/// vertices still in the cache, in linear time. cacheSize should be the one of the target, a bit less is safer.
+	void OptimizeVertexCache( std::vector<u32> &indices, u32 vertexCount, u32 cacheSize = VertexCacheSize );
+
+	/// Reorders the vertices by first use in the index buffer, for pre-transform fetch locality, and remaps the
+	/// indices. Vertices no triangle uses are dropped. Returns the new vertex count.
+	u32 OptimizeVertexFetch( VertexStreams &vs, std::vector<u32> &indices );
+
+	/// IEEE 754 half of f, rounded to nearest even. Out of range values give infinities, NaN stays NaN
+	u16 FloatToHalf( f32 f );
+	f32 HalfToFloat( u16 h );
+
+	/// Signed normalized 10:10:10:2 (GL_INT_2_10_10_10_REV) of v, components clamped to [-1, 1]. w is 0
+	u32 PackSnorm1010102( const vec3f &v );
+
+	struct TangentOptions
+	{
+		TangentOptions() : weld( true ), splitMirrored( true ) {}
+
+		bool weld;			//!< Run WeldVertices first, so that triangles sharing a corner share its tangent
+		bool splitMirrored;	//!< Duplicate the vertices shared by triangles of opposite UV handedness (mirrored UVs)
+	};
+
+	/// Merges the vertices having the same position, normal & texcoords, and remaps indices accordingly
+	/// (assimp's JoinIdenticalVertices). The kept vertices stay in their original order. Returns the new vertex count.
+	/// The three input streams must be filled.
+	u32 WeldVertices( VertexStreams &vs, std::vector<u32> &indices );
+
+	/// Per-vertex tangent frames [Lengyel01] : the UV gradients of the triangles around each vertex are
+	/// accumulated, then orthonormalized against the normal. The handedness is the one of the UV mapping relative
+	/// to the triangle winding, so the bitangent is cross( n, t ) times +-1. The tangent written is -dP/du, the
+	/// convention of the mesh shaders.
+	/// Triangles are split in one contiguous range per thread, each range scattering in its own buffer covering
+	/// the vertex span it references; a parallel pass over the vertices then sums the buffers and orthonormalizes,
+	/// simdf::Width vertices at a time.
+	/// weld & splitMirrored may change the vertex count and the indices. Returns false if the streams are incomplete.
+	bool GenerateTangents( VertexStreams &vs, std::vector<u32> &indices, const TangentOptions &opts = TangentOptions() );
+}
@@ -1,4 +1,6 @@
 #include "scene.h"
+#include "device.h"
+#include "meshtools.h"
 
 #include <assimp/Importer.hpp>
 #include <assimp/scene.h>
@@ -202,55 +204,76 @@ bool _ProcessAssimpMesh( Scene *gameScene, ModelResource::Data &model, aiMesh *m
 		return false;
 	}
 
-	vec3f *vp = new vec3f[vertices_n];
-	vec3f *vn = new vec3f[vertices_n];
-	vec3f *vtan = new vec3f[vertices_n];
-	vec3f *vbit = new vec3f[vertices_n];
-	vec2f *vt = new vec2f[vertices_n];
-	u32 *idx = new u32[indices_n];
+	std::vector<u32> idx( indices_n );
+	for ( u32 i = 0; i < faces_n; ++i )
+	{
+		aiFace &face = mesh->mFaces[i];
+		for ( u32 j = 0; j < 3; ++j )
+		{
+			idx[i * 3 + j] = face.mIndices[j];
+		}
+	}
+
+	// SoA import. Without tangents in the file, generate them on welded vertices, mirrored UVs split
+	MeshTools::VertexStreams vs;
+	vs.Resize( vertices_n );
 
 	for ( u32 i = 0; i < vertices_n; ++i )
 	{
-		vp[i] = aiVector3D_To_vec3f( mesh->mVertices[i] );
-		vn[i] = aiVector3D_To_vec3f( mesh->mNormals[i] );
+		const aiVector3D &p = mesh->mVertices[i], &n = mesh->mNormals[i];
+		vs.px[i] = p.x; vs.py[i] = p.y; vs.pz[i] = p.z;
+		vs.nx[i] = n.x; vs.ny[i] = n.y; vs.nz[i] = n.z;
 
 		if ( mesh->mTextureCoords[0] )
 		{
-			vt[i] = aiVector3D_To_vec2f( mesh->mTextureCoords[0][i] );
+			vs.u[i] = mesh->mTextureCoords[0][i].x;
+			vs.v[i] = mesh->mTextureCoords[0][i].y;
 		}
 		if ( hasTangents )
 		{
-			vtan[i] = aiVector3D_To_vec3f( mesh->mTangents[i] );
-			vbit[i] = aiVector3D_To_vec3f( mesh->mBitangents[i] );
+			vs.tx[i] = mesh->mTangents[i].x; vs.ty[i] = mesh->mTangents[i].y; vs.tz[i] = mesh->mTangents[i].z;
+			vs.bx[i] = mesh->mBitangents[i].x; vs.by[i] = mesh->mBitangents[i].y; vs.bz[i] = mesh->mBitangents[i].z;
 		}
 	}
 
-	for ( u32 i = 0; i < faces_n; ++i )
+	if ( !hasTangents && mesh->mTextureCoords[0] )
+		hasTangents = MeshTools::GenerateTangents( vs, idx );
+
+	// Triangle order for the post-transform cache, then vertex order for fetch locality
+	if ( GetDevice().GetConfig().optimizeMeshes )
 	{
-		aiFace &face = mesh->mFaces[i];
-		for ( u32 j = 0; j < 3; ++j )
-		{
-			idx[i * 3 + j] = face.mIndices[j];
-		}
+		const f32 acmr = MeshTools::ComputeACMR( idx, vs.Count() );
+		MeshTools::OptimizeVertexCache( idx, vs.Count() );
+		MeshTools::OptimizeVertexFetch( vs, idx );
+
+		LogInfo( "Submesh ", model.numSubMeshes, " of ", model.resourceName, " : ACMR ", acmr, " -> ",
+			MeshTools::ComputeACMR( idx, vs.Count() ), " (", faces_n, " triangles)." );
 	}
 
+	vertices_n = vs.Count();
+	std::vector<vec3f> vp( vertices_n ), vn( vertices_n ), vtan( vertices_n ), vbit( vertices_n );
+	std::vector<vec2f> vt( vertices_n );
+	vs.ToArrays( &vp[0], &vn[0], &vt[0], &vtan[0], &vbit[0] );
+
 	f32 *tan_ptr = nullptr, *bit_ptr = nullptr;
 
 	if ( hasTangents )
 	{
-		tan_ptr = (f32*) vtan;
-		bit_ptr = (f32*) vbit;
+		tan_ptr = (f32*) &vtan[0];
+		bit_ptr = (f32*) &vbit[0];
 	}
 
 	std::stringstream ss;
 	ss << model.resourceName << model.numSubMeshes;
 
-	Render::Mesh::Desc mesh_desc( ss.str(), false, indices_n, idx, vertices_n, (f32*) vp, (f32*) vn, (f32*) vt, tan_ptr, bit_ptr );
+	Render::Mesh::Desc mesh_desc( ss.str(), false, indices_n, &idx[0], vertices_n, (f32*) &vp[0], (f32*) &vn[0], (f32*) &vt[0], tan_ptr, bit_ptr );
+	if ( GetDevice().GetConfig().compactVertices )
+		mesh_desc.layout = Render::Mesh::Layout::Compact();
+
 	Render::Mesh::Handle mesh_h = Render::Mesh::Build( mesh_desc );
 	if ( mesh_h < 0 )
 	{
 		LogErr( "Error creating subMesh." );
-		delete[] vp; delete[] vn; delete[] vtan; delete[] vbit; delete[] vt; delete[] idx;
 		return false;
 	}
 
@@ -259,6 +282,5 @@ bool _ProcessAssimpMesh( Scene *gameScene, ModelResource::Data &model, aiMesh *m
 	// Index the used material/texture
 	model.materialIdx.push_back( mesh->mMaterialIndex );
 
-	delete[] vp; delete[] vn; delete[] vtan; delete[] vbit; delete[] vt; delete[] idx;
 	return true;
 }
\ No newline at end of file
@@ -1,10 +1,14 @@
 #include "render.h"
 #include "device.h"
+#include "meshtools.h"
+#include "groundtruth.h"
 #include "common/resource.h"
 #include "common/SHEval.h"
+#include "common/parallel.h"
 #include "json/cJSON.h"
 
 #include <algorithm>
+#include <cstring>
 #include <ft2build.h>
 #include FT_FREETYPE_H
 
@@ -44,6 +48,7 @@ namespace Render
 		std::vector<Texture::_internal::Data> textures;
 		std::vector<Font::_internal::Data> fonts;
 		std::vector<SpriteSheet::_internal::Data> spritesheets;
+		std::vector<Mesh::_internal::SHVisualization> shvisualizations;
 
 
 		std::vector<Shader::Handle> shaders_proj3d; //!< list of shaders using 3D projection matrix
@@ -87,6 +92,7 @@ namespace Render
 		renderer->textures.clear();
 		renderer->fonts.clear();
 		renderer->spritesheets.clear();
+		renderer->shvisualizations.clear();
 	}
 
 	bool Init()
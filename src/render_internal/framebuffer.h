@@ -37,6 +37,13 @@ namespace Render
 		/// General GBuffer query. Query only 1 texel value of the idx attachment.
 		vec4f ReadGBuffer( GBufferAttachment idx, int x, int y );
 
+		/// Reads back the whole idx attachment as RGB floats, row-major with the top row first (see GroundTruth::GBufferDump).
+		/// Returns the attachment size.
+		vec2i ReadGBuffer( GBufferAttachment idx, std::vector<vec3f> &texels );
+
+		/// Writes the Normal & World Position attachments to a GroundTruth::GBufferDump file, for bin/radar_groundtruth
+		bool DumpGBuffer( const std::string &filePath );
+
 		/// GBuffer picking : returns the object ID & Vertex ID under the given position (x,y)
 		vec2i ReadVertexID( int x, int y );
 
@@ -165,5 +165,40 @@ namespace Render
 
 			return data;
 		}
+
+		vec2i ReadGBuffer( GBufferAttachment idx, std::vector<vec3f> &texels )
+		{
+			Device &d = GetDevice();
+			const vec2i &ws = d.windowSize;
+
+			_internal::Data &fbo = renderer->fbos[0];
+			glBindFramebuffer( GL_READ_FRAMEBUFFER, fbo.framebuffer );
+			glReadBuffer( (GLenum) GL_COLOR_ATTACHMENT0 + idx );
+
+			std::vector<vec3f> rows( ws.x * ws.y );
+			glReadPixels( 0, 0, ws.x, ws.y, GL_RGB, GL_FLOAT, (void*) &rows[0] );
+
+			glReadBuffer( GL_NONE );
+			glBindFramebuffer( GL_READ_FRAMEBUFFER, 0 );
+
+			// GL rows are bottom-up
+			texels.resize( ws.x * ws.y );
+			for ( int y = 0; y < ws.y; ++y )
+				std::copy( &rows[( ws.y - 1 - y ) * ws.x], &rows[( ws.y - y ) * ws.x], &texels[y * ws.x] );
+
+			return ws;
+		}
+
+		bool DumpGBuffer( const std::string &filePath )
+		{
+			GroundTruth::GBufferDump dump;
+
+			const vec2i size = ReadGBuffer( GBufferAttachment::NORMAL, dump.normal );
+			ReadGBuffer( GBufferAttachment::WORLDPOS, dump.position );
+			dump.width = (u32) size.x;
+			dump.height = (u32) size.y;
+
+			return dump.Save( filePath );
+		}
 	}
 }
\ No newline at end of file
@@ -110,6 +110,29 @@ namespace Render
 		};
 
 
+		/// Storage of the vertex attributes of a mesh, selected at Build. The default is the historic one : one f32
+		/// buffer per attribute & 32 bits indices. Compressed attributes are decoded by the vertex fetch (normalized
+		/// integers, half floats), the shaders see the same inputs.
+		struct Layout
+		{
+			Layout() : interleaved( false ), packedNormals( false ), halfTexcoords( false ), packedColors( false ),
+				shortIndices( false ) {}
+
+			/// Every option on : 28 bytes per position/normal/uv/tangent/binormal vertex instead of 56
+			static Layout Compact()
+			{
+				Layout l;
+				l.interleaved = l.packedNormals = l.halfTexcoords = l.packedColors = l.shortIndices = true;
+				return l;
+			}
+
+			bool interleaved;	//!< A single buffer holds attributes 0 to 5, side by side. No UpdateSHVisualization then
+			bool packedNormals;	//!< Normals, tangents & binormals as signed normalized 10:10:10:2 (4 bytes instead of 12)
+			bool halfTexcoords;	//!< Texcoords as half floats (4 bytes instead of 8)
+			bool packedColors;	//!< Colors as normalized RGBA8 (4 bytes instead of 16)
+			bool shortIndices;	//!< 16 bits indices when vertices_n <= 65536
+		};
+
 		/// Mesh Description
 		/// param vertices_n : number of vertices the mesh has.    
 		/// @param positions : array of vertex positions.          
@@ -124,7 +147,7 @@ namespace Render
 				name( resource_name ), empty_mesh( empty_mesh ), vertices_n( vcount ), indices_n( icount ),
 				indices( idx_arr ), positions( pos_arr ), normals( normal_arr ), texcoords( texcoord_arr ),
 				tangents( tangent_arr ), bitangents( bitangent_arr ), colors( col_arr ), additional(nullptr),
-				additional_elt(0), additional_fmt(0), additional_n(1)
+				additional_elt(0), additional_fmt(0), additional_n(1), dynamic( false )
 			{}
 
 			void SetAdditionalData(f32 *arr, u32 format, int elements, int instances);
@@ -149,6 +172,9 @@ namespace Render
 			int additional_elt;	//!< nb of elements for above
 			u32 additional_fmt;	//!< format type for above
 			int additional_n;   //!< nb of instances for instancing 
+
+			bool dynamic;		//!< positions & normals are rewritten often (GL_DYNAMIC_DRAW)
+			Layout layout;		//!< Vertex & index storage
 		};
 
 		/// Mesh Handle.
@@ -168,8 +194,15 @@ namespace Render
 
 		/// Build a SH visualization mesh
 		/// @param shNormalization : put to true if the sh visualization should be normalized by DC
+		/// If meshName is already a SH visualization of the same resolution, it is updated in place and returned.
 		Handle BuildSHVisualization( const float *shCoeffs, const u32 bandN, const std::string &meshName, bool shNormalization, const u32 numPhi = 48, const u32 numTheta = 96 );
 
+		/// Recomputes the lobe of a SH visualization mesh for new coefficients, without any GL allocation :
+		/// topology and buffers are kept, positions & normals are evaluated in parallel from the cached
+		/// SH basis of the vertex directions and uploaded to the existing VBOs. Cheap enough to run every frame.
+		/// @return : false if h is not a mesh built by BuildSHVisualization
+		bool UpdateSHVisualization( Handle h, const float *shCoeffs, const u32 bandN, bool shNormalization );
+
 		/// Deallocate GL data for the given mesh handle
 		void Destroy( Handle h );
 
@@ -181,6 +214,11 @@ namespace Render
 		bool Exists( Handle h );
 		bool Exists( const std::string &resourceName, Handle &h ); // returns the resource in h if it exists as a resource
 
+		/// Object space bounds of the mesh, computed when it is built or updated (see MeshTools::ComputeBounds).
+		/// @return : false if h is not a valid mesh
+		bool GetAABB( Handle h, vec3f &boxMin, vec3f &boxMax );
+		bool GetBoundingSphere( Handle h, vec3f &center, f32 &radius );
+
 		/// Renders the given mesh, binding it if not currently bound as GL Current VAO.
 		/// The given animation state is used to transmit bone-matrix data to the shader
 		/// before drawing the mesh. If NULL, an identity bonematrix is used
@@ -249,7 +287,7 @@ namespace Render
 			struct Data
 			{
 				Data() : vao( 0 ), vertices_n( 0 ), indices_n( 0 ), instances_n( 1 ),
-						 attrib_flags( MESH_POSITIONS ), center( 0 ), radius( 0 )
+						 attrib_flags( MESH_POSITIONS ), short_indices( false ), boxMin( 0 ), boxMax( 0 ), center( 0 ), radius( 0 )
 				{
 					vbo[0] = vbo[1] = vbo[2] = vbo[3] = vbo[4] = vbo[5] = vbo[6] = 0;
 					ibo = 0;
@@ -260,14 +298,17 @@ namespace Render
 				u32 vbo[7];             	//!< 0: positions, 1: normals, 2: texcoords,
 											//!< 3: tangent, 4: binormal, 5: colors
 											//!< 6: additional_1
+											//!< Interleaved layout : 0 holds attributes 0 to 5
 				u32 ibo;					//!< Element buffer
 
 				u32			vertices_n;     //!< Number of vertices the mesh has
 				u32			indices_n;		//!< Number of indices it has
 				u32 		instances_n;	//!< Number of instances for additional data
 				int 		attrib_flags; 	//!< OR'ed enum defining which vertex attribs it has
+				bool		short_indices;	//!< u16 element buffer instead of u32
 
-				vec3f		center;			//!< Mesh center of mass (from all vertices)
+				vec3f		boxMin, boxMax;	//!< Axis-aligned bounding box
+				vec3f		center;			//!< Bounding sphere center
 				float		radius;			//!< Bounding sphere radius
 
 				// Animations
@@ -275,6 +316,25 @@ namespace Render
 				//_Animation  animations[ANIM_N]; //!< All animations for this mesh. Some might not be
 				//!< available. Test animations[i].used.
 			};
+
+			/// CPU side of a SH visualization mesh, kept for UpdateSHVisualization
+			struct SHVisualization
+			{
+				SHVisualization() : mesh( -1 ), numPhi( 0 ), numTheta( 0 ), bandN( 0 ) {}
+
+				Handle				mesh;			//!< -1 when the slot is free
+				u32					numPhi, numTheta;
+				u32					bandN;			//!< Band count of basis
+
+				std::vector<vec3f>	dirs;			//!< Unit direction of each vertex. Never changes
+				std::vector<f32>	basis;			//!< SH basis of dirs, coefficient-major (see SHEvalBatch)
+				std::vector<u32>	indices;
+				std::vector<u32>	vertexFaces;	//!< Faces around vertex v : [faceOffsets[v], faceOffsets[v+1])
+				std::vector<u32>	faceOffsets;
+
+				std::vector<f32>	values;			//!< Function value of each vertex
+				std::vector<vec3f>	pos, nrm;		//!< Last evaluated vertices
+			};
 		}
 
 	}
@@ -2,104 +2,92 @@ namespace Render
 {
 	namespace Mesh
 	{
-		vec3f CalcTangent( const vec3f &e1, const vec3f &e2, const vec2f &du, const vec2f &dv )
+		static void CalcTangentSpace( vec3f *vtan, vec3f *vbit, u32 indices_n, u32 vertices_n, const vec3f *vp, const vec2f *vt,
+			const vec3f *vn, const u32 *idx )
 		{
-			f32 den = 1.f / ( du.x * dv.y - dv.x * du.y );
+			// Vertex count is fixed here : no welding nor splitting
+			MeshTools::TangentOptions opts;
+			opts.weld = false;
+			opts.splitMirrored = false;
 
-			vec3f tangent = Normalize( ( e1 * dv.y - e2 * du.y ) * den );
+			MeshTools::VertexStreams vs;
+			vs.FromArrays( vertices_n, vp, vn, vt );
 
-			return tangent;
+			std::vector<u32> indices( idx, idx + indices_n );
+			if ( MeshTools::GenerateTangents( vs, indices, opts ) )
+				vs.ToArrays( nullptr, nullptr, nullptr, vtan, vbit );
 		}
 
-		vec3f CalcBitangent( const vec3f &e1, const vec3f &e2, const vec2f &du, const vec2f &dv )
+
+		/// Attributes 0 to 5 : positions, normals, texcoords, tangents, binormals, colors
+		static const u32 VertexAttribCount = 6;
+
+		/// GL storage of one vertex attribute
+		struct AttribFormat
+		{
+			GLint		components;
+			GLenum		type;
+			GLboolean	normalized;
+			u32			size;		//!< Bytes per vertex
+			u32			offset;		//!< In the interleaved vertex
+		};
+
+		static AttribFormat GetAttribFormat( u32 attrib, const Layout &layout )
 		{
-			f32 den = 1.f / ( du.x * dv.y - dv.x * du.y );
+			static const GLint components[VertexAttribCount] = { 3, 3, 2, 3, 3, 4 };
+
+			AttribFormat fmt = { components[attrib], GL_FLOAT, GL_FALSE, components[attrib] * (u32) sizeof( f32 ), 0 };
 
-			vec3f bitangent = Normalize( ( e2 * du.x - e1 * dv.x ) * den );
+			if ( ( attrib == 1 || attrib == 3 || attrib == 4 ) && layout.packedNormals )
+				fmt = { 4, GL_INT_2_10_10_10_REV, GL_TRUE, 4, 0 };
+			else if ( attrib == 2 && layout.halfTexcoords )
+				fmt = { 2, GL_HALF_FLOAT, GL_FALSE, 4, 0 };
+			else if ( attrib == 5 && layout.packedColors )
+				fmt = { 4, GL_UNSIGNED_BYTE, GL_TRUE, 4, 0 };
 
-			return bitangent;
+			return fmt;
 		}
 
-		static void CalcTangentSpace( vec3f *vtan, vec3f *vbit, u32 indices_n, u32 vertices_n, const vec3f *vp, const vec2f *vt,
-			const vec3f *vn, const u32 *idx )
+		/// Converts count vertices of the f32 attribute src to fmt, written every stride bytes from dst
+		static void WriteAttribute( u32 attrib, const AttribFormat &fmt, const f32 *src, u32 count, u8 *dst, u32 stride )
 		{
-			const u32 triangle_n = indices_n / 3;
+			const u32 srcComponents = attrib == 2 ? 2 : ( attrib == 5 ? 4 : 3 );
 
-			for ( u32 i = 0; i < triangle_n; ++i )
+			for ( u32 i = 0; i < count; ++i, dst += stride )
 			{
-				for ( u32 j = 0; j < 1; ++j )
+				const f32 *v = src + i * srcComponents;
+
+				if ( fmt.type == GL_FLOAT )
 				{
-					const u32 i1 = idx[i * 3];
-					const u32 i2 = idx[i * 3 + 1];
-					const u32 i3 = idx[i * 3 + 2];
-
-					const vec3f &p1 = vp[i1];
-					const vec3f &p2 = vp[i2];
-					const vec3f &p3 = vp[i3];
-					const vec2f &uv1 = vt[i1];
-					const vec2f &uv2 = vt[i2];
-					const vec2f &uv3 = vt[i3];
-
-					const vec3f e1 = p2 - p1;
-					const vec3f e2 = p3 - p1;
-					const vec2f du = uv2 - uv1;
-					const vec2f dv = uv3 - uv1;
-
-					vec3f tangent = CalcTangent( e1, e2, du, dv );
-					vec3f bitangent = CalcBitangent( e1, e2, du, dv );
-
-					vtan[i1] = tangent;
-					vtan[i2] = tangent;
-					vtan[i3] = tangent;
-
-					vbit[i1] = bitangent;
-					vbit[i2] = bitangent;
-					vbit[i3] = bitangent;
+					std::memcpy( dst, v, fmt.size );
+				}
+				else if ( fmt.type == GL_INT_2_10_10_10_REV )
+				{
+					const u32 packed = MeshTools::PackSnorm1010102( vec3f( v[0], v[1], v[2] ) );
+					std::memcpy( dst, &packed, sizeof( packed ) );
+				}
+				else if ( fmt.type == GL_HALF_FLOAT )
+				{
+					const u16 packed[2] = { MeshTools::FloatToHalf( v[0] ), MeshTools::FloatToHalf( v[1] ) };
+					std::memcpy( dst, packed, sizeof( packed ) );
+				}
+				else
+				{
+					for ( u32 c = 0; c < 4; ++c )
+						dst[c] = (u8) ( std::min( std::max( v[c], 0.f ), 1.f ) * 255.f + 0.5f );
 				}
 			}
-			// #if 0
-			for ( u32 i = 0; i < vertices_n; ++i )
-			{
-				const vec3f &n = vn[i];
-				const vec3f &t = vtan[i];
-				const vec3f &b = vbit[i];
-
-				vec3f tangent = Normalize( ( t - n * Dot( n, t ) ) );
-
-				// handedness
-				vec3f nCrossT = Cross( n, tangent );
-				float handedness = Dot( nCrossT, b ) < 0.f ? -1.f : 1.f;
-				tangent *= -1.f;
-
-				vec3f binormal = Normalize( nCrossT * handedness );
-
-				vtan[i] = tangent;
-				vbit[i] = binormal;
-			}
-			// #endif
 		}
 
-
-		void ComputeBoundingSphere( f32 *vp, u32 vcount, vec3f *center, float *radius )
+		static void ComputeBounds( _internal::Data &mesh, const f32 *vp )
 		{
-			vec3f c( 0 );
-			vec3f *verts = (vec3f*) vp;
-
-			for ( u32 i = 0; i < vcount; ++i )
-			{
-				c += verts[i];
-			}
-			*center = c / (float) vcount;
-
-			*radius = 0.f;
-			for ( u32 i = 0; i < vcount; ++i )
-			{
-				const vec3f dV = verts[i] - *center;
-				const f32 len = Len( dV );
+			MeshTools::Bounds bounds;
+			MeshTools::ComputeBounds( vp, mesh.vertices_n, bounds );
 
-				if ( len > *radius )
-					*radius = len;
-			}
+			mesh.boxMin = bounds.boxMin;
+			mesh.boxMax = bounds.boxMax;
+			mesh.center = bounds.center;
+			mesh.radius = bounds.radius;
 		}
 
 		void Desc::SetAdditionalData(f32 *arr, u32 format, int elements, int instances)
@@ -178,121 +166,112 @@ namespace Render
 			mesh.vertices_n = desc.vertices_n;
 			mesh.indices_n = desc.indices_n;
 
+			const GLenum vertexUsage = desc.dynamic ? GL_DYNAMIC_DRAW : GL_STATIC_DRAW;
+
+			if ( ( vtan || vbit ) && !vn )
+			{
+				LogErr( "Found tangent or binormal array but no normal array." );
+				if ( deallocTangents )
+				{
+					delete[] vtan;
+					delete[] vbit;
+				}
+				return -1;
+			}
+
 			glGenVertexArrays( 1, &mesh.vao );
 			// Disallow 0-Vao. If given VAO with index 0, ask for another one
 			// this should never happen because VAO-0 is already constructed for the text
 			if ( !mesh.vao ) glGenVertexArrays( 1, &mesh.vao );
 			glBindVertexArray( mesh.vao );
 
-			if ( vp )
-			{
-				mesh.attrib_flags = MESH_POSITIONS;
-				glEnableVertexAttribArray( 0 );
-
-				// fill position buffer
-				glGenBuffers( 1, &mesh.vbo[0] );
-				glBindBuffer( GL_ARRAY_BUFFER, mesh.vbo[0] );
-				glBufferData( GL_ARRAY_BUFFER, mesh.vertices_n * sizeof( vec3f ),
-					vp, GL_STATIC_DRAW );
-
-				// add it to the vao
-				glVertexAttribPointer( 0, 3, GL_FLOAT, GL_FALSE, 0, (GLvoid*) NULL );
-			}
-
-			// Check for indices
-			if ( idx )
-			{
-				mesh.attrib_flags |= MESH_INDICES;
-				glGenBuffers( 1, &mesh.ibo );
-				glBindBuffer( GL_ELEMENT_ARRAY_BUFFER, mesh.ibo );
-				glBufferData( GL_ELEMENT_ARRAY_BUFFER, mesh.indices_n * sizeof( u32 ),
-					idx, GL_STATIC_DRAW );
-			}
-
-			// check for normals
-			if ( vn )
-			{
-				mesh.attrib_flags |= MESH_NORMALS;
-				glEnableVertexAttribArray( 1 );
-
-				// fill normal buffer
-				glGenBuffers( 1, &mesh.vbo[1] );
-				glBindBuffer( GL_ARRAY_BUFFER, mesh.vbo[1] );
-				glBufferData( GL_ARRAY_BUFFER, mesh.vertices_n * sizeof( vec3f ),
-					vn, GL_STATIC_DRAW );
+			// Vertex attributes 0 to 5, in the formats of desc.layout
+			const f32 *sources[VertexAttribCount] = { vp, vn, vt, vtan, vbit, vc };
+			const int flags[VertexAttribCount] = { MESH_POSITIONS, MESH_NORMALS, MESH_TEXCOORDS, MESH_TANGENT, MESH_BINORMAL, MESH_COLORS };
+			AttribFormat formats[VertexAttribCount];
 
-				// add it to vao
-				glVertexAttribPointer( 1, 3, GL_FLOAT, GL_FALSE, 0, (GLvoid*) NULL );
-			}
-
-			// check for texcoords
-			if ( vt )
+			mesh.attrib_flags = MESH_POSITIONS;
+			u32 stride = 0;
+			for ( u32 a = 0; a < VertexAttribCount; ++a )
 			{
-				mesh.attrib_flags |= MESH_TEXCOORDS;
-				glEnableVertexAttribArray( 2 );
-
-				// fill normal buffer
-				glGenBuffers( 1, &mesh.vbo[2] );
-				glBindBuffer( GL_ARRAY_BUFFER, mesh.vbo[2] );
-				glBufferData( GL_ARRAY_BUFFER, mesh.vertices_n * sizeof( vec2f ),
-					vt, GL_STATIC_DRAW );
+				if ( !sources[a] )
+					continue;
 
-				// add it to vao
-				glVertexAttribPointer( 2, 2, GL_FLOAT, GL_FALSE, 0, (GLvoid*) NULL );
+				formats[a] = GetAttribFormat( a, desc.layout );
+				formats[a].offset = stride;
+				stride += formats[a].size;
+				mesh.attrib_flags |= flags[a];
 			}
 
-			// check for tangents, should exist if normals exist
-			if ( vtan )
+			if ( vp && desc.layout.interleaved )
 			{
-				if ( !vn )
+				// single buffer, attributes side by side
+				std::vector<u8> data( (size_t) mesh.vertices_n * stride );
+				for ( u32 a = 0; a < VertexAttribCount; ++a )
 				{
-					LogErr( "Found tangent array but no normal array." );
-					return -1;
+					if ( sources[a] )
+						WriteAttribute( a, formats[a], sources[a], mesh.vertices_n, &data[formats[a].offset], stride );
 				}
 
-				mesh.attrib_flags |= MESH_TANGENT;
-				glEnableVertexAttribArray( 3 );
-				glGenBuffers( 1, &mesh.vbo[3] );
-				glBindBuffer( GL_ARRAY_BUFFER, mesh.vbo[3] );
-				glBufferData( GL_ARRAY_BUFFER, mesh.vertices_n * sizeof( vec3f ),
-					vtan, GL_STATIC_DRAW );
+				glGenBuffers( 1, &mesh.vbo[0] );
+				glBindBuffer( GL_ARRAY_BUFFER, mesh.vbo[0] );
+				glBufferData( GL_ARRAY_BUFFER, data.size(), &data[0], vertexUsage );
+
+				for ( u32 a = 0; a < VertexAttribCount; ++a )
+				{
+					if ( !sources[a] )
+						continue;
 
-				glVertexAttribPointer( 3, 3, GL_FLOAT, GL_FALSE, 0, (GLvoid*) NULL );
+					glEnableVertexAttribArray( a );
+					glVertexAttribPointer( a, formats[a].components, formats[a].type, formats[a].normalized, stride,
+						(GLvoid*) (size_t) formats[a].offset );
+				}
 			}
-
-			// check for tangents, should exist if normals exist
-			if ( vbit )
+			else
 			{
-				if ( !vn )
+				// one buffer per attribute. f32 ones are uploaded straight from desc
+				std::vector<u8> data;
+				for ( u32 a = 0; a < VertexAttribCount; ++a )
 				{
-					LogErr( "Found binormal array but no normal or tangent array." );
-					return -1;
-				}
+					if ( !sources[a] )
+						continue;
 
-				mesh.attrib_flags |= MESH_BINORMAL;
-				glEnableVertexAttribArray( 4 );
-				glGenBuffers( 1, &mesh.vbo[4] );
-				glBindBuffer( GL_ARRAY_BUFFER, mesh.vbo[4] );
-				glBufferData( GL_ARRAY_BUFFER, mesh.vertices_n * sizeof( vec3f ),
-					vbit, GL_STATIC_DRAW );
+					const AttribFormat &fmt = formats[a];
+					const void *src = sources[a];
+					if ( fmt.type != GL_FLOAT )
+					{
+						data.resize( (size_t) mesh.vertices_n * fmt.size );
+						WriteAttribute( a, fmt, sources[a], mesh.vertices_n, &data[0], fmt.size );
+						src = &data[0];
+					}
 
-				glVertexAttribPointer( 4, 3, GL_FLOAT, GL_FALSE, 0, (GLvoid*) NULL );
+					glEnableVertexAttribArray( a );
+					glGenBuffers( 1, &mesh.vbo[a] );
+					glBindBuffer( GL_ARRAY_BUFFER, mesh.vbo[a] );
+					glBufferData( GL_ARRAY_BUFFER, (size_t) mesh.vertices_n * fmt.size, src, a < 2 ? vertexUsage : GL_STATIC_DRAW );
+					glVertexAttribPointer( a, fmt.components, fmt.type, fmt.normalized, 0, (GLvoid*) NULL );
+				}
 			}
 
-			// check for colors
-			if ( vc )
+			// Check for indices, 16 bits when they fit
+			if ( idx )
 			{
-				mesh.attrib_flags |= MESH_COLORS;
-				glEnableVertexAttribArray( 5 );
-
-				// fill normal buffer
-				glGenBuffers( 1, &mesh.vbo[5] );
-				glBindBuffer( GL_ARRAY_BUFFER, mesh.vbo[5] );
-				glBufferData( GL_ARRAY_BUFFER, mesh.vertices_n * sizeof( vec4f ),
-					vc, GL_STATIC_DRAW );
+				mesh.attrib_flags |= MESH_INDICES;
+				glGenBuffers( 1, &mesh.ibo );
+				glBindBuffer( GL_ELEMENT_ARRAY_BUFFER, mesh.ibo );
 
-				// add it to vao
-				glVertexAttribPointer( 5, 4, GL_FLOAT, GL_FALSE, 0, (GLvoid*) NULL );
+				if ( desc.layout.shortIndices && mesh.vertices_n <= 65536 )
+				{
+					std::vector<u16> shortIdx( idx, idx + mesh.indices_n );
+					mesh.short_indices = true;
+					glBufferData( GL_ELEMENT_ARRAY_BUFFER, mesh.indices_n * sizeof( u16 ),
+						&shortIdx[0], GL_STATIC_DRAW );
+				}
+				else
+				{
+					glBufferData( GL_ELEMENT_ARRAY_BUFFER, mesh.indices_n * sizeof( u32 ),
+						idx, GL_STATIC_DRAW );
+				}
 			}
 
 			// check for additional data
@@ -320,8 +299,9 @@ namespace Render
 
 			glBindVertexArray( 0 );
 
-			// Compute BoundingSphere and store attributes
-			ComputeBoundingSphere( vp, mesh.vertices_n, &mesh.center, &mesh.radius );
+			// Compute bounds and store attributes
+			if ( vp )
+				ComputeBounds( mesh, vp );
 
 			int mesh_i = (int) renderer->meshes.size();
 			renderer->meshes.push_back( mesh );
@@ -345,6 +325,12 @@ namespace Render
 				mesh.indices_n = 0;
 				mesh.instances_n = 1;
 
+				for ( u32 i = 0; i < renderer->shvisualizations.size(); ++i )
+				{
+					if ( renderer->shvisualizations[i].mesh == h )
+						renderer->shvisualizations[i] = _internal::SHVisualization();
+				}
+
 				// Remove it as a loaded resource
 				for ( u32 i = 0; i < renderer->mesh_resources.size(); ++i )
 				{
@@ -375,7 +361,7 @@ namespace Render
 				const _internal::Data &md = renderer->meshes[h];
 
 				Bind( h );
-				glDrawElements( GL_TRIANGLES, md.indices_n, GL_UNSIGNED_INT, 0 );
+				glDrawElements( GL_TRIANGLES, md.indices_n, md.short_indices ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT, 0 );
 			}
 			//if (state && state.type > ANIM_NONE) {
 			//}
@@ -394,7 +380,7 @@ namespace Render
 			    const _internal::Data &md = renderer->meshes[h];
 
 			    Bind(h);
-			    glDrawElementsInstanced(GL_TRIANGLES, md.indices_n, GL_UNSIGNED_INT, 0, md.instances_n);
+			    glDrawElementsInstanced(GL_TRIANGLES, md.indices_n, md.short_indices ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT, 0, md.instances_n);
 			}
 		}
 
@@ -407,6 +393,26 @@ namespace Render
 		{
 			return FindResource( renderer->mesh_resources, resourceName, res, false );
 		}
+
+		bool GetAABB( Handle h, vec3f &boxMin, vec3f &boxMax )
+		{
+			if ( !Exists( h ) )
+				return false;
+
+			boxMin = renderer->meshes[h].boxMin;
+			boxMax = renderer->meshes[h].boxMax;
+			return true;
+		}
+
+		bool GetBoundingSphere( Handle h, vec3f &center, f32 &radius )
+		{
+			if ( !Exists( h ) )
+				return false;
+
+			center = renderer->meshes[h].center;
+			radius = renderer->meshes[h].radius;
+			return true;
+		}
 		/*
 			void SetAnimation(Handle h, AnimState &state, AnimType type) {
 				if (Exists(h)) {
@@ -663,18 +669,133 @@ namespace Render
 			return Build( desc );
 		}
 
+		static _internal::SHVisualization *FindSHVisualization( Handle h )
+		{
+			for ( u32 i = 0; i < renderer->shvisualizations.size(); ++i )
+			{
+				if ( h >= 0 && renderer->shvisualizations[i].mesh == h )
+					return &renderer->shvisualizations[i];
+			}
+			return nullptr;
+		}
+
+		/// Evaluates vis.pos & vis.nrm for the given coefficients. The basis is only re-evaluated when bandN changes.
+		static void EvalSHVisualization( _internal::SHVisualization &vis, const float *shCoeffs, const u32 bandN, bool shNormalization )
+		{
+			const u32 vertexCount = (u32) vis.dirs.size();
+			const u32 shCoeffsN = bandN * bandN;
+
+			if ( vis.bandN != bandN )
+			{
+				// SH z-up convention
+				std::vector<f32> dx( vertexCount ), dy( vertexCount ), dz( vertexCount );
+				for ( u32 i = 0; i < vertexCount; ++i )
+				{
+					dx[i] = vis.dirs[i].x;
+					dy[i] = vis.dirs[i].z;
+					dz[i] = vis.dirs[i].y;
+				}
+
+				vis.basis.resize( shCoeffsN * vertexCount );
+				SHEvalBatch( bandN, vertexCount, &dx[0], &dy[0], &dz[0], &vis.basis[0], vertexCount );
+				vis.bandN = bandN;
+			}
+
+			// Scale function coeffs
+			std::vector<float> scaledCoeffs( shCoeffsN );
+			const float normFactor = shNormalization ? 0.3334f / shCoeffs[0] : 1.f;
+			for ( u32 ci = 0; ci < shCoeffsN; ++ci )
+			{
+				scaledCoeffs[ci] = shCoeffs[ci] * normFactor;
+			}
+
+			vis.values.resize( vertexCount );
+			vis.pos.resize( vertexCount );
+			vis.nrm.resize( vertexCount );
+
+			const u32 blockSize = 256;
+			const u32 blockCount = ( vertexCount + blockSize - 1 ) / blockSize;
+
+			// Radius of each vertex : |f(dir)|, accumulated coefficient by coefficient over a block of vertices
+			Parallel::For( blockCount, [&]( u32 block, u32 )
+			{
+				const u32 begin = block * blockSize;
+				const u32 end = std::min( begin + blockSize, vertexCount );
+				f32 *values = &vis.values[0];
+
+				std::fill( values + begin, values + end, 0.f );
+				for ( u32 ci = 0; ci < shCoeffsN; ++ci )
+				{
+					const f32 coeff = scaledCoeffs[ci];
+					const f32 *basis = &vis.basis[ci * vertexCount];
+					for ( u32 i = begin; i < end; ++i )
+						values[i] += coeff * basis[i];
+				}
+
+				for ( u32 i = begin; i < end; ++i )
+					vis.pos[i] = vis.dirs[i] * std::fabs( values[i] );
+			} );
+
+			// Area-weighted face normals around each vertex. Falls back to the direction where the lobe vanishes
+			Parallel::For( blockCount, [&]( u32 block, u32 )
+			{
+				const u32 begin = block * blockSize;
+				const u32 end = std::min( begin + blockSize, vertexCount );
+
+				for ( u32 v = begin; v < end; ++v )
+				{
+					vec3f n( 0.f );
+					for ( u32 t = vis.faceOffsets[v]; t < vis.faceOffsets[v + 1]; ++t )
+					{
+						const u32 *tri = &vis.indices[vis.vertexFaces[t] * 3];
+						const vec3f &p0 = vis.pos[tri[0]];
+						n += Cross( vis.pos[tri[1]] - p0, vis.pos[tri[2]] - p0 );
+					}
+
+					const f32 len = Len( n );
+					vis.nrm[v] = len > 0.f ? n / len : vis.dirs[v];
+				}
+			} );
+		}
+
 		Handle BuildSHVisualization( const float *shCoeffs, const u32 bandN, const std::string &meshName, bool shNormalization, const u32 numPhi, const u32 numTheta )
 		{
+			if ( bandN < 3 || bandN > 21 )
+			{
+				LogErr( "SH visualization needs 3 to 21 bands, got ", bandN, "." );
+				return -1;
+			}
+
+			// Same mesh requested again : update it instead of creating a new resource
+			Handle h;
+			if ( Exists( meshName, h ) )
+			{
+				const _internal::SHVisualization *vis = FindSHVisualization( h );
+				if ( !vis )
+					return h;	// not a SH visualization, as Build would do
+
+				if ( vis->numPhi == numPhi && vis->numTheta == numTheta )
+				{
+					UpdateSHVisualization( h, shCoeffs, bandN, shNormalization );
+					return h;
+				}
+
+				Destroy( h );	// new resolution, new buffers
+			}
+
 			const u32 faceCount = numPhi * 2 + ( numTheta - 3 ) * numPhi * 2;
 			const u32 indexCount = faceCount * 3;
 			const u32 vertexCount = 2 + numPhi * ( numTheta - 2 );
-			const u32 shCoeffsN = bandN * bandN;
 
-			std::vector<u32> indices( indexCount );
-			std::vector<vec3f> pos( vertexCount );
-			std::vector<vec3f> nrm( vertexCount );
+			_internal::SHVisualization vis;
+			vis.numPhi = numPhi;
+			vis.numTheta = numTheta;
+
+			std::vector<u32> &indices = vis.indices;
+			indices.resize( indexCount );
+			vis.dirs.resize( vertexCount );
 
-			u32 fi, vi, rvi = 0, ci;
+			u32 fi, vi, rvi = 0;
 
 			// Triangles
 			{
@@ -715,53 +836,20 @@ namespace Render
 				}
 			}
 
-			// Scale function coeffs
-			std::vector<float> scaledCoeffs( shCoeffsN );
-			float normFactor = shNormalization ? 0.3334f / shCoeffs[0] : 1.f;
-			for ( ci = 0; ci < shCoeffsN; ++ci )
-			{
-				scaledCoeffs[ci] = shCoeffs[ci] * normFactor;
-			}
-
-			std::vector<float> shVals( shCoeffsN );
-
+			// Vertex directions
 			for ( vi = 0; vi < numTheta; ++vi )
 			{
 				float theta = vi * M_PI / ( (float) numTheta - 1.f );
-				float cT = std::cos( theta );
-				float sT = std::sin( theta );
 
 				if ( vi && ( vi < numTheta - 1 ) )
 				{ // spans
+					const float cT = std::cos( theta );
+					const float sT = std::sin( theta );
+
 					for ( fi = 0; fi < numPhi; ++fi )
 					{
 						float phi = fi * 2.f * M_PI / (float) numPhi;
-						float cP = std::cos( phi );
-						float sP = std::sin( phi );
-
-						vec3f vpos( sT * cP, sT * sP, cT );
-						vec3f vnrm = Normalize( vpos );
-
-						// Get sh coeffs for this direction
-						std::fill_n( shVals.begin(), shCoeffsN, 0.f );
-						SHEval( bandN, vpos.x, vpos.z, vpos.y, &shVals[0] );
-
-						float fVal = 0.f;
-						for ( ci = 0; ci < shCoeffsN; ++ci )
-						{
-							fVal += shVals[ci] * scaledCoeffs[ci];
-						}
-
-						if ( fVal < 0.f )
-						{
-							fVal *= -1.f;
-						}
-
-						vpos *= fVal;
-
-						pos[rvi] = vpos;
-						nrm[rvi] = vnrm;
-						++rvi;
+						vis.dirs[rvi++] = Normalize( vec3f( sT * std::cos( phi ), sT * std::sin( phi ), cT ) );
 					}
 				}
 				else
@@ -769,42 +857,80 @@ namespace Render
 					if ( vi ) theta -= 1e-4f;
 					else theta = 1e-4f;
 
-					cT = std::cos( theta );
-					sT = std::sin( theta );
-					float cP, sP;
-					cP = sP = 0.707106769f; // sqrt(0.5)
+					const float cT = std::cos( theta );
+					const float sT = std::sin( theta );
+					const float cP = 0.707106769f, sP = 0.707106769f; // sqrt(0.5)
 
-					vec3f vpos( sT * cP, sT * sP, cT );
-					vec3f vnrm = Normalize( vpos );
+					vis.dirs[rvi++] = Normalize( vec3f( sT * cP, sT * sP, cT ) );
+				}
+			}
 
-					// Get sh coeffs for this direction
-					std::fill_n( shVals.begin(), shCoeffsN, 0.f );
-					SHEval( bandN, vpos.x, vpos.z, vpos.y, &shVals[0] );
+			// Faces around each vertex, for the normals
+			vis.faceOffsets.assign( vertexCount + 1, 0 );
+			for ( u32 i = 0; i < indexCount; ++i )
+				++vis.faceOffsets[indices[i] + 1];
+			for ( u32 v = 0; v < vertexCount; ++v )
+				vis.faceOffsets[v + 1] += vis.faceOffsets[v];
 
-					float fVal = 0.f;
-					for ( ci = 0; ci < shCoeffsN; ++ci )
-					{
-						fVal += shVals[ci] * scaledCoeffs[ci];
-					}
+			vis.vertexFaces.resize( indexCount );
+			std::vector<u32> fill( vis.faceOffsets.begin(), vis.faceOffsets.end() - 1 );
+			for ( u32 i = 0; i < indexCount; ++i )
+				vis.vertexFaces[fill[indices[i]]++] = i / 3;
 
-					if ( fVal < 0.f )
-					{
-						fVal *= -1.f;
-					}
+			EvalSHVisualization( vis, shCoeffs, bandN, shNormalization );
 
-					vpos *= fVal;
+			Desc desc( meshName, false, indexCount, &indices[0], vertexCount, (f32*) ( &vis.pos[0] ), (f32*) ( &vis.nrm[0] ) );
+			desc.dynamic = true;
+			h = Build( desc );
+
+			if ( h >= 0 )
+			{
+				vis.mesh = h;
 
-					pos[rvi] = vpos;
-					nrm[rvi] = vnrm;
-					++rvi;
+				_internal::SHVisualization *slot = FindSHVisualization( h );
+				for ( u32 i = 0; !slot && i < renderer->shvisualizations.size(); ++i )
+				{
+					if ( renderer->shvisualizations[i].mesh < 0 )
+						slot = &renderer->shvisualizations[i];
 				}
-			}
 
-			Desc desc( meshName, false, indexCount, (u32*) ( &indices[0] ), vertexCount, (f32*) ( &pos[0] ), (f32*) ( &nrm[0] ) );
-			Handle h = Build( desc );
+				if ( slot )
+					*slot = std::move( vis );
+				else
+					renderer->shvisualizations.push_back( std::move( vis ) );
+			}
 
 			return h;
 		}
+
+		bool UpdateSHVisualization( Handle h, const float *shCoeffs, const u32 bandN, bool shNormalization )
+		{
+			_internal::SHVisualization *vis = FindSHVisualization( h );
+			if ( !vis || !Exists( h ) )
+			{
+				LogErr( "Mesh ", h, " is not a SH visualization." );
+				return false;
+			}
+
+			if ( bandN < 3 || bandN > 21 )
+			{
+				LogErr( "SH visualization needs 3 to 21 bands, got ", bandN, "." );
+				return false;
+			}
+
+			EvalSHVisualization( *vis, shCoeffs, bandN, shNormalization );
+
+			// Same size, same buffers : no reallocation
+			_internal::Data &mesh = renderer->meshes[h];
+			glBindBuffer( GL_ARRAY_BUFFER, mesh.vbo[0] );
+			glBufferSubData( GL_ARRAY_BUFFER, 0, mesh.vertices_n * sizeof( vec3f ), &vis->pos[0] );
+			glBindBuffer( GL_ARRAY_BUFFER, mesh.vbo[1] );
+			glBufferSubData( GL_ARRAY_BUFFER, 0, mesh.vertices_n * sizeof( vec3f ), &vis->nrm[0] );
+
+			ComputeBounds( mesh, (f32*) &vis->pos[0] );
+
+			return true;
+		}
 	}
 
 
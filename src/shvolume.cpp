@@ -0,0 +1,277 @@
+#include "shvolume.h"
+#include "common/SHEval.h"
+#include "common/parallel.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+
+#ifdef RADAR_WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#ifdef RADAR_UNIX
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+#endif
+
+namespace SHVolume
+{
+	static const u32 FileMagic = 0x4C564853;	// 'SHVL'
+	static const u32 FileVersion = 1;
+
+	/// On-disk header, followed by the coefficients in Volume::data order
+	struct FileHeader
+	{
+		u32 magic;
+		u32 version;
+		vec3i resolution;
+		int nBand;
+		vec3f boundsMin, boundsMax;
+	};
+	static_assert( sizeof( FileHeader ) == 48, "SHVolume file header must stay 48 bytes" );
+
+	static size_t PointCount( const vec3i &res )
+	{
+		return (size_t) res.x * res.y * res.z;
+	}
+
+	Volume::Volume() : resolution( 0 ), nBand( 0 ), data( nullptr ), mapBase( nullptr ), mapSize( 0 ), mapHandle( nullptr )
+	{
+	}
+
+	Volume::~Volume()
+	{
+		Release();
+	}
+
+	void Volume::Release()
+	{
+		if ( mapBase )
+		{
+#ifdef RADAR_WIN32
+			UnmapViewOfFile( mapBase );
+			CloseHandle( (HANDLE) mapHandle );
+#else
+			munmap( mapBase, mapSize );
+#endif
+		}
+
+		mapBase = nullptr;
+		mapHandle = nullptr;
+		mapSize = 0;
+		std::vector<f32>().swap( storage );
+		data = nullptr;
+		resolution = vec3i( 0 );
+		nBand = 0;
+	}
+
+	bool Volume::Save( const std::string &filePath ) const
+	{
+		Assert( data );
+
+		std::ofstream file( filePath, std::ios::out | std::ios::binary );
+		if ( !file )
+		{
+			LogErr( "Error opening file ", filePath, " for writing." );
+			return false;
+		}
+
+		const FileHeader header = { FileMagic, FileVersion, resolution, nBand, boundsMin, boundsMax };
+
+		file.write( (const char*) &header, sizeof( header ) );
+		file.write( (const char*) data, PointCount( resolution ) * CoeffCount() * sizeof( f32 ) );
+
+		return file.good();
+	}
+
+	bool Volume::Load( const std::string &filePath )
+	{
+		Release();
+
+#ifdef RADAR_WIN32
+		HANDLE file = CreateFileA( filePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr );
+		if ( file == INVALID_HANDLE_VALUE )
+		{
+			LogErr( "Error opening file ", filePath );
+			return false;
+		}
+
+		LARGE_INTEGER fileSize;
+		GetFileSizeEx( file, &fileSize );
+		mapSize = (size_t) fileSize.QuadPart;
+
+		HANDLE mapping = mapSize >= sizeof( FileHeader ) ? CreateFileMappingA( file, nullptr, PAGE_READONLY, 0, 0, nullptr ) : nullptr;
+		CloseHandle( file );
+
+		if ( mapping )
+		{
+			mapBase = MapViewOfFile( mapping, FILE_MAP_READ, 0, 0, 0 );
+			if ( mapBase )
+				mapHandle = mapping;
+			else
+				CloseHandle( mapping );
+		}
+#else
+		const int fd = open( filePath.c_str(), O_RDONLY );
+		if ( fd < 0 )
+		{
+			LogErr( "Error opening file ", filePath );
+			return false;
+		}
+
+		struct stat st;
+		if ( !fstat( fd, &st ) && (size_t) st.st_size >= sizeof( FileHeader ) )
+		{
+			mapSize = (size_t) st.st_size;
+			mapBase = mmap( nullptr, mapSize, PROT_READ, MAP_PRIVATE, fd, 0 );
+			if ( mapBase == MAP_FAILED )
+				mapBase = nullptr;
+		}
+		close( fd );
+#endif
+
+		if ( !mapBase )
+		{
+			LogErr( "Error mapping SH volume file ", filePath );
+			Release();
+			return false;
+		}
+
+		const FileHeader &header = *(const FileHeader*) mapBase;
+		const bool validShape = header.resolution.x >= 2 && header.resolution.y >= 2 && header.resolution.z >= 2 &&
+								header.nBand >= 3 && header.nBand <= 21;
+
+		if ( header.magic != FileMagic || header.version != FileVersion || !validShape ||
+			 mapSize != sizeof( FileHeader ) + PointCount( header.resolution ) * header.nBand * header.nBand * sizeof( f32 ) )
+		{
+			LogErr( "Invalid SH volume file ", filePath );
+			Release();
+			return false;
+		}
+
+		boundsMin = header.boundsMin;
+		boundsMax = header.boundsMax;
+		resolution = header.resolution;
+		nBand = header.nBand;
+		data = (const f32*) ( (const u8*) mapBase + sizeof( FileHeader ) );
+
+		return true;
+	}
+
+	void Volume::Lookup( const vec3f &P, f32 *sh ) const
+	{
+		Assert( data );
+
+		const u32 nCoeff = CoeffCount();
+
+		// grid coordinates of P, and of the lower corner of its cell
+		int i0[3];
+		f32 t[3];
+		for ( int a = 0; a < 3; ++a )
+		{
+			const f32 extent = boundsMax[a] - boundsMin[a];
+			const f32 g = extent > 0.f ? ( P[a] - boundsMin[a] ) / extent * ( resolution[a] - 1 ) : 0.f;
+			const f32 gc = std::min( std::max( g, 0.f ), (f32) ( resolution[a] - 1 ) );
+
+			i0[a] = std::min( (int) gc, resolution[a] - 2 );
+			t[a] = gc - i0[a];
+		}
+
+		const size_t strideY = (size_t) resolution.x * nCoeff;
+		const size_t strideZ = strideY * resolution.y;
+		const f32 *base = data + ( ( (size_t) i0[2] * resolution.y + i0[1] ) * resolution.x + i0[0] ) * nCoeff;
+
+		const f32 wx[2] = { 1.f - t[0], t[0] };
+		const f32 wy[2] = { 1.f - t[1], t[1] };
+		const f32 wz[2] = { 1.f - t[2], t[2] };
+
+		std::fill( sh, sh + nCoeff, 0.f );
+
+		for ( int z = 0; z < 2; ++z )
+		{
+			for ( int y = 0; y < 2; ++y )
+			{
+				const f32 wzy = wz[z] * wy[y];
+				const f32 *row = base + z * strideZ + y * strideY;
+				const f32 *c0 = row;
+				const f32 *c1 = row + nCoeff;
+				const f32 w0 = wzy * wx[0];
+				const f32 w1 = wzy * wx[1];
+
+				for ( u32 c = 0; c < nCoeff; ++c )
+					sh[c] += w0 * c0[c] + w1 * c1[c];
+			}
+		}
+	}
+
+	void Bake( const Rectangle &light, const Desc &desc, Volume &out )
+	{
+		Assert( desc.resolution.x >= 2 && desc.resolution.y >= 2 && desc.resolution.z >= 2 );
+		Assert( desc.nBand >= 3 && desc.nBand <= 21 );
+		Assert( desc.sampleCount > 0 );
+
+		out.Release();
+		out.boundsMin = desc.boundsMin;
+		out.boundsMax = desc.boundsMax;
+		out.resolution = desc.resolution;
+		out.nBand = desc.nBand;
+
+		const u32 nCoeff = out.CoeffCount();
+		const u32 pointCount = (u32) PointCount( desc.resolution );
+		const u32 sampleCount = desc.sampleCount;
+
+		out.storage.assign( (size_t) pointCount * nCoeff, 0.f );
+		out.data = &out.storage[0];
+
+		const vec3f extent = desc.boundsMax - desc.boundsMin;
+		const vec3f cellSize( extent.x / ( desc.resolution.x - 1 ), extent.y / ( desc.resolution.y - 1 ), extent.z / ( desc.resolution.z - 1 ) );
+
+		// per-thread scratch : samples, then swizzled SoA directions & weights
+		struct Scratch
+		{
+			std::vector<vec2f> samples;
+			std::vector<f32> x, y, z, w;
+		};
+		std::vector<Scratch> scratch( Parallel::ThreadCount() );
+
+		Parallel::For( pointCount, [&]( u32 pointIdx, u32 threadIdx )
+		{
+			const u32 px = pointIdx % desc.resolution.x;
+			const u32 py = ( pointIdx / desc.resolution.x ) % desc.resolution.y;
+			const u32 pz = pointIdx / ( desc.resolution.x * desc.resolution.y );
+			const vec3f P = desc.boundsMin + vec3f( cellSize.x * px, cellSize.y * py, cellSize.z * pz );
+
+			// one-sided emitter : nothing reaches points on, or behind, its plane
+			if ( Dot( P - light.position, light.ez ) < 1e-5f )
+				return;
+
+			SphericalRectangle srect;
+			srect.Init( light, P );
+
+			Scratch &s = scratch[threadIdx];
+			s.samples.resize( sampleCount );
+			s.x.resize( sampleCount );
+			s.y.resize( sampleCount );
+			s.z.resize( sampleCount );
+			s.w.assign( sampleCount, srect.S / (f32) sampleCount );
+
+			Random::Generate2D( desc.sequence, desc.seed, (u64) pointIdx * sampleCount, sampleCount, &s.samples[0] );
+
+			for ( u32 i = 0; i < sampleCount; ++i )
+			{
+				const vec3f dir = Normalize( srect.Sample( s.samples[i].x, s.samples[i].y ) - srect.o );
+
+				// SH z-up convention
+				s.x[i] = dir.x;
+				s.y[i] = dir.z;
+				s.z[i] = dir.y;
+			}
+
+			SHEvalAccumulateBatch( desc.nBand, sampleCount, &s.x[0], &s.y[0], &s.z[0], &s.w[0], &out.storage[(size_t) pointIdx * nCoeff] );
+		} );
+	}
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include "common/common.h"
+#include "geometry.h"
+
+/// Baked SH projection of the radiance coming from a static rectangular area light, on a regular 3D grid.
+/// Replaces the per-point Monte Carlo integration by a trilinear lookup of the baked coefficients.
+/// Coefficients are for a unit emitted radiance : scale them by the light's Ld.
+namespace SHVolume
+{
+	struct Desc
+	{
+		Desc() : boundsMin( -1.f ), boundsMax( 1.f ), resolution( 16 ), nBand( 5 ), sampleCount( 1024 ), seed( 0 ), sequence( Random::SEQ_SOBOL ) {}
+
+		vec3f boundsMin, boundsMax;	//!< World space box covered by the grid. Grid points lie on its faces and corners
+		vec3i resolution;			//!< Grid points along each axis, at least 2
+		int nBand;					//!< [3, 21]
+		u32 sampleCount;			//!< Samples per grid point
+		u64 seed;
+		Random::Sequence sequence;	//!< Each grid point uses its own range of indices, the result does not depend on the thread count
+	};
+
+	/// Grid of nBand * nBand coefficients per point, x-major : point (x, y, z) starts at
+	/// data[( ( z * resolution.y + y ) * resolution.x + x ) * nBand * nBand].
+	/// The coefficients either live in memory (Bake) or in a read-only mapping of a volume file (Load).
+	struct Volume
+	{
+		vec3f boundsMin, boundsMax;
+		vec3i resolution;
+		int nBand;
+		const f32 *data;
+
+		Volume();
+		~Volume();
+
+		/// Binary file : a 48 bytes header followed by the raw coefficients
+		bool Save( const std::string &filePath ) const;
+
+		/// Memory-maps the file, nothing is copied. The mapping lives until Release, the next Load or the destruction.
+		bool Load( const std::string &filePath );
+
+		void Release();
+
+		u32 CoeffCount() const { return nBand * nBand; }
+
+		/// Writes the trilinear interpolation of the 8 grid points around P in sh (CoeffCount() floats).
+		/// P is clamped to the grid bounds.
+		void Lookup( const vec3f &P, f32 *sh ) const;
+
+	private:
+		Volume( const Volume& );
+		Volume& operator=( const Volume& );
+
+		friend void Bake( const Rectangle&, const Desc&, Volume& );
+
+		std::vector<f32> storage;	// baked coefficients
+		void *mapBase;				// or file mapping
+		size_t mapSize;
+		void *mapHandle;
+	};
+
+	/// Bakes the light on the desc grid. Grid points are integrated in parallel (see Parallel::For), by uniformly
+	/// sampling the light's solid angle [Urena13]. The light only emits towards rect.ez : points behind it get zeroes.
+	void Bake( const Rectangle &light, const Desc &desc, Volume &out );
+}
@@ -0,0 +1,404 @@
+#include "zhlobes.h"
+#include "common/SHEval.h"
+#include "common/sampling.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <memory>
+#include <mutex>
+
+/// Offset of band l's matrix in the block arrays : sum of (2k+1)^2 for k < l
+static u32 BlockOffset( int l )
+{
+	return (u32) ( l * ( 2 * l - 1 ) * ( 2 * l + 1 ) / 3 );
+}
+
+/// All SH basis functions up to 21 bands, of a world space direction
+static void EvalBasis( const vec3f &dir, f64 *sh )
+{
+	f32 shf[21 * 21];
+	SHEval21( dir.x, dir.z, dir.y, shf );
+	std::copy( shf, shf + 21 * 21, sh );
+}
+
+/// Gauss-Jordan inversion with partial pivoting of the n x n row-major A, in place. False if singular.
+static bool Invert( int n, f64 *A )
+{
+	std::vector<f64> inv( n * n, 0.0 );
+	for ( int i = 0; i < n; ++i )
+		inv[i * n + i] = 1.0;
+
+	for ( int c = 0; c < n; ++c )
+	{
+		int pivot = c;
+		for ( int r = c + 1; r < n; ++r )
+			if ( std::abs( A[r * n + c] ) > std::abs( A[pivot * n + c] ) )
+				pivot = r;
+
+		if ( std::abs( A[pivot * n + c] ) < 1e-9 )
+			return false;
+
+		for ( int k = 0; k < n; ++k )
+		{
+			std::swap( A[c * n + k], A[pivot * n + k] );
+			std::swap( inv[c * n + k], inv[pivot * n + k] );
+		}
+
+		const f64 invPivot = 1.0 / A[c * n + c];
+		for ( int k = 0; k < n; ++k )
+		{
+			A[c * n + k] *= invPivot;
+			inv[c * n + k] *= invPivot;
+		}
+
+		for ( int r = 0; r < n; ++r )
+		{
+			if ( r == c )
+				continue;
+
+			const f64 f = A[r * n + c];
+			for ( int k = 0; k < n; ++k )
+			{
+				A[r * n + k] -= f * A[c * n + k];
+				inv[r * n + k] -= f * inv[c * n + k];
+			}
+		}
+	}
+
+	std::copy( inv.begin(), inv.end(), A );
+	return true;
+}
+
+void ZHLobes::OptimalDirections( int nBand, std::vector<vec3f> &dirs )
+{
+	Assert( nBand >= 1 && nBand <= 21 );
+
+	const u32 candidateCount = 1024;
+	std::vector<f32> cx( candidateCount ), cy( candidateCount ), cz( candidateCount );
+	Sampling::SampleSphereFibonacci( &cx[0], &cy[0], &cz[0], candidateCount );
+
+	std::vector<f64> candidateSH( candidateCount * 21 * 21 );
+	for ( u32 c = 0; c < candidateCount; ++c )
+		EvalBasis( vec3f( cx[c], cy[c], cz[c] ), &candidateSH[c * 21 * 21] );
+
+	dirs.clear();
+	std::vector<bool> used( candidateCount, false );
+	std::vector<u32> picked;
+	std::vector<f64> basis, residual;
+
+	// Greedy pivoted Gram-Schmidt : band l keeps the directions of the lower bands, and adds the two
+	// candidates whose band l basis vectors are the farthest from the span of the current ones
+	for ( int l = 0; l < nBand; ++l )
+	{
+		const int size = 2 * l + 1;
+		const u32 first = l * l;
+		basis.clear();
+
+		for ( int k = 0; k < size; ++k )
+		{
+			f64 bestNorm = -1.0;
+			u32 best = 0;
+			std::vector<f64> bestResidual;
+
+			const bool fixed = k < (int) picked.size();
+			for ( u32 c = fixed ? picked[k] : 0; c < candidateCount; ++c )
+			{
+				if ( !fixed && used[c] )
+					continue;
+
+				residual.assign( &candidateSH[c * 21 * 21 + first], &candidateSH[c * 21 * 21 + first] + size );
+				for ( size_t b = 0; b < basis.size(); b += size )
+				{
+					f64 d = 0.0;
+					for ( int m = 0; m < size; ++m )
+						d += residual[m] * basis[b + m];
+					for ( int m = 0; m < size; ++m )
+						residual[m] -= d * basis[b + m];
+				}
+
+				f64 norm = 0.0;
+				for ( int m = 0; m < size; ++m )
+					norm += residual[m] * residual[m];
+
+				if ( norm > bestNorm )
+				{
+					bestNorm = norm;
+					best = c;
+					bestResidual = residual;
+				}
+
+				if ( fixed )
+					break;
+			}
+
+			const f64 invNorm = 1.0 / std::sqrt( std::max( bestNorm, 1e-30 ) );
+			for ( int m = 0; m < size; ++m )
+				basis.push_back( bestResidual[m] * invNorm );
+
+			if ( !fixed )
+			{
+				used[best] = true;
+				picked.push_back( best );
+			}
+		}
+	}
+
+	for ( u32 c : picked )
+		dirs.push_back( vec3f( cx[c], cy[c], cz[c] ) );
+}
+
+bool ZHLobes::Init( int nBand )
+{
+	std::vector<vec3f> dirs;
+	OptimalDirections( nBand, dirs );
+	return Init( dirs, nBand );
+}
+
+bool ZHLobes::Init( const std::vector<vec3f> &dirs, int nBand )
+{
+	Assert( nBand >= 1 && nBand <= 21 );
+	Assert( dirs.size() >= (size_t) ( 2 * nBand - 1 ) );
+
+	this->nBand = nBand;
+	const u32 dirCount = 2 * nBand - 1;
+
+	directions.assign( dirs.begin(), dirs.begin() + dirCount );
+	dirX.resize( dirCount );
+	dirY.resize( dirCount );
+	dirZ.resize( dirCount );
+	for ( u32 i = 0; i < dirCount; ++i )
+	{
+		dirX[i] = directions[i].x;
+		dirY[i] = directions[i].y;
+		dirZ[i] = directions[i].z;
+	}
+
+	// Legendre polynomials by Bonnet's recursion
+	legendre.assign( nBand * nBand, 0.0 );
+	legendre[0] = 1.0;
+	if ( nBand > 1 )
+		legendre[nBand + 1] = 1.0;
+	for ( int l = 2; l < nBand; ++l )
+	{
+		const f64 *p1 = &legendre[( l - 1 ) * nBand];
+		const f64 *p2 = &legendre[( l - 2 ) * nBand];
+		f64 *p = &legendre[l * nBand];
+
+		for ( int n = 0; n <= l; ++n )
+			p[n] = ( ( n > 0 ? ( 2 * l - 1 ) * p1[n - 1] : 0.0 ) - ( l - 1 ) * p2[n] ) / l;
+	}
+
+	std::vector<f64> dirSH( dirCount * 21 * 21 );
+	for ( u32 i = 0; i < dirCount; ++i )
+		EvalBasis( directions[i], &dirSH[i * 21 * 21] );
+
+	projection.resize( BlockOffset( nBand ) );
+	lobes.resize( BlockOffset( nBand ) );
+
+	std::vector<f64> Y;
+	for ( int l = 0; l < nBand; ++l )
+	{
+		const int size = 2 * l + 1;
+		const f64 scale = ( 2 * l + 1 ) / ( 4.0 * M_PI );
+		f32 *P = &projection[BlockOffset( l )];
+		f32 *L = &lobes[BlockOffset( l )];
+
+		// Y_l[i][m] = Y_lm( d_i )
+		Y.resize( size * size );
+		for ( int i = 0; i < size; ++i )
+			for ( int m = 0; m < size; ++m )
+			{
+				Y[i * size + m] = dirSH[i * 21 * 21 + l * l + m];
+				L[m * size + i] = (f32) ( Y[i * size + m] / scale );
+			}
+
+		if ( !Invert( size, &Y[0] ) )
+		{
+			LogErr( "ZHLobes : the lobe directions of band ", l, " are linearly dependent." );
+			this->nBand = 0;
+			return false;
+		}
+
+		for ( int k = 0; k < size * size; ++k )
+			P[k] = (f32) ( Y[k] * scale );
+	}
+
+	return true;
+}
+
+void ZHLobes::Decompose( const f32 *sh, f32 *weights ) const
+{
+	for ( int l = 0; l < nBand; ++l )
+	{
+		const int size = 2 * l + 1;
+		const f32 *P = &projection[BlockOffset( l )];
+		const f32 *f = sh + l * l;
+
+		// z_l = projection_l^T f_l
+		for ( int i = 0; i < size; ++i )
+		{
+			f32 z = 0.f;
+			for ( int m = 0; m < size; ++m )
+				z += P[m * size + i] * f[m];
+			weights[l * l + i] = z;
+		}
+	}
+}
+
+void ZHLobes::Reconstruct( const f32 *weights, f32 *sh ) const
+{
+	for ( int l = 0; l < nBand; ++l )
+	{
+		const int size = 2 * l + 1;
+		const f32 *L = &lobes[BlockOffset( l )];
+		const f32 *z = weights + l * l;
+
+		for ( int m = 0; m < size; ++m, L += size )
+		{
+			f32 f = 0.f;
+			for ( int i = 0; i < size; ++i )
+				f += L[i] * z[i];
+			sh[l * l + m] = f;
+		}
+	}
+}
+
+f32 ZHLobes::Evaluate( const f32 *weights, const vec3f &dir ) const
+{
+	const u32 dirCount = 2 * nBand - 1;
+	f64 P[21];
+	f64 value = 0.0;
+
+	for ( u32 i = 0; i < dirCount; ++i )
+	{
+		// P_l( dot( d_i, dir ) ) by Bonnet's recursion
+		const f64 x = Dot( directions[i], dir );
+		P[0] = 1.0;
+		P[1] = x;
+		for ( int l = 2; l < nBand; ++l )
+			P[l] = ( ( 2 * l - 1 ) * x * P[l - 1] - ( l - 1 ) * P[l - 2] ) / l;
+
+		// direction i only carries the lobes of bands l >= i / 2
+		for ( int l = ( i + 1 ) / 2; l < nBand; ++l )
+			value += weights[l * l + i] * P[l];
+	}
+
+	return (f32) value;
+}
+
+void ZHLobes::ProjectMoments( const f32 *moments, f32 *sh ) const
+{
+	f64 q[2 * 21 - 1];
+
+	for ( int l = 0; l < nBand; ++l )
+	{
+		const int size = 2 * l + 1;
+		const f64 *p = &legendre[l * nBand];
+		const f32 *P = &projection[BlockOffset( l )];
+
+		// integral of P_l( dot( d_i, w ) ) : P_l only has monomials of the parity of l
+		for ( int i = 0; i < size; ++i )
+		{
+			const f32 *m = moments + i * nBand;
+			f64 s = 0.0;
+			for ( int n = l & 1; n <= l; n += 2 )
+				s += p[n] * m[n];
+			q[i] = s;
+		}
+
+		for ( int m = 0; m < size; ++m, P += size )
+		{
+			f64 f = 0.0;
+			for ( int i = 0; i < size; ++i )
+				f += P[i] * q[i];
+			sh[l * l + m] = (f32) f;
+		}
+	}
+}
+
+void ZHLobes::ProjectPolygon( const FixedPolygon &P, f32 *sh, MomentWorkspace &ws ) const
+{
+	const u32 dirCount = 2 * nBand - 1;
+
+	ws.Reserve( nBand - 1 );
+	ws.moments.resize( dirCount * nBand );
+	P.AxialMomentsBatch( &dirX[0], &dirY[0], &dirZ[0], dirCount, nBand - 1, &ws.moments[0], ws );
+
+	ProjectMoments( &ws.moments[0], sh );
+}
+
+void ZHLobes::ProjectPolygon( const Polygon &P, f32 *sh ) const
+{
+	// Polygon::AxialMoments gives the moments up to order nBand - 1 for 2 * nBand - 1 directions
+	const std::vector<f32> moments = P.AxialMoments( directions );
+	ProjectMoments( &moments[0], sh );
+}
+
+void ZHLobes::ProjectConvexPolygon( const vec3f *verts, u32 count, const vec3f &pos, f32 *sh, MomentWorkspace &ws ) const
+{
+	Assert( count >= 3 );
+
+	if ( count <= FixedPolygon::MaxEdges )
+	{
+		vec3f pts[FixedPolygon::MaxEdges];
+		for ( u32 i = 0; i < count; ++i )
+			pts[i] = Normalize( verts[i] - pos );
+
+		ProjectPolygon( FixedPolygon( pts, count ), sh, ws );
+	}
+	else
+	{
+		std::vector<vec3f> pts( count );
+		for ( u32 i = 0; i < count; ++i )
+			pts[i] = Normalize( verts[i] - pos );
+
+		ProjectPolygon( Polygon( pts ), sh );
+	}
+
+	// The projection is negative for polygons wound counter-clockwise as seen from pos, i.e. when pos is on
+	// the side of their (Newell) normal. Flip those from the geometry, not from the sign of sh[0].
+	vec3f nrm( 0.f );
+	for ( u32 i = 0; i < count; ++i )
+		nrm += Cross( verts[i], verts[( i + 1 ) % count] );
+
+	if ( Dot( nrm, pos - verts[0] ) > 0.f )
+		for ( int c = 0; c < nBand * nBand; ++c )
+			sh[c] = -sh[c];
+}
+
+void ZHLobes::ProjectRectangle( const Rectangle &rect, const vec3f &pos, f32 *sh, MomentWorkspace &ws ) const
+{
+	if ( Dot( pos - rect.position, rect.ez ) < 1e-5f )
+	{
+		std::fill( sh, sh + nBand * nBand, 0.f );
+		return;
+	}
+
+	ProjectConvexPolygon( &rect.p0, 4, pos, sh, ws );
+}
+
+const ZHLobes& ZHLobes::Get( int nBand )
+{
+	Assert( nBand >= 1 && nBand <= 21 );
+
+	// built sets are published through an atomic pointer, so that the per point integrators
+	// only pay an acquire load once the set exists : the mutex only serializes construction
+	static std::mutex mutex;
+	static std::unique_ptr<ZHLobes> sets[22];
+	static std::atomic<const ZHLobes*> published[22];
+
+	const ZHLobes *set = published[nBand].load( std::memory_order_acquire );
+	if ( set )
+		return *set;
+
+	std::lock_guard<std::mutex> lock( mutex );
+	if ( !sets[nBand] )
+	{
+		sets[nBand].reset( new ZHLobes() );
+		sets[nBand]->Init( nBand );
+		published[nBand].store( sets[nBand].get(), std::memory_order_release );
+	}
+
+	return *sets[nBand];
+}
@@ -0,0 +1,66 @@
+#pragma once
+
+#include "common/common.h"
+#include "geometry.h"
+
+/// Lobe-sharing zonal harmonics factorization of SH vectors [Belcour18].
+/// Band l of any SH function is a sum of 2l+1 rotated zonal lobes : f_l( w ) = sum_i z_li P_l( dot( d_i, w ) ),
+/// P_l being the Legendre polynomial of degree l. Band l uses the first 2l+1 directions d_i of a set of 2 * nBand - 1,
+/// so that all bands share the same axes.
+/// Since the SH projection of a polygon along a zonal lobe only depends on its axial moments around the lobe axis,
+/// projecting a polygon on nBand bands becomes 2 * nBand - 1 axial moment evaluations (FixedPolygon::AxialMomentsBatch)
+/// and one small matrix-vector product per band, with no sampling at all.
+/// Directions are in world space (y up), and swizzled to the SH z-up convention like the integrators' ones.
+struct ZHLobes
+{
+	ZHLobes() : nBand( 0 ) {}
+
+	/// Precomputes the per-band inverse projection matrices for the given directions (at least 2 * nBand - 1 unit
+	/// vectors). Returns false if some band's lobes are linearly dependent. nBand in [1, 21].
+	bool Init( const std::vector<vec3f> &dirs, int nBand );
+
+	/// Same with the directions of OptimalDirections
+	bool Init( int nBand );
+
+	/// 2 * nBand - 1 directions picked greedily among a spherical Fibonacci set, each new pair maximizing the
+	/// conditioning of its band's lobe matrix. Deterministic.
+	static void OptimalDirections( int nBand, std::vector<vec3f> &dirs );
+
+	/// sh (nBand * nBand coefficients) to lobe weights, band l's 2l+1 weights starting at weights[l * l]
+	void Decompose( const f32 *sh, f32 *weights ) const;
+
+	/// Lobe weights back to SH coefficients
+	void Reconstruct( const f32 *weights, f32 *sh ) const;
+
+	/// Value of the function in direction dir, straight from its lobe weights
+	f32 Evaluate( const f32 *weights, const vec3f &dir ) const;
+
+	/// SH projection of a function from its axial moments around the lobe directions : moments holds the
+	/// nBand moments (order 0 to nBand - 1) of each direction, as written by FixedPolygon::AxialMoments
+	void ProjectMoments( const f32 *moments, f32 *sh ) const;
+
+	/// SH projection ( integral of Y_lm over P ) of the spherical polygon P. Like the axial moments, the result
+	/// is signed by the winding of P.
+	void ProjectPolygon( const FixedPolygon &P, f32 *sh, MomentWorkspace &ws ) const;
+
+	/// Same for a Polygon of any edge count, through Polygon::AxialMoments
+	void ProjectPolygon( const Polygon &P, f32 *sh ) const;
+
+	/// Exact SH projection of the solid angle subtended from pos by the world space convex polygon verts, whatever
+	/// its winding. Runs ProjectPolygon on a FixedPolygon up to FixedPolygon::MaxEdges vertices, on a Polygon above.
+	void ProjectConvexPolygon( const vec3f *verts, u32 count, const vec3f &pos, f32 *sh, MomentWorkspace &ws ) const;
+
+	/// ProjectConvexPolygon of rect, same as the unnormalized shvals of the Rectangle integrators.
+	/// One-sided : zero when pos is behind the light.
+	void ProjectRectangle( const Rectangle &rect, const vec3f &pos, f32 *sh, MomentWorkspace &ws ) const;
+
+	/// Shared set with the OptimalDirections of nBand, built on first use. Thread-safe, and lock-free once built.
+	static const ZHLobes& Get( int nBand );
+
+	int nBand;
+	std::vector<vec3f> directions;
+	std::vector<f32> dirX, dirY, dirZ;	//!< SoA copy of directions, for AxialMomentsBatch
+	std::vector<f32> projection;		//!< Band l : ( 2l+1 ) / 4pi * Y_l^-1, Y_l[i][m] = Y_lm( d_i ). (2l+1)^2 row-major blocks
+	std::vector<f32> lobes;				//!< Band l : 4pi / ( 2l+1 ) * Y_l^T, lobe weights to SH
+	std::vector<f64> legendre;			//!< Monomial coefficients of P_l, row l (nBand wide)
+};
@@ -0,0 +1,103 @@
+// Offline CPU ground truth rendering of a GBuffer dump.
+// Build with 'make groundtruth', run bin/radar_groundtruth <dump> <lights> [-samples N] [-bands N] [-sh sampled|analytic|validate]
+//                                                         [-seed N] [-out file.hdr]
+//
+// <dump> is written by the app with Render::FBO::DumpGBuffer, <lights> with GroundTruth::SaveLights.
+// Writes the irradiance to -out (default : groundtruth.hdr). With -sh validate, the per pixel relative error of the
+// sampled SH projection is written as well, to <out>_sherror.hdr.
+
+#include "common/common.h"
+#include "common/parallel.h"
+#include "groundtruth.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+
+static void Usage( const char *exe )
+{
+	printf( "usage : %s <dump> <lights> [-samples N] [-bands N] [-sh sampled|analytic|validate] [-seed N] [-out file.hdr]\n", exe );
+}
+
+int main( int argc, char **argv )
+{
+	GroundTruth::Desc desc;
+	std::string outPath = "groundtruth.hdr";
+	std::vector<std::string> inputs;
+
+	for ( int i = 1; i < argc; ++i )
+	{
+		if ( !strcmp( argv[i], "-samples" ) && i + 1 < argc )
+			desc.sampleCount = std::max( 1, atoi( argv[++i] ) );
+		else if ( !strcmp( argv[i], "-bands" ) && i + 1 < argc )
+			desc.nBand = std::min( 21, std::max( 3, atoi( argv[++i] ) ) );
+		else if ( !strcmp( argv[i], "-sh" ) && i + 1 < argc )
+		{
+			const char *method = argv[++i];
+			desc.shMethod = !strcmp( method, "analytic" ) ? GroundTruth::SH_ANALYTIC :
+							!strcmp( method, "validate" ) ? GroundTruth::SH_VALIDATE : GroundTruth::SH_SAMPLED;
+		}
+		else if ( !strcmp( argv[i], "-seed" ) && i + 1 < argc )
+			desc.seed = strtoull( argv[++i], nullptr, 10 );
+		else if ( !strcmp( argv[i], "-out" ) && i + 1 < argc )
+			outPath = argv[++i];
+		else if ( argv[i][0] != '-' )
+			inputs.push_back( argv[i] );
+		else
+		{
+			Usage( argv[0] );
+			return 1;
+		}
+	}
+
+	if ( inputs.size() != 2 )
+	{
+		Usage( argv[0] );
+		return 1;
+	}
+
+	if ( desc.shMethod == GroundTruth::SH_VALIDATE && !desc.nBand )
+		desc.nBand = 5;
+
+	GroundTruth::GBufferDump gbuffer;
+	std::vector<GroundTruth::Light> lights;
+	if ( !gbuffer.Load( inputs[0] ) || !GroundTruth::LoadLights( inputs[1], lights ) )
+	{
+		printf( "Error loading %s or %s\n", inputs[0].c_str(), inputs[1].c_str() );
+		return 1;
+	}
+
+	Random::InitRandom();
+
+	printf( "Rendering %ux%u, %u lights, %u samples on %u threads...\n", gbuffer.width, gbuffer.height,
+			(u32) lights.size(), desc.sampleCount, Parallel::ThreadCount() );
+
+	const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+	GroundTruth::Image image;
+	GroundTruth::Render( gbuffer, lights, desc, image );
+
+	printf( "Done in %.1f s\n", std::chrono::duration<f64>( std::chrono::steady_clock::now() - start ).count() );
+
+	if ( !GroundTruth::WriteHDR( outPath, image.width, image.height, &image.irradiance[0] ) )
+		return 1;
+	printf( "Wrote %s\n", outPath.c_str() );
+
+	if ( !image.shError.empty() )
+	{
+		f64 sum = 0.0;
+		std::vector<vec3f> error( image.shError.size() );
+		for ( size_t i = 0; i < error.size(); ++i )
+		{
+			error[i] = vec3f( image.shError[i] );
+			sum += image.shError[i];
+		}
+
+		const std::string errorPath = outPath.substr( 0, outPath.find_last_of( '.' ) ) + "_sherror.hdr";
+		if ( !GroundTruth::WriteHDR( errorPath, image.width, image.height, &error[0] ) )
+			return 1;
+		printf( "Wrote %s, mean SH error %.3e\n", errorPath.c_str(), sum / error.size() );
+	}
+
+	return 0;
+}
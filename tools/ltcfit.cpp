@@ -0,0 +1,63 @@
+// Offline LTC table fitting.
+// Build with 'make ltcfit', run bin/radar_ltcfit [-size N] [-brdf ggx|burley] [-samples N] [-iterations N] [-out prefix]
+//
+// Writes <prefix>_mat.dds and <prefix>_amp.dds (default prefix : ltc_<brdf>_<size>, in the working directory),
+// in the format the ltc_mat & ltc_amp material textures are loaded from. The default never points at the shipped
+// data/ltc_*.dds tables : replacing them takes an explicit -out data/ltc.
+
+#include "common/common.h"
+#include "common/parallel.h"
+#include "ltcfit.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+
+int main( int argc, char **argv )
+{
+	LTCFit::Desc desc;
+	std::string prefix;
+
+	for ( int i = 1; i < argc; ++i )
+	{
+		if ( !strcmp( argv[i], "-size" ) && i + 1 < argc )
+			desc.lutSize = std::max( 2, atoi( argv[++i] ) );
+		else if ( !strcmp( argv[i], "-samples" ) && i + 1 < argc )
+			desc.sampleCount = std::max( 1, atoi( argv[++i] ) );
+		else if ( !strcmp( argv[i], "-iterations" ) && i + 1 < argc )
+			desc.maxIterations = std::max( 1, atoi( argv[++i] ) );
+		else if ( !strcmp( argv[i], "-brdf" ) && i + 1 < argc )
+			desc.brdf = !strcmp( argv[++i], "burley" ) ? LTCFit::BRDF_BURLEY : LTCFit::BRDF_GGX;
+		else if ( !strcmp( argv[i], "-out" ) && i + 1 < argc )
+			prefix = argv[++i];
+		else
+		{
+			printf( "usage : %s [-size N] [-brdf ggx|burley] [-samples N] [-iterations N] [-out prefix]\n"
+					"default prefix : ltc_<brdf>_<size>, use -out data/ltc to replace the shipped tables\n", argv[0] );
+			return 1;
+		}
+	}
+
+	if ( prefix.empty() )
+	{
+		char name[64];
+		snprintf( name, sizeof( name ), "ltc_%s_%u", desc.brdf == LTCFit::BRDF_GGX ? "ggx" : "burley", desc.lutSize );
+		prefix = name;
+	}
+
+	printf( "Fitting %ux%u %s LTC tables on %u threads...\n", desc.lutSize, desc.lutSize,
+			desc.brdf == LTCFit::BRDF_GGX ? "GGX" : "Burley", Parallel::ThreadCount() );
+
+	const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+	LTCFit::Table table;
+	LTCFit::Fit( desc, table );
+
+	printf( "Done in %.1f s\n", std::chrono::duration<f64>( std::chrono::steady_clock::now() - start ).count() );
+
+	if ( !LTCFit::WriteTables( table, prefix + "_mat.dds", prefix + "_amp.dds" ) )
+		return 1;
+
+	printf( "Wrote %s_mat.dds & %s_amp.dds\n", prefix.c_str(), prefix.c_str() );
+	return 0;
+}